@@ -129,6 +129,8 @@ void populateHALDeviceToVMPatterns(MLIRContext *context,
       context, importSymbols, typeConverter, "hal.device.queue.execute");
   patterns.insert<VMImportOpConversion<IREE::HAL::DeviceQueueFlushOp>>(
       context, importSymbols, typeConverter, "hal.device.queue.flush");
+  patterns.insert<VMImportOpConversion<IREE::HAL::DeviceQueueReadOp>>(
+      context, importSymbols, typeConverter, "hal.device.queue.read");
 }
 
 }  // namespace iree_compiler
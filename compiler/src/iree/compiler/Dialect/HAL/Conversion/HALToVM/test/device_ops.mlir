@@ -173,3 +173,36 @@ func.func @device_queue_flush(
       affinity(%affinity)
   return
 }
+
+// -----
+
+// CHECK-LABEL: @device_queue_read
+func.func @device_queue_read(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !vm.ref<!hal.device>, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !vm.ref<!hal.fence>, %[[SIGNAL_FENCE:.+]]: !vm.ref<!hal.fence>,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME: %[[SOURCE:.+]]: !vm.buffer, %[[TARGET:.+]]: !vm.ref<!hal.buffer>)
+    %source: !util.buffer, %target: !hal.buffer) {
+  // CHECK-DAG: %[[SOURCE_OFFSET:.+]] = vm.const.i64 100
+  %c100 = arith.constant 100 : index
+  // CHECK-DAG: %[[TARGET_OFFSET:.+]] = vm.const.i64 200
+  %c200 = arith.constant 200 : index
+  // CHECK-DAG: %[[LENGTH:.+]] = vm.const.i64 300
+  %c300 = arith.constant 300 : index
+  // CHECK-DAG: %[[FLAGS:.+]] = vm.const.i32.zero
+  // CHECK: vm.call @hal.device.queue.read(
+  // CHECK-SAME: %[[DEVICE]], %[[AFFINITY]],
+  // CHECK-SAME: %[[WAIT_FENCE]], %[[SIGNAL_FENCE]],
+  // CHECK-SAME: %[[SOURCE]], %[[SOURCE_OFFSET]],
+  // CHECK-SAME: %[[TARGET]], %[[TARGET_OFFSET]],
+  // CHECK-SAME: %[[LENGTH]], %[[FLAGS]])
+  hal.device.queue.read<%device : !hal.device>
+      affinity(%affinity)
+      wait(%wait_fence) signal(%signal_fence)
+      source(%source : !util.buffer)[%c100]
+      target(%target : !hal.buffer)[%c200]
+      length(%c300)
+      flags(0)
+  return
+}
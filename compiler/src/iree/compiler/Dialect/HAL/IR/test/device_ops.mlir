@@ -132,3 +132,33 @@ func.func @device_queue_flush(
       affinity(%affinity)
   return
 }
+
+// -----
+
+// CHECK-LABEL: @device_queue_read
+func.func @device_queue_read(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !hal.device, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !hal.fence, %[[SIGNAL_FENCE:.+]]: !hal.fence,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME: %[[SOURCE:.+]]: !util.buffer, %[[TARGET:.+]]: !hal.buffer)
+    %source: !util.buffer, %target: !hal.buffer) {
+  %c100 = arith.constant 100 : index
+  %c200 = arith.constant 200 : index
+  %c300 = arith.constant 300 : index
+  // CHECK: hal.device.queue.read<%[[DEVICE]] : !hal.device>
+  hal.device.queue.read<%device : !hal.device>
+      // CHECK-SAME: affinity(%[[AFFINITY]])
+      affinity(%affinity)
+      // CHECK-SAME: wait(%[[WAIT_FENCE]]) signal(%[[SIGNAL_FENCE]])
+      wait(%wait_fence) signal(%signal_fence)
+      // CHECK-SAME: source(%[[SOURCE]] : !util.buffer)[%c100]
+      source(%source : !util.buffer)[%c100]
+      // CHECK-SAME: target(%[[TARGET]] : !hal.buffer)[%c200]
+      target(%target : !hal.buffer)[%c200]
+      // CHECK-SAME: length(%c300)
+      length(%c300)
+      // CHECK-SAME: flags(0)
+      flags(0)
+  return
+}
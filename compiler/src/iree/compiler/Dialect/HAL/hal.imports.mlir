@@ -384,6 +384,22 @@ vm.import private @device.queue.flush(
   %queue_affinity : i64
 )
 
+// Reads a range of host memory into a device buffer.
+// The read will not begin until the wait fence has been reached and the signal
+// fence will be signaled once the data is resident in the target buffer.
+vm.import private @device.queue.read(
+  %device : !vm.ref<!hal.device>,
+  %queue_affinity : i64,
+  %wait_fence : !vm.ref<!hal.fence>,
+  %signal_fence : !vm.ref<!hal.fence>,
+  %source : !vm.buffer,
+  %source_offset : i64,
+  %target_buffer : !vm.ref<!hal.buffer>,
+  %target_offset : i64,
+  %length : i64,
+  %flags : i32
+)
+
 //===----------------------------------------------------------------------===//
 // iree_hal_executable_t
 //===----------------------------------------------------------------------===//
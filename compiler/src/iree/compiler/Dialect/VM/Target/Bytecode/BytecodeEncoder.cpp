@@ -11,6 +11,7 @@
 #include "iree/compiler/Dialect/VM/IR/VMDialect.h"
 #include "iree/compiler/Dialect/VM/IR/VMTypes.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/TypeSwitch.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/Diagnostics.h"
 
@@ -190,8 +191,16 @@ class V0BytecodeEncoder : public BytecodeEncoder {
     // 64-bit registers, which are split in 2, need to be remapped as each part.
     // This is something that could be improved in the bytecode format with
     // dedicated remapping commands or something.
+    //
+    // Primitive remappings are emitted before ref remappings so that the
+    // runtime can copy them without checking the register type of each one.
+    // The banks are disjoint so reordering across them does not change the
+    // result as long as the order within each bank is preserved.
     auto srcDstRegs = registerAllocation_->remapSuccessorRegisters(
         currentOp_, successorIndex);
+    std::stable_partition(
+        srcDstRegs.begin(), srcDstRegs.end(),
+        [](const auto &srcDstReg) { return srcDstReg.first.isValue(); });
     uint16_t registerParts = 0;
     for (auto srcDstReg : srcDstRegs) {
       registerParts +=
@@ -340,6 +349,54 @@ class V0BytecodeEncoder : public BytecodeEncoder {
   std::vector<std::pair<Block *, size_t>> blockOffsetFixups_;
 };
 
+// Returns the fused compare-and-branch opcode for |op| if it is a comparison
+// whose result is only used as the condition of the vm.cond_br immediately
+// following it. The pair can then be encoded as a single superinstruction.
+static std::optional<Opcode> getFusedCondBranchOpcode(Operation *op) {
+  auto condBranchOp = dyn_cast_or_null<CondBranchOp>(op->getNextNode());
+  if (!condBranchOp || op->getNumResults() != 1) return std::nullopt;
+  Value result = op->getResult(0);
+  if (condBranchOp.getCondition() != result || !result.hasOneUse()) {
+    return std::nullopt;
+  }
+  return llvm::TypeSwitch<Operation *, std::optional<Opcode>>(op)
+      .Case([](CmpEQI32Op) { return Opcode::CondBranchEQI32; })
+      .Case([](CmpNEI32Op) { return Opcode::CondBranchNEI32; })
+      .Case([](CmpLTI32SOp) { return Opcode::CondBranchLTI32S; })
+      .Case([](CmpLTI32UOp) { return Opcode::CondBranchLTI32U; })
+      .Case([](CmpEQI64Op) { return Opcode::CondBranchEQI64; })
+      .Case([](CmpNEI64Op) { return Opcode::CondBranchNEI64; })
+      .Case([](CmpLTI64SOp) { return Opcode::CondBranchLTI64S; })
+      .Case([](CmpLTI64UOp) { return Opcode::CondBranchLTI64U; })
+      .Default([](Operation *) { return std::nullopt; });
+}
+
+// Encodes |cmpOp| and the |condBranchOp| consuming its result as the fused
+// |opcode|. The comparison operands are encoded as uses by |cmpOp| so that
+// register lookups match those of the unfused ops and the branch targets and
+// operands are encoded exactly as vm.cond_br would.
+static LogicalResult encodeFusedCondBranch(Opcode opcode, Operation *cmpOp,
+                                           CondBranchOp condBranchOp,
+                                           VMFuncEncoder &e) {
+  if (failed(e.beginOp(cmpOp)) ||
+      failed(e.encodeOpcode(stringifyOpcode(opcode),
+                            static_cast<int>(opcode))) ||
+      failed(e.encodeOperand(cmpOp->getOperand(0), 0)) ||
+      failed(e.encodeOperand(cmpOp->getOperand(1), 1)) ||
+      failed(e.endOp(cmpOp))) {
+    return failure();
+  }
+  if (failed(e.beginOp(condBranchOp)) ||
+      failed(e.encodeBranch(condBranchOp.getTrueDest(),
+                            condBranchOp.getTrueOperands(), 0)) ||
+      failed(e.encodeBranch(condBranchOp.getFalseDest(),
+                            condBranchOp.getFalseOperands(), 1)) ||
+      failed(e.endOp(condBranchOp))) {
+    return failure();
+  }
+  return success();
+}
+
 }  // namespace
 
 // static
@@ -378,6 +435,26 @@ std::optional<EncodedBytecodeFunction> BytecodeEncoder::encodeFunction(
         op.emitOpError() << "is not serializable";
         return std::nullopt;
       }
+
+      // Comparisons feeding a vm.cond_br are fused into a single compare-and-
+      // branch instruction encoded when the branch is reached.
+      if (getFusedCondBranchOpcode(&op).has_value()) continue;
+      if (auto condBranchOp = dyn_cast<CondBranchOp>(op)) {
+        Operation *cmpOp = op.getPrevNode();
+        auto fusedOpcode =
+            cmpOp ? getFusedCondBranchOpcode(cmpOp) : std::nullopt;
+        if (fusedOpcode.has_value()) {
+          sourceMap.locations.push_back(
+              {static_cast<int32_t>(encoder.getOffset()), cmpOp->getLoc()});
+          if (failed(encodeFusedCondBranch(fusedOpcode.value(), cmpOp,
+                                           condBranchOp, encoder))) {
+            op.emitOpError() << "failed to encode fused comparison";
+            return std::nullopt;
+          }
+          continue;
+        }
+      }
+
       sourceMap.locations.push_back(
           {static_cast<int32_t>(encoder.getOffset()), op.getLoc()});
       if (failed(encoder.beginOp(&op)) ||
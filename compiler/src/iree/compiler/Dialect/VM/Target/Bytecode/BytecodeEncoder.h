@@ -39,7 +39,7 @@ class BytecodeEncoder : public VMFuncEncoder {
   // Matches IREE_VM_BYTECODE_VERSION_MAJOR.
   static constexpr uint32_t kVersionMajor = 15;
   // Matches IREE_VM_BYTECODE_VERSION_MINOR.
-  static constexpr uint32_t kVersionMinor = 0;
+  static constexpr uint32_t kVersionMinor = 1;
   static constexpr uint32_t kVersion = (kVersionMajor << 16) | kVersionMinor;
 
   // Encodes a vm.func to bytecode and returns the result.
@@ -550,6 +550,10 @@ static LogicalResult buildFlatBufferModule(
   return success();
 }
 
+// TODO: optionally emit a companion native library with ahead-of-time compiled
+// implementations of selected functions (iree_vm_bytecode_native_library_t in
+// runtime/src/iree/vm/bytecode/module.h). Until then native libraries have to
+// be written by hand against the module state layout and its fingerprint.
 LogicalResult translateModuleToBytecode(
     IREE::VM::ModuleOp moduleOp, IREE::VM::TargetOptions vmOptions,
     IREE::VM::BytecodeTargetOptions bytecodeOptions,
@@ -48,3 +48,28 @@ vm.module @simple_module {
   // CHECK-NEXT:   0
   // CHECK-NEXT: ]
 }
+
+// -----
+
+// Compares feeding a conditional branch are fused into a single op.
+
+// CHECK: "name": "fused_cmp_branch_module"
+vm.module @fused_cmp_branch_module {
+  vm.export @func
+  vm.func @func(%arg0 : i32, %arg1 : i32) -> i32 {
+    %0 = vm.cmp.lt.i32.s %arg0, %arg1 : i32
+    vm.cond_br %0, ^bb1, ^bb2
+  ^bb1:
+    vm.return %arg0 : i32
+  ^bb2:
+    vm.return %arg1 : i32
+  }
+
+  //      CHECK: "bytecode_data": [
+  // CHECK-NEXT:   121,
+  // CHECK-NEXT:   133,
+  // CHECK-NEXT:   0,
+  // CHECK-NEXT:   0,
+  // CHECK-NEXT:   1,
+  // CHECK-NEXT:   0,
+}
@@ -20,6 +20,15 @@
 #define IREE_SET_BINARY_MODE(handle) ((void)0)
 #endif  // IREE_PLATFORM_WINDOWS
 
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) || \
+    defined(IREE_PLATFORM_LINUX)
+#define IREE_FILE_MAPPING_POSIX 1
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // IREE_PLATFORM_*
+
 // We could take alignment as an arg, but roughly page aligned should be
 // acceptable for all uses - if someone cares about memory usage they won't
 // be using this method.
@@ -93,8 +102,7 @@ iree_status_t iree_file_contents_allocator_ctl(void* self,
     return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                             "only the file contents buffer is valid");
   }
-  iree_allocator_t allocator = contents->allocator;
-  iree_allocator_free(allocator, contents);
+  iree_file_contents_free(contents);
   return iree_ok_status();
 }
 
@@ -110,6 +118,7 @@ iree_allocator_t iree_file_contents_deallocator(
 void iree_file_contents_free(iree_file_contents_t* contents) {
   if (!contents) return;
   IREE_TRACE_ZONE_BEGIN(z0);
+  iree_file_unmap(&contents->mapping);
   iree_allocator_free(contents->allocator, contents);
   IREE_TRACE_ZONE_END(z0);
 }
@@ -276,6 +285,288 @@ iree_status_t iree_stdin_read_contents(iree_allocator_t allocator,
   return status;
 }
 
+//===----------------------------------------------------------------------===//
+// File mapping
+//===----------------------------------------------------------------------===//
+
+// Resolves the mapped range of a file with |file_length| total bytes and
+// returns the |offset| aligned down to |granularity| and the total length of
+// the aligned range.
+static iree_status_t iree_file_mapping_resolve_range(
+    uint64_t file_length, uint64_t offset, iree_host_size_t* inout_length,
+    iree_host_size_t granularity, uint64_t* out_aligned_offset,
+    iree_host_size_t* out_aligned_length) {
+  if (offset > file_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "mapping offset %" PRIu64
+                            " is past the end of the file (%" PRIu64 ")",
+                            offset, file_length);
+  }
+  uint64_t length = *inout_length;
+  if (*inout_length == IREE_HOST_SIZE_MAX) length = file_length - offset;
+  if (length > file_length - offset) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "mapping range [%" PRIu64 ", %" PRIu64
+                            ") exceeds the file length (%" PRIu64 ")",
+                            offset, offset + length, file_length);
+  }
+  const uint64_t aligned_offset = offset & ~((uint64_t)granularity - 1);
+  const uint64_t aligned_length = length + (offset - aligned_offset);
+  if (aligned_length > IREE_HOST_SIZE_MAX) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "mapping length exceeds host address range");
+  }
+  *inout_length = (iree_host_size_t)length;
+  *out_aligned_offset = aligned_offset;
+  *out_aligned_length = (iree_host_size_t)aligned_length;
+  return iree_ok_status();
+}
+
+#if defined(IREE_FILE_MAPPING_POSIX)
+
+iree_status_t iree_file_map_handle(iree_file_native_handle_t handle,
+                                   uint64_t offset, iree_host_size_t length,
+                                   iree_file_mapping_flags_t flags,
+                                   iree_file_mapping_t* out_mapping) {
+  IREE_ASSERT_ARGUMENT(out_mapping);
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  IREE_TRACE_ZONE_BEGIN(z0);
+  const int fd = (int)handle;
+
+  struct stat stat_buf;
+  if (fstat(fd, &stat_buf) == -1) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "unable to query file length");
+  }
+  uint64_t aligned_offset = 0;
+  iree_host_size_t aligned_length = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_file_mapping_resolve_range(
+              (uint64_t)stat_buf.st_size, offset, &length,
+              (iree_host_size_t)sysconf(_SC_PAGESIZE), &aligned_offset,
+              &aligned_length));
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)length);
+
+  // Zero-length mappings are not supported by mmap but are valid here.
+  void* base_address = NULL;
+  if (aligned_length > 0) {
+    const int prot = (flags & IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE)
+                         ? PROT_READ | PROT_WRITE
+                         : PROT_READ;
+    base_address = mmap(NULL, aligned_length, prot, MAP_PRIVATE, fd,
+                        (off_t)aligned_offset);
+    if (base_address == MAP_FAILED) {
+      IREE_TRACE_ZONE_END(z0);
+      return iree_make_status(iree_status_code_from_errno(errno),
+                              "failed to map %" PRIhsz " file bytes",
+                              aligned_length);
+    }
+  }
+
+  out_mapping->base_address = base_address;
+  out_mapping->base_length = aligned_length;
+  out_mapping->contents = iree_make_byte_span(
+      base_address ? (uint8_t*)base_address + (offset - aligned_offset) : NULL,
+      length);
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+iree_status_t iree_file_map_path(const char* path, uint64_t offset,
+                                 iree_host_size_t length,
+                                 iree_file_mapping_flags_t flags,
+                                 iree_file_mapping_t* out_mapping) {
+  IREE_ASSERT_ARGUMENT(path);
+  IREE_ASSERT_ARGUMENT(out_mapping);
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to open file '%s'", path);
+  }
+  iree_status_t status = iree_file_map_handle(
+      (iree_file_native_handle_t)fd, offset, length, flags, out_mapping);
+  if (!iree_status_is_ok(status)) {
+    status = iree_status_annotate_f(status, "mapping file '%s'", path);
+  }
+  close(fd);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_file_unmap(iree_file_mapping_t* mapping) {
+  if (!mapping || !mapping->base_address) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  munmap(mapping->base_address, mapping->base_length);
+  memset(mapping, 0, sizeof(*mapping));
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#elif defined(IREE_PLATFORM_WINDOWS)
+
+iree_status_t iree_file_map_handle(iree_file_native_handle_t handle,
+                                   uint64_t offset, iree_host_size_t length,
+                                   iree_file_mapping_flags_t flags,
+                                   iree_file_mapping_t* out_mapping) {
+  IREE_ASSERT_ARGUMENT(out_mapping);
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  IREE_TRACE_ZONE_BEGIN(z0);
+  HANDLE file_handle = (HANDLE)handle;
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file_handle, &file_size)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_win32_error(GetLastError()),
+                            "unable to query file length");
+  }
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  uint64_t aligned_offset = 0;
+  iree_host_size_t aligned_length = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_file_mapping_resolve_range(
+              (uint64_t)file_size.QuadPart, offset, &length,
+              (iree_host_size_t)system_info.dwAllocationGranularity,
+              &aligned_offset, &aligned_length));
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)length);
+
+  // Zero-length mappings are not supported but are valid here.
+  void* base_address = NULL;
+  if (aligned_length > 0) {
+    const bool copy_on_write = flags & IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE;
+    HANDLE mapping_handle = CreateFileMappingA(
+        file_handle, NULL, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0,
+        0, NULL);
+    if (!mapping_handle) {
+      IREE_TRACE_ZONE_END(z0);
+      return iree_make_status(
+          iree_status_code_from_win32_error(GetLastError()),
+          "failed to create file mapping");
+    }
+    // The view retains the mapping object so we can close our handle.
+    base_address = MapViewOfFile(
+        mapping_handle, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ,
+        (DWORD)(aligned_offset >> 32), (DWORD)aligned_offset, aligned_length);
+    DWORD error = GetLastError();
+    CloseHandle(mapping_handle);
+    if (!base_address) {
+      IREE_TRACE_ZONE_END(z0);
+      return iree_make_status(iree_status_code_from_win32_error(error),
+                              "failed to map %" PRIhsz " file bytes",
+                              aligned_length);
+    }
+  }
+
+  out_mapping->base_address = base_address;
+  out_mapping->base_length = aligned_length;
+  out_mapping->contents = iree_make_byte_span(
+      base_address ? (uint8_t*)base_address + (offset - aligned_offset) : NULL,
+      length);
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+iree_status_t iree_file_map_path(const char* path, uint64_t offset,
+                                 iree_host_size_t length,
+                                 iree_file_mapping_flags_t flags,
+                                 iree_file_mapping_t* out_mapping) {
+  IREE_ASSERT_ARGUMENT(path);
+  IREE_ASSERT_ARGUMENT(out_mapping);
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  HANDLE file_handle =
+      CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                  FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_win32_error(GetLastError()),
+                            "failed to open file '%s'", path);
+  }
+  iree_status_t status =
+      iree_file_map_handle((iree_file_native_handle_t)file_handle, offset,
+                           length, flags, out_mapping);
+  if (!iree_status_is_ok(status)) {
+    status = iree_status_annotate_f(status, "mapping file '%s'", path);
+  }
+  CloseHandle(file_handle);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_file_unmap(iree_file_mapping_t* mapping) {
+  if (!mapping || !mapping->base_address) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  UnmapViewOfFile(mapping->base_address);
+  memset(mapping, 0, sizeof(*mapping));
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#else
+
+iree_status_t iree_file_map_handle(iree_file_native_handle_t handle,
+                                   uint64_t offset, iree_host_size_t length,
+                                   iree_file_mapping_flags_t flags,
+                                   iree_file_mapping_t* out_mapping) {
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                          "file mapping not supported on this platform");
+}
+
+iree_status_t iree_file_map_path(const char* path, uint64_t offset,
+                                 iree_host_size_t length,
+                                 iree_file_mapping_flags_t flags,
+                                 iree_file_mapping_t* out_mapping) {
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                          "file mapping not supported on this platform");
+}
+
+void iree_file_unmap(iree_file_mapping_t* mapping) {}
+
+#endif  // IREE_FILE_MAPPING_POSIX
+
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents) {
+  IREE_ASSERT_ARGUMENT(path);
+  IREE_ASSERT_ARGUMENT(out_contents);
+  *out_contents = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_file_contents_t* contents = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, sizeof(*contents),
+                                (void**)&contents));
+  contents->allocator = allocator;
+
+  // Map copy-on-write so that the contents are mutable like those returned by
+  // iree_file_read_contents; untouched pages stay shared with the page cache.
+  iree_status_t status =
+      iree_file_map_path(path, 0, IREE_HOST_SIZE_MAX,
+                         IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE,
+                         &contents->mapping);
+  if (iree_status_is_ok(status)) {
+    contents->buffer = contents->mapping.contents;
+    *out_contents = contents;
+  } else {
+    iree_allocator_free(allocator, contents);
+    if (iree_status_is_unavailable(status)) {
+      iree_status_ignore(status);
+      status = iree_file_read_contents(path, allocator, out_contents);
+    }
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 #else
 
 iree_status_t iree_file_exists(const char* path) {
@@ -295,6 +586,12 @@ iree_status_t iree_file_read_contents(const char* path,
   return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
 }
 
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents) {
+  return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
+}
+
 iree_status_t iree_file_write_contents(const char* path,
                                        iree_const_byte_span_t content) {
   return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
@@ -305,4 +602,22 @@ iree_status_t iree_stdin_read_contents(iree_allocator_t allocator,
   return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
 }
 
+iree_status_t iree_file_map_handle(iree_file_native_handle_t handle,
+                                   uint64_t offset, iree_host_size_t length,
+                                   iree_file_mapping_flags_t flags,
+                                   iree_file_mapping_t* out_mapping) {
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
+}
+
+iree_status_t iree_file_map_path(const char* path, uint64_t offset,
+                                 iree_host_size_t length,
+                                 iree_file_mapping_flags_t flags,
+                                 iree_file_mapping_t* out_mapping) {
+  memset(out_mapping, 0, sizeof(*out_mapping));
+  return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
+}
+
+void iree_file_unmap(iree_file_mapping_t* mapping) {}
+
 #endif  // IREE_FILE_IO_ENABLE
@@ -29,6 +29,32 @@ iree_status_t iree_file_query_length(FILE* file, uint64_t* out_length);
 // Returns true if |file| position is at |position|.
 bool iree_file_is_at(FILE* file, uint64_t position);
 
+// Native platform file handle: a POSIX file descriptor or a Win32 HANDLE.
+typedef intptr_t iree_file_native_handle_t;
+
+// Flags controlling how files are mapped.
+enum iree_file_mapping_flag_bits_t {
+  // Maps the file read-only.
+  IREE_FILE_MAPPING_FLAG_NONE = 0u,
+  // Allows writes to the mapped contents. Writes are private to the process
+  // (copy-on-write) and are never written back to the file. Pages that are
+  // not written remain shared with the system page cache.
+  IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE = 1u << 0,
+};
+typedef uint32_t iree_file_mapping_flags_t;
+
+// A range of a file mapped into the host address space.
+// Mapped pages are backed by the system page cache and are shared with all
+// other processes mapping the same file. Pages are faulted in on first access.
+typedef struct iree_file_mapping_t {
+  // Base address of the mapping aligned to the system allocation granularity.
+  void* base_address;
+  // Total length of the mapping in bytes from |base_address|.
+  iree_host_size_t base_length;
+  // The requested file range within the mapping.
+  iree_byte_span_t contents;
+} iree_file_mapping_t;
+
 // Loaded file contents.
 typedef struct iree_file_contents_t {
   iree_allocator_t allocator;
@@ -36,6 +62,9 @@ typedef struct iree_file_contents_t {
     iree_byte_span_t buffer;
     iree_const_byte_span_t const_buffer;
   };
+  // File mapping backing |buffer| when loaded with iree_file_map_contents.
+  // Empty if the contents were read into memory.
+  iree_file_mapping_t mapping;
 } iree_file_contents_t;
 
 // Returns an allocator that deallocates the |contents|.
@@ -54,6 +83,22 @@ iree_status_t iree_file_read_contents(const char* path,
                                       iree_allocator_t allocator,
                                       iree_file_contents_t** out_contents);
 
+// Maps a file's contents into memory.
+// Pages of the file are faulted in on first access and remain shared with the
+// system page cache (and other processes mapping the same file) until written.
+// Writes to the contents are private to the process and never modify the file.
+// Unlike iree_file_read_contents the contents have no trailing NUL.
+//
+// If the platform does not support mapping files this falls back to
+// iree_file_read_contents.
+//
+// Returns the contents of the file in |out_contents|.
+// |allocator| is used to allocate the contents and the caller must use
+// iree_file_contents_free to release the memory and mapping.
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents);
+
 // Synchronously writes a byte buffer into a file.
 // Existing contents are overwritten.
 iree_status_t iree_file_write_contents(const char* path,
@@ -70,6 +115,32 @@ iree_status_t iree_file_write_contents(const char* path,
 iree_status_t iree_stdin_read_contents(iree_allocator_t allocator,
                                        iree_file_contents_t** out_contents);
 
+//===----------------------------------------------------------------------===//
+// File mapping
+//===----------------------------------------------------------------------===//
+
+// Maps |length| bytes starting at |offset| of the file referenced by |handle|
+// into the host address space. If |length| is IREE_HOST_SIZE_MAX the range
+// extends to the end of the file. The handle may be closed once the mapping
+// has been created. The mapping must be released with iree_file_unmap.
+//
+// Returns IREE_STATUS_UNAVAILABLE if the platform does not support mapping
+// files.
+iree_status_t iree_file_map_handle(iree_file_native_handle_t handle,
+                                   uint64_t offset, iree_host_size_t length,
+                                   iree_file_mapping_flags_t flags,
+                                   iree_file_mapping_t* out_mapping);
+
+// Maps |length| bytes starting at |offset| of the file at |path|.
+// See iree_file_map_handle for more information.
+iree_status_t iree_file_map_path(const char* path, uint64_t offset,
+                                 iree_host_size_t length,
+                                 iree_file_mapping_flags_t flags,
+                                 iree_file_mapping_t* out_mapping);
+
+// Unmaps a |mapping| created with iree_file_map_handle or iree_file_map_path.
+void iree_file_unmap(iree_file_mapping_t* mapping);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
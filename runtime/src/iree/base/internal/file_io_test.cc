@@ -94,6 +94,123 @@ TEST(FileIO, ReadWriteContents) {
   iree_file_contents_free(read_contents);
 }
 
+TEST(FileIO, MapPath) {
+  constexpr const char* kUniqueName = "MapPath";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  // Map the entire file.
+  iree_file_mapping_t mapping;
+  IREE_ASSERT_OK(iree_file_map_path(path.c_str(), 0, IREE_HOST_SIZE_MAX,
+                                    IREE_FILE_MAPPING_FLAG_NONE, &mapping));
+  EXPECT_EQ(write_contents.size(), mapping.contents.data_length);
+  EXPECT_EQ(memcmp(write_contents.data(), mapping.contents.data,
+                   mapping.contents.data_length),
+            0);
+  iree_file_unmap(&mapping);
+  EXPECT_EQ(mapping.base_address, nullptr);
+}
+
+TEST(FileIO, MapUnalignedRange) {
+  constexpr const char* kUniqueName = "MapUnalignedRange";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  // Offsets need not be page aligned.
+  iree_file_mapping_t mapping;
+  IREE_ASSERT_OK(iree_file_map_path(path.c_str(), 5, 4,
+                                    IREE_FILE_MAPPING_FLAG_NONE, &mapping));
+  EXPECT_EQ(std::string((const char*)mapping.contents.data,
+                        mapping.contents.data_length),
+            write_contents.substr(5, 4));
+  iree_file_unmap(&mapping);
+}
+
+TEST(FileIO, MapCopyOnWrite) {
+  constexpr const char* kUniqueName = "MapCopyOnWrite";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  // Writes to the mapping must not be visible in the file.
+  iree_file_mapping_t mapping;
+  IREE_ASSERT_OK(iree_file_map_path(path.c_str(), 0, IREE_HOST_SIZE_MAX,
+                                    IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE,
+                                    &mapping));
+  memset(mapping.contents.data, 'x', mapping.contents.data_length);
+  iree_file_unmap(&mapping);
+
+  iree_file_contents_t* read_contents = NULL;
+  IREE_ASSERT_OK(iree_file_read_contents(path.c_str(), iree_allocator_system(),
+                                         &read_contents));
+  EXPECT_EQ(memcmp(write_contents.data(), read_contents->const_buffer.data,
+                   read_contents->const_buffer.data_length),
+            0);
+  iree_file_contents_free(read_contents);
+}
+
+TEST(FileIO, MapContents) {
+  constexpr const char* kUniqueName = "MapContents";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  iree_file_contents_t* mapped_contents = NULL;
+  IREE_ASSERT_OK(iree_file_map_contents(path.c_str(), iree_allocator_system(),
+                                        &mapped_contents));
+  EXPECT_EQ(write_contents.size(), mapped_contents->const_buffer.data_length);
+  EXPECT_EQ(memcmp(write_contents.data(), mapped_contents->const_buffer.data,
+                   mapped_contents->const_buffer.data_length),
+            0);
+
+  // Contents are mutable without modifying the file.
+  mapped_contents->buffer.data[0] = 'x';
+
+  // Release through the deallocator as done when handing off ownership.
+  iree_allocator_t deallocator =
+      iree_file_contents_deallocator(mapped_contents);
+  iree_allocator_free(deallocator, mapped_contents->buffer.data);
+
+  iree_file_contents_t* read_contents = NULL;
+  IREE_ASSERT_OK(iree_file_read_contents(path.c_str(), iree_allocator_system(),
+                                         &read_contents));
+  EXPECT_EQ(read_contents->const_buffer.data[0], write_contents[0]);
+  iree_file_contents_free(read_contents);
+}
+
+TEST(FileIO, MapContentsNotFound) {
+  auto path = GetUniquePath("MapContentsNotFound");
+  iree_file_contents_t* mapped_contents = NULL;
+  EXPECT_THAT(Status(iree_file_map_contents(
+                  path.c_str(), iree_allocator_system(), &mapped_contents)),
+              StatusIs(StatusCode::kNotFound));
+  EXPECT_EQ(mapped_contents, nullptr);
+}
+
+TEST(FileIO, MapOutOfRange) {
+  constexpr const char* kUniqueName = "MapOutOfRange";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  iree_file_mapping_t mapping;
+  EXPECT_THAT(Status(iree_file_map_path(path.c_str(), 1, write_contents.size(),
+                                        IREE_FILE_MAPPING_FLAG_NONE, &mapping)),
+              StatusIs(StatusCode::kOutOfRange));
+}
+
 }  // namespace
 }  // namespace file_io
 }  // namespace iree
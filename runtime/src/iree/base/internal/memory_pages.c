@@ -0,0 +1,226 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/memory_pages.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) || \
+    defined(IREE_PLATFORM_LINUX)
+#define IREE_MEMORY_PAGES_POSIX 1
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // IREE_PLATFORM_*
+
+// Transparent huge page size used to align ranges that request huge pages.
+// This matches the PMD size on x86-64 and arm64 with 4KB base pages; other
+// configurations still get correctly aligned (if not huge) pages.
+#define IREE_MEMORY_PAGES_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+#if defined(IREE_MEMORY_PAGES_POSIX) || defined(IREE_PLATFORM_WINDOWS)
+
+// Touches each page in |pages| so that they are faulted in.
+// Pages are already zeroed by the system and writing zeros keeps them that way
+// while forcing a private copy instead of the shared zero page.
+static void iree_memory_pages_prefault(iree_memory_pages_t pages,
+                                       iree_host_size_t page_size) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)pages.length);
+  volatile uint8_t* base_ptr = (volatile uint8_t*)pages.base_address;
+  for (iree_host_size_t offset = 0; offset < pages.length;
+       offset += page_size) {
+    base_ptr[offset] = 0;
+  }
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#endif  // IREE_MEMORY_PAGES_POSIX || IREE_PLATFORM_WINDOWS
+
+#if defined(IREE_MEMORY_PAGES_POSIX)
+
+iree_host_size_t iree_memory_pages_page_size(void) {
+  return (iree_host_size_t)sysconf(_SC_PAGESIZE);
+}
+
+// Maps |length| bytes of anonymous read/write memory with additional |flags|.
+static void* iree_memory_pages_mmap(iree_host_size_t length, int flags) {
+#if !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS MAP_ANON
+#endif  // !MAP_ANONYMOUS
+  void* base_address = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  return base_address == MAP_FAILED ? NULL : base_address;
+}
+
+// Allocates a range aligned to the huge page size and asks the kernel to back
+// it with huge pages.
+static iree_status_t iree_memory_pages_allocate_huge(
+    iree_host_size_t minimum_length, iree_memory_pages_flags_t flags,
+    iree_memory_pages_t* out_pages) {
+  const iree_host_size_t huge_page_size = IREE_MEMORY_PAGES_HUGE_PAGE_SIZE;
+  const iree_host_size_t length =
+      iree_host_align(minimum_length, huge_page_size);
+
+#if defined(MAP_HUGETLB)
+  // Try explicitly reserved huge pages first. These usually need to be set up
+  // by the system administrator (vm.nr_hugepages) and fail otherwise.
+  int hugetlb_flags = MAP_HUGETLB;
+#if defined(MAP_POPULATE)
+  if (flags & IREE_MEMORY_PAGES_FLAG_PREFAULT) hugetlb_flags |= MAP_POPULATE;
+#endif  // MAP_POPULATE
+  void* base_address = iree_memory_pages_mmap(length, hugetlb_flags);
+  if (base_address) {
+    out_pages->base_address = base_address;
+    out_pages->length = length;
+    return iree_ok_status();
+  }
+#endif  // MAP_HUGETLB
+
+  // Over-reserve so that we can trim to a huge page aligned range that the
+  // kernel is able to back with transparent huge pages.
+  uint8_t* reserved_ptr =
+      (uint8_t*)iree_memory_pages_mmap(length + huge_page_size, 0);
+  if (!reserved_ptr) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to map %" PRIhsz " bytes of pages",
+                            length + huge_page_size);
+  }
+  uint8_t* aligned_ptr =
+      (uint8_t*)iree_host_align((uintptr_t)reserved_ptr, huge_page_size);
+  const iree_host_size_t head_length = aligned_ptr - reserved_ptr;
+  const iree_host_size_t tail_length = huge_page_size - head_length;
+  if (head_length) munmap(reserved_ptr, head_length);
+  if (tail_length) munmap(aligned_ptr + length, tail_length);
+#if defined(MADV_HUGEPAGE)
+  // Best-effort: THP may be disabled in which case we get normal pages.
+  madvise(aligned_ptr, length, MADV_HUGEPAGE);
+#endif  // MADV_HUGEPAGE
+
+  out_pages->base_address = aligned_ptr;
+  out_pages->length = length;
+  return iree_ok_status();
+}
+
+iree_status_t iree_memory_pages_allocate(iree_host_size_t minimum_length,
+                                         iree_memory_pages_flags_t flags,
+                                         iree_memory_pages_t* out_pages) {
+  IREE_ASSERT_ARGUMENT(out_pages);
+  memset(out_pages, 0, sizeof(*out_pages));
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)minimum_length);
+
+  const iree_host_size_t page_size = iree_memory_pages_page_size();
+  iree_status_t status = iree_ok_status();
+  if (flags & IREE_MEMORY_PAGES_FLAG_HUGE_PAGES) {
+    status = iree_memory_pages_allocate_huge(iree_max(1, minimum_length),
+                                             flags, out_pages);
+  } else {
+    const iree_host_size_t length =
+        iree_host_align(iree_max(1, minimum_length), page_size);
+    void* base_address = iree_memory_pages_mmap(length, 0);
+    if (base_address) {
+      out_pages->base_address = base_address;
+      out_pages->length = length;
+    } else {
+      status = iree_make_status(iree_status_code_from_errno(errno),
+                                "failed to map %" PRIhsz " bytes of pages",
+                                length);
+    }
+  }
+
+  // Explicit faulting works regardless of how the pages were mapped and is
+  // cheap if the kernel already populated them.
+  if (iree_status_is_ok(status) && (flags & IREE_MEMORY_PAGES_FLAG_PREFAULT)) {
+    iree_memory_pages_prefault(*out_pages, page_size);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_memory_pages_free(iree_memory_pages_t pages) {
+  if (!pages.base_address) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  munmap(pages.base_address, pages.length);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#elif defined(IREE_PLATFORM_WINDOWS)
+
+iree_host_size_t iree_memory_pages_page_size(void) {
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  return (iree_host_size_t)system_info.dwPageSize;
+}
+
+iree_status_t iree_memory_pages_allocate(iree_host_size_t minimum_length,
+                                         iree_memory_pages_flags_t flags,
+                                         iree_memory_pages_t* out_pages) {
+  IREE_ASSERT_ARGUMENT(out_pages);
+  memset(out_pages, 0, sizeof(*out_pages));
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)minimum_length);
+
+  // Large pages require SeLockMemoryPrivilege and are always committed and
+  // resident; if unavailable we fall back to normal pages.
+  const iree_host_size_t page_size = iree_memory_pages_page_size();
+  const iree_host_size_t large_page_size = GetLargePageMinimum();
+  void* base_address = NULL;
+  iree_host_size_t length = 0;
+  if ((flags & IREE_MEMORY_PAGES_FLAG_HUGE_PAGES) && large_page_size) {
+    length = iree_host_align(iree_max(1, minimum_length), large_page_size);
+    base_address =
+        VirtualAlloc(NULL, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                     PAGE_READWRITE);
+  }
+  if (!base_address) {
+    length = iree_host_align(iree_max(1, minimum_length), page_size);
+    base_address =
+        VirtualAlloc(NULL, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+  }
+
+  iree_status_t status = iree_ok_status();
+  if (base_address) {
+    out_pages->base_address = base_address;
+    out_pages->length = length;
+    if (flags & IREE_MEMORY_PAGES_FLAG_PREFAULT) {
+      iree_memory_pages_prefault(*out_pages, page_size);
+    }
+  } else {
+    status = iree_make_status(iree_status_code_from_win32_error(GetLastError()),
+                              "failed to allocate %" PRIhsz " bytes of pages",
+                              length);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_memory_pages_free(iree_memory_pages_t pages) {
+  if (!pages.base_address) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  VirtualFree(pages.base_address, 0, MEM_RELEASE);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#else
+
+iree_host_size_t iree_memory_pages_page_size(void) { return 4096; }
+
+iree_status_t iree_memory_pages_allocate(iree_host_size_t minimum_length,
+                                         iree_memory_pages_flags_t flags,
+                                         iree_memory_pages_t* out_pages) {
+  IREE_ASSERT_ARGUMENT(out_pages);
+  memset(out_pages, 0, sizeof(*out_pages));
+  return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                          "page allocation not supported on this platform");
+}
+
+void iree_memory_pages_free(iree_memory_pages_t pages) {}
+
+#endif  // IREE_PLATFORM_*
@@ -0,0 +1,62 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_BASE_INTERNAL_MEMORY_PAGES_H_
+#define IREE_BASE_INTERNAL_MEMORY_PAGES_H_
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Flags controlling how pages are allocated from the system.
+enum iree_memory_pages_flag_bits_t {
+  IREE_MEMORY_PAGES_FLAG_NONE = 0u,
+
+  // Backs the allocation with huge/large pages when the platform supports it.
+  // Explicitly reserved huge pages (MAP_HUGETLB/MEM_LARGE_PAGES) are tried
+  // first and if unavailable transparent huge pages are requested for the
+  // range (MADV_HUGEPAGE). This is best-effort and silently falls back to
+  // normal pages.
+  IREE_MEMORY_PAGES_FLAG_HUGE_PAGES = 1u << 0,
+
+  // Faults in all pages at allocation time so that first access does not
+  // incur page faults. Pages are always zero-initialized.
+  IREE_MEMORY_PAGES_FLAG_PREFAULT = 1u << 1,
+};
+typedef uint32_t iree_memory_pages_flags_t;
+
+// A range of pages allocated directly from the system.
+typedef struct iree_memory_pages_t {
+  // Base address of the allocation aligned to at least the system page size.
+  void* base_address;
+  // Total length of the allocation in bytes. May be larger than requested if
+  // rounded up to the page size used.
+  iree_host_size_t length;
+} iree_memory_pages_t;
+
+// Returns the normal page size of the system in bytes.
+iree_host_size_t iree_memory_pages_page_size(void);
+
+// Allocates at least |minimum_length| bytes of zero-initialized read/write
+// pages directly from the system as controlled by |flags|.
+// The pages must be freed with iree_memory_pages_free.
+//
+// Returns IREE_STATUS_UNAVAILABLE if the platform has no virtual memory
+// support; callers can fall back to iree_allocator_t allocations.
+iree_status_t iree_memory_pages_allocate(iree_host_size_t minimum_length,
+                                         iree_memory_pages_flags_t flags,
+                                         iree_memory_pages_t* out_pages);
+
+// Frees |pages| previously allocated with iree_memory_pages_allocate.
+void iree_memory_pages_free(iree_memory_pages_t pages);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_BASE_INTERNAL_MEMORY_PAGES_H_
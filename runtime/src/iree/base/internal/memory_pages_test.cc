@@ -0,0 +1,74 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/memory_pages.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "iree/base/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace {
+
+// Allocates pages with |flags| and verifies they are zeroed and writable.
+// Skips if the platform does not support page allocation.
+void TestAllocation(iree_host_size_t minimum_length,
+                    iree_memory_pages_flags_t flags) {
+  iree_memory_pages_t pages;
+  iree_status_t status =
+      iree_memory_pages_allocate(minimum_length, flags, &pages);
+  if (iree_status_is_unavailable(status)) {
+    iree_status_ignore(status);
+    GTEST_SKIP() << "page allocation not supported";
+  }
+  IREE_ASSERT_OK(status);
+  ASSERT_NE(pages.base_address, nullptr);
+  EXPECT_GE(pages.length, minimum_length);
+  EXPECT_TRUE(iree_host_size_has_alignment((uintptr_t)pages.base_address,
+                                           iree_memory_pages_page_size()));
+  EXPECT_EQ(pages.length % iree_memory_pages_page_size(), 0);
+
+  uint8_t* data = (uint8_t*)pages.base_address;
+  for (iree_host_size_t i = 0; i < pages.length; ++i) {
+    ASSERT_EQ(data[i], 0);
+  }
+  memset(data, 0xCD, minimum_length);
+  EXPECT_EQ(data[minimum_length - 1], 0xCD);
+
+  iree_memory_pages_free(pages);
+}
+
+TEST(MemoryPagesTest, PageSize) {
+  iree_host_size_t page_size = iree_memory_pages_page_size();
+  EXPECT_GT(page_size, 0);
+  EXPECT_TRUE(iree_host_size_is_power_of_two(page_size));
+}
+
+TEST(MemoryPagesTest, Allocate) { TestAllocation(12345, 0); }
+
+TEST(MemoryPagesTest, AllocatePrefault) {
+  TestAllocation(12345, IREE_MEMORY_PAGES_FLAG_PREFAULT);
+}
+
+TEST(MemoryPagesTest, AllocateHugePages) {
+  TestAllocation(3 * 1024 * 1024, IREE_MEMORY_PAGES_FLAG_HUGE_PAGES);
+}
+
+TEST(MemoryPagesTest, AllocateHugePagesPrefault) {
+  TestAllocation(3 * 1024 * 1024, IREE_MEMORY_PAGES_FLAG_HUGE_PAGES |
+                                      IREE_MEMORY_PAGES_FLAG_PREFAULT);
+}
+
+TEST(MemoryPagesTest, FreeEmpty) {
+  iree_memory_pages_t pages = {NULL, 0};
+  iree_memory_pages_free(pages);
+}
+
+}  // namespace
+}  // namespace iree
@@ -57,42 +57,6 @@
 #define IREE_DISABLE_THREAD_SAFETY_ANALYSIS \
   IREE_THREAD_ANNOTATION_ATTRIBUTE(no_thread_safety_analysis)
 
-//==============================================================================
-// Cross-platform processor yield (where supported)
-//==============================================================================
-
-#if defined(IREE_COMPILER_MSVC)
-
-// MSVC uses architecture-specific intrinsics.
-
-static inline void iree_processor_yield(void) {
-#if defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64)
-  // https://docs.microsoft.com/en-us/cpp/intrinsics/x86-intrinsics-list
-  _mm_pause();
-#elif defined(IREE_ARCH_ARM_64)
-  // https://docs.microsoft.com/en-us/cpp/intrinsics/arm64-intrinsics
-  __yield();
-#else
-  // None available; we'll spin hard.
-#endif  // IREE_ARCH_*
-}
-
-#else
-
-// Clang/GCC and compatibles use architecture-specific inline assembly.
-
-static inline void iree_processor_yield(void) {
-#if defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64)
-  asm volatile("pause");
-#elif defined(IREE_ARCH_ARM_32) || defined(IREE_ARCH_ARM_64)
-  asm volatile("yield");
-#else
-  // None available; we'll spin hard.
-#endif  // IREE_ARCH_*
-}
-
-#endif  // IREE_COMPILER_*
-
 //==============================================================================
 // Cross-platform futex mappings (where supported)
 //==============================================================================
@@ -63,6 +63,10 @@
 #include <pthread.h>
 #endif  // !IREE_PLATFORM_WINDOWS
 
+#if defined(IREE_COMPILER_MSVC)
+#include <intrin.h>
+#endif  // IREE_COMPILER_MSVC
+
 // We have the CRITICAL_SECTION path for now but Slim Reader/Writer lock (SRW)
 // is much better (and what std::mutex uses). SRW doesn't spin, though, and has
 // some other implications that don't quite line up with pthread_mutex_t on most
@@ -79,6 +83,46 @@ extern "C" {
 #define IREE_ALL_WAITERS INT32_MAX
 #define IREE_INFINITE_TIMEOUT_MS UINT32_MAX
 
+//==============================================================================
+// Cross-platform processor yield (where supported)
+//==============================================================================
+
+// Hints to the processor that the caller is spinning. On SMT cores this frees
+// execution resources for the sibling thread and reduces the power spent on
+// the spin.
+
+#if defined(IREE_COMPILER_MSVC)
+
+// MSVC uses architecture-specific intrinsics.
+
+static inline void iree_processor_yield(void) {
+#if defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64)
+  // https://docs.microsoft.com/en-us/cpp/intrinsics/x86-intrinsics-list
+  _mm_pause();
+#elif defined(IREE_ARCH_ARM_64)
+  // https://docs.microsoft.com/en-us/cpp/intrinsics/arm64-intrinsics
+  __yield();
+#else
+  // None available; we'll spin hard.
+#endif  // IREE_ARCH_*
+}
+
+#else
+
+// Clang/GCC and compatibles use architecture-specific inline assembly.
+
+static inline void iree_processor_yield(void) {
+#if defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64)
+  __asm__ __volatile__("pause");
+#elif defined(IREE_ARCH_ARM_32) || defined(IREE_ARCH_ARM_64)
+  __asm__ __volatile__("yield");
+#else
+  // None available; we'll spin hard.
+#endif  // IREE_ARCH_*
+}
+
+#endif  // IREE_COMPILER_*
+
 //==============================================================================
 // iree_mutex_t
 //==============================================================================
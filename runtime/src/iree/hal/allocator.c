@@ -67,6 +67,19 @@ IREE_API_EXPORT iree_status_t iree_hal_allocator_statistics_format(
       statistics->device_bytes_freed,
       (statistics->device_bytes_allocated - statistics->device_bytes_freed)));
 
+  const uint64_t cache_request_count =
+      statistics->cache_hit_count + statistics->cache_miss_count;
+  if (cache_request_count > 0) {
+    IREE_RETURN_IF_ERROR(iree_string_builder_append_format(
+        builder,
+        "       CACHE: %12" PRIu64 " hits / %12" PRIu64
+        " misses / %11.2f%% hit rate / %12" PRIdsz "B wasted\n",
+        statistics->cache_hit_count, statistics->cache_miss_count,
+        100.0 * (double)statistics->cache_hit_count /
+            (double)cache_request_count,
+        statistics->cache_bytes_wasted));
+  }
+
 #else
   // No-op when disabled.
 #endif  // IREE_STATISTICS_ENABLE
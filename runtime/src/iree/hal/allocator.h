@@ -294,8 +294,22 @@ typedef enum iree_hal_external_buffer_type_e {
   //  Uses VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT.
   IREE_HAL_EXTERNAL_BUFFER_TYPE_OPAQUE_WIN32,
 
+  // A range of a file referenced by a native file handle (POSIX file
+  // descriptor or Win32 HANDLE) that is mapped into memory by the importer.
+  // The imported buffer owns the mapping and the handle may be closed once
+  // the import completes. Mapped pages are shared with the system page cache
+  // and other processes mapping the same file and are faulted in on first
+  // access. Writes to imported buffers are private (copy-on-write) and never
+  // reach the file.
+  //
+  // CPU:
+  //  When using the default heap allocator the file is mapped with
+  //  mmap/MapViewOfFile. Offsets not aligned to the minimum buffer alignment
+  //  require IREE_HAL_MEMORY_ACCESS_UNALIGNED.
+  IREE_HAL_EXTERNAL_BUFFER_TYPE_MAPPED_FILE,
+
   // TODO(benvanik): additional memory types:
-  //  shared memory fd (shmem)/mapped file
+  //  shared memory fd (shmem)
   //  VkBuffer?
   //  VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT
   //  VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID
@@ -339,6 +353,14 @@ typedef struct iree_hal_external_buffer_t {
     struct {
       void* handle;
     } opaque_win32;
+    // IREE_HAL_EXTERNAL_BUFFER_TYPE_MAPPED_FILE
+    struct {
+      // Native file handle: a POSIX file descriptor or Win32 HANDLE.
+      intptr_t handle;
+      // Offset of the range in the file in bytes. The size of the range is
+      // the external buffer size.
+      uint64_t offset;
+    } mapped_file;
   } handle;
 } iree_hal_external_buffer_t;
 
@@ -355,6 +377,13 @@ typedef struct iree_hal_allocator_statistics_t {
   iree_device_size_t device_bytes_peak;
   iree_device_size_t device_bytes_allocated;
   iree_device_size_t device_bytes_freed;
+  // Allocation requests serviced by reusing a cached buffer. Only populated by
+  // allocators that cache allocations (such as iree_hal_caching_allocator_t).
+  uint64_t cache_hit_count;
+  // Allocation requests eligible for caching that had to allocate new storage.
+  uint64_t cache_miss_count;
+  // Total bytes beyond the requested size in cached buffers that were reused.
+  iree_device_size_t cache_bytes_wasted;
   // TODO(benvanik): mapping information (discarded, mapping ranges,
   //                 flushed/invalidated, etc).
 #else
@@ -530,6 +559,51 @@ IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
     iree_string_view_t identifier, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator);
 
+// Controls how heap allocators back large buffers.
+enum iree_hal_heap_allocator_flag_bits_t {
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE = 0u,
+
+  // Backs large buffers with huge pages (MAP_HUGETLB/MADV_HUGEPAGE/
+  // MEM_LARGE_PAGES) when available to reduce TLB misses. Falls back to normal
+  // pages if the system has none available.
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_HUGE_PAGES = 1u << 0,
+
+  // Faults in and zeroes large buffers at allocation time so that the first
+  // use does not incur page faults. Useful for long-lived constant pools and
+  // transient arenas allocated during load.
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT = 1u << 1,
+};
+typedef uint32_t iree_hal_heap_allocator_flags_t;
+
+// Default minimum size of a buffer for it to be allocated directly from system
+// pages when any page flags are specified.
+#define IREE_HAL_HEAP_ALLOCATOR_DEFAULT_PAGE_ALLOCATION_THRESHOLD \
+  (2 * 1024 * 1024)
+
+// Options controlling heap allocator behavior.
+typedef struct iree_hal_heap_allocator_options_t {
+  // Flags controlling how large buffers are allocated.
+  iree_hal_heap_allocator_flags_t flags;
+  // Buffers of at least this size are allocated directly from system pages
+  // instead of the data allocator if any page flags are set. Smaller buffers
+  // are not worth the page granularity waste.
+  iree_device_size_t page_allocation_threshold;
+} iree_hal_heap_allocator_options_t;
+
+// Initializes |out_options| to the default values matching
+// iree_hal_allocator_create_heap.
+IREE_API_EXPORT void iree_hal_heap_allocator_options_initialize(
+    iree_hal_heap_allocator_options_t* out_options);
+
+// Creates a host-local heap allocator as with iree_hal_allocator_create_heap
+// using the provided |options|. Buffers allocated from system pages bypass
+// |data_allocator|.
+IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap_with_options(
+    iree_string_view_t identifier,
+    const iree_hal_heap_allocator_options_t* options,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_allocator_t implementation details
 //===----------------------------------------------------------------------===//
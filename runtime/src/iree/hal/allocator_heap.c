@@ -5,8 +5,11 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <stddef.h>
+#include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/memory_pages.h"
 #include "iree/hal/allocator.h"
 #include "iree/hal/buffer.h"
 #include "iree/hal/buffer_heap_impl.h"
@@ -17,6 +20,7 @@ typedef struct iree_hal_heap_allocator_t {
   iree_allocator_t host_allocator;
   iree_allocator_t data_allocator;
   iree_string_view_t identifier;
+  iree_hal_heap_allocator_options_t options;
   IREE_STATISTICS(iree_hal_heap_allocator_statistics_t statistics;)
 } iree_hal_heap_allocator_t;
 
@@ -27,9 +31,30 @@ iree_hal_heap_allocator_t* iree_hal_heap_allocator_cast(
   return (iree_hal_heap_allocator_t*)base_value;
 }
 
+IREE_API_EXPORT void iree_hal_heap_allocator_options_initialize(
+    iree_hal_heap_allocator_options_t* out_options) {
+  IREE_ASSERT_ARGUMENT(out_options);
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->flags = IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE;
+  out_options->page_allocation_threshold =
+      IREE_HAL_HEAP_ALLOCATOR_DEFAULT_PAGE_ALLOCATION_THRESHOLD;
+}
+
 IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
     iree_string_view_t identifier, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator) {
+  iree_hal_heap_allocator_options_t options;
+  iree_hal_heap_allocator_options_initialize(&options);
+  return iree_hal_allocator_create_heap_with_options(
+      identifier, &options, data_allocator, host_allocator, out_allocator);
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap_with_options(
+    iree_string_view_t identifier,
+    const iree_hal_heap_allocator_options_t* options,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(options);
   IREE_ASSERT_ARGUMENT(out_allocator);
   *out_allocator = NULL;
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -44,6 +69,7 @@ IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
                                  &allocator->resource);
     allocator->host_allocator = host_allocator;
     allocator->data_allocator = data_allocator;
+    allocator->options = *options;
     iree_string_view_append_to_buffer(
         identifier, &allocator->identifier,
         (char*)allocator + iree_sizeof_struct(*allocator));
@@ -191,13 +217,25 @@ static iree_status_t iree_hal_heap_allocator_allocate_buffer(
         "allocator cannot allocate a buffer with the given parameters");
   }
 
+  // Large buffers may be allocated directly from system pages.
+  iree_memory_pages_flags_t page_flags = IREE_MEMORY_PAGES_FLAG_NONE;
+  if (allocation_size >= allocator->options.page_allocation_threshold) {
+    if (allocator->options.flags & IREE_HAL_HEAP_ALLOCATOR_FLAG_HUGE_PAGES) {
+      page_flags |= IREE_MEMORY_PAGES_FLAG_HUGE_PAGES;
+    }
+    if (allocator->options.flags & IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT) {
+      page_flags |= IREE_MEMORY_PAGES_FLAG_PREFAULT;
+    }
+  }
+
   // Allocate the buffer (both the wrapper and the contents).
   iree_hal_heap_allocator_statistics_t* statistics = NULL;
   IREE_STATISTICS(statistics = &allocator->statistics);
   iree_hal_buffer_t* buffer = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_heap_buffer_create(
       base_allocator, statistics, &compat_params, allocation_size, initial_data,
-      allocator->data_allocator, allocator->host_allocator, &buffer));
+      page_flags, allocator->data_allocator, allocator->host_allocator,
+      &buffer));
 
   *out_buffer = buffer;
   return iree_ok_status();
@@ -211,6 +249,77 @@ static void iree_hal_heap_allocator_deallocate_buffer(
   iree_hal_buffer_destroy(base_buffer);
 }
 
+// A file mapping owned by an imported heap buffer.
+typedef struct iree_hal_heap_mapped_file_t {
+  iree_allocator_t host_allocator;
+  iree_file_mapping_t mapping;
+  // User callback to notify after the mapping has been released.
+  iree_hal_buffer_release_callback_t release_callback;
+} iree_hal_heap_mapped_file_t;
+
+static void iree_hal_heap_mapped_file_release(void* user_data,
+                                              iree_hal_buffer_t* buffer) {
+  iree_hal_heap_mapped_file_t* mapped_file =
+      (iree_hal_heap_mapped_file_t*)user_data;
+  iree_file_unmap(&mapped_file->mapping);
+  if (mapped_file->release_callback.fn) {
+    mapped_file->release_callback.fn(mapped_file->release_callback.user_data,
+                                     buffer);
+  }
+  iree_allocator_free(mapped_file->host_allocator, mapped_file);
+}
+
+// Maps the file range referenced by |external_buffer| and wraps it in a heap
+// buffer that owns the mapping.
+static iree_status_t iree_hal_heap_allocator_import_mapped_file(
+    iree_hal_heap_allocator_t* allocator,
+    const iree_hal_buffer_params_t* params,
+    iree_hal_external_buffer_t* external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** out_buffer) {
+  if (external_buffer->size > IREE_HOST_SIZE_MAX) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "mapped file range exceeds host address range");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_heap_mapped_file_t* mapped_file = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator->host_allocator,
+                                sizeof(*mapped_file), (void**)&mapped_file));
+  mapped_file->host_allocator = allocator->host_allocator;
+  mapped_file->release_callback = release_callback;
+
+  // Writable imports get private copies of the pages they write.
+  const iree_file_mapping_flags_t mapping_flags =
+      iree_any_bit_set(params->access, IREE_HAL_MEMORY_ACCESS_WRITE)
+          ? IREE_FILE_MAPPING_FLAG_COPY_ON_WRITE
+          : IREE_FILE_MAPPING_FLAG_NONE;
+  iree_status_t status = iree_file_map_handle(
+      (iree_file_native_handle_t)external_buffer->handle.mapped_file.handle,
+      external_buffer->handle.mapped_file.offset,
+      (iree_host_size_t)external_buffer->size, mapping_flags,
+      &mapped_file->mapping);
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_heap_buffer_wrap(
+        (iree_hal_allocator_t*)allocator, params->type, params->access,
+        params->usage, external_buffer->size, mapped_file->mapping.contents,
+        (iree_hal_buffer_release_callback_t){
+            .fn = iree_hal_heap_mapped_file_release,
+            .user_data = mapped_file,
+        },
+        out_buffer);
+  }
+
+  if (!iree_status_is_ok(status)) {
+    iree_file_unmap(&mapped_file->mapping);
+    iree_allocator_free(allocator->host_allocator, mapped_file);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static iree_status_t iree_hal_heap_allocator_import_buffer(
     iree_hal_allocator_t* IREE_RESTRICT base_allocator,
     const iree_hal_buffer_params_t* IREE_RESTRICT params,
@@ -236,6 +345,10 @@ static iree_status_t iree_hal_heap_allocator_import_buffer(
     case IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION:
       ptr = (void*)external_buffer->handle.device_allocation.ptr;
       break;
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_MAPPED_FILE:
+      return iree_hal_heap_allocator_import_mapped_file(
+          iree_hal_heap_allocator_cast(base_allocator), &compat_params,
+          external_buffer, release_callback, out_buffer);
     default:
       return iree_make_status(IREE_STATUS_UNAVAILABLE,
                               "external buffer type not supported");
@@ -0,0 +1,395 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/memory_pages.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+#if defined(IREE_PLATFORM_LINUX)
+#include <sys/mman.h>
+#endif  // IREE_PLATFORM_LINUX
+
+// Mapped file imports are tested with POSIX file descriptors.
+#if IREE_FILE_IO_ENABLE &&                                          \
+    (defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) || \
+     defined(IREE_PLATFORM_LINUX))
+#define IREE_HAL_TEST_MAPPED_FILES 1
+#include <fcntl.h>
+#include <unistd.h>
+#endif  // IREE_FILE_IO_ENABLE && POSIX
+
+namespace iree {
+namespace hal {
+namespace {
+
+// Buffers at or above this size are allocated from pages in the tests.
+static const iree_device_size_t kPageThreshold = 64 * 1024;
+
+// Returns true if the platform supports allocating pages directly.
+static bool ArePagesAvailable() {
+  iree_memory_pages_t pages;
+  iree_status_t status = iree_memory_pages_allocate(
+      (iree_host_size_t)kPageThreshold, IREE_MEMORY_PAGES_FLAG_NONE, &pages);
+  if (iree_status_is_unavailable(status)) {
+    iree_status_ignore(status);
+    return false;
+  }
+  IREE_CHECK_OK(status);
+  iree_memory_pages_free(pages);
+  return true;
+}
+
+class HeapAllocatorTest : public ::testing::Test {
+ protected:
+  // Counts allocations made through an allocator forwarding to the system.
+  struct AllocationCounts {
+    iree_host_size_t total = 0;
+    iree_host_size_t live = 0;
+  };
+
+  static iree_status_t CountingCtl(void* self, iree_allocator_command_t command,
+                                   const void* params, void** inout_ptr) {
+    AllocationCounts* counts = (AllocationCounts*)self;
+    switch (command) {
+      case IREE_ALLOCATOR_COMMAND_MALLOC:
+      case IREE_ALLOCATOR_COMMAND_CALLOC:
+        ++counts->total;
+        ++counts->live;
+        break;
+      case IREE_ALLOCATOR_COMMAND_REALLOC:
+        if (!*inout_ptr) {
+          ++counts->total;
+          ++counts->live;
+        }
+        break;
+      case IREE_ALLOCATOR_COMMAND_FREE:
+        if (*inout_ptr) --counts->live;
+        break;
+      default:
+        break;
+    }
+    return iree_allocator_system_ctl(NULL, command, params, inout_ptr);
+  }
+
+  void TearDown() override {
+    iree_hal_allocator_release(allocator_);
+    EXPECT_EQ(data_counts_.live, 0);
+    EXPECT_EQ(host_counts_.live, 0);
+  }
+
+  // Creates |allocator_| with |flags| and the test page threshold. The data
+  // and host allocators are counted separately so that tests can tell where
+  // buffer storage came from.
+  void CreateAllocator(iree_hal_heap_allocator_flags_t flags) {
+    iree_hal_heap_allocator_options_t options;
+    iree_hal_heap_allocator_options_initialize(&options);
+    options.flags = flags;
+    options.page_allocation_threshold = kPageThreshold;
+    iree_allocator_t data_allocator = {&data_counts_, CountingCtl};
+    iree_allocator_t host_allocator = {&host_counts_, CountingCtl};
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap_with_options(
+        IREE_SV("test"), &options, data_allocator, host_allocator,
+        &allocator_));
+  }
+
+  iree_hal_buffer_t* AllocateBuffer(iree_device_size_t size,
+                                    iree_const_byte_span_t initial_data) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(allocator_, params, size,
+                                                     initial_data, &buffer));
+    return buffer;
+  }
+
+  // Returns the host pointer backing |buffer|.
+  static uint8_t* GetBufferData(iree_hal_buffer_t* buffer) {
+    iree_hal_buffer_mapping_t mapping;
+    IREE_CHECK_OK(iree_hal_buffer_map_range(
+        buffer, IREE_HAL_MAPPING_MODE_SCOPED, IREE_HAL_MEMORY_ACCESS_READ, 0,
+        IREE_WHOLE_BUFFER, &mapping));
+    uint8_t* data = mapping.contents.data;
+    IREE_CHECK_OK(iree_hal_buffer_unmap_range(&mapping));
+    return data;
+  }
+
+  static std::vector<uint8_t> ReadBuffer(iree_hal_buffer_t* buffer) {
+    std::vector<uint8_t> contents((size_t)iree_hal_buffer_byte_length(buffer));
+    IREE_CHECK_OK(
+        iree_hal_buffer_map_read(buffer, 0, contents.data(), contents.size()));
+    return contents;
+  }
+
+  AllocationCounts data_counts_;
+  AllocationCounts host_counts_;
+  iree_hal_allocator_t* allocator_ = NULL;
+};
+
+// Buffers under the threshold always use the data allocator.
+TEST_F(HeapAllocatorTest, SmallBuffersUseDataAllocator) {
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_HUGE_PAGES |
+                  IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT);
+  iree_hal_buffer_t* buffer =
+      AllocateBuffer(kPageThreshold - 1, iree_const_byte_span_empty());
+  EXPECT_EQ(data_counts_.total, 1);
+  EXPECT_EQ(data_counts_.live, 1);
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(data_counts_.live, 0);
+}
+
+// Without any page flags large buffers use the data allocator.
+TEST_F(HeapAllocatorTest, NoFlagsUseDataAllocator) {
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE);
+  iree_hal_buffer_t* buffer =
+      AllocateBuffer(kPageThreshold * 2, iree_const_byte_span_empty());
+  EXPECT_EQ(data_counts_.total, 1);
+  iree_hal_buffer_release(buffer);
+}
+
+// Buffers at or above the threshold come from system pages when available and
+// otherwise fall back to the data allocator.
+TEST_F(HeapAllocatorTest, LargeBuffersUsePages) {
+  const bool pages_available = ArePagesAvailable();
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT);
+  const iree_device_size_t sizes[] = {kPageThreshold, kPageThreshold * 3 + 5};
+  for (iree_device_size_t size : sizes) {
+    iree_hal_buffer_t* buffer =
+        AllocateBuffer(size, iree_const_byte_span_empty());
+    EXPECT_EQ(iree_hal_buffer_byte_length(buffer), size);
+    if (pages_available) {
+      // Only the metadata is allocated and it comes from the host allocator.
+      EXPECT_EQ(data_counts_.total, 0);
+      EXPECT_TRUE(iree_host_size_has_alignment(
+          (uintptr_t)GetBufferData(buffer), iree_memory_pages_page_size()));
+    } else {
+      EXPECT_EQ(data_counts_.live, 1);
+    }
+    std::vector<uint8_t> contents = ReadBuffer(buffer);
+    EXPECT_EQ(contents, std::vector<uint8_t>(contents.size(), 0));
+    iree_hal_buffer_release(buffer);
+    EXPECT_EQ(data_counts_.live, 0);
+  }
+}
+
+// Huge pages are best-effort and must not change where storage comes from.
+TEST_F(HeapAllocatorTest, LargeBuffersUseHugePages) {
+  const bool pages_available = ArePagesAvailable();
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_HUGE_PAGES);
+  iree_hal_buffer_t* buffer = AllocateBuffer(
+      IREE_HAL_HEAP_ALLOCATOR_DEFAULT_PAGE_ALLOCATION_THRESHOLD + 123,
+      iree_const_byte_span_empty());
+  EXPECT_EQ(data_counts_.total, pages_available ? 0 : 1);
+  iree_hal_buffer_release(buffer);
+}
+
+// Initial data is copied into page-backed buffers and the remainder is zeroed.
+TEST_F(HeapAllocatorTest, LargeBufferInitialData) {
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT);
+  std::vector<uint8_t> initial_data((size_t)kPageThreshold + 17);
+  for (size_t i = 0; i < initial_data.size(); ++i) {
+    initial_data[i] = (uint8_t)(i * 13 + 1);
+  }
+  iree_hal_buffer_t* buffer =
+      AllocateBuffer(initial_data.size() + 4096,
+                     iree_make_const_byte_span(initial_data.data(),
+                                               initial_data.size()));
+  std::vector<uint8_t> contents = ReadBuffer(buffer);
+  std::vector<uint8_t> expected = initial_data;
+  expected.resize(contents.size(), 0);
+  EXPECT_EQ(contents, expected);
+  iree_hal_buffer_release(buffer);
+}
+
+// Destroying a page-backed buffer returns its pages to the system.
+TEST_F(HeapAllocatorTest, LargeBufferFreesPages) {
+  if (!ArePagesAvailable()) {
+    GTEST_SKIP() << "page allocation not supported";
+  }
+  CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT);
+  const iree_host_size_t host_live = host_counts_.live;
+  iree_hal_buffer_t* buffer =
+      AllocateBuffer(kPageThreshold, iree_const_byte_span_empty());
+  EXPECT_EQ(host_counts_.live, host_live + 1);
+  uint8_t* data = GetBufferData(buffer);
+  iree_hal_allocator_statistics_t before;
+  iree_hal_allocator_query_statistics(allocator_, &before);
+
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(host_counts_.live, host_live);
+  EXPECT_EQ(data_counts_.total, 0);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t after;
+  iree_hal_allocator_query_statistics(allocator_, &after);
+  EXPECT_EQ(after.host_bytes_freed - before.host_bytes_freed, kPageThreshold);
+#endif  // IREE_STATISTICS_ENABLE
+#if defined(IREE_PLATFORM_LINUX)
+  // mincore fails with ENOMEM once the range is no longer mapped.
+  unsigned char residency[1];
+  EXPECT_EQ(mincore(data, (size_t)iree_memory_pages_page_size(), residency),
+            -1);
+#endif  // IREE_PLATFORM_LINUX
+  (void)data;
+}
+
+#if defined(IREE_HAL_TEST_MAPPED_FILES)
+
+class HeapAllocatorMappedFileTest : public HeapAllocatorTest {
+ protected:
+  void SetUp() override {
+    CreateAllocator(IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE);
+    // Three pages plus a partial page so that offset imports are not page
+    // sized.
+    contents_.resize(3 * 4096 + 123);
+    for (size_t i = 0; i < contents_.size(); ++i) {
+      contents_[i] = (uint8_t)(i * 7 + 3);
+    }
+    path_ = GetUniquePath();
+    IREE_ASSERT_OK(iree_file_write_contents(
+        path_.c_str(),
+        iree_make_const_byte_span(contents_.data(), contents_.size())));
+    fd_ = open(path_.c_str(), O_RDONLY);
+    ASSERT_NE(fd_, -1);
+  }
+
+  void TearDown() override {
+    if (fd_ != -1) close(fd_);
+    remove(path_.c_str());
+    HeapAllocatorTest::TearDown();
+  }
+
+  static std::string GetUniquePath() {
+    const char* test_tmpdir = getenv("TEST_TMPDIR");
+    if (!test_tmpdir) test_tmpdir = getenv("TMPDIR");
+    if (!test_tmpdir) test_tmpdir = "/tmp";
+    std::random_device d;
+    uint64_t random = ((uint64_t)d() << 32) | d();
+    char unique_path[256];
+    snprintf(unique_path, sizeof(unique_path),
+             "%s/iree_test_%" PRIx64 "_mapped_file", test_tmpdir, random);
+    return unique_path;
+  }
+
+  static void CountRelease(void* user_data, iree_hal_buffer_t* buffer) {
+    ++*(int*)user_data;
+  }
+
+  // Imports |length| bytes of the file at |offset| with |access|.
+  iree_hal_buffer_t* ImportFile(iree_hal_memory_access_t access,
+                                uint64_t offset, iree_device_size_t length) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.access = access;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+    iree_hal_external_buffer_t external_buffer;
+    memset(&external_buffer, 0, sizeof(external_buffer));
+    external_buffer.type = IREE_HAL_EXTERNAL_BUFFER_TYPE_MAPPED_FILE;
+    external_buffer.size = length;
+    external_buffer.handle.mapped_file.handle = (intptr_t)fd_;
+    external_buffer.handle.mapped_file.offset = offset;
+    iree_hal_buffer_release_callback_t release_callback = {CountRelease,
+                                                           &release_count_};
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_import_buffer(
+        allocator_, params, &external_buffer, release_callback, &buffer));
+    return buffer;
+  }
+
+  std::vector<uint8_t> ReadFile() {
+    iree_file_contents_t* file_contents = NULL;
+    IREE_CHECK_OK(iree_file_read_contents(
+        path_.c_str(), iree_allocator_system(), &file_contents));
+    iree_const_byte_span_t span = file_contents->const_buffer;
+    std::vector<uint8_t> result(span.data, span.data + span.data_length);
+    iree_file_contents_free(file_contents);
+    return result;
+  }
+
+  std::vector<uint8_t> contents_;
+  std::string path_;
+  int fd_ = -1;
+  int release_count_ = 0;
+};
+
+// Imported file ranges are readable and the release callback runs on destroy.
+TEST_F(HeapAllocatorMappedFileTest, Read) {
+  iree_hal_buffer_t* buffer =
+      ImportFile(IREE_HAL_MEMORY_ACCESS_READ, 0, contents_.size());
+  EXPECT_EQ(ReadBuffer(buffer), contents_);
+  EXPECT_EQ(release_count_, 0);
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(release_count_, 1);
+}
+
+// Ranges may start at any aligned offset within the file.
+TEST_F(HeapAllocatorMappedFileTest, ReadOffset) {
+  const uint64_t offset = 4096 + IREE_HAL_HEAP_BUFFER_ALIGNMENT;
+  iree_hal_buffer_t* buffer = ImportFile(IREE_HAL_MEMORY_ACCESS_READ, offset,
+                                         contents_.size() - offset - 5);
+  EXPECT_EQ(ReadBuffer(buffer),
+            std::vector<uint8_t>(contents_.begin() + offset,
+                                 contents_.end() - 5));
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(release_count_, 1);
+}
+
+// Writes to imported buffers are private and never reach the file.
+TEST_F(HeapAllocatorMappedFileTest, WriteIsCopyOnWrite) {
+  iree_hal_buffer_t* buffer =
+      ImportFile(IREE_HAL_MEMORY_ACCESS_ALL, 0, contents_.size());
+  std::vector<uint8_t> written(contents_.size());
+  for (size_t i = 0; i < written.size(); ++i) {
+    written[i] = (uint8_t)~contents_[i];
+  }
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_write(buffer, 0, written.data(), written.size()));
+  EXPECT_EQ(ReadBuffer(buffer), written);
+  EXPECT_EQ(ReadFile(), contents_);
+
+  // Other mappings of the file do not observe the writes either.
+  iree_hal_buffer_t* other_buffer =
+      ImportFile(IREE_HAL_MEMORY_ACCESS_READ, 0, contents_.size());
+  EXPECT_EQ(ReadBuffer(other_buffer), contents_);
+  iree_hal_buffer_release(other_buffer);
+
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(release_count_, 2);
+  EXPECT_EQ(ReadFile(), contents_);
+}
+
+// The handle may be closed as soon as the import completes.
+TEST_F(HeapAllocatorMappedFileTest, CloseHandleAfterImport) {
+  iree_hal_buffer_t* buffer =
+      ImportFile(IREE_HAL_MEMORY_ACCESS_READ, 0, contents_.size());
+  close(fd_);
+  fd_ = -1;
+  EXPECT_EQ(ReadBuffer(buffer), contents_);
+  EXPECT_EQ(release_count_, 0);
+  iree_hal_buffer_release(buffer);
+  EXPECT_EQ(release_count_, 1);
+}
+
+#endif  // IREE_HAL_TEST_MAPPED_FILES
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
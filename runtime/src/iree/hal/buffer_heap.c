@@ -28,6 +28,10 @@ typedef enum iree_hal_heap_buffer_storage_mode_e {
   // A user-provided buffer release callback is notified that the buffer is no
   // longer referencing the data.
   IREE_HAL_HEAP_BUFFER_STORAGE_MODE_EXTERNAL = 2u,
+  // Allocated as split [metadata] and [data] allocated from system pages.
+  // The base metadata pointer must be freed with iree_allocator_free.
+  // The data storage must be freed with iree_memory_pages_free.
+  IREE_HAL_HEAP_BUFFER_STORAGE_MODE_PAGES = 3u,
 } iree_hal_heap_buffer_storage_mode_t;
 
 typedef struct iree_hal_heap_buffer_t {
@@ -40,6 +44,8 @@ typedef struct iree_hal_heap_buffer_t {
     iree_allocator_t data_allocator;
     // Used for IREE_HAL_HEAP_BUFFER_STORAGE_MODE_EXTERNAL.
     iree_hal_buffer_release_callback_t release_callback;
+    // Used for IREE_HAL_HEAP_BUFFER_STORAGE_MODE_PAGES.
+    iree_memory_pages_t pages;
   };
 
   // Optional statistics shared with the allocator.
@@ -79,6 +85,38 @@ static iree_status_t iree_hal_heap_buffer_allocate_split(
   return status;
 }
 
+// Allocates a buffer with the metadata split from storage allocated directly
+// from system pages. Returns IREE_STATUS_UNAVAILABLE if pages cannot be
+// allocated on the platform.
+static iree_status_t iree_hal_heap_buffer_allocate_pages(
+    iree_device_size_t allocation_size, iree_memory_pages_flags_t page_flags,
+    iree_allocator_t host_allocator, iree_hal_heap_buffer_t** out_buffer,
+    iree_memory_pages_t* out_pages) {
+  if (allocation_size > IREE_HOST_SIZE_MAX) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "allocation size %" PRIdsz
+                            " exceeds the host address space",
+                            allocation_size);
+  }
+
+  // Try allocating the storage first as it's the most likely to fail if OOM.
+  // Pages are always aligned to at least the minimum buffer alignment.
+  IREE_RETURN_IF_ERROR(iree_memory_pages_allocate(
+      (iree_host_size_t)allocation_size, page_flags, out_pages));
+  IREE_ASSERT_TRUE(iree_host_size_has_alignment(
+      (iree_host_size_t)out_pages->base_address,
+      IREE_HAL_HEAP_BUFFER_ALIGNMENT));
+
+  // Allocate the host metadata wrapper with natural alignment.
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(**out_buffer), (void**)out_buffer);
+  if (!iree_status_is_ok(status)) {
+    // Need to free the storage we just allocated.
+    iree_memory_pages_free(*out_pages);
+  }
+  return status;
+}
+
 // Allocates a buffer with the metadata as a prefix to the storage.
 // This results in a single allocation per buffer but requires that both the
 // metadata and storage live together.
@@ -114,27 +152,49 @@ iree_status_t iree_hal_heap_buffer_create(
     iree_hal_allocator_t* allocator,
     iree_hal_heap_allocator_statistics_t* statistics,
     const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
-    iree_const_byte_span_t initial_data, iree_allocator_t data_allocator,
-    iree_allocator_t host_allocator, iree_hal_buffer_t** out_buffer) {
+    iree_const_byte_span_t initial_data, iree_memory_pages_flags_t page_flags,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_buffer_t** out_buffer) {
   IREE_ASSERT_ARGUMENT(allocator);
   IREE_ASSERT_ARGUMENT(params);
   IREE_ASSERT_ARGUMENT(out_buffer);
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  iree_hal_heap_buffer_t* buffer = NULL;
+  iree_byte_span_t data = iree_make_byte_span(NULL, 0);
+  iree_hal_heap_buffer_storage_mode_t storage_mode =
+      IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SLAB;
+  iree_status_t status = iree_status_from_code(IREE_STATUS_UNAVAILABLE);
+
+  // Try to allocate directly from system pages if requested. If the platform
+  // does not support it we fall back to the data allocator.
+  iree_memory_pages_t pages = {NULL, 0};
+  if (page_flags != IREE_MEMORY_PAGES_FLAG_NONE) {
+    status = iree_hal_heap_buffer_allocate_pages(
+        allocation_size, page_flags, host_allocator, &buffer, &pages);
+    if (iree_status_is_ok(status)) {
+      storage_mode = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_PAGES;
+      data = iree_make_byte_span(pages.base_address, allocation_size);
+    }
+  }
+
   // If the data and host allocators are the same we can allocate more
   // efficiently as a large slab. Otherwise we need to allocate both the
   // metadata and the storage independently.
-  const bool same_allocator =
-      memcmp(&data_allocator, &host_allocator, sizeof(data_allocator)) == 0;
-
-  iree_hal_heap_buffer_t* buffer = NULL;
-  iree_byte_span_t data = iree_make_byte_span(NULL, 0);
-  iree_status_t status =
-      same_allocator
-          ? iree_hal_heap_buffer_allocate_slab(allocation_size, host_allocator,
-                                               &buffer, &data)
-          : iree_hal_heap_buffer_allocate_split(allocation_size, data_allocator,
-                                                host_allocator, &buffer, &data);
+  if (iree_status_is_unavailable(status)) {
+    iree_status_ignore(status);
+    const bool same_allocator =
+        memcmp(&data_allocator, &host_allocator, sizeof(data_allocator)) == 0;
+    if (same_allocator) {
+      storage_mode = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SLAB;
+      status = iree_hal_heap_buffer_allocate_slab(
+          allocation_size, host_allocator, &buffer, &data);
+    } else {
+      storage_mode = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SPLIT;
+      status = iree_hal_heap_buffer_allocate_split(
+          allocation_size, data_allocator, host_allocator, &buffer, &data);
+    }
+  }
 
   if (iree_status_is_ok(status)) {
     iree_hal_buffer_initialize(host_allocator, allocator, &buffer->base,
@@ -143,12 +203,17 @@ iree_status_t iree_hal_heap_buffer_create(
                                &iree_hal_heap_buffer_vtable, &buffer->base);
     buffer->data = data;
 
-    if (same_allocator) {
-      buffer->base.flags = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SLAB;
-      buffer->data_allocator = iree_allocator_null();
-    } else {
-      buffer->base.flags = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SPLIT;
-      buffer->data_allocator = data_allocator;
+    buffer->base.flags = storage_mode;
+    switch (storage_mode) {
+      case IREE_HAL_HEAP_BUFFER_STORAGE_MODE_PAGES:
+        buffer->pages = pages;
+        break;
+      case IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SPLIT:
+        buffer->data_allocator = data_allocator;
+        break;
+      default:
+        buffer->data_allocator = iree_allocator_null();
+        break;
     }
 
     IREE_STATISTICS({
@@ -238,7 +303,12 @@ static void iree_hal_heap_buffer_destroy(iree_hal_buffer_t* base_buffer) {
       break;
     }
     case IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SPLIT: {
-      iree_allocator_free(buffer->data_allocator, buffer->data.data);
+      iree_allocator_free_aligned(buffer->data_allocator, buffer->data.data);
+      iree_allocator_free(host_allocator, buffer);
+      break;
+    }
+    case IREE_HAL_HEAP_BUFFER_STORAGE_MODE_PAGES: {
+      iree_memory_pages_free(buffer->pages);
       iree_allocator_free(host_allocator, buffer);
       break;
     }
@@ -8,6 +8,7 @@
 #define IREE_HAL_BUFFER_HEAP_IMPL_H_
 
 #include "iree/base/api.h"
+#include "iree/base/internal/memory_pages.h"
 #include "iree/base/internal/synchronization.h"
 #include "iree/hal/buffer.h"
 
@@ -29,13 +30,16 @@ typedef struct iree_hal_heap_allocator_statistics_t {
 // Allocates a new heap buffer from the specified |data_allocator|.
 // |host_allocator| is used for the iree_hal_buffer_t metadata. If both
 // |data_allocator| and |host_allocator| are the same the buffer will be created
-// as a flat slab. |out_buffer| must be released by the caller.
+// as a flat slab. If any |page_flags| are specified the storage is allocated
+// directly from system pages instead of |data_allocator| when supported.
+// |out_buffer| must be released by the caller.
 iree_status_t iree_hal_heap_buffer_create(
     iree_hal_allocator_t* allocator,
     iree_hal_heap_allocator_statistics_t* statistics,
     const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
-    iree_const_byte_span_t initial_data, iree_allocator_t data_allocator,
-    iree_allocator_t host_allocator, iree_hal_buffer_t** out_buffer);
+    iree_const_byte_span_t initial_data, iree_memory_pages_flags_t page_flags,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_buffer_t** out_buffer);
 
 #ifdef __cplusplus
 }  // extern "C"
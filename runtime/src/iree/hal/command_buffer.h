@@ -68,6 +68,13 @@ enum iree_hal_command_buffer_mode_bits_t {
   // `IREE_HAL_COMMAND_BUFFER_VALIDATION_ENABLE=1` - if shimming command buffers
   // or performing replay this validation can be disabled per-command buffer.
   IREE_HAL_COMMAND_BUFFER_MODE_UNVALIDATED = 1u << 5,
+
+  // Indicates that the caller guarantees that all buffers referenced by the
+  // command buffer remain live until all submissions of it have completed
+  // execution. Implementations may use this to skip retaining buffers while
+  // recording; this is usually the case when the buffers are already pinned by
+  // the enclosing submission or owned by the caller for the entire program.
+  IREE_HAL_COMMAND_BUFFER_MODE_UNRETAINED = 1u << 6,
 };
 typedef uint32_t iree_hal_command_buffer_mode_t;
 
@@ -585,7 +585,17 @@ iree_status_t iree_hal_command_buffer_execute_commands_validation(
                             "part of a primary command buffer");
   }
 
-  // TODO(benvanik): validate bindings as with push descriptor sets.
+  // Nested command buffers may reference any slot up to their capacity and the
+  // table must be able to satisfy all of them.
+  if (binding_table.count < commands->binding_capacity) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "binding table has %" PRIhsz
+                            " entries but the nested command buffer was "
+                            "created with a capacity of %u",
+                            binding_table.count, commands->binding_capacity);
+  }
+
+  // TODO(benvanik): validate binding buffer parameters/access.
 
   return iree_ok_status();
 }
@@ -0,0 +1,179 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_CTS_COMMAND_BUFFER_NESTED_TEST_H_
+#define IREE_HAL_CTS_COMMAND_BUFFER_NESTED_TEST_H_
+
+#include "iree/base/api.h"
+#include "iree/base/string_view.h"
+#include "iree/hal/api.h"
+#include "iree/hal/cts/cts_test_base.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace cts {
+
+class command_buffer_nested_test : public CtsTestBase {
+ protected:
+  void PrepareAbsExecutable() {
+    IREE_ASSERT_OK(iree_hal_executable_cache_create(
+        device_, iree_make_cstring_view("default"),
+        iree_loop_inline(&loop_status_), &executable_cache_));
+
+    iree_hal_descriptor_set_layout_binding_t descriptor_set_layout_bindings[] =
+        {
+            {
+                0,
+                IREE_HAL_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                IREE_HAL_DESCRIPTOR_FLAG_NONE,
+            },
+            {
+                1,
+                IREE_HAL_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                IREE_HAL_DESCRIPTOR_FLAG_NONE,
+            },
+        };
+    IREE_ASSERT_OK(iree_hal_descriptor_set_layout_create(
+        device_, IREE_HAL_DESCRIPTOR_SET_LAYOUT_FLAG_NONE,
+        IREE_ARRAYSIZE(descriptor_set_layout_bindings),
+        descriptor_set_layout_bindings, &descriptor_set_layout_));
+    IREE_ASSERT_OK(iree_hal_pipeline_layout_create(
+        device_, /*push_constants=*/0, /*set_layout_count=*/1,
+        &descriptor_set_layout_, &pipeline_layout_));
+
+    iree_hal_executable_params_t executable_params;
+    iree_hal_executable_params_initialize(&executable_params);
+    executable_params.caching_mode =
+        IREE_HAL_EXECUTABLE_CACHING_MODE_ALIAS_PROVIDED_DATA;
+    executable_params.executable_format =
+        iree_make_cstring_view(get_test_executable_format());
+    executable_params.executable_data = get_test_executable_data(
+        iree_make_cstring_view("command_buffer_dispatch_test.bin"));
+    executable_params.pipeline_layout_count = 1;
+    executable_params.pipeline_layouts = &pipeline_layout_;
+
+    IREE_ASSERT_OK(iree_hal_executable_cache_prepare_executable(
+        executable_cache_, &executable_params, &executable_));
+  }
+
+  void CleanupExecutable() {
+    iree_hal_executable_release(executable_);
+    iree_hal_pipeline_layout_release(pipeline_layout_);
+    iree_hal_descriptor_set_layout_release(descriptor_set_layout_);
+    iree_hal_executable_cache_release(executable_cache_);
+    IREE_ASSERT_OK(loop_status_);
+  }
+
+  void CreateFloatBuffer(float value, iree_hal_buffer_t** out_buffer) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+    params.usage = IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE |
+                   IREE_HAL_BUFFER_USAGE_TRANSFER |
+                   IREE_HAL_BUFFER_USAGE_MAPPING;
+    IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+        device_allocator_, params, sizeof(value),
+        iree_make_const_byte_span(&value, sizeof(value)), out_buffer));
+  }
+
+  float ReadFloatBuffer(iree_hal_buffer_t* buffer) {
+    float value = 0.0f;
+    IREE_EXPECT_OK(iree_hal_device_transfer_d2h(
+        device_, buffer, /*source_offset=*/0, &value, sizeof(value),
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+    return value;
+  }
+
+  iree_status_t loop_status_ = iree_ok_status();
+  iree_hal_executable_cache_t* executable_cache_ = NULL;
+  iree_hal_descriptor_set_layout_t* descriptor_set_layout_ = NULL;
+  iree_hal_pipeline_layout_t* pipeline_layout_ = NULL;
+  iree_hal_executable_t* executable_ = NULL;
+};
+
+// Records a dispatch once with bindings sourced from a binding table and
+// executes it twice within a primary command buffer with different tables.
+TEST_P(command_buffer_nested_test, DispatchWithBindingTables) {
+  PrepareAbsExecutable();
+
+  iree_hal_command_buffer_t* nested_command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_NESTED,
+      IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/2, &nested_command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(nested_command_buffer));
+  iree_hal_descriptor_set_binding_t descriptor_set_bindings[] = {
+      {
+          /*binding=*/0,
+          /*buffer_slot=*/0,
+          /*buffer=*/NULL,
+          /*offset=*/0,
+          /*length=*/IREE_WHOLE_BUFFER,
+      },
+      {
+          /*binding=*/1,
+          /*buffer_slot=*/1,
+          /*buffer=*/NULL,
+          /*offset=*/0,
+          /*length=*/IREE_WHOLE_BUFFER,
+      },
+  };
+  IREE_ASSERT_OK(iree_hal_command_buffer_push_descriptor_set(
+      nested_command_buffer, pipeline_layout_, /*set=*/0,
+      IREE_ARRAYSIZE(descriptor_set_bindings), descriptor_set_bindings));
+  IREE_ASSERT_OK(iree_hal_command_buffer_dispatch(
+      nested_command_buffer, executable_, /*entry_point=*/0,
+      /*workgroup_x=*/1, /*workgroup_y=*/1, /*workgroup_z=*/1));
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(nested_command_buffer));
+
+  iree_hal_buffer_t* input_buffers[2] = {NULL, NULL};
+  iree_hal_buffer_t* output_buffers[2] = {NULL, NULL};
+  CreateFloatBuffer(-2.5f, &input_buffers[0]);
+  CreateFloatBuffer(0.0f, &output_buffers[0]);
+  CreateFloatBuffer(-4.0f, &input_buffers[1]);
+  CreateFloatBuffer(0.0f, &output_buffers[1]);
+
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/0, &command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+  for (int i = 0; i < 2; ++i) {
+    iree_hal_buffer_binding_t bindings[] = {
+        {input_buffers[i], /*offset=*/0, IREE_WHOLE_BUFFER},
+        {output_buffers[i], /*offset=*/0, IREE_WHOLE_BUFFER},
+    };
+    iree_hal_buffer_binding_table_t binding_table = {
+        IREE_ARRAYSIZE(bindings),
+        bindings,
+    };
+    IREE_ASSERT_OK(iree_hal_command_buffer_execute_commands(
+        command_buffer, nested_command_buffer, binding_table));
+  }
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+
+  IREE_ASSERT_OK(SubmitCommandBufferAndWait(command_buffer));
+
+  EXPECT_EQ(2.5f, ReadFloatBuffer(output_buffers[0]));
+  EXPECT_EQ(4.0f, ReadFloatBuffer(output_buffers[1]));
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_command_buffer_release(nested_command_buffer);
+  for (int i = 0; i < 2; ++i) {
+    iree_hal_buffer_release(output_buffers[i]);
+    iree_hal_buffer_release(input_buffers[i]);
+  }
+  CleanupExecutable();
+}
+
+}  // namespace cts
+}  // namespace hal
+}  // namespace iree
+
+#endif  // IREE_HAL_CTS_COMMAND_BUFFER_NESTED_TEST_H_
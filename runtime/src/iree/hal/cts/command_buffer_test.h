@@ -588,6 +588,143 @@ TEST_P(command_buffer_test, UpdateBufferSubspan) {
   iree_hal_buffer_release(device_buffer);
 }
 
+TEST_P(command_buffer_test, BufferBarrierOrdering) {
+  iree_hal_buffer_t* source_buffer = NULL;
+  CreateZeroedDeviceBuffer(kDefaultAllocationSize, &source_buffer);
+  iree_hal_buffer_t* target_buffer = NULL;
+  CreateZeroedDeviceBuffer(kDefaultAllocationSize, &target_buffer);
+  iree_hal_buffer_t* unrelated_buffer = NULL;
+  CreateZeroedDeviceBuffer(kDefaultAllocationSize, &unrelated_buffer);
+
+  // Barriers may reference subspans of the buffers used by commands.
+  iree_hal_buffer_t* source_subspan = NULL;
+  IREE_ASSERT_OK(iree_hal_buffer_subspan(source_buffer, /*byte_offset=*/4,
+                                         /*byte_length=*/8, &source_subspan));
+
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_TRANSFER, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/0, &command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+
+  uint8_t source_val = 0x11;
+  uint8_t unrelated_val = 0x22;
+  uint8_t target_val = 0x33;
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, source_buffer, /*target_offset=*/0,
+      /*length=*/kDefaultAllocationSize, &source_val,
+      /*pattern_length=*/sizeof(source_val)));
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, unrelated_buffer, /*target_offset=*/0,
+      /*length=*/kDefaultAllocationSize, &unrelated_val,
+      /*pattern_length=*/sizeof(unrelated_val)));
+
+  // Only orders the fill of the source buffer; the fill of the unrelated buffer
+  // is allowed to overlap with the copy.
+  iree_hal_buffer_barrier_t buffer_barrier;
+  buffer_barrier.source_scope = IREE_HAL_ACCESS_SCOPE_TRANSFER_WRITE;
+  buffer_barrier.target_scope = IREE_HAL_ACCESS_SCOPE_TRANSFER_READ;
+  buffer_barrier.buffer = source_subspan;
+  buffer_barrier.offset = 0;
+  buffer_barrier.length = IREE_WHOLE_BUFFER;
+  IREE_ASSERT_OK(iree_hal_command_buffer_execution_barrier(
+      command_buffer, IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      IREE_HAL_EXECUTION_STAGE_TRANSFER, IREE_HAL_EXECUTION_BARRIER_FLAG_NONE,
+      /*memory_barrier_count=*/0, /*memory_barriers=*/NULL,
+      /*buffer_barrier_count=*/1, &buffer_barrier));
+  IREE_ASSERT_OK(iree_hal_command_buffer_copy_buffer(
+      command_buffer, /*source_buffer=*/source_buffer, /*source_offset=*/4,
+      /*target_buffer=*/target_buffer, /*target_offset=*/0,
+      /*length=*/8));
+
+  // Global barrier ordering all prior work.
+  IREE_ASSERT_OK(iree_hal_command_buffer_execution_barrier(
+      command_buffer, IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      IREE_HAL_EXECUTION_STAGE_TRANSFER, IREE_HAL_EXECUTION_BARRIER_FLAG_NONE,
+      /*memory_barrier_count=*/0, /*memory_barriers=*/NULL,
+      /*buffer_barrier_count=*/0, /*buffer_barriers=*/NULL));
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, target_buffer, /*target_offset=*/0, /*length=*/4,
+      &target_val, /*pattern_length=*/sizeof(target_val)));
+
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+  IREE_ASSERT_OK(SubmitCommandBufferAndWait(command_buffer));
+
+  std::vector<uint8_t> actual_data(kDefaultAllocationSize);
+  IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+      device_, target_buffer, /*source_offset=*/0, actual_data.data(),
+      actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  std::vector<uint8_t> reference_buffer(kDefaultAllocationSize);
+  std::memset(reference_buffer.data(), target_val, 4);
+  std::memset(reference_buffer.data() + 4, source_val, 4);
+  EXPECT_THAT(actual_data, ContainerEq(reference_buffer));
+
+  IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+      device_, unrelated_buffer, /*source_offset=*/0, actual_data.data(),
+      actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  std::memset(reference_buffer.data(), unrelated_val, kDefaultAllocationSize);
+  EXPECT_THAT(actual_data, ContainerEq(reference_buffer));
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_buffer_release(source_subspan);
+  iree_hal_buffer_release(unrelated_buffer);
+  iree_hal_buffer_release(target_buffer);
+  iree_hal_buffer_release(source_buffer);
+}
+
+TEST_P(command_buffer_test, SubmitReusableMultipleTimes) {
+  iree_hal_buffer_t* source_buffer = NULL;
+  CreateZeroedDeviceBuffer(kDefaultAllocationSize, &source_buffer);
+  iree_hal_buffer_t* target_buffer = NULL;
+  CreateZeroedDeviceBuffer(kDefaultAllocationSize, &target_buffer);
+
+  // Recorded once without the one-shot mode and submitted repeatedly.
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, /*mode=*/0,
+      IREE_HAL_COMMAND_CATEGORY_TRANSFER, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/0, &command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+  uint8_t source_val = 0x11;
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, source_buffer, /*target_offset=*/0,
+      /*length=*/kDefaultAllocationSize, &source_val,
+      /*pattern_length=*/sizeof(source_val)));
+  IREE_ASSERT_OK(iree_hal_command_buffer_execution_barrier(
+      command_buffer, IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      IREE_HAL_EXECUTION_STAGE_TRANSFER, IREE_HAL_EXECUTION_BARRIER_FLAG_NONE,
+      /*memory_barrier_count=*/0, /*memory_barriers=*/NULL,
+      /*buffer_barrier_count=*/0, /*buffer_barriers=*/NULL));
+  IREE_ASSERT_OK(iree_hal_command_buffer_copy_buffer(
+      command_buffer, /*source_buffer=*/source_buffer, /*source_offset=*/0,
+      /*target_buffer=*/target_buffer, /*target_offset=*/0,
+      /*length=*/kDefaultAllocationSize));
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+
+  std::vector<uint8_t> reference_buffer(kDefaultAllocationSize);
+  std::memset(reference_buffer.data(), source_val, kDefaultAllocationSize);
+  for (int i = 0; i < 3; ++i) {
+    IREE_ASSERT_OK(iree_hal_buffer_map_zero(source_buffer, 0,
+                                            IREE_WHOLE_BUFFER));
+    IREE_ASSERT_OK(iree_hal_buffer_map_zero(target_buffer, 0,
+                                            IREE_WHOLE_BUFFER));
+    IREE_ASSERT_OK(SubmitCommandBufferAndWait(command_buffer));
+    std::vector<uint8_t> actual_data(kDefaultAllocationSize);
+    IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+        device_, target_buffer, /*source_offset=*/0, actual_data.data(),
+        actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+        iree_infinite_timeout()));
+    EXPECT_THAT(actual_data, ContainerEq(reference_buffer));
+  }
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_buffer_release(target_buffer);
+  iree_hal_buffer_release(source_buffer);
+}
+
 }  // namespace cts
 }  // namespace hal
 }  // namespace iree
@@ -8,6 +8,8 @@
 #define IREE_HAL_CTS_EVENT_TEST_H_
 
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
@@ -19,6 +21,8 @@ namespace iree {
 namespace hal {
 namespace cts {
 
+using ::testing::ContainerEq;
+
 class event_test : public CtsTestBase {};
 
 TEST_P(event_test, Create) {
@@ -96,6 +100,99 @@ TEST_P(event_test, SubmitWithChainedCommandBuffers) {
   iree_hal_event_release(event);
 }
 
+TEST_P(event_test, WaitWithinCommandBuffer) {
+  iree_hal_event_t* event = NULL;
+  IREE_ASSERT_OK(iree_hal_event_create(device_, &event));
+
+  const iree_device_size_t buffer_size = 1024;
+  iree_hal_buffer_params_t params = {0};
+  params.type =
+      IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+  params.usage = IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+  iree_hal_buffer_t* source_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      device_allocator_, params, buffer_size, iree_const_byte_span_empty(),
+      &source_buffer));
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      device_allocator_, params, buffer_size, iree_const_byte_span_empty(),
+      &target_buffer));
+  iree_hal_buffer_t* unrelated_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      device_allocator_, params, buffer_size, iree_const_byte_span_empty(),
+      &unrelated_buffer));
+
+  // Events require the dispatch category even when only transfers use them.
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_DISPATCH | IREE_HAL_COMMAND_CATEGORY_TRANSFER,
+      IREE_HAL_QUEUE_AFFINITY_ANY, /*binding_capacity=*/0, &command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+
+  // Produce the source contents in two steps and signal the event after both:
+  // a fill of the second half and an update of the first half. The ranges do
+  // not overlap as the two commands are unordered relative to each other.
+  uint8_t source_val = 0x11;
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, source_buffer, /*target_offset=*/buffer_size / 2,
+      buffer_size - buffer_size / 2, &source_val, sizeof(source_val)));
+  std::vector<uint8_t> update_data(buffer_size / 2);
+  for (size_t i = 0; i < update_data.size(); ++i) {
+    update_data[i] = (uint8_t)i;
+  }
+  IREE_ASSERT_OK(iree_hal_command_buffer_update_buffer(
+      command_buffer, update_data.data(), /*source_offset=*/0, source_buffer,
+      /*target_offset=*/0, update_data.size()));
+  IREE_ASSERT_OK(iree_hal_command_buffer_signal_event(
+      command_buffer, event, IREE_HAL_EXECUTION_STAGE_TRANSFER));
+
+  // Work between the signal and the wait need not wait on the signal.
+  uint8_t unrelated_val = 0x22;
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, unrelated_buffer, /*target_offset=*/0, buffer_size,
+      &unrelated_val, sizeof(unrelated_val)));
+
+  // Copying from the source buffer must observe both writes made before the
+  // signal.
+  const iree_hal_event_t* event_pts[] = {event};
+  IREE_ASSERT_OK(iree_hal_command_buffer_wait_events(
+      command_buffer, IREE_ARRAYSIZE(event_pts), event_pts,
+      /*source_stage_mask=*/IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      /*target_stage_mask=*/IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      /*memory_barrier_count=*/0,
+      /*memory_barriers=*/NULL, /*buffer_barrier_count=*/0,
+      /*buffer_barriers=*/NULL));
+  IREE_ASSERT_OK(iree_hal_command_buffer_copy_buffer(
+      command_buffer, source_buffer, /*source_offset=*/0, target_buffer,
+      /*target_offset=*/0, buffer_size));
+
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+  IREE_ASSERT_OK(SubmitCommandBufferAndWait(command_buffer));
+
+  std::vector<uint8_t> actual_data(buffer_size);
+  IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+      device_, target_buffer, /*source_offset=*/0, actual_data.data(),
+      actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  std::vector<uint8_t> reference_buffer(buffer_size, source_val);
+  std::memcpy(reference_buffer.data(), update_data.data(), update_data.size());
+  EXPECT_THAT(actual_data, ContainerEq(reference_buffer));
+
+  IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+      device_, unrelated_buffer, /*source_offset=*/0, actual_data.data(),
+      actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  std::vector<uint8_t> unrelated_reference(buffer_size, unrelated_val);
+  EXPECT_THAT(actual_data, ContainerEq(unrelated_reference));
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_buffer_release(unrelated_buffer);
+  iree_hal_buffer_release(target_buffer);
+  iree_hal_buffer_release(source_buffer);
+  iree_hal_event_release(event);
+}
+
 }  // namespace cts
 }  // namespace hal
 }  // namespace iree
@@ -183,6 +183,65 @@ TEST_P(semaphore_submission_test, SubmitWithMultipleSemaphores) {
   iree_hal_semaphore_release(signal_semaphore_2);
 }
 
+TEST_P(semaphore_submission_test, QueueAllocaExecuteDealloca) {
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  uint64_t payload_values[] = {1ull, 2ull, 3ull};
+  iree_hal_semaphore_list_t semaphore_lists[] = {
+      {1, &semaphore, &payload_values[0]},
+      {1, &semaphore, &payload_values[1]},
+      {1, &semaphore, &payload_values[2]},
+  };
+
+  // Allocate a transient buffer that is usable once the semaphore reaches 1.
+  const iree_device_size_t buffer_size = 1024;
+  iree_hal_buffer_params_t params = {0};
+  params.type =
+      IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+  params.usage = IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_device_queue_alloca(
+      device_, IREE_HAL_QUEUE_AFFINITY_ANY, iree_hal_semaphore_list_empty(),
+      semaphore_lists[0], IREE_HAL_ALLOCATOR_POOL_DEFAULT, params, buffer_size,
+      &buffer));
+
+  // Fill the buffer after the alloca.
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_TRANSFER, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/0, &command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+  uint32_t pattern = 0xCAFEF00Du;
+  IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, buffer, /*target_offset=*/0, buffer_size, &pattern,
+      sizeof(pattern)));
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+  IREE_ASSERT_OK(iree_hal_device_queue_execute(
+      device_, IREE_HAL_QUEUE_AFFINITY_ANY, semaphore_lists[0],
+      semaphore_lists[1], 1, &command_buffer));
+
+  IREE_ASSERT_OK(
+      iree_hal_semaphore_wait(semaphore, 2ull, iree_infinite_timeout()));
+  uint32_t actual_data[buffer_size / sizeof(uint32_t)];
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_read(buffer, 0, actual_data, sizeof(actual_data)));
+  for (uint32_t value : actual_data) {
+    EXPECT_EQ(pattern, value);
+  }
+
+  // Return the buffer to the queue once the reads above have completed.
+  IREE_ASSERT_OK(iree_hal_device_queue_dealloca(
+      device_, IREE_HAL_QUEUE_AFFINITY_ANY, semaphore_lists[1],
+      semaphore_lists[2], buffer));
+  IREE_ASSERT_OK(
+      iree_hal_semaphore_wait(semaphore, 3ull, iree_infinite_timeout()));
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_buffer_release(buffer);
+  iree_hal_semaphore_release(semaphore);
+}
+
 }  // namespace cts
 }  // namespace hal
 }  // namespace iree
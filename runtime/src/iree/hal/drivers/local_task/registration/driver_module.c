@@ -10,11 +10,25 @@
 #include <stddef.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/flags.h"
 #include "iree/hal/drivers/local_task/task_driver.h"
 #include "iree/hal/local/loaders/registration/init.h"
 #include "iree/hal/local/plugins/registration/init.h"
 #include "iree/task/api.h"
 
+IREE_FLAG(
+    bool, task_heap_huge_pages, false,
+    "Backs large device buffers with huge pages when available to reduce TLB\n"
+    "misses. Requires reserved huge pages (vm.nr_hugepages) or transparent\n"
+    "huge pages in madvise/always mode on Linux and SeLockMemoryPrivilege on\n"
+    "Windows; otherwise normal pages are used.");
+
+IREE_FLAG(
+    bool, task_heap_prefault, false,
+    "Faults in and zeroes large device buffers when they are allocated\n"
+    "instead of on first use. Moves page fault latency from the first\n"
+    "invocation to load time.");
+
 static iree_status_t iree_hal_local_task_driver_factory_enumerate(
     void* self, iree_host_size_t* out_driver_info_count,
     const iree_hal_driver_info_t** out_driver_infos) {
@@ -68,9 +82,17 @@ static iree_status_t iree_hal_local_task_driver_factory_try_create(
   // TODO(benvanik): allow this to be injected to share across drivers.
   iree_hal_allocator_t* device_allocator = NULL;
   if (iree_status_is_ok(status)) {
-    status = iree_hal_allocator_create_heap(iree_make_cstring_view("local"),
-                                            host_allocator, host_allocator,
-                                            &device_allocator);
+    iree_hal_heap_allocator_options_t heap_options;
+    iree_hal_heap_allocator_options_initialize(&heap_options);
+    if (FLAG_task_heap_huge_pages) {
+      heap_options.flags |= IREE_HAL_HEAP_ALLOCATOR_FLAG_HUGE_PAGES;
+    }
+    if (FLAG_task_heap_prefault) {
+      heap_options.flags |= IREE_HAL_HEAP_ALLOCATOR_FLAG_PREFAULT;
+    }
+    status = iree_hal_allocator_create_heap_with_options(
+        iree_make_cstring_view("local"), &heap_options, host_allocator,
+        host_allocator, &device_allocator);
   }
 
   // Create a task driver that will use the given executors for scheduling work
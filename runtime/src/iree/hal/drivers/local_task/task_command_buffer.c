@@ -16,7 +16,9 @@
 #include "iree/hal/local/executable_library.h"
 #include "iree/hal/local/local_executable.h"
 #include "iree/hal/local/local_pipeline_layout.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
 #include "iree/hal/utils/resource_set.h"
+#include "iree/hal/utils/shm_channel.h"
 #include "iree/task/affinity_set.h"
 #include "iree/task/list.h"
 #include "iree/task/submission.h"
@@ -26,6 +28,71 @@
 // iree_hal_task_command_buffer_t
 //===----------------------------------------------------------------------===//
 
+// A byte range of a buffer accessed by a recorded command.
+// Used to determine which recorded tasks must be joined by a barrier that is
+// restricted to a set of buffer ranges.
+typedef struct iree_hal_task_cmd_range_t {
+  iree_hal_buffer_t* buffer;
+  iree_device_size_t offset;
+  iree_device_size_t length;
+} iree_hal_task_cmd_range_t;
+
+// A recorded task that does not yet have a completion task assigned.
+// Leaves are joined to barriers as the barriers are recorded (or to the
+// command buffer retire task during issue) and until then may overlap with any
+// subsequently recorded work that does not depend on them.
+typedef struct iree_hal_task_cmd_leaf_t {
+  struct iree_hal_task_cmd_leaf_t* next;
+  iree_task_t* task;
+  // Total number of buffer ranges accessed by the task in |ranges|.
+  iree_host_size_t range_count;
+  iree_hal_task_cmd_range_t ranges[];
+} iree_hal_task_cmd_leaf_t;
+
+// Tracks the task that is reached when an event is signaled within the
+// command buffer. Waits on the event are recorded as dependency edges from
+// this task instead of barriers over all prior work.
+typedef struct iree_hal_task_cmd_event_t {
+  struct iree_hal_task_cmd_event_t* next;
+  const iree_hal_event_t* event;
+  // Barrier joining all work recorded prior to the signal or NULL if the event
+  // has not been signaled in the command buffer (or has since been reset).
+  iree_task_barrier_t* signal_barrier;
+} iree_hal_task_cmd_event_t;
+
+// Tracks the last collective recorded on a channel. Participants must issue
+// collectives on a channel in the same order and each collective is ordered
+// after the prior one on its channel instead of after all prior work.
+typedef struct iree_hal_task_cmd_channel_t {
+  struct iree_hal_task_cmd_channel_t* next;
+  const iree_hal_channel_t* channel;
+  // Task of the last collective recorded on the channel.
+  iree_task_t* last_task;
+} iree_hal_task_cmd_channel_t;
+
+// A task recorded into the DAG of a reusable command buffer.
+// Executing a task mutates it (completion links are cleared, dependency counts
+// are decremented, indirect dispatches are converted to direct ones, etc) and
+// the recorded state is captured in |snapshot| when recording ends so that it
+// can be restored prior to each issue.
+typedef struct iree_hal_task_cmd_template_t {
+  struct iree_hal_task_cmd_template_t* next;
+  iree_task_t* task;
+  // Size of the task structure (based on its type) in bytes.
+  iree_host_size_t size;
+  // Copy of the task as recorded; NULL until the command buffer has ended.
+  void* snapshot;
+} iree_hal_task_cmd_template_t;
+
+// Task joining all leaves of a reusable command buffer.
+// The leaves of the DAG are fixed once recording ends and by joining them to a
+// single task the retire task of each issue only needs to be chained to it.
+// Cleared from the in-flight state of the command buffer when it retires.
+typedef struct iree_hal_task_cmd_exit_t {
+  iree_task_nop_t task;
+  struct iree_hal_task_command_buffer_t* command_buffer;
+} iree_hal_task_cmd_exit_t;
+
 // iree/task/-based command buffer.
 // We track a minimal amount of state here and incrementally build out the task
 // DAG that we can submit to the task system directly. There's no intermediate
@@ -34,6 +101,19 @@
 // additional allocations required during recording or execution. That means our
 // command buffer here is essentially just a builder for the task system types
 // and manager of the lifetime of the tasks.
+//
+// Barriers are only inserted into the DAG when they order work that was
+// actually recorded: an execution barrier restricted to a set of buffer ranges
+// only joins the prior tasks that access those ranges and all other prior
+// tasks are left as leaves that may continue to overlap with the tasks
+// recorded after the barrier.
+//
+// Reusable (non-one-shot) command buffers record the DAG once and snapshot all
+// of the tasks when recording ends. Each issue restores the tasks from their
+// snapshots before enqueuing them so the same DAG can be replayed any number of
+// times without re-recording. Issues must not overlap: the prior execution
+// must have retired before the command buffer is issued again (as is the case
+// when submissions are ordered by semaphores).
 typedef struct iree_hal_task_command_buffer_t {
   iree_hal_command_buffer_t base;
   iree_allocator_t host_allocator;
@@ -52,18 +132,31 @@ typedef struct iree_hal_task_command_buffer_t {
   // ready task set in the submission.
   iree_task_list_t root_tasks;
 
-  // One or more tasks at the leaves of the DAG.
+  // Zero or more tasks at the leaves of the DAG that have no completion task.
   // Only once all these tasks have completed execution will the command buffer
-  // be considered completed as a whole.
-  //
-  // An empty list indicates that root_tasks are also the leaves.
-  iree_task_list_t leaf_tasks;
+  // be considered completed as a whole. Stored in the arena.
+  iree_hal_task_cmd_leaf_t* leaf_tasks;
+
+  // All tasks recorded into the DAG when the command buffer is reusable.
+  // Restored from their snapshots prior to each issue. Stored in the arena.
+  iree_hal_task_cmd_template_t* templates;
+
+  // Task joining all leaves when the command buffer is reusable; the retire
+  // task of each issue is chained to it.
+  iree_hal_task_cmd_exit_t* exit_task;
+
+  // Copy of |root_tasks| as recorded. The task list links are restored from the
+  // snapshots but the list itself must be rebuilt on each issue.
+  iree_task_list_t recorded_root_tasks;
+
+  // Nonzero while an issue of a reusable command buffer is executing.
+  iree_atomic_int32_t in_flight;
 
   // TODO(benvanik): move this out of the struct and allocate from the arena -
   // we only need this during recording and it's ~4KB of waste otherwise.
   // State tracked within the command buffer during recording only.
   struct {
-    // The last global barrier that was inserted, if any.
+    // The last barrier that was inserted, if any.
     // The barrier is allocated and inserted into the DAG when requested but the
     // actual barrier dependency list is only allocated and set on flushes.
     // This lets us allocate the appropriately sized barrier task list from the
@@ -78,6 +171,14 @@ typedef struct iree_hal_task_command_buffer_t {
     // All execution tasks emitted that must execute after |open_barrier|.
     iree_task_list_t open_tasks;
 
+    // All events signaled or reset within the command buffer. Stored in the
+    // arena.
+    iree_hal_task_cmd_event_t* events;
+
+    // All channels used by collectives within the command buffer. Stored in the
+    // arena.
+    iree_hal_task_cmd_channel_t* channels;
+
     // A flattened list of all available descriptor set bindings.
     // As descriptor sets are pushed/bound the bindings will be updated to
     // represent the fully-translated binding data pointer.
@@ -89,6 +190,12 @@ typedef struct iree_hal_task_command_buffer_t {
         binding_lengths[IREE_HAL_LOCAL_MAX_DESCRIPTOR_SET_COUNT *
                         IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT];
 
+    // Buffer ranges of each binding in |bindings| used to track the accesses
+    // performed by dispatches for barrier construction.
+    iree_hal_task_cmd_range_t
+        binding_ranges[IREE_HAL_LOCAL_MAX_DESCRIPTOR_SET_COUNT *
+                       IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT];
+
     // All available push constants updated each time push_constants is called.
     // Reset only with the command buffer and otherwise will maintain its values
     // during recording to allow for partial push_constants updates.
@@ -115,25 +222,6 @@ iree_status_t iree_hal_task_command_buffer_create(
   IREE_ASSERT_ARGUMENT(out_command_buffer);
   *out_command_buffer = NULL;
 
-  if (!iree_all_bits_set(mode, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)) {
-    // If we want reuse we'd need to support duplicating the task DAG after
-    // recording or have some kind of copy-on-submit behavior that does so if
-    // a command buffer is submitted for execution twice. Allowing for the same
-    // command buffer to be enqueued multiple times would be fine so long as
-    // execution doesn't overlap (`cmdbuf|cmdbuf` vs
-    // `cmdbuf -> semaphore -> cmdbuf`) though we'd still need to be careful
-    // that we did the enqueuing and reset of the task structures at the right
-    // times. Definitely something that'll be useful in the future... but not
-    // today :)
-    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                            "only one-shot command buffer usage is supported");
-  }
-  if (binding_capacity > 0) {
-    // TODO(#10144): support indirect command buffers with binding tables.
-    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                            "indirect command buffers not yet implemented");
-  }
-
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_task_command_buffer_t* command_buffer = NULL;
@@ -147,7 +235,12 @@ iree_status_t iree_hal_task_command_buffer_create(
     command_buffer->scope = scope;
     iree_arena_initialize(block_pool, &command_buffer->arena);
     iree_task_list_initialize(&command_buffer->root_tasks);
-    iree_task_list_initialize(&command_buffer->leaf_tasks);
+    command_buffer->leaf_tasks = NULL;
+    command_buffer->templates = NULL;
+    command_buffer->exit_task = NULL;
+    iree_task_list_initialize(&command_buffer->recorded_root_tasks);
+    iree_atomic_store_int32(&command_buffer->in_flight, 0,
+                            iree_memory_order_relaxed);
     memset(&command_buffer->state, 0, sizeof(command_buffer->state));
     status = iree_hal_resource_set_allocate(block_pool,
                                             &command_buffer->resource_set);
@@ -169,9 +262,20 @@ static void iree_hal_task_command_buffer_destroy(
   iree_allocator_t host_allocator = command_buffer->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  IREE_ASSERT_EQ(0, iree_atomic_load_int32(&command_buffer->in_flight,
+                                           iree_memory_order_acquire));
+
   memset(&command_buffer->state, 0, sizeof(command_buffer->state));
-  iree_task_list_discard(&command_buffer->root_tasks);
-  iree_task_list_discard(&command_buffer->leaf_tasks);
+  if (command_buffer->templates == NULL) {
+    iree_task_list_discard(&command_buffer->root_tasks);
+  } else {
+    // Tasks of reusable command buffers are never owned by the executor once
+    // issued and have no resources beyond the arena to release.
+    iree_task_list_initialize(&command_buffer->root_tasks);
+  }
+  command_buffer->leaf_tasks = NULL;
+  command_buffer->templates = NULL;
+  command_buffer->exit_task = NULL;
   iree_arena_deinitialize(&command_buffer->arena);
   iree_hal_resource_set_free(command_buffer->resource_set);
   iree_allocator_free(host_allocator, command_buffer);
@@ -203,6 +307,92 @@ static iree_status_t iree_hal_task_command_buffer_begin(
   return iree_ok_status();
 }
 
+static iree_status_t iree_hal_task_command_buffer_allocate_leaf(
+    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task,
+    iree_host_size_t range_count, iree_hal_task_cmd_leaf_t** out_leaf);
+
+// Returns true if the command buffer may be issued more than once.
+static bool iree_hal_task_command_buffer_is_reusable(
+    iree_hal_task_command_buffer_t* command_buffer) {
+  return !iree_all_bits_set(command_buffer->base.mode,
+                            IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT);
+}
+
+// Tracks |task| as part of the DAG so that it can be restored prior to each
+// issue of a reusable command buffer. No-op for one-shot command buffers.
+static iree_status_t iree_hal_task_command_buffer_track_task(
+    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task) {
+  if (!iree_hal_task_command_buffer_is_reusable(command_buffer)) {
+    return iree_ok_status();
+  }
+  iree_host_size_t size = 0;
+  switch (task->type) {
+    case IREE_TASK_TYPE_NOP:
+      size = sizeof(iree_task_nop_t);
+      break;
+    case IREE_TASK_TYPE_CALL:
+      size = sizeof(iree_task_call_t);
+      break;
+    case IREE_TASK_TYPE_BARRIER:
+      size = sizeof(iree_task_barrier_t);
+      break;
+    case IREE_TASK_TYPE_DISPATCH:
+      size = sizeof(iree_task_dispatch_t);
+      break;
+    default:
+      return iree_make_status(IREE_STATUS_INTERNAL,
+                              "unexpected task type %d in command buffer",
+                              (int)task->type);
+  }
+  iree_hal_task_cmd_template_t* cmd_template = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(
+      &command_buffer->arena, sizeof(*cmd_template), (void**)&cmd_template));
+  cmd_template->next = command_buffer->templates;
+  cmd_template->task = task;
+  cmd_template->size = size;
+  cmd_template->snapshot = NULL;
+  command_buffer->templates = cmd_template;
+  return iree_ok_status();
+}
+
+static void iree_hal_task_cmd_exit_cleanup(iree_task_t* task,
+                                           iree_status_code_t status_code) {
+  iree_hal_task_cmd_exit_t* exit_task = (iree_hal_task_cmd_exit_t*)task;
+  iree_atomic_store_int32(&exit_task->command_buffer->in_flight, 0,
+                          iree_memory_order_release);
+}
+
+// Joins all leaves of a reusable command buffer to an exit task and snapshots
+// every task in the DAG as recorded.
+static iree_status_t iree_hal_task_command_buffer_snapshot_tasks(
+    iree_hal_task_command_buffer_t* command_buffer) {
+  iree_hal_task_cmd_exit_t* exit_task = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(
+      &command_buffer->arena, sizeof(*exit_task), (void**)&exit_task));
+  iree_task_nop_initialize(command_buffer->scope, &exit_task->task);
+  iree_task_set_cleanup_fn(&exit_task->task.header,
+                           iree_hal_task_cmd_exit_cleanup);
+  exit_task->command_buffer = command_buffer;
+  for (iree_hal_task_cmd_leaf_t* leaf = command_buffer->leaf_tasks;
+       leaf != NULL; leaf = leaf->next) {
+    iree_task_set_completion_task(leaf->task, &exit_task->task.header);
+  }
+  command_buffer->leaf_tasks = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_track_task(
+      command_buffer, &exit_task->task.header));
+  command_buffer->exit_task = exit_task;
+
+  for (iree_hal_task_cmd_template_t* cmd_template = command_buffer->templates;
+       cmd_template != NULL; cmd_template = cmd_template->next) {
+    IREE_RETURN_IF_ERROR(iree_arena_allocate(
+        &command_buffer->arena, cmd_template->size, &cmd_template->snapshot));
+    memcpy(cmd_template->snapshot, cmd_template->task, cmd_template->size);
+  }
+  command_buffer->recorded_root_tasks = command_buffer->root_tasks;
+
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_task_command_buffer_end(
     iree_hal_command_buffer_t* base_command_buffer) {
   iree_hal_task_command_buffer_t* command_buffer =
@@ -212,12 +402,23 @@ static iree_status_t iree_hal_task_command_buffer_end(
   IREE_RETURN_IF_ERROR(
       iree_hal_task_command_buffer_flush_tasks(command_buffer));
 
-  // Move the tasks from the leaf list (tail) to the root list (head) if this
-  // was the first set of tasks recorded.
-  if (iree_task_list_is_empty(&command_buffer->root_tasks) &&
-      !iree_task_list_is_empty(&command_buffer->leaf_tasks)) {
-    iree_task_list_move(&command_buffer->leaf_tasks,
-                        &command_buffer->root_tasks);
+  // The last barrier recorded has no subsequent barrier to join with and must
+  // instead be joined with the retire task when the command buffer is issued.
+  iree_task_barrier_t* open_barrier = command_buffer->state.open_barrier;
+  if (open_barrier != NULL) {
+    iree_hal_task_cmd_leaf_t* leaf = NULL;
+    IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+        command_buffer, &open_barrier->header, 0, &leaf));
+    leaf->next = command_buffer->leaf_tasks;
+    command_buffer->leaf_tasks = leaf;
+    command_buffer->state.open_barrier = NULL;
+  }
+
+  // Empty command buffers have nothing to replay.
+  if (iree_hal_task_command_buffer_is_reusable(command_buffer) &&
+      !iree_task_list_is_empty(&command_buffer->root_tasks)) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_task_command_buffer_snapshot_tasks(command_buffer));
   }
 
   iree_hal_resource_set_freeze(command_buffer->resource_set);
@@ -226,10 +427,9 @@ static iree_status_t iree_hal_task_command_buffer_end(
 }
 
 // Flushes all open tasks to the previous barrier and prepares for more
-// recording. The root tasks are also populated here when required as this is
-// the one place where we can see both halves of the most recent synchronization
-// event: those tasks recorded prior (if any) and the task that marks the set of
-// tasks that will be recorded after (if any).
+// recording. This is the one place where we can see both halves of the most
+// recent synchronization event: those tasks recorded prior (if any) and the
+// task that marks the set of tasks that will be recorded after (if any).
 static iree_status_t iree_hal_task_command_buffer_flush_tasks(
     iree_hal_task_command_buffer_t* command_buffer) {
   iree_task_barrier_t* open_barrier = command_buffer->state.open_barrier;
@@ -240,11 +440,10 @@ static iree_status_t iree_hal_task_command_buffer_flush_tasks(
         iree_task_list_front(&command_buffer->state.open_tasks);
     iree_host_size_t dependent_task_count =
         command_buffer->state.open_task_count;
-    if (dependent_task_count == 1) {
-      // Special-case: only one open task so we can avoid the additional barrier
-      // overhead by reusing the completion task.
-      iree_task_set_completion_task(&open_barrier->header, task_head);
-    } else if (dependent_task_count > 1) {
+    // NOTE: we can't reuse the completion task of the barrier for the
+    // single-dependent case as the barrier must remain joinable with the next
+    // barrier (or the retire task) to preserve transitive ordering.
+    if (dependent_task_count > 0) {
       // Allocate the list of tasks we'll stash back on the previous barrier.
       // Since we couldn't know at the time how many tasks would end up in the
       // barrier we had to defer it until now.
@@ -261,29 +460,71 @@ static iree_status_t iree_hal_task_command_buffer_flush_tasks(
                                             dependent_tasks);
     }
   }
-  command_buffer->state.open_barrier = NULL;
-
-  // Move the open tasks to the tail as they represent the first half of the
-  // *next* barrier that will be inserted.
-  if (command_buffer->state.open_task_count > 0) {
-    iree_task_list_move(&command_buffer->state.open_tasks,
-                        &command_buffer->leaf_tasks);
-    command_buffer->state.open_task_count = 0;
-  }
+
+  // The open tasks remain tracked as leaves until they are joined with a
+  // subsequent barrier or the retire task.
+  iree_task_list_initialize(&command_buffer->state.open_tasks);
+  command_buffer->state.open_task_count = 0;
 
   return iree_ok_status();
 }
 
-// Emits a global barrier, splitting execution into all prior recorded tasks
-// and all subsequent recorded tasks. This is currently the critical piece that
-// limits our concurrency: changing to fine-grained barriers (via barrier
-// buffers or events) will allow more work to overlap at the cost of more brain
-// to build out the proper task graph.
-static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
-    iree_hal_task_command_buffer_t* command_buffer) {
+// Returns a range of |length| bytes at |offset| into |buffer|.
+static iree_hal_task_cmd_range_t iree_hal_task_cmd_make_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t offset,
+    iree_device_size_t length) {
+  iree_hal_task_cmd_range_t range = {buffer, offset, length};
+  return range;
+}
+
+// Returns true if |leaf| must complete prior to the barrier defined by the
+// given |buffer_barriers|. If no buffer barriers are provided the barrier is
+// global and all leaves are ordered by it.
+static bool iree_hal_task_cmd_leaf_is_ordered_by(
+    const iree_hal_task_cmd_leaf_t* leaf, iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  if (buffer_barrier_count == 0) return true;
+  for (iree_host_size_t i = 0; i < leaf->range_count; ++i) {
+    const iree_hal_task_cmd_range_t* range = &leaf->ranges[i];
+    for (iree_host_size_t j = 0; j < buffer_barrier_count; ++j) {
+      if (iree_hal_buffer_test_overlap(
+              range->buffer, range->offset, range->length,
+              buffer_barriers[j].buffer, buffer_barriers[j].offset,
+              buffer_barriers[j].length) != IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Emits a barrier splitting execution into the prior recorded tasks accessing
+// any of the given |buffer_barriers| ranges and all subsequent recorded tasks.
+// If no buffer barriers are provided the barrier is global and joins all prior
+// recorded tasks. Prior tasks that are not ordered by the barrier remain leaves
+// and are allowed to overlap with the tasks recorded after the barrier.
+static iree_status_t iree_hal_task_command_buffer_emit_barrier(
+    iree_hal_task_command_buffer_t* command_buffer,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  // If no prior task is ordered by the barrier then there's nothing for the
+  // tasks recorded after it to wait on beyond the barrier that is already open
+  // and we can elide the barrier entirely. This is common when there are no
+  // tasks recorded since the last barrier or the barrier ranges are disjoint
+  // from all work still in flight.
+  bool any_ordered = false;
+  for (iree_hal_task_cmd_leaf_t* leaf = command_buffer->leaf_tasks;
+       leaf != NULL; leaf = leaf->next) {
+    if (iree_hal_task_cmd_leaf_is_ordered_by(leaf, buffer_barrier_count,
+                                             buffer_barriers)) {
+      any_ordered = true;
+      break;
+    }
+  }
+  if (!any_ordered) return iree_ok_status();
+
   // Flush open tasks to the previous barrier. This resets our state such that
   // we can assign the new open barrier and start recording tasks for it.
-  // Previous tasks will be moved into the leaf_tasks list.
   IREE_RETURN_IF_ERROR(
       iree_hal_task_command_buffer_flush_tasks(command_buffer));
 
@@ -296,27 +537,29 @@ static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
   IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
                                            sizeof(*barrier), (void**)&barrier));
   iree_task_barrier_initialize_empty(command_buffer->scope, barrier);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_track_task(command_buffer, &barrier->header));
 
-  // If there were previous tasks then join them to the barrier.
-  for (iree_task_t* task = iree_task_list_front(&command_buffer->leaf_tasks);
-       task != NULL; task = task->next_task) {
-    iree_task_set_completion_task(task, &barrier->header);
+  // All tasks recorded after the barrier are also recorded after the previous
+  // barrier and must transitively wait on it.
+  iree_task_barrier_t* previous_barrier = command_buffer->state.open_barrier;
+  if (previous_barrier != NULL) {
+    iree_task_set_completion_task(&previous_barrier->header, &barrier->header);
   }
 
-  // Move the tasks from the leaf list (tail) to the root list (head) if this
-  // was the first set of tasks recorded.
-  if (iree_task_list_is_empty(&command_buffer->root_tasks) &&
-      !iree_task_list_is_empty(&command_buffer->leaf_tasks)) {
-    iree_task_list_move(&command_buffer->leaf_tasks,
-                        &command_buffer->root_tasks);
+  // Join the ordered leaves to the barrier and drop them from the leaf list.
+  iree_hal_task_cmd_leaf_t** leaf_ptr = &command_buffer->leaf_tasks;
+  while (*leaf_ptr != NULL) {
+    iree_hal_task_cmd_leaf_t* leaf = *leaf_ptr;
+    if (iree_hal_task_cmd_leaf_is_ordered_by(leaf, buffer_barrier_count,
+                                             buffer_barriers)) {
+      iree_task_set_completion_task(leaf->task, &barrier->header);
+      *leaf_ptr = leaf->next;
+    } else {
+      leaf_ptr = &leaf->next;
+    }
   }
 
-  // Reset the tail of the command buffer to the barrier. This leaves us in a
-  // consistent state if the recording ends immediate after this (the barrier
-  // will be the last task).
-  iree_task_list_initialize(&command_buffer->leaf_tasks);
-  iree_task_list_push_back(&command_buffer->leaf_tasks, &barrier->header);
-
   // NOTE: all new tasks emitted will be executed after this barrier.
   command_buffer->state.open_barrier = barrier;
   command_buffer->state.open_task_count = 0;
@@ -324,19 +567,47 @@ static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
   return iree_ok_status();
 }
 
-// Emits a the given execution |task| into the current open synchronization
+// Allocates a leaf for |task| with storage for |range_count| buffer ranges.
+// The caller must populate the ranges accessed by the task before emitting it.
+static iree_status_t iree_hal_task_command_buffer_allocate_leaf(
+    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task,
+    iree_host_size_t range_count, iree_hal_task_cmd_leaf_t** out_leaf) {
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(
+      &command_buffer->arena,
+      sizeof(*leaf) + range_count * sizeof(leaf->ranges[0]), (void**)&leaf));
+  leaf->next = NULL;
+  leaf->task = task;
+  leaf->range_count = range_count;
+  *out_leaf = leaf;
+  return iree_ok_status();
+}
+
+// Emits the task of the given |leaf| into the current open synchronization
 // scope (after state.open_barrier and before the next barrier).
 static iree_status_t iree_hal_task_command_buffer_emit_execution_task(
-    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task) {
+    iree_hal_task_command_buffer_t* command_buffer,
+    iree_hal_task_cmd_leaf_t* leaf) {
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_track_task(command_buffer, leaf->task));
+
   if (command_buffer->state.open_barrier == NULL) {
     // If there is no open barrier then we are at the head and going right into
-    // the task DAG.
-    iree_task_list_push_back(&command_buffer->leaf_tasks, task);
+    // the task DAG. Tasks that already have dependencies (such as event signal
+    // barriers joining prior work) are readied by those instead.
+    if (iree_task_is_ready(leaf->task)) {
+      iree_task_list_push_back(&command_buffer->root_tasks, leaf->task);
+    }
   } else {
     // Append to the open task list that will be flushed to the open barrier.
-    iree_task_list_push_back(&command_buffer->state.open_tasks, task);
+    iree_task_list_push_back(&command_buffer->state.open_tasks, leaf->task);
     ++command_buffer->state.open_task_count;
   }
+
+  // The task has no completion task until a barrier that orders it is emitted.
+  leaf->next = command_buffer->leaf_tasks;
+  command_buffer->leaf_tasks = leaf;
+
   return iree_ok_status();
 }
 
@@ -358,29 +629,41 @@ iree_status_t iree_hal_task_command_buffer_issue(
     return iree_ok_status();
   }
 
-  bool has_leaf_tasks = !iree_task_list_is_empty(&command_buffer->leaf_tasks);
-  if (has_leaf_tasks) {
-    // Chain the retire task onto the leaf tasks as their completion indicates
-    // that all commands have completed.
-    for (iree_task_t* task = command_buffer->leaf_tasks.head; task != NULL;
-         task = task->next_task) {
-      iree_task_set_completion_task(task, retire_task);
+  if (command_buffer->templates != NULL) {
+    // Reusable command buffers replay the recorded DAG. The tasks are shared
+    // across issues and the prior issue must have fully retired before they can
+    // be restored.
+    if (iree_atomic_exchange_int32(&command_buffer->in_flight, 1,
+                                   iree_memory_order_acq_rel) != 0) {
+      return iree_make_status(
+          IREE_STATUS_FAILED_PRECONDITION,
+          "reusable command buffer issued while a prior issue is still "
+          "executing; submissions must be ordered with semaphores");
     }
-  } else {
-    // If we have no leaf tasks it means that this is a single layer DAG and
-    // after the root tasks complete the entire command buffer has completed.
-    for (iree_task_t* task = command_buffer->root_tasks.head; task != NULL;
-         task = task->next_task) {
-      iree_task_set_completion_task(task, retire_task);
+    for (iree_hal_task_cmd_template_t* cmd_template = command_buffer->templates;
+         cmd_template != NULL; cmd_template = cmd_template->next) {
+      memcpy(cmd_template->task, cmd_template->snapshot, cmd_template->size);
     }
+    iree_task_set_completion_task(&command_buffer->exit_task->task.header,
+                                  retire_task);
+    iree_task_list_t root_tasks = command_buffer->recorded_root_tasks;
+    iree_task_submission_enqueue_list(pending_submission, &root_tasks);
+    return iree_ok_status();
+  }
+
+  // Chain the retire task onto the leaf tasks as their completion indicates
+  // that all commands have completed.
+  for (iree_hal_task_cmd_leaf_t* leaf = command_buffer->leaf_tasks;
+       leaf != NULL; leaf = leaf->next) {
+    iree_task_set_completion_task(leaf->task, retire_task);
   }
+  command_buffer->leaf_tasks = NULL;
 
   // Enqueue all root tasks that are ready to run immediately.
   // After this all of the command buffer tasks are owned by the submission and
   // we need to ensure the command buffer doesn't try to discard them.
   iree_task_submission_enqueue_list(pending_submission,
                                     &command_buffer->root_tasks);
-  iree_task_list_initialize(&command_buffer->leaf_tasks);
 
   return iree_ok_status();
 }
@@ -417,20 +700,89 @@ static iree_status_t iree_hal_task_command_buffer_execution_barrier(
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
 
-  // TODO(benvanik): actual DAG construction. Right now we are just doing simple
-  // global barriers each time and forcing a join-fork point.
-  return iree_hal_task_command_buffer_emit_global_barrier(command_buffer);
+  // Global memory barriers order all prior work while buffer barriers only
+  // order the prior work accessing the specified buffer ranges.
+  if (memory_barrier_count > 0) buffer_barrier_count = 0;
+  return iree_hal_task_command_buffer_emit_barrier(
+      command_buffer, buffer_barrier_count, buffer_barriers);
 }
 
 //===----------------------------------------------------------------------===//
 // iree_hal_command_buffer_signal_event
 //===----------------------------------------------------------------------===//
+// Events are modeled as split barriers: signaling joins all outstanding work
+// into an event barrier without blocking any subsequently recorded work and
+// waits join only the event barriers into the barrier preceding the waiting
+// work.
+//
+// TODO(#4518): track events across command buffers in the queue state. Events
+// not signaled within the command buffer are treated as global barriers.
+
+// Returns the event tracking record for |event| in the command buffer,
+// allocating a new unsignaled record if one does not exist.
+static iree_status_t iree_hal_task_command_buffer_lookup_event(
+    iree_hal_task_command_buffer_t* command_buffer,
+    const iree_hal_event_t* event, iree_hal_task_cmd_event_t** out_cmd_event) {
+  for (iree_hal_task_cmd_event_t* cmd_event = command_buffer->state.events;
+       cmd_event != NULL; cmd_event = cmd_event->next) {
+    if (cmd_event->event == event) {
+      *out_cmd_event = cmd_event;
+      return iree_ok_status();
+    }
+  }
+  iree_hal_task_cmd_event_t* cmd_event = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(
+      &command_buffer->arena, sizeof(*cmd_event), (void**)&cmd_event));
+  cmd_event->next = command_buffer->state.events;
+  cmd_event->event = event;
+  cmd_event->signal_barrier = NULL;
+  command_buffer->state.events = cmd_event;
+  *out_cmd_event = cmd_event;
+  return iree_ok_status();
+}
 
 static iree_status_t iree_hal_task_command_buffer_signal_event(
     iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
     iree_hal_execution_stage_t source_stage_mask) {
-  // TODO(#4518): implement events. For now we just insert global barriers.
-  return iree_ok_status();
+  iree_hal_task_command_buffer_t* command_buffer =
+      iree_hal_task_command_buffer_cast(base_command_buffer);
+
+  IREE_RETURN_IF_ERROR(
+      iree_hal_resource_set_insert(command_buffer->resource_set, 1, &event));
+  iree_hal_task_cmd_event_t* cmd_event = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_lookup_event(
+      command_buffer, event, &cmd_event));
+
+  iree_task_barrier_t* barrier = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
+                                           sizeof(*barrier), (void**)&barrier));
+  iree_task_barrier_initialize_empty(command_buffer->scope, barrier);
+
+  // The event barrier takes the place of all outstanding leaves and accesses
+  // every buffer range they did so that subsequent barriers can still order it
+  // precisely.
+  iree_host_size_t range_count = 0;
+  for (iree_hal_task_cmd_leaf_t* leaf = command_buffer->leaf_tasks;
+       leaf != NULL; leaf = leaf->next) {
+    range_count += leaf->range_count;
+  }
+  iree_hal_task_cmd_leaf_t* barrier_leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &barrier->header, range_count, &barrier_leaf));
+  iree_host_size_t range_offset = 0;
+  for (iree_hal_task_cmd_leaf_t* leaf = command_buffer->leaf_tasks;
+       leaf != NULL; leaf = leaf->next) {
+    memcpy(&barrier_leaf->ranges[range_offset], leaf->ranges,
+           leaf->range_count * sizeof(leaf->ranges[0]));
+    range_offset += leaf->range_count;
+    iree_task_set_completion_task(leaf->task, &barrier->header);
+  }
+  command_buffer->leaf_tasks = NULL;
+
+  // Work recorded prior to the open barrier is joined by way of it.
+  cmd_event->signal_barrier = barrier;
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
+                                                          barrier_leaf);
 }
 
 //===----------------------------------------------------------------------===//
@@ -440,7 +792,14 @@ static iree_status_t iree_hal_task_command_buffer_signal_event(
 static iree_status_t iree_hal_task_command_buffer_reset_event(
     iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
     iree_hal_execution_stage_t source_stage_mask) {
-  // TODO(#4518): implement events. For now we just insert global barriers.
+  iree_hal_task_command_buffer_t* command_buffer =
+      iree_hal_task_command_buffer_cast(base_command_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_resource_set_insert(command_buffer->resource_set, 1, &event));
+  iree_hal_task_cmd_event_t* cmd_event = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_lookup_event(
+      command_buffer, event, &cmd_event));
+  cmd_event->signal_barrier = NULL;
   return iree_ok_status();
 }
 
@@ -448,6 +807,24 @@ static iree_status_t iree_hal_task_command_buffer_reset_event(
 // iree_hal_command_buffer_wait_events
 //===----------------------------------------------------------------------===//
 
+// Returns the task that must be joined in order to wait on |task| or NULL if
+// the wait is already satisfied by the open barrier (or |wait_barrier|).
+// Tasks only have a single completion task so if |task| has already been
+// joined with another barrier we walk the completion chain to find the first
+// task transitively completing after it that has not yet been joined.
+static iree_task_t* iree_hal_task_command_buffer_resolve_wait_task(
+    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task,
+    iree_task_barrier_t* wait_barrier) {
+  while (task->completion_task != NULL &&
+         (wait_barrier == NULL || task != &wait_barrier->header)) {
+    task = task->completion_task;
+  }
+  if (wait_barrier != NULL && task == &wait_barrier->header) return NULL;
+  iree_task_barrier_t* open_barrier = command_buffer->state.open_barrier;
+  if (open_barrier != NULL && task == &open_barrier->header) return NULL;
+  return task;
+}
+
 static iree_status_t iree_hal_task_command_buffer_wait_events(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_host_size_t event_count, const iree_hal_event_t** events,
@@ -459,8 +836,68 @@ static iree_status_t iree_hal_task_command_buffer_wait_events(
     const iree_hal_buffer_barrier_t* buffer_barriers) {
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
-  // TODO(#4518): implement events. For now we just insert global barriers.
-  return iree_hal_task_command_buffer_emit_global_barrier(command_buffer);
+
+  // Resolve all events to the tasks that must be joined prior to the work
+  // following the wait. The memory and buffer barriers only apply to the work
+  // joined by the event signals and need no additional edges.
+  bool any_unsatisfied = false;
+  for (iree_host_size_t i = 0; i < event_count; ++i) {
+    iree_hal_task_cmd_event_t* cmd_event = NULL;
+    IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_lookup_event(
+        command_buffer, events[i], &cmd_event));
+    if (cmd_event->signal_barrier == NULL) {
+      // Event not signaled within this command buffer; we have no way of
+      // knowing what it orders and must conservatively order all prior work.
+      return iree_hal_task_command_buffer_emit_barrier(command_buffer, 0,
+                                                       NULL);
+    }
+    if (iree_hal_task_command_buffer_resolve_wait_task(
+            command_buffer, &cmd_event->signal_barrier->header, NULL)) {
+      any_unsatisfied = true;
+    }
+  }
+  if (!any_unsatisfied) return iree_ok_status();
+
+  // Flush open tasks to the previous barrier and open a new one that all new
+  // tasks emitted will be executed after.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_flush_tasks(command_buffer));
+  iree_task_barrier_t* barrier = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
+                                           sizeof(*barrier), (void**)&barrier));
+  iree_task_barrier_initialize_empty(command_buffer->scope, barrier);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_track_task(command_buffer, &barrier->header));
+
+  // Join each unsatisfied event; if the event task resolved to a leaf it must
+  // be dropped from the leaf list as it now has a completion task.
+  for (iree_host_size_t i = 0; i < event_count; ++i) {
+    iree_hal_task_cmd_event_t* cmd_event = NULL;
+    IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_lookup_event(
+        command_buffer, events[i], &cmd_event));
+    iree_task_t* wait_task = iree_hal_task_command_buffer_resolve_wait_task(
+        command_buffer, &cmd_event->signal_barrier->header, barrier);
+    if (!wait_task) continue;
+    iree_task_set_completion_task(wait_task, &barrier->header);
+    for (iree_hal_task_cmd_leaf_t** leaf_ptr = &command_buffer->leaf_tasks;
+         *leaf_ptr != NULL; leaf_ptr = &(*leaf_ptr)->next) {
+      if ((*leaf_ptr)->task == wait_task) {
+        *leaf_ptr = (*leaf_ptr)->next;
+        break;
+      }
+    }
+  }
+
+  // All tasks recorded after the wait are also recorded after the previous
+  // barrier and must transitively wait on it.
+  iree_task_barrier_t* previous_barrier = command_buffer->state.open_barrier;
+  if (previous_barrier != NULL) {
+    iree_task_set_completion_task(&previous_barrier->header, &barrier->header);
+  }
+  command_buffer->state.open_barrier = barrier;
+  command_buffer->state.open_task_count = 0;
+
+  return iree_ok_status();
 }
 
 //===----------------------------------------------------------------------===//
@@ -551,8 +988,13 @@ static iree_status_t iree_hal_task_command_buffer_fill_buffer(
   memcpy(cmd->pattern, pattern, pattern_length);
   cmd->pattern_length = pattern_length;
 
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &cmd->task.header, 1, &leaf));
+  leaf->ranges[0] =
+      iree_hal_task_cmd_make_range(target_buffer, target_offset, length);
+
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer, leaf);
 }
 
 //===----------------------------------------------------------------------===//
@@ -607,8 +1049,13 @@ static iree_status_t iree_hal_task_command_buffer_update_buffer(
   memcpy(cmd->source_buffer, (const uint8_t*)source_buffer + source_offset,
          cmd->length);
 
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &cmd->task.header, 1, &leaf));
+  leaf->ranges[0] =
+      iree_hal_task_cmd_make_range(target_buffer, target_offset, length);
+
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer, leaf);
 }
 
 //===----------------------------------------------------------------------===//
@@ -691,39 +1138,196 @@ static iree_status_t iree_hal_task_command_buffer_copy_buffer(
   cmd->target_offset = target_offset;
   cmd->length = length;
 
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &cmd->task.header, 2, &leaf));
+  leaf->ranges[0] =
+      iree_hal_task_cmd_make_range(source_buffer, source_offset, length);
+  leaf->ranges[1] =
+      iree_hal_task_cmd_make_range(target_buffer, target_offset, length);
+
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer, leaf);
 }
 
 //===----------------------------------------------------------------------===//
 // iree_hal_command_buffer_collective
 //===----------------------------------------------------------------------===//
 
+// Collectives are executed on shared memory channels by a call task that
+// blocks the worker running it until all participants have contributed. Other
+// work in the command buffer that is not ordered by barriers continues to run
+// on other workers while the call waits. Collectives on the same channel are
+// chained so that they run in the order recorded without ordering any other
+// work.
+//
+// NOTE: each participant must be able to make progress independently: if the
+// devices of multiple ranks share an executor it must have enough workers to
+// run all of their collectives concurrently.
+
+typedef struct iree_hal_cmd_collective_t {
+  iree_task_call_t task;
+  iree_hal_channel_t* channel;
+  iree_hal_collective_op_t op;
+  uint32_t param;
+  iree_hal_buffer_binding_t send_binding;
+  iree_hal_buffer_binding_t recv_binding;
+  iree_device_size_t element_count;
+} iree_hal_cmd_collective_t;
+
+static iree_status_t iree_hal_cmd_collective(
+    void* user_context, iree_task_t* task,
+    iree_task_submission_t* pending_submission) {
+  const iree_hal_cmd_collective_t* cmd =
+      (const iree_hal_cmd_collective_t*)user_context;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_t status = iree_ok_status();
+  iree_hal_buffer_mapping_t send_mapping = {{0}};
+  iree_hal_buffer_mapping_t recv_mapping = {{0}};
+  if (cmd->send_binding.buffer) {
+    status = iree_hal_buffer_map_range(
+        cmd->send_binding.buffer, IREE_HAL_MAPPING_MODE_SCOPED,
+        IREE_HAL_MEMORY_ACCESS_READ, cmd->send_binding.offset,
+        cmd->send_binding.length, &send_mapping);
+  }
+  if (iree_status_is_ok(status) && cmd->recv_binding.buffer) {
+    status = iree_hal_buffer_map_range(
+        cmd->recv_binding.buffer, IREE_HAL_MAPPING_MODE_SCOPED,
+        IREE_HAL_MEMORY_ACCESS_WRITE, cmd->recv_binding.offset,
+        cmd->recv_binding.length, &recv_mapping);
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_shm_channel_execute(
+        cmd->channel, cmd->op, cmd->param,
+        iree_make_const_byte_span(send_mapping.contents.data,
+                                  send_mapping.contents.data_length),
+        recv_mapping.contents, cmd->element_count);
+  }
+
+  if (cmd->recv_binding.buffer) {
+    status =
+        iree_status_join(status, iree_hal_buffer_unmap_range(&recv_mapping));
+  }
+  if (cmd->send_binding.buffer) {
+    status =
+        iree_status_join(status, iree_hal_buffer_unmap_range(&send_mapping));
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Returns the channel tracking record for |channel| in the command buffer,
+// allocating a new record with no prior collective if one does not exist.
+static iree_status_t iree_hal_task_command_buffer_lookup_channel(
+    iree_hal_task_command_buffer_t* command_buffer,
+    const iree_hal_channel_t* channel,
+    iree_hal_task_cmd_channel_t** out_cmd_channel) {
+  for (iree_hal_task_cmd_channel_t* cmd_channel =
+           command_buffer->state.channels;
+       cmd_channel != NULL; cmd_channel = cmd_channel->next) {
+    if (cmd_channel->channel == channel) {
+      *out_cmd_channel = cmd_channel;
+      return iree_ok_status();
+    }
+  }
+  iree_hal_task_cmd_channel_t* cmd_channel = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(
+      &command_buffer->arena, sizeof(*cmd_channel), (void**)&cmd_channel));
+  cmd_channel->next = command_buffer->state.channels;
+  cmd_channel->channel = channel;
+  cmd_channel->last_task = NULL;
+  command_buffer->state.channels = cmd_channel;
+  *out_cmd_channel = cmd_channel;
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_task_command_buffer_collective(
     iree_hal_command_buffer_t* base_command_buffer, iree_hal_channel_t* channel,
     iree_hal_collective_op_t op, uint32_t param,
     iree_hal_buffer_binding_t send_binding,
     iree_hal_buffer_binding_t recv_binding, iree_device_size_t element_count) {
-  // The channel can be used as a vtable if we want to inject collective APIs -
-  // the device creation function would set up the channel once and we'll
-  // receive it here each time. When interacting with the task system we want to
-  // get wait handles we can model with iree_task_wait_t.
-  //
-  // An example basic flow:
-  //   insert iree_task_call_t:
-  //     chains with prior commands and makes the collective API call
-  //   insert iree_task_wait_t with API wait handle or our event:
-  //     chains with call
-  //
-  // What we probably want to do, though, is group the commands based on
-  // execution barriers. When a new collective command comes in we should
-  // reserve an event from the event pool, create the call to issue the
-  // collective operation, and then track the event in the command buffer state.
-  // When another collective call comes in we'll do the same and append the
-  // event. At the next execution barrier (or non-collective command) we'd
-  // flush to a multi-wait on all of the pending events.
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "collectives not yet implemented on the task system");
+  iree_hal_task_command_buffer_t* command_buffer =
+      iree_hal_task_command_buffer_cast(base_command_buffer);
+  if (!iree_hal_shm_channel_isa(channel)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "channel was not created by a local-task device");
+  }
+
+  IREE_RETURN_IF_ERROR(
+      iree_hal_resource_set_insert(command_buffer->resource_set, 1, &channel));
+  const iree_hal_buffer_t* buffers[2] = {NULL, NULL};
+  iree_host_size_t buffer_count = 0;
+  if (send_binding.buffer) buffers[buffer_count++] = send_binding.buffer;
+  if (recv_binding.buffer) buffers[buffer_count++] = recv_binding.buffer;
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, buffer_count, buffers));
+
+  // All participants must issue collectives on a channel in the same order so
+  // the prior collective on the channel must complete first. If it has already
+  // been ordered by a barrier we wait on the first task not yet joined after
+  // it; when that is a leaf it is replaced by the new collective, which takes
+  // over its buffer ranges so that later barriers still order it precisely.
+  iree_hal_task_cmd_channel_t* cmd_channel = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_lookup_channel(
+      command_buffer, channel, &cmd_channel));
+  iree_hal_task_cmd_leaf_t** prior_leaf_ptr = NULL;
+  if (cmd_channel->last_task != NULL) {
+    iree_task_t* wait_task = iree_hal_task_command_buffer_resolve_wait_task(
+        command_buffer, cmd_channel->last_task, NULL);
+    for (iree_hal_task_cmd_leaf_t** leaf_ptr = &command_buffer->leaf_tasks;
+         wait_task != NULL && *leaf_ptr != NULL;
+         leaf_ptr = &(*leaf_ptr)->next) {
+      if ((*leaf_ptr)->task == wait_task) {
+        prior_leaf_ptr = leaf_ptr;
+        break;
+      }
+    }
+  }
+  const iree_host_size_t prior_range_count =
+      prior_leaf_ptr ? (*prior_leaf_ptr)->range_count : 0;
+
+  iree_hal_cmd_collective_t* cmd = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_arena_allocate(&command_buffer->arena, sizeof(*cmd), (void**)&cmd));
+  iree_task_call_initialize(
+      command_buffer->scope,
+      iree_task_make_call_closure(iree_hal_cmd_collective, (void*)cmd),
+      &cmd->task);
+  cmd->channel = channel;
+  cmd->op = op;
+  cmd->param = param;
+  cmd->send_binding = send_binding;
+  cmd->recv_binding = recv_binding;
+  cmd->element_count = element_count;
+
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &cmd->task.header, buffer_count + prior_range_count,
+      &leaf));
+  iree_host_size_t range_index = 0;
+  if (send_binding.buffer) {
+    leaf->ranges[range_index++] = iree_hal_task_cmd_make_range(
+        send_binding.buffer, send_binding.offset, send_binding.length);
+  }
+  if (recv_binding.buffer) {
+    leaf->ranges[range_index++] = iree_hal_task_cmd_make_range(
+        recv_binding.buffer, recv_binding.offset, recv_binding.length);
+  }
+
+  // Chain the prior collective (or the task joining it) to this one and drop it
+  // from the leaf list as it now has a completion task.
+  if (prior_leaf_ptr != NULL) {
+    iree_hal_task_cmd_leaf_t* prior_leaf = *prior_leaf_ptr;
+    memcpy(&leaf->ranges[range_index], prior_leaf->ranges,
+           prior_range_count * sizeof(prior_leaf->ranges[0]));
+    iree_task_set_completion_task(prior_leaf->task, &cmd->task.header);
+    *prior_leaf_ptr = prior_leaf->next;
+  }
+  cmd_channel->last_task = &cmd->task.header;
+
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer, leaf);
 }
 
 //===----------------------------------------------------------------------===//
@@ -770,6 +1374,16 @@ static iree_status_t iree_hal_task_command_buffer_push_descriptor_set(
                             "set %u out of bounds", set);
   }
 
+  // Retain all bound buffers in one batch unless the caller has guaranteed
+  // they remain live for the duration of execution.
+  if (binding_count > 0 &&
+      !iree_all_bits_set(command_buffer->base.mode,
+                         IREE_HAL_COMMAND_BUFFER_MODE_UNRETAINED)) {
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_strided(
+        command_buffer->resource_set, binding_count, &bindings[0].buffer,
+        sizeof(bindings[0])));
+  }
+
   iree_host_size_t binding_base =
       set * IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT;
   for (iree_host_size_t i = 0; i < binding_count; ++i) {
@@ -780,10 +1394,6 @@ static iree_status_t iree_hal_task_command_buffer_push_descriptor_set(
     }
     iree_host_size_t binding_ordinal = binding_base + bindings[i].binding;
 
-    // TODO(benvanik): batch insert by getting the resources in their own list.
-    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
-        command_buffer->resource_set, 1, &bindings[i].buffer));
-
     // TODO(benvanik): track mapping so we can properly map/unmap/flush/etc.
     iree_hal_buffer_mapping_t buffer_mapping = {{0}};
     if (bindings[i].buffer) {
@@ -795,10 +1405,16 @@ static iree_status_t iree_hal_task_command_buffer_push_descriptor_set(
           buffer_mapping.contents.data;
       command_buffer->state.binding_lengths[binding_ordinal] =
           buffer_mapping.contents.data_length;
+      command_buffer->state.binding_ranges[binding_ordinal] =
+          iree_hal_task_cmd_make_range(bindings[i].buffer, bindings[i].offset,
+                                       bindings[i].length);
     } else {
-      // TODO(#10144): stash indirect binding reference in the state table.
-      return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                              "binding table lookup not yet supported");
+      // Indirect bindings are only valid in nested command buffers which are
+      // recorded as deferred command buffers and have their bindings resolved
+      // against the binding table when executed (see execute_commands).
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "indirect bindings are only supported in nested "
+                              "command buffers");
     }
   }
 
@@ -882,6 +1498,7 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_executable_t* executable, int32_t entry_point,
     uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z,
+    const iree_hal_task_cmd_range_t* workgroups_range,
     iree_hal_cmd_dispatch_t** out_cmd) {
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
@@ -930,6 +1547,14 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
       iree_task_make_dispatch_closure(iree_hal_cmd_dispatch_tile, (void*)cmd),
       workgroup_size, workgroup_count, &cmd->task);
 
+  // Track all bindings (and the indirect workgroup count, if any) as accessed
+  // by the dispatch so that barriers can order it precisely.
+  iree_hal_task_cmd_leaf_t* leaf = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_leaf(
+      command_buffer, &cmd->task.header,
+      used_binding_count + (workgroups_range ? 1 : 0), &leaf));
+  if (workgroups_range) leaf->ranges[used_binding_count] = *workgroups_range;
+
   // Tell the task system how much workgroup local memory is required for the
   // dispatch; each invocation of the entry point will have at least as much
   // scratch memory available during execution.
@@ -966,6 +1591,7 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
     used_binding_mask = iree_shr(used_binding_mask, mask_offset + 1);
     binding_ptrs[i] = command_buffer->state.bindings[binding_ordinal];
     binding_lengths[i] = command_buffer->state.binding_lengths[binding_ordinal];
+    leaf->ranges[i] = command_buffer->state.binding_ranges[binding_ordinal];
     if (!binding_ptrs[i]) {
       return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
                               "(flat) binding %d is NULL", binding_ordinal);
@@ -973,8 +1599,7 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
   }
 
   *out_cmd = cmd;
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  return iree_hal_task_command_buffer_emit_execution_task(command_buffer, leaf);
 }
 
 static iree_status_t iree_hal_task_command_buffer_dispatch(
@@ -988,7 +1613,7 @@ static iree_status_t iree_hal_task_command_buffer_dispatch(
   iree_hal_cmd_dispatch_t* cmd = NULL;
   return iree_hal_task_command_buffer_build_dispatch(
       base_command_buffer, executable, entry_point, workgroup_x, workgroup_y,
-      workgroup_z, &cmd);
+      workgroup_z, /*workgroups_range=*/NULL, &cmd);
 }
 
 static iree_status_t iree_hal_task_command_buffer_dispatch_indirect(
@@ -1010,9 +1635,13 @@ static iree_status_t iree_hal_task_command_buffer_dispatch_indirect(
       IREE_HAL_MEMORY_ACCESS_READ, workgroups_offset, 3 * sizeof(uint32_t),
       &buffer_mapping));
 
+  const iree_hal_task_cmd_range_t workgroups_range =
+      iree_hal_task_cmd_make_range(workgroups_buffer, workgroups_offset,
+                                   3 * sizeof(uint32_t));
   iree_hal_cmd_dispatch_t* cmd = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_build_dispatch(
-      base_command_buffer, executable, entry_point, 0, 0, 0, &cmd));
+      base_command_buffer, executable, entry_point, 0, 0, 0, &workgroups_range,
+      &cmd));
   cmd->task.workgroup_count.ptr = (const uint32_t*)buffer_mapping.contents.data;
   cmd->task.header.flags |= IREE_TASK_FLAG_DISPATCH_INDIRECT;
   return iree_ok_status();
@@ -1026,16 +1655,23 @@ static iree_status_t iree_hal_task_command_buffer_execute_commands(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_command_buffer_t* base_commands,
     iree_hal_buffer_binding_table_t binding_table) {
-  // TODO(#10144): support indirect command buffers by using deferred command
-  // buffers or caching the task topology (probably not worth the tracking).
-  // If we could separate the topology that referenced the binding table we'd
-  // be able to reissue but not concurrently (as each task can only be in flight
-  // as a singleton) - which may be enough in many cases but adds complexity to
-  // tracking as we'd need to either enforce serialization of subsequent
-  // submissions or copy-on-write-style clone the topology for each additional
-  // concurrent submission.
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "indirect command buffers not yet implemented");
+  iree_hal_task_command_buffer_t* command_buffer =
+      iree_hal_task_command_buffer_cast(base_command_buffer);
+
+  // Nested command buffers are recorded as deferred command buffers (see
+  // iree_hal_task_device_create_command_buffer) and replayed into this command
+  // buffer with their indirect bindings resolved against |binding_table|. The
+  // tasks produced are identical to those that would have been produced had
+  // the commands been recorded here directly. The same nested command buffer
+  // can be executed any number of times with different binding tables.
+  if (!iree_hal_deferred_command_buffer_isa(base_commands)) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "only deferred command buffers can be nested");
+  }
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, 1, &base_commands));
+  return iree_hal_deferred_command_buffer_apply_nested(
+      base_commands, base_command_buffer, binding_table);
 }
 
 //===----------------------------------------------------------------------===//
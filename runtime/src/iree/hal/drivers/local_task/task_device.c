@@ -11,15 +11,19 @@
 #include <string.h>
 
 #include "iree/base/internal/arena.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/base/internal/cpu.h"
+#include "iree/base/internal/math.h"
 #include "iree/hal/drivers/local_task/task_command_buffer.h"
 #include "iree/hal/drivers/local_task/task_event.h"
 #include "iree/hal/drivers/local_task/task_queue.h"
 #include "iree/hal/drivers/local_task/task_semaphore.h"
+#include "iree/hal/drivers/local_task/task_transient_pool.h"
 #include "iree/hal/local/executable_environment.h"
 #include "iree/hal/local/local_executable_cache.h"
 #include "iree/hal/local/local_pipeline_layout.h"
 #include "iree/hal/utils/buffer_transfer.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
 
 typedef struct iree_hal_task_device_t {
   iree_hal_resource_t resource;
@@ -38,8 +42,13 @@ typedef struct iree_hal_task_device_t {
   iree_allocator_t host_allocator;
   iree_hal_allocator_t* device_allocator;
 
+  // Stream-ordered pool servicing queue_alloca/queue_dealloca.
+  iree_hal_task_transient_pool_t* transient_pool;
+
   // Optional provider used for creating/configuring collective channels.
   iree_hal_channel_provider_t* channel_provider;
+  // Options for shared memory channels created by the device.
+  iree_hal_shm_channel_options_t channel_options;
 
   iree_host_size_t queue_count;
   iree_hal_task_queue_t queues[];
@@ -56,6 +65,8 @@ static iree_hal_task_device_t* iree_hal_task_device_cast(
 void iree_hal_task_device_params_initialize(
     iree_hal_task_device_params_t* out_params) {
   out_params->arena_block_size = 32 * 1024;
+  out_params->transient_pool_capacity = 256 * 1024 * 1024;
+  iree_hal_shm_channel_options_initialize(&out_params->channel_options);
 }
 
 static iree_status_t iree_hal_task_device_check_params(
@@ -112,6 +123,7 @@ iree_status_t iree_hal_task_device_create(
     device->host_allocator = host_allocator;
     device->device_allocator = device_allocator;
     iree_hal_allocator_retain(device_allocator);
+    device->channel_options = params->channel_options;
 
     iree_arena_block_pool_initialize(4096, host_allocator,
                                      &device->small_block_pool);
@@ -136,6 +148,12 @@ iree_status_t iree_hal_task_device_create(
     }
   }
 
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_task_transient_pool_create(
+        params->transient_pool_capacity, host_allocator,
+        &device->transient_pool);
+  }
+
   if (iree_status_is_ok(status)) {
     *out_device = (iree_hal_device_t*)device;
   } else {
@@ -158,6 +176,13 @@ static void iree_hal_task_device_destroy(iree_hal_device_t* base_device) {
     iree_hal_executable_loader_release(device->loaders[i]);
   }
 
+  // Outstanding transient buffers retain the pool but we drop any unused
+  // memory now while the device allocator is still live.
+  if (device->transient_pool) {
+    iree_hal_task_transient_pool_trim(device->transient_pool);
+    iree_hal_task_transient_pool_release(device->transient_pool);
+  }
+
   iree_hal_allocator_release(device->device_allocator);
   iree_hal_channel_provider_release(device->channel_provider);
 
@@ -190,6 +215,8 @@ static iree_hal_allocator_t* iree_hal_task_device_allocator(
 static void iree_hal_task_replace_device_allocator(
     iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  // Pooled memory belongs to the previous allocator.
+  iree_hal_task_transient_pool_trim(device->transient_pool);
   iree_hal_allocator_retain(new_allocator);
   iree_hal_allocator_release(device->device_allocator);
   device->device_allocator = new_allocator;
@@ -211,6 +238,7 @@ static iree_status_t iree_hal_task_device_trim(iree_hal_device_t* base_device) {
   for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
     iree_hal_task_queue_trim(&device->queues[i]);
   }
+  iree_hal_task_transient_pool_trim(device->transient_pool);
   IREE_RETURN_IF_ERROR(iree_hal_allocator_trim(device->device_allocator));
 
   iree_arena_block_pool_trim(&device->small_block_pool);
@@ -269,11 +297,67 @@ static iree_host_size_t iree_hal_task_device_select_queue(
   return queue_affinity % device->queue_count;
 }
 
+// Default channel IDs are generated by rank 0 and shared with all other
+// participants by the channel provider. They only need to be unique among
+// channels that may be live at the same time.
+static iree_atomic_int64_t iree_hal_task_device_channel_id_counter =
+    IREE_ATOMIC_VAR_INIT(0);
+
 static iree_status_t iree_hal_task_device_create_channel(
     iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
     iree_hal_channel_params_t params, iree_hal_channel_t** out_channel) {
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "collectives not implemented");
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+
+  // Today we only allow a single logical device per channel.
+  // We could multiplex channels but it'd be better to surface that to the
+  // compiler so that it can emit the right rank math.
+  int requested_count = iree_math_count_ones_u64(queue_affinity);
+  // TODO(#12206): properly assign affinity in the compiler.
+  if (requested_count != 64 && requested_count != 1) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "exactly one participant is allowed in a "
+                            "channel but %d were specified",
+                            requested_count);
+  }
+
+  // Ask the channel provider (if configured) for the default rank and count
+  // if the user did not set them.
+  if (device->channel_provider &&
+      (params.rank == IREE_HAL_CHANNEL_RANK_DEFAULT ||
+       params.count == IREE_HAL_CHANNEL_COUNT_DEFAULT)) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_channel_provider_query_default_rank_and_count(
+            device->channel_provider, &params.rank, &params.count),
+        "querying default collective group rank and count");
+  }
+
+  // If neither an ID nor a group were provided the provider is used to share a
+  // unique ID from the root with all other participants.
+  uint64_t default_id[2] = {0, 0};
+  if (iree_const_byte_span_is_empty(params.id) &&
+      iree_string_view_is_empty(params.group)) {
+    if (!device->channel_provider) {
+      return iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "default collective channel ID requested but no channel provider has "
+          "been set on the device to provide it");
+    }
+    if (params.rank == 0) {
+      default_id[0] = (uint64_t)iree_time_now();
+      default_id[1] = (uint64_t)iree_atomic_fetch_add_int64(
+          &iree_hal_task_device_channel_id_counter, 1,
+          iree_memory_order_relaxed);
+    }
+    IREE_RETURN_IF_ERROR(
+        iree_hal_channel_provider_exchange_default_id(
+            device->channel_provider,
+            iree_make_byte_span((void*)default_id, sizeof(default_id))),
+        "exchanging channel ID with other participants");
+    params.id = iree_make_const_byte_span(default_id, sizeof(default_id));
+  }
+
+  return iree_hal_shm_channel_create(&device->channel_options, params,
+                                     device->host_allocator, out_channel);
 }
 
 static iree_status_t iree_hal_task_device_create_command_buffer(
@@ -282,6 +366,14 @@ static iree_status_t iree_hal_task_device_create_command_buffer(
     iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  if (iree_all_bits_set(mode, IREE_HAL_COMMAND_BUFFER_MODE_NESTED)) {
+    // Nested command buffers are never submitted directly and are instead
+    // replayed into primary command buffers with their binding tables resolved
+    // when recorded via iree_hal_command_buffer_execute_commands.
+    return iree_hal_deferred_command_buffer_create(
+        base_device, mode, command_categories, binding_capacity,
+        &device->large_block_pool, device->host_allocator, out_command_buffer);
+  }
   iree_host_size_t queue_index = iree_hal_task_device_select_queue(
       device, command_categories, queue_affinity);
   return iree_hal_task_command_buffer_create(
@@ -366,13 +458,41 @@ static iree_status_t iree_hal_task_device_queue_alloca(
     iree_hal_allocator_pool_t pool, iree_hal_buffer_params_t params,
     iree_device_size_t allocation_size,
     iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
-  // TODO(benvanik): queue-ordered allocations.
-  IREE_RETURN_IF_ERROR(iree_hal_semaphore_list_wait(wait_semaphore_list,
-                                                    iree_infinite_timeout()));
-  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
-      iree_hal_device_allocator(base_device), params, allocation_size,
-      iree_const_byte_span_empty(), out_buffer));
-  IREE_RETURN_IF_ERROR(iree_hal_semaphore_list_signal(signal_semaphore_list));
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  *out_buffer = NULL;
+
+  // Backing memory is committed immediately (reusing memory released by
+  // executed deallocas when possible) as command buffers referencing the buffer
+  // may be recorded before the alloca executes. The alloca itself only needs to
+  // order the signals after the waits.
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_task_transient_pool_allocate(
+      device->transient_pool, device->device_allocator, params,
+      allocation_size, &buffer));
+  iree_host_size_t queue_index = iree_hal_task_device_select_queue(
+      device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+  iree_hal_submission_batch_t batch = {
+      .wait_semaphores = wait_semaphore_list,
+      .signal_semaphores = signal_semaphore_list,
+      .command_buffer_count = 0,
+      .command_buffers = NULL,
+  };
+  iree_status_t status =
+      iree_hal_task_queue_submit(&device->queues[queue_index], 1, &batch);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+// Returns the backing memory of a transient buffer to its pool once the
+// dealloca executes on the queue.
+static iree_status_t iree_hal_task_device_queue_dealloca_cmd(
+    void* user_context, iree_task_t* task,
+    iree_task_submission_t* pending_submission) {
+  iree_hal_task_transient_buffer_decommit((iree_hal_buffer_t*)user_context);
   return iree_ok_status();
 }
 
@@ -381,10 +501,24 @@ static iree_status_t iree_hal_task_device_queue_dealloca(
     const iree_hal_semaphore_list_t wait_semaphore_list,
     const iree_hal_semaphore_list_t signal_semaphore_list,
     iree_hal_buffer_t* buffer) {
-  // TODO(benvanik): queue-ordered allocations.
-  IREE_RETURN_IF_ERROR(iree_hal_device_queue_barrier(
-      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list));
-  return iree_ok_status();
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+
+  // Buffers not allocated with queue_alloca have their lifetime managed by
+  // reference counting and the dealloca is only a barrier.
+  if (!iree_hal_task_transient_buffer_isa(buffer)) {
+    return iree_hal_device_queue_barrier(base_device, queue_affinity,
+                                         wait_semaphore_list,
+                                         signal_semaphore_list);
+  }
+
+  // The buffer is retained by the queue operation until it retires.
+  iree_host_size_t queue_index = iree_hal_task_device_select_queue(
+      device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+  return iree_hal_task_queue_submit_callback(
+      &device->queues[queue_index], wait_semaphore_list, signal_semaphore_list,
+      /*resource_count=*/1, (iree_hal_resource_t* const*)&buffer,
+      iree_task_make_call_closure(iree_hal_task_device_queue_dealloca_cmd,
+                                  buffer));
 }
 
 static iree_status_t iree_hal_task_device_queue_execute(
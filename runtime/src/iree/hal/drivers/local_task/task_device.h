@@ -10,6 +10,7 @@
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
 #include "iree/hal/local/executable_loader.h"
+#include "iree/hal/utils/shm_channel.h"
 #include "iree/task/executor.h"
 
 #ifdef __cplusplus
@@ -23,6 +24,15 @@ typedef struct iree_hal_task_device_params_t {
   // Larger sizes will lower overhead and ensure the heap isn't hit for
   // transient allocations while also increasing memory consumption.
   iree_host_size_t arena_block_size;
+
+  // Maximum total size, in bytes, of memory released by queue_dealloca that
+  // is retained for reuse by subsequent queue_alloca requests.
+  iree_device_size_t transient_pool_capacity;
+
+  // Options used when creating collective channels. Channels communicate
+  // through shared memory with other devices in the same process by default
+  // and may be configured to include devices in other processes on the host.
+  iree_hal_shm_channel_options_t channel_options;
 } iree_hal_task_device_params_t;
 
 // Initializes |out_params| to default values.
@@ -0,0 +1,227 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/local_task/task_device.h"
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/task/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+static constexpr size_t kElementCount = 1000;
+
+static iree_hal_collective_op_t MakeOp(
+    iree_hal_collective_kind_t kind,
+    iree_hal_collective_reduction_t reduction =
+        IREE_HAL_COLLECTIVE_REDUCTION_NONE) {
+  iree_hal_collective_op_t op;
+  op.packed = 0;
+  op.kind = kind;
+  op.reduction = reduction;
+  op.element_type = IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32;
+  return op;
+}
+
+// Runs |fn| on |count| threads, each with its own local-task device acting as
+// one rank. Each device has its own executor with multiple workers so that
+// unordered work in a command buffer could run concurrently.
+static void RunRanks(
+    int32_t count,
+    std::function<void(iree_hal_device_t* device, int32_t rank)> fn) {
+  std::vector<std::thread> threads;
+  for (int32_t rank = 0; rank < count; ++rank) {
+    threads.emplace_back([&, rank]() {
+      iree_task_topology_t topology;
+      iree_task_topology_initialize_from_group_count(/*group_count=*/2,
+                                                     &topology);
+      iree_task_executor_options_t executor_options;
+      iree_task_executor_options_initialize(&executor_options);
+      iree_task_executor_t* executor = NULL;
+      IREE_ASSERT_OK(iree_task_executor_create(
+          executor_options, &topology, iree_allocator_system(), &executor));
+      iree_task_topology_deinitialize(&topology);
+
+      iree_hal_allocator_t* device_allocator = NULL;
+      IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+          IREE_SV("local"), iree_allocator_system(), iree_allocator_system(),
+          &device_allocator));
+
+      iree_hal_task_device_params_t params;
+      iree_hal_task_device_params_initialize(&params);
+      iree_hal_device_t* device = NULL;
+      IREE_ASSERT_OK(iree_hal_task_device_create(
+          IREE_SV("local-task"), &params, /*queue_count=*/1, &executor,
+          /*loader_count=*/0, /*loaders=*/NULL, device_allocator,
+          iree_allocator_system(), &device));
+      iree_hal_allocator_release(device_allocator);
+      iree_task_executor_release(executor);
+
+      fn(device, rank);
+
+      iree_hal_device_release(device);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+static iree_hal_buffer_t* AllocateBuffer(iree_hal_device_t* device,
+                                         const std::vector<int32_t>& contents) {
+  iree_hal_buffer_params_t params = {0};
+  params.type =
+      IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+  params.usage = IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE |
+                 IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+      iree_hal_device_allocator(device), params,
+      contents.size() * sizeof(int32_t),
+      iree_make_const_byte_span(contents.data(),
+                                contents.size() * sizeof(int32_t)),
+      &buffer));
+  return buffer;
+}
+
+static std::vector<int32_t> ReadBuffer(iree_hal_buffer_t* buffer) {
+  std::vector<int32_t> contents(iree_hal_buffer_byte_length(buffer) /
+                                sizeof(int32_t));
+  IREE_CHECK_OK(iree_hal_buffer_map_read(buffer, 0, contents.data(),
+                                         contents.size() * sizeof(int32_t)));
+  return contents;
+}
+
+static iree_hal_buffer_binding_t MakeBinding(iree_hal_buffer_t* buffer) {
+  iree_hal_buffer_binding_t binding = {0};
+  binding.buffer = buffer;
+  binding.offset = 0;
+  binding.length = iree_hal_buffer_byte_length(buffer);
+  return binding;
+}
+
+// Submits |command_buffer| and waits for it to complete.
+static void SubmitAndWait(iree_hal_device_t* device,
+                          iree_hal_command_buffer_t* command_buffer) {
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device, 0ull, &semaphore));
+  uint64_t signal_value = 1ull;
+  iree_hal_semaphore_list_t signal_semaphores = {1, &semaphore, &signal_value};
+  IREE_ASSERT_OK(iree_hal_device_queue_execute(
+      device, IREE_HAL_QUEUE_AFFINITY_ANY, iree_hal_semaphore_list_empty(),
+      signal_semaphores, 1, &command_buffer));
+  IREE_ASSERT_OK(
+      iree_hal_semaphore_wait(semaphore, 1ull, iree_infinite_timeout()));
+  iree_hal_semaphore_release(semaphore);
+}
+
+// Collectives on the same channel recorded without barriers between them must
+// still execute in the order recorded on all ranks while other work in the
+// command buffer is left unordered.
+static void RunCollectives(iree_hal_command_buffer_mode_t mode,
+                           const char* group, int32_t count,
+                           int submission_count) {
+  RunRanks(count, [&](iree_hal_device_t* device, int32_t rank) {
+    iree_hal_channel_params_t params = {0};
+    params.group = iree_make_cstring_view(group);
+    params.rank = rank;
+    params.count = count;
+    iree_hal_channel_t* channel = NULL;
+    IREE_ASSERT_OK(iree_hal_channel_create(
+        device, IREE_HAL_QUEUE_AFFINITY_ANY, params, &channel));
+    EXPECT_EQ(iree_hal_channel_rank(channel), rank);
+    EXPECT_EQ(iree_hal_channel_count(channel), count);
+
+    iree_hal_buffer_t* send_buffer =
+        AllocateBuffer(device, std::vector<int32_t>(kElementCount, rank + 1));
+    iree_hal_buffer_t* reduce_buffer =
+        AllocateBuffer(device, std::vector<int32_t>(kElementCount, -1));
+    iree_hal_buffer_t* gather_buffer =
+        AllocateBuffer(device, std::vector<int32_t>(kElementCount * count, -1));
+    iree_hal_buffer_t* fill_buffer =
+        AllocateBuffer(device, std::vector<int32_t>(kElementCount, -1));
+
+    iree_hal_command_buffer_t* command_buffer = NULL;
+    IREE_ASSERT_OK(iree_hal_command_buffer_create(
+        device, mode,
+        IREE_HAL_COMMAND_CATEGORY_DISPATCH | IREE_HAL_COMMAND_CATEGORY_TRANSFER,
+        IREE_HAL_QUEUE_AFFINITY_ANY, /*binding_capacity=*/0, &command_buffer));
+    IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+    IREE_ASSERT_OK(iree_hal_command_buffer_collective(
+        command_buffer, channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+        /*param=*/0, MakeBinding(send_buffer), MakeBinding(reduce_buffer),
+        kElementCount));
+    const int32_t pattern = 42;
+    IREE_ASSERT_OK(iree_hal_command_buffer_fill_buffer(
+        command_buffer, fill_buffer, 0,
+        iree_hal_buffer_byte_length(fill_buffer), &pattern, sizeof(pattern)));
+    IREE_ASSERT_OK(iree_hal_command_buffer_collective(
+        command_buffer, channel, MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_GATHER),
+        /*param=*/0, MakeBinding(send_buffer), MakeBinding(gather_buffer),
+        kElementCount));
+    IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+
+    for (int i = 0; i < submission_count; ++i) {
+      SubmitAndWait(device, command_buffer);
+      const int32_t sum = count * (count + 1) / 2;
+      EXPECT_EQ(ReadBuffer(reduce_buffer),
+                std::vector<int32_t>(kElementCount, sum));
+      std::vector<int32_t> gathered = ReadBuffer(gather_buffer);
+      for (int32_t r = 0; r < count; ++r) {
+        auto begin = gathered.begin() + r * kElementCount;
+        EXPECT_EQ(std::vector<int32_t>(begin, begin + kElementCount),
+                  std::vector<int32_t>(kElementCount, r + 1));
+      }
+      EXPECT_EQ(ReadBuffer(fill_buffer),
+                std::vector<int32_t>(kElementCount, pattern));
+    }
+
+    iree_hal_command_buffer_release(command_buffer);
+    iree_hal_buffer_release(fill_buffer);
+    iree_hal_buffer_release(gather_buffer);
+    iree_hal_buffer_release(reduce_buffer);
+    iree_hal_buffer_release(send_buffer);
+    iree_hal_channel_release(channel);
+  });
+}
+
+TEST(TaskDeviceTest, CollectivesOneShot) {
+  RunCollectives(IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT, "collectives_one_shot",
+                 /*count=*/3, /*submission_count=*/1);
+}
+
+TEST(TaskDeviceTest, CollectivesReusable) {
+  RunCollectives(/*mode=*/0, "collectives_reusable",
+                 /*count=*/2, /*submission_count=*/3);
+}
+
+TEST(TaskDeviceTest, CreateChannelRequiresGroupOrProvider) {
+  RunRanks(1, [](iree_hal_device_t* device, int32_t rank) {
+    iree_hal_channel_params_t params = {0};
+    params.rank = 0;
+    params.count = 1;
+    iree_hal_channel_t* channel = NULL;
+    EXPECT_THAT(Status(iree_hal_channel_create(
+                    device, IREE_HAL_QUEUE_AFFINITY_ANY, params, &channel)),
+                StatusIs(StatusCode::kInvalidArgument));
+    EXPECT_EQ(channel, nullptr);
+  });
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
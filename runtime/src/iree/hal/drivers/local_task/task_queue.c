@@ -450,6 +450,29 @@ void iree_hal_task_queue_trim(iree_hal_task_queue_t* queue) {
   iree_task_executor_trim(queue->executor);
 }
 
+// Submits |head_task| to the executor such that it is only issued after all
+// waits in the optional |wait_cmd| have been satisfied.
+static void iree_hal_task_queue_submit_sequenced(
+    iree_hal_task_queue_t* queue, iree_hal_task_queue_wait_cmd_t* wait_cmd,
+    iree_task_t* head_task) {
+  iree_task_submission_t submission;
+  iree_task_submission_initialize(&submission);
+
+  // Sequencing: wait on semaphores or go directly into the executor queue.
+  if (wait_cmd != NULL) {
+    // Ensure that we only issue the head after all waits have completed.
+    iree_task_set_completion_task(&wait_cmd->task.header, head_task);
+    iree_task_submission_enqueue(&submission, &wait_cmd->task.header);
+  } else {
+    // No waits needed; directly enqueue.
+    iree_task_submission_enqueue(&submission, head_task);
+  }
+
+  // Submit the tasks immediately. The executor may queue them up until we
+  // force the flush after all batches have been processed.
+  iree_task_executor_submit(queue->executor, &submission);
+}
+
 static iree_status_t iree_hal_task_queue_submit_batch(
     iree_hal_task_queue_t* queue, const iree_hal_submission_batch_t* batch) {
   // Task to retire the submission and free the transient memory allocated for
@@ -497,24 +520,9 @@ static iree_status_t iree_hal_task_queue_submit_batch(
     return status;
   }
 
-  iree_task_submission_t submission;
-  iree_task_submission_initialize(&submission);
-
-  // Sequencing: wait on semaphores or go directly into the executor queue.
   iree_task_t* head_task =
       issue_cmd ? &issue_cmd->task.header : &retire_cmd->task.header;
-  if (wait_cmd != NULL) {
-    // Ensure that we only issue command buffers after all waits have completed.
-    iree_task_set_completion_task(&wait_cmd->task.header, head_task);
-    iree_task_submission_enqueue(&submission, &wait_cmd->task.header);
-  } else {
-    // No waits needed; directly enqueue.
-    iree_task_submission_enqueue(&submission, head_task);
-  }
-
-  // Submit the tasks immediately. The executor may queue them up until we
-  // force the flush after all batches have been processed.
-  iree_task_executor_submit(queue->executor, &submission);
+  iree_hal_task_queue_submit_sequenced(queue, wait_cmd, head_task);
   return iree_ok_status();
 }
 
@@ -546,6 +554,55 @@ iree_status_t iree_hal_task_queue_submit(
   return status;
 }
 
+iree_status_t iree_hal_task_queue_submit_callback(
+    iree_hal_task_queue_t* queue, iree_hal_semaphore_list_t wait_semaphores,
+    iree_hal_semaphore_list_t signal_semaphores,
+    iree_host_size_t resource_count, iree_hal_resource_t* const* resources,
+    iree_task_call_closure_t callback) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Task to retire the operation and signal the semaphores. As with batches
+  // its arena is used for all of the other tasks required.
+  iree_hal_task_queue_retire_cmd_t* retire_cmd = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_task_queue_retire_cmd_allocate(
+              &queue->scope, resource_count, resources, &signal_semaphores,
+              queue->block_pool, &retire_cmd));
+
+  // NOTE: if we fail from here on we must drop the retire_cmd arena.
+  iree_task_fence_t* fence = NULL;
+  iree_status_t status =
+      iree_task_executor_acquire_fence(queue->executor, &queue->scope, &fence);
+  if (iree_status_is_ok(status)) {
+    iree_task_set_completion_task(&retire_cmd->task.header, &fence->header);
+  }
+
+  iree_hal_task_queue_wait_cmd_t* wait_cmd = NULL;
+  if (iree_status_is_ok(status) && wait_semaphores.count > 0) {
+    status = iree_hal_task_queue_wait_cmd_allocate(
+        &queue->scope, &wait_semaphores, &retire_cmd->arena, &wait_cmd);
+  }
+
+  // Task calling the callback once all waits have been satisfied.
+  iree_task_call_t* call_task = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_arena_allocate(&retire_cmd->arena, sizeof(*call_task),
+                                 (void**)&call_task);
+  }
+  if (iree_status_is_ok(status)) {
+    iree_task_call_initialize(&queue->scope, callback, call_task);
+    iree_task_set_completion_task(&call_task->header,
+                                  &retire_cmd->task.header);
+    iree_hal_task_queue_submit_sequenced(queue, wait_cmd, &call_task->header);
+    iree_task_executor_flush(queue->executor);
+  } else {
+    iree_arena_deinitialize(&retire_cmd->arena);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 iree_status_t iree_hal_task_queue_wait_idle(iree_hal_task_queue_t* queue,
                                             iree_timeout_t timeout) {
   IREE_TRACE_ZONE_BEGIN(z0);
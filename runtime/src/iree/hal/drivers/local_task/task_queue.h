@@ -52,6 +52,16 @@ iree_status_t iree_hal_task_queue_submit(
     iree_hal_task_queue_t* queue, iree_host_size_t batch_count,
     const iree_hal_submission_batch_t* batches);
 
+// Submits a queue-ordered |callback| that is called from the executor once all
+// |wait_semaphores| have been satisfied. |signal_semaphores| are signaled after
+// the callback returns or failed if it returns an error. |resources| are
+// retained until the operation retires and may be referenced by the callback.
+iree_status_t iree_hal_task_queue_submit_callback(
+    iree_hal_task_queue_t* queue, iree_hal_semaphore_list_t wait_semaphores,
+    iree_hal_semaphore_list_t signal_semaphores,
+    iree_host_size_t resource_count, iree_hal_resource_t* const* resources,
+    iree_task_call_closure_t callback);
+
 iree_status_t iree_hal_task_queue_wait_idle(iree_hal_task_queue_t* queue,
                                             iree_timeout_t timeout);
 
@@ -0,0 +1,395 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/local_task/task_transient_pool.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/hal/detail.h"
+
+// Maximum number of unused allocations retained by a pool.
+#define IREE_HAL_TASK_TRANSIENT_POOL_FREE_LIST_CAPACITY 64
+
+//===----------------------------------------------------------------------===//
+// iree_hal_task_transient_pool_t
+//===----------------------------------------------------------------------===//
+
+IREE_TRACE(static const char* IREE_HAL_TASK_TRANSIENT_POOL_ID =
+               "Free Transient Memory");
+
+struct iree_hal_task_transient_pool_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+
+  // Maximum total size of unused allocations retained in the free list.
+  iree_device_size_t max_free_size;
+
+  // Guards the free list. Never held during device allocator operations.
+  iree_slim_mutex_t mutex;
+
+  // Total size, in bytes, of all buffers in the free list.
+  iree_device_size_t free_size;
+
+  // Flat MRU list of unused backing buffers sorted by ascending recency.
+  iree_host_size_t free_count;
+  iree_hal_buffer_t* free_buffers[IREE_HAL_TASK_TRANSIENT_POOL_FREE_LIST_CAPACITY];
+};
+
+iree_status_t iree_hal_task_transient_pool_create(
+    iree_device_size_t max_free_size, iree_allocator_t host_allocator,
+    iree_hal_task_transient_pool_t** out_pool) {
+  IREE_ASSERT_ARGUMENT(out_pool);
+  *out_pool = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_task_transient_pool_t* pool = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*pool), (void**)&pool);
+  if (iree_status_is_ok(status)) {
+    memset(pool, 0, sizeof(*pool));
+    iree_atomic_ref_count_init(&pool->ref_count);
+    pool->host_allocator = host_allocator;
+    pool->max_free_size = max_free_size;
+    iree_slim_mutex_initialize(&pool->mutex);
+    IREE_TRACE_SET_PLOT_TYPE(IREE_HAL_TASK_TRANSIENT_POOL_ID,
+                             IREE_TRACING_PLOT_TYPE_MEMORY, /*step=*/true,
+                             /*fill=*/true, /*color=*/0);
+    *out_pool = pool;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_task_transient_pool_destroy(
+    iree_hal_task_transient_pool_t* pool) {
+  iree_allocator_t host_allocator = pool->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_task_transient_pool_trim(pool);
+  iree_slim_mutex_deinitialize(&pool->mutex);
+  iree_allocator_free(host_allocator, pool);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+void iree_hal_task_transient_pool_retain(iree_hal_task_transient_pool_t* pool) {
+  if (IREE_LIKELY(pool)) {
+    iree_atomic_ref_count_inc(&pool->ref_count);
+  }
+}
+
+void iree_hal_task_transient_pool_release(
+    iree_hal_task_transient_pool_t* pool) {
+  if (IREE_LIKELY(pool) && iree_atomic_ref_count_dec(&pool->ref_count) == 1) {
+    iree_hal_task_transient_pool_destroy(pool);
+  }
+}
+
+// Takes the buffer in the |pool| free list at index |i| and returns ownership.
+//
+// Must be called with the pool mutex held.
+static iree_hal_buffer_t* iree_hal_task_transient_pool_take_buffer_at(
+    iree_hal_task_transient_pool_t* pool, iree_host_size_t i) {
+  iree_hal_buffer_t* buffer = pool->free_buffers[i];
+  if (i < pool->free_count - 1) {
+    memmove(&pool->free_buffers[i], &pool->free_buffers[i + 1],
+            (pool->free_count - i - 1) * sizeof(pool->free_buffers[0]));
+  }
+  --pool->free_count;
+  pool->free_size -= iree_hal_buffer_allocation_size(buffer);
+  IREE_TRACE_PLOT_VALUE_I64(IREE_HAL_TASK_TRANSIENT_POOL_ID, pool->free_size);
+  return buffer;
+}
+
+// Scans the |pool| free list for the smallest buffer that can service a request
+// with |params| and |allocation_size| and returns ownership. Buffers more than
+// twice the requested size are skipped to avoid pinning large allocations with
+// small requests.
+//
+// Must be called with the pool mutex held.
+static iree_hal_buffer_t* iree_hal_task_transient_pool_find_and_take_buffer(
+    iree_hal_task_transient_pool_t* pool,
+    iree_hal_allocator_t* device_allocator,
+    const iree_hal_buffer_params_t* params,
+    iree_device_size_t allocation_size) {
+  iree_host_size_t best_index = IREE_HOST_SIZE_MAX;
+  iree_device_size_t best_size = IREE_DEVICE_SIZE_MAX;
+  // Walk backwards so that ties prefer the most recently released buffers.
+  for (int i = (int)pool->free_count - 1; i >= 0; --i) {
+    iree_hal_buffer_t* buffer = pool->free_buffers[i];
+    iree_device_size_t buffer_size = iree_hal_buffer_allocation_size(buffer);
+    if (buffer_size < allocation_size || buffer_size / 2 > allocation_size ||
+        buffer_size >= best_size) {
+      continue;
+    }
+    if (buffer->device_allocator == device_allocator &&
+        iree_all_bits_set(iree_hal_buffer_memory_type(buffer), params->type) &&
+        iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer),
+                          params->usage) &&
+        iree_all_bits_set(iree_hal_buffer_allowed_access(buffer),
+                          params->access)) {
+      best_index = (iree_host_size_t)i;
+      best_size = buffer_size;
+      if (buffer_size == allocation_size) break;  // exact match
+    }
+  }
+  if (best_index == IREE_HOST_SIZE_MAX) return NULL;
+  return iree_hal_task_transient_pool_take_buffer_at(pool, best_index);
+}
+
+// Returns ownership of |buffer| to the |pool| free list if there is capacity
+// remaining and otherwise releases it to its device allocator.
+static void iree_hal_task_transient_pool_recycle(
+    iree_hal_task_transient_pool_t* pool, iree_hal_buffer_t* buffer) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(
+      z0, (int64_t)iree_hal_buffer_allocation_size(buffer));
+
+  iree_slim_mutex_lock(&pool->mutex);
+  const iree_device_size_t allocation_size =
+      iree_hal_buffer_allocation_size(buffer);
+  if (pool->free_size + allocation_size <= pool->max_free_size) {
+    // Evict the oldest buffer to make room if the list is full.
+    iree_hal_buffer_t* evicted_buffer = NULL;
+    if (pool->free_count == IREE_ARRAYSIZE(pool->free_buffers)) {
+      evicted_buffer = iree_hal_task_transient_pool_take_buffer_at(pool, 0);
+    }
+    pool->free_buffers[pool->free_count++] = buffer;
+    pool->free_size += allocation_size;
+    IREE_TRACE_PLOT_VALUE_I64(IREE_HAL_TASK_TRANSIENT_POOL_ID, pool->free_size);
+    buffer = evicted_buffer;
+  }
+  iree_slim_mutex_unlock(&pool->mutex);
+
+  // Release outside of the lock as deallocation can be slow.
+  iree_hal_buffer_release(buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+void iree_hal_task_transient_pool_trim(iree_hal_task_transient_pool_t* pool) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_slim_mutex_lock(&pool->mutex);
+  while (pool->free_count > 0) {
+    iree_hal_buffer_t* dead_buffer =
+        iree_hal_task_transient_pool_take_buffer_at(pool, 0);
+    iree_slim_mutex_unlock(&pool->mutex);
+    iree_hal_buffer_release(dead_buffer);
+    iree_slim_mutex_lock(&pool->mutex);
+  }
+  iree_slim_mutex_unlock(&pool->mutex);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_task_transient_buffer_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_task_transient_buffer_t {
+  iree_hal_buffer_t base;
+
+  // Pool the backing buffer is returned to on decommit.
+  iree_hal_task_transient_pool_t* pool;
+
+  // Committed backing buffer (iree_hal_buffer_t*) or 0 if decommitted.
+  // Exchanged atomically so that a decommit racing with the handle being
+  // destroyed only returns the backing buffer to the pool once.
+  iree_atomic_intptr_t committed_buffer;
+} iree_hal_task_transient_buffer_t;
+
+static const iree_hal_buffer_vtable_t iree_hal_task_transient_buffer_vtable;
+
+static iree_hal_task_transient_buffer_t* iree_hal_task_transient_buffer_cast(
+    iree_hal_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_task_transient_buffer_vtable);
+  return (iree_hal_task_transient_buffer_t*)base_value;
+}
+
+iree_status_t iree_hal_task_transient_pool_allocate(
+    iree_hal_task_transient_pool_t* pool,
+    iree_hal_allocator_t* device_allocator, iree_hal_buffer_params_t params,
+    iree_device_size_t allocation_size, iree_hal_buffer_t** out_buffer) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_ASSERT_ARGUMENT(device_allocator);
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  *out_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)allocation_size);
+
+  iree_hal_task_transient_buffer_t* buffer = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(pool->host_allocator, sizeof(*buffer),
+                                (void**)&buffer));
+
+  // Reuse an allocation whose dealloca has executed if possible; otherwise
+  // allocate new backing memory without holding the lock.
+  iree_slim_mutex_lock(&pool->mutex);
+  iree_hal_buffer_t* backing_buffer =
+      iree_hal_task_transient_pool_find_and_take_buffer(
+          pool, device_allocator, &params, allocation_size);
+  iree_slim_mutex_unlock(&pool->mutex);
+  iree_status_t status = iree_ok_status();
+  if (!backing_buffer) {
+    status = iree_hal_allocator_allocate_buffer(device_allocator, params,
+                                                allocation_size,
+                                                iree_const_byte_span_empty(),
+                                                &backing_buffer);
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_hal_buffer_initialize(
+        pool->host_allocator, /*device_allocator=*/NULL, &buffer->base,
+        allocation_size, /*byte_offset=*/0, allocation_size,
+        iree_hal_buffer_memory_type(backing_buffer),
+        iree_hal_buffer_allowed_access(backing_buffer),
+        iree_hal_buffer_allowed_usage(backing_buffer),
+        &iree_hal_task_transient_buffer_vtable, &buffer->base);
+    buffer->pool = pool;
+    iree_hal_task_transient_pool_retain(pool);
+    iree_atomic_store_intptr(&buffer->committed_buffer,
+                             (intptr_t)backing_buffer,
+                             iree_memory_order_release);
+    *out_buffer = &buffer->base;
+  } else {
+    iree_allocator_free(pool->host_allocator, buffer);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_task_transient_buffer_destroy(
+    iree_hal_buffer_t* base_buffer) {
+  iree_hal_task_transient_buffer_t* buffer =
+      iree_hal_task_transient_buffer_cast(base_buffer);
+  iree_allocator_t host_allocator = base_buffer->host_allocator;
+  iree_hal_task_transient_pool_t* pool = buffer->pool;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // If the buffer was never deallocated on the queue we return the backing
+  // memory now; no outstanding work can reference it as all users retain the
+  // handle.
+  iree_hal_task_transient_buffer_decommit(base_buffer);
+  iree_allocator_free(host_allocator, buffer);
+  iree_hal_task_transient_pool_release(pool);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_hal_task_transient_buffer_isa(iree_hal_buffer_t* buffer) {
+  return iree_hal_resource_is(buffer, &iree_hal_task_transient_buffer_vtable);
+}
+
+void iree_hal_task_transient_buffer_decommit(iree_hal_buffer_t* base_buffer) {
+  iree_hal_task_transient_buffer_t* buffer =
+      iree_hal_task_transient_buffer_cast(base_buffer);
+  iree_hal_buffer_t* backing_buffer =
+      (iree_hal_buffer_t*)iree_atomic_exchange_intptr(
+          &buffer->committed_buffer, 0, iree_memory_order_acq_rel);
+  if (backing_buffer) {
+    iree_hal_task_transient_pool_recycle(buffer->pool, backing_buffer);
+  }
+}
+
+// Returns the committed backing buffer of |buffer| or fails if the buffer has
+// been deallocated.
+static iree_status_t iree_hal_task_transient_buffer_resolve(
+    iree_hal_buffer_t* base_buffer, iree_hal_buffer_t** out_backing_buffer) {
+  iree_hal_task_transient_buffer_t* buffer =
+      iree_hal_task_transient_buffer_cast(base_buffer);
+  *out_backing_buffer = (iree_hal_buffer_t*)iree_atomic_load_intptr(
+      &buffer->committed_buffer, iree_memory_order_acquire);
+  if (IREE_UNLIKELY(!*out_backing_buffer)) {
+    return iree_make_status(
+        IREE_STATUS_FAILED_PRECONDITION,
+        "transient buffer accessed after its queue_dealloca executed");
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_task_transient_buffer_map_range(
+    iree_hal_buffer_t* base_buffer, iree_hal_mapping_mode_t mapping_mode,
+    iree_hal_memory_access_t memory_access,
+    iree_device_size_t local_byte_offset, iree_device_size_t local_byte_length,
+    iree_hal_buffer_mapping_t* mapping) {
+  iree_hal_buffer_t* backing_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_transient_buffer_resolve(base_buffer, &backing_buffer));
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(backing_buffer);
+  IREE_RETURN_IF_ERROR(
+      IREE_HAL_VTABLE_DISPATCH(allocated_buffer, iree_hal_buffer, map_range)(
+          allocated_buffer, mapping_mode, memory_access,
+          iree_hal_buffer_byte_offset(backing_buffer) + local_byte_offset,
+          local_byte_length, mapping));
+  // Scoped mappings keep the backing buffer live until unmapped in case the
+  // buffer is decommitted while mapped.
+  if (!iree_all_bits_set(mapping_mode, IREE_HAL_MAPPING_MODE_PERSISTENT)) {
+    iree_hal_buffer_retain(allocated_buffer);
+    mapping->impl.reserved[0] = (uint64_t)(uintptr_t)allocated_buffer;
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_task_transient_buffer_unmap_range(
+    iree_hal_buffer_t* base_buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length, iree_hal_buffer_mapping_t* mapping) {
+  iree_hal_buffer_t* allocated_buffer =
+      (iree_hal_buffer_t*)(uintptr_t)mapping->impl.reserved[0];
+  if (!allocated_buffer) return iree_ok_status();
+  mapping->impl.reserved[0] = 0;
+  iree_status_t status = IREE_HAL_VTABLE_DISPATCH(
+      allocated_buffer, iree_hal_buffer, unmap_range)(
+      allocated_buffer, local_byte_offset, local_byte_length, mapping);
+  iree_hal_buffer_release(allocated_buffer);
+  return status;
+}
+
+static iree_status_t iree_hal_task_transient_buffer_invalidate_range(
+    iree_hal_buffer_t* base_buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  iree_hal_buffer_t* backing_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_transient_buffer_resolve(base_buffer, &backing_buffer));
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(backing_buffer);
+  return IREE_HAL_VTABLE_DISPATCH(allocated_buffer, iree_hal_buffer,
+                                  invalidate_range)(
+      allocated_buffer,
+      iree_hal_buffer_byte_offset(backing_buffer) + local_byte_offset,
+      local_byte_length);
+}
+
+static iree_status_t iree_hal_task_transient_buffer_flush_range(
+    iree_hal_buffer_t* base_buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  iree_hal_buffer_t* backing_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_transient_buffer_resolve(base_buffer, &backing_buffer));
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(backing_buffer);
+  return IREE_HAL_VTABLE_DISPATCH(allocated_buffer, iree_hal_buffer,
+                                  flush_range)(
+      allocated_buffer,
+      iree_hal_buffer_byte_offset(backing_buffer) + local_byte_offset,
+      local_byte_length);
+}
+
+static const iree_hal_buffer_vtable_t iree_hal_task_transient_buffer_vtable = {
+    .recycle = iree_hal_buffer_recycle,
+    .destroy = iree_hal_task_transient_buffer_destroy,
+    .map_range = iree_hal_task_transient_buffer_map_range,
+    .unmap_range = iree_hal_task_transient_buffer_unmap_range,
+    .invalidate_range = iree_hal_task_transient_buffer_invalidate_range,
+    .flush_range = iree_hal_task_transient_buffer_flush_range,
+};
@@ -0,0 +1,79 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_LOCAL_TASK_TASK_TRANSIENT_POOL_H_
+#define IREE_HAL_DRIVERS_LOCAL_TASK_TASK_TRANSIENT_POOL_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_task_transient_pool_t
+//===----------------------------------------------------------------------===//
+
+// A stream-ordered pool of device allocations backing queue_alloca buffers.
+//
+// Buffers returned from the pool are lightweight handles that reference a
+// committed backing allocation. The backing allocation is detached from the
+// handle and returned to the pool when the queue_dealloca operation executes
+// on the queue (after its wait semaphores are satisfied) regardless of how
+// long the user keeps the handle alive. Subsequent queue_alloca requests will
+// reuse returned allocations before going to the device allocator.
+//
+// Backing memory is committed when the allocation is requested instead of when
+// the queue_alloca operation executes as command buffers resolve their bindings
+// at recording time. Because a returned allocation is only reused once its
+// dealloca has executed it is safe to hand it to a new allocation that will
+// only be used after its own alloca has been signaled.
+//
+// Thread-safe: allocations may be requested from any thread while deallocations
+// are performed by executor workers.
+typedef struct iree_hal_task_transient_pool_t iree_hal_task_transient_pool_t;
+
+// Creates a transient pool retaining at most |max_free_size| bytes of unused
+// allocations.
+iree_status_t iree_hal_task_transient_pool_create(
+    iree_device_size_t max_free_size, iree_allocator_t host_allocator,
+    iree_hal_task_transient_pool_t** out_pool);
+
+// Retains the given |pool| for the caller.
+void iree_hal_task_transient_pool_retain(iree_hal_task_transient_pool_t* pool);
+
+// Releases the given |pool| from the caller.
+void iree_hal_task_transient_pool_release(iree_hal_task_transient_pool_t* pool);
+
+// Releases all unused allocations in |pool| back to their device allocators.
+void iree_hal_task_transient_pool_trim(iree_hal_task_transient_pool_t* pool);
+
+// Allocates a transient buffer of |allocation_size| with backing memory either
+// reused from |pool| or allocated from |device_allocator|.
+iree_status_t iree_hal_task_transient_pool_allocate(
+    iree_hal_task_transient_pool_t* pool,
+    iree_hal_allocator_t* device_allocator, iree_hal_buffer_params_t params,
+    iree_device_size_t allocation_size, iree_hal_buffer_t** out_buffer);
+
+//===----------------------------------------------------------------------===//
+// Transient buffers
+//===----------------------------------------------------------------------===//
+
+// Returns true if |buffer| was allocated from an
+// iree_hal_task_transient_pool_t.
+bool iree_hal_task_transient_buffer_isa(iree_hal_buffer_t* buffer);
+
+// Detaches the backing allocation from the transient |buffer| and returns it to
+// the pool it was allocated from. Any further access to |buffer| will fail.
+// No-op if the buffer has already been decommitted.
+void iree_hal_task_transient_buffer_decommit(iree_hal_buffer_t* buffer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_LOCAL_TASK_TASK_TRANSIENT_POOL_H_
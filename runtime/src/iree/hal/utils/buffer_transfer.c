@@ -10,45 +10,42 @@
 // Transfer utilities
 //===----------------------------------------------------------------------===//
 
-// Synchronously executes one or more transfer operations against a queue.
+// Submits one or more transfer operations against a queue without waiting.
 // All buffers must be compatible with |device| and ranges must not overlap
 // (same as with memcpy).
 //
-// This is a blocking operation and may incur significant overheads as
-// internally it issues a command buffer with the transfer operations and waits
-// for it to complete. Users should do that themselves so that the work can be
-// issued concurrently and batched effectively. This is only useful as a
-// fallback for implementations that require it or tools where things like I/O
-// are transferred without worrying about performance. When submitting other
-// work it's preferable to use iree_hal_create_transfer_command_buffer and a
-// normal queue submission that allows for more fine-grained sequencing and
-// amortizes the submission cost by batching other work.
-//
-// The transfer will begin after the optional |wait_semaphore| reaches
-// |wait_value|. Behavior is undefined if no semaphore is provided and there are
-// in-flight operations concurrently using the buffer ranges.
-// Returns only after all transfers have completed and been flushed.
-static iree_status_t iree_hal_device_transfer_and_wait(
-    iree_hal_device_t* device, iree_hal_semaphore_t* wait_semaphore,
-    uint64_t wait_value, iree_host_size_t transfer_count,
-    const iree_hal_transfer_command_t* transfer_commands,
-    iree_timeout_t timeout) {
+// The transfer will begin after all of |wait_semaphore_list| have been reached
+// and |signal_semaphore_list| will be signaled when it completes. Behavior is
+// undefined if no wait semaphores are provided and there are in-flight
+// operations concurrently using the buffer ranges.
+static iree_status_t iree_hal_device_submit_transfer(
+    iree_hal_device_t* device, iree_hal_semaphore_list_t wait_semaphore_list,
+    iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_host_size_t transfer_count,
+    const iree_hal_transfer_command_t* transfer_commands) {
   IREE_ASSERT_ARGUMENT(device);
   IREE_ASSERT_ARGUMENT(!transfer_count || transfer_commands);
   IREE_TRACE_ZONE_BEGIN(z0);
 
   // We only want to allow inline execution if we have not been instructed to
-  // wait on a semaphore and it hasn't yet been signaled.
+  // wait on a semaphore that hasn't yet been signaled.
   iree_hal_command_buffer_mode_t mode = IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT;
-  if (wait_semaphore) {
+  bool allow_inline_execution = true;
+  for (iree_host_size_t i = 0; i < wait_semaphore_list.count; ++i) {
     uint64_t current_value = 0ull;
     IREE_RETURN_AND_END_ZONE_IF_ERROR(
-        z0, iree_hal_semaphore_query(wait_semaphore, &current_value));
-    if (current_value >= wait_value) {
-      mode |= IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION;
+        z0, iree_hal_semaphore_query(wait_semaphore_list.semaphores[i],
+                                     &current_value));
+    if (current_value < wait_semaphore_list.payload_values[i]) {
+      allow_inline_execution = false;
+      break;
     }
-  } else {
+  }
+  if (allow_inline_execution) {
+    // Inline command buffers must not be submitted with waits; all of ours
+    // have already been reached so they can be dropped.
     mode |= IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION;
+    wait_semaphore_list = iree_hal_semaphore_list_empty();
   }
 
   // Create a command buffer performing all of the transfer operations.
@@ -58,39 +55,275 @@ static iree_status_t iree_hal_device_transfer_and_wait(
               device, mode, IREE_HAL_QUEUE_AFFINITY_ANY, transfer_count,
               transfer_commands, &command_buffer));
 
+  // On devices with multiple queues this can run out-of-order/overlapped with
+  // other work.
+  iree_status_t status = iree_hal_device_queue_execute(
+      device, IREE_HAL_QUEUE_AFFINITY_ANY, wait_semaphore_list,
+      signal_semaphore_list, 1, &command_buffer);
+
+  iree_hal_command_buffer_release(command_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Synchronously executes one or more transfer operations against a queue.
+// All buffers must be compatible with |device| and ranges must not overlap
+// (same as with memcpy).
+//
+// This is a blocking operation and may incur significant overheads as
+// internally it issues a command buffer with the transfer operations and waits
+// for it to complete. Users should do that themselves so that the work can be
+// issued concurrently and batched effectively. This is only useful as a
+// fallback for implementations that require it or tools where things like I/O
+// are transferred without worrying about performance. When submitting other
+// work it's preferable to use iree_hal_create_transfer_command_buffer and a
+// normal queue submission that allows for more fine-grained sequencing and
+// amortizes the submission cost by batching other work.
+//
+// Behavior is undefined if there are in-flight operations concurrently using
+// the buffer ranges.
+// Returns only after all transfers have completed and been flushed.
+static iree_status_t iree_hal_device_transfer_and_wait(
+    iree_hal_device_t* device, iree_host_size_t transfer_count,
+    const iree_hal_transfer_command_t* transfer_commands,
+    iree_timeout_t timeout) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
   // Perform a full submit-and-wait. On devices with multiple queues this can
   // run out-of-order/overlapped with other work and return earlier than device
   // idle.
   iree_hal_semaphore_t* fence_semaphore = NULL;
-  iree_status_t status =
-      iree_hal_semaphore_create(device, 0ull, &fence_semaphore);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_semaphore_create(device, 0ull, &fence_semaphore));
   uint64_t signal_value = 1ull;
-  if (iree_status_is_ok(status)) {
-    iree_hal_semaphore_list_t wait_semaphores = {
-        .count = wait_semaphore != NULL ? 1 : 0,
-        .semaphores = &wait_semaphore,
-        .payload_values = &wait_value,
-    };
-    iree_hal_semaphore_list_t signal_semaphores = {
-        .count = 1,
-        .semaphores = &fence_semaphore,
-        .payload_values = &signal_value,
-    };
-    status = iree_hal_device_queue_execute(device, IREE_HAL_QUEUE_AFFINITY_ANY,
-                                           wait_semaphores, signal_semaphores,
-                                           1, &command_buffer);
-  }
+  iree_hal_semaphore_list_t signal_semaphores = {
+      .count = 1,
+      .semaphores = &fence_semaphore,
+      .payload_values = &signal_value,
+  };
+  iree_status_t status = iree_hal_device_submit_transfer(
+      device, iree_hal_semaphore_list_empty(), signal_semaphores,
+      transfer_count, transfer_commands);
   if (iree_status_is_ok(status)) {
     status = iree_hal_semaphore_wait(fence_semaphore, signal_value, timeout);
   }
 
-  iree_hal_command_buffer_release(command_buffer);
   iree_hal_semaphore_release(fence_semaphore);
 
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
 
+// Returns true if |buffer| can be mapped into host memory (or is host memory).
+static bool iree_hal_transfer_buffer_is_mappable(
+    iree_hal_transfer_buffer_t buffer) {
+  return !buffer.device_buffer ||
+         (iree_all_bits_set(iree_hal_buffer_memory_type(buffer.device_buffer),
+                            IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) &&
+          iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer.device_buffer),
+                            IREE_HAL_BUFFER_USAGE_MAPPING));
+}
+
+// Tries to import |host_buffer| as a device-visible buffer usable for
+// transfers. Returns NULL if the device cannot import the host memory for any
+// reason (unsupported, unaligned, out of pinnable memory, etc) and staging is
+// required instead. Import is only a fast path and never fails the transfer.
+static iree_hal_buffer_t* iree_hal_transfer_try_import_host_buffer(
+    iree_hal_device_t* device, iree_byte_span_t host_buffer) {
+  iree_hal_external_buffer_t external_buffer = {
+      .type = IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION,
+      .flags = IREE_HAL_EXTERNAL_BUFFER_FLAG_NONE,
+      .size = host_buffer.data_length,
+      .handle.host_allocation.ptr = host_buffer.data,
+  };
+  const iree_hal_buffer_params_t params = {
+      .type =
+          IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE,
+      .usage = IREE_HAL_BUFFER_USAGE_TRANSFER,
+  };
+  iree_hal_buffer_t* buffer = NULL;
+  iree_status_t status = iree_hal_allocator_import_buffer(
+      iree_hal_device_allocator(device), params, &external_buffer,
+      iree_hal_buffer_release_callback_null(), &buffer);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    return NULL;
+  }
+  return buffer;
+}
+
+// State shared by the chunks of a staged transfer.
+typedef struct iree_hal_transfer_staging_ring_t {
+  iree_hal_device_t* device;
+  // Timeline tracking chunk completion: chunk i signals i+1.
+  iree_hal_semaphore_t* semaphore;
+  // Staging buffer with |slot_count| chunks of |chunk_size| each.
+  iree_hal_buffer_t* staging_buffer;
+  // Device buffer being uploaded to or downloaded from.
+  iree_hal_buffer_t* device_buffer;
+  iree_device_size_t device_offset;
+  bool is_upload;
+  iree_device_size_t data_length;
+  iree_device_size_t chunk_size;
+  iree_device_size_t slot_count;
+} iree_hal_transfer_staging_ring_t;
+
+// Submits the device copy of chunk |chunk_index| between its staging ring slot
+// and the device buffer. Device copies are chained so that the semaphore
+// reaching a value implies that all prior chunks have completed and their
+// slots are available for reuse.
+static iree_status_t iree_hal_device_submit_staged_chunk(
+    const iree_hal_transfer_staging_ring_t* ring,
+    iree_device_size_t chunk_index) {
+  iree_device_size_t chunk_offset = chunk_index * ring->chunk_size;
+  iree_device_size_t chunk_length =
+      iree_min(ring->chunk_size, ring->data_length - chunk_offset);
+  iree_device_size_t slot_offset =
+      (chunk_index % ring->slot_count) * ring->chunk_size;
+  iree_hal_transfer_command_t transfer_command = {
+      .type = IREE_HAL_TRANSFER_COMMAND_TYPE_COPY,
+      .copy =
+          {
+              .length = chunk_length,
+          },
+  };
+  if (ring->is_upload) {
+    transfer_command.copy.source_buffer = ring->staging_buffer;
+    transfer_command.copy.source_offset = slot_offset;
+    transfer_command.copy.target_buffer = ring->device_buffer;
+    transfer_command.copy.target_offset = ring->device_offset + chunk_offset;
+  } else {
+    transfer_command.copy.source_buffer = ring->device_buffer;
+    transfer_command.copy.source_offset = ring->device_offset + chunk_offset;
+    transfer_command.copy.target_buffer = ring->staging_buffer;
+    transfer_command.copy.target_offset = slot_offset;
+  }
+  iree_hal_semaphore_t* semaphore = ring->semaphore;
+  uint64_t wait_value = (uint64_t)chunk_index;
+  uint64_t signal_value = (uint64_t)chunk_index + 1;
+  iree_hal_semaphore_list_t wait_semaphores = {
+      .count = chunk_index > 0 ? 1 : 0,
+      .semaphores = &semaphore,
+      .payload_values = &wait_value,
+  };
+  iree_hal_semaphore_list_t signal_semaphores = {
+      .count = 1,
+      .semaphores = &semaphore,
+      .payload_values = &signal_value,
+  };
+  return iree_hal_device_submit_transfer(ring->device, wait_semaphores,
+                                         signal_semaphores, 1,
+                                         &transfer_command);
+}
+
+// Transfers between host memory and a device buffer by staging through a ring
+// of reusable chunks of a single device-visible host-local staging buffer.
+// Host copies into/out of one chunk overlap with device copies of the others.
+// Exactly one of |source| or |target| must be host memory.
+static iree_status_t iree_hal_device_transfer_staged_range(
+    iree_hal_device_t* device, iree_hal_transfer_buffer_t source,
+    iree_device_size_t source_offset, iree_hal_transfer_buffer_t target,
+    iree_device_size_t target_offset, iree_device_size_t data_length,
+    iree_timeout_t timeout) {
+  IREE_ASSERT(!source.device_buffer != !target.device_buffer);
+  if (data_length == 0) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (uint64_t)data_length);
+
+  const bool is_upload = !source.device_buffer;
+  const iree_device_size_t chunk_size =
+      iree_min(data_length, IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE);
+  const iree_device_size_t chunk_count =
+      (data_length + chunk_size - 1) / chunk_size;
+  const iree_device_size_t slot_count =
+      iree_min(chunk_count, IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT);
+
+  // Operations within the ring are bounded by a single deadline.
+  timeout = iree_make_deadline(iree_timeout_as_deadline_ns(timeout));
+
+  // Allocate the staging ring. Uploads never read back from it and downloads
+  // never write to it from the host so we don't need the contents initialized.
+  const iree_hal_buffer_params_t staging_params = {
+      .type =
+          IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE,
+      .usage = IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING,
+  };
+  iree_hal_buffer_t* staging_buffer = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_allocator_allocate_buffer(
+              iree_hal_device_allocator(device), staging_params,
+              slot_count * chunk_size, iree_const_byte_span_empty(),
+              &staging_buffer));
+
+  // Chunk i signals the semaphore to i+1 when its device copy completes.
+  iree_hal_semaphore_t* semaphore = NULL;
+  iree_status_t status = iree_hal_semaphore_create(device, 0ull, &semaphore);
+  const iree_hal_transfer_staging_ring_t ring = {
+      .device = device,
+      .semaphore = semaphore,
+      .staging_buffer = staging_buffer,
+      .device_buffer = is_upload ? target.device_buffer : source.device_buffer,
+      .device_offset = is_upload ? target_offset : source_offset,
+      .is_upload = is_upload,
+      .data_length = data_length,
+      .chunk_size = chunk_size,
+      .slot_count = slot_count,
+  };
+
+  if (is_upload) {
+    // Fill each slot from the host and submit its copy to the device. Before
+    // reusing a slot we wait for the copy of the chunk that last used it.
+    for (iree_device_size_t i = 0; i < chunk_count; ++i) {
+      if (!iree_status_is_ok(status)) break;
+      if (i >= slot_count) {
+        status =
+            iree_hal_semaphore_wait(semaphore, i - slot_count + 1, timeout);
+        if (!iree_status_is_ok(status)) break;
+      }
+      iree_device_size_t chunk_offset = i * chunk_size;
+      status = iree_hal_buffer_map_write(
+          staging_buffer, (i % slot_count) * chunk_size,
+          source.host_buffer.data + source_offset + chunk_offset,
+          iree_min(chunk_size, data_length - chunk_offset));
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_device_submit_staged_chunk(&ring, i);
+      }
+    }
+  } else {
+    // Prime the ring with as many chunks as there are slots and then as each
+    // completes read it back to the host and reuse its slot for the next one.
+    for (iree_device_size_t i = 0; i < slot_count; ++i) {
+      if (!iree_status_is_ok(status)) break;
+      status = iree_hal_device_submit_staged_chunk(&ring, i);
+    }
+    for (iree_device_size_t i = 0; i < chunk_count; ++i) {
+      if (!iree_status_is_ok(status)) break;
+      status = iree_hal_semaphore_wait(semaphore, i + 1, timeout);
+      if (!iree_status_is_ok(status)) break;
+      iree_device_size_t chunk_offset = i * chunk_size;
+      status = iree_hal_buffer_map_read(
+          staging_buffer, (i % slot_count) * chunk_size,
+          target.host_buffer.data + target_offset + chunk_offset,
+          iree_min(chunk_size, data_length - chunk_offset));
+      if (iree_status_is_ok(status) && i + slot_count < chunk_count) {
+        status = iree_hal_device_submit_staged_chunk(&ring, i + slot_count);
+      }
+    }
+  }
+
+  // Wait for all device copies to complete. Downloads have already waited.
+  if (iree_status_is_ok(status) && is_upload) {
+    status = iree_hal_semaphore_wait(semaphore, chunk_count, timeout);
+  }
+
+  iree_hal_semaphore_release(semaphore);
+  iree_hal_buffer_release(staging_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_device_transfer_range implementations
 //===----------------------------------------------------------------------===//
@@ -103,23 +336,9 @@ IREE_API_EXPORT iree_status_t iree_hal_device_submit_transfer_range_and_wait(
   // If the source and target are both mappable into host memory (or are host
   // memory) then we can use the fast zero-alloc path. This may actually be
   // slower than doing a device queue transfer depending on the size of the data
-  // and where the memory lives. For example, if we have two device buffers in
-  // device-local host-visible memory we'd be performing the transfer by pulling
-  // all the memory to the CPU and pushing it back again.
-  // TODO(benvanik): check for device-local -> device-local and avoid mapping.
-  bool is_source_mappable =
-      !source.device_buffer ||
-      (iree_all_bits_set(iree_hal_buffer_memory_type(source.device_buffer),
-                         IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) &&
-       iree_all_bits_set(iree_hal_buffer_allowed_usage(source.device_buffer),
-                         IREE_HAL_BUFFER_USAGE_MAPPING));
-  bool is_target_mappable =
-      !target.device_buffer ||
-      (iree_all_bits_set(iree_hal_buffer_memory_type(target.device_buffer),
-                         IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) &&
-       iree_all_bits_set(iree_hal_buffer_allowed_usage(target.device_buffer),
-                         IREE_HAL_BUFFER_USAGE_MAPPING));
-  if (is_source_mappable && is_target_mappable) {
+  // and where the memory lives.
+  if (iree_hal_transfer_buffer_is_mappable(source) &&
+      iree_hal_transfer_buffer_is_mappable(target)) {
     return iree_hal_device_transfer_mappable_range(
         device, source, source_offset, target, target_offset, data_length,
         flags, timeout);
@@ -141,80 +360,70 @@ IREE_API_EXPORT iree_status_t iree_hal_device_submit_transfer_range_and_wait(
                 .length = data_length,
             },
     };
-    return iree_hal_device_transfer_and_wait(device, /*wait_semaphore=*/NULL,
-                                             /*wait_value=*/0ull, 1,
-                                             &transfer_command, timeout);
+    return iree_hal_device_transfer_and_wait(device, 1, &transfer_command,
+                                             timeout);
   }
 
-  iree_status_t status = iree_ok_status();
-
-  // Allocate the staging buffer for upload to the device.
-  iree_hal_buffer_t* source_buffer = source.device_buffer;
-  if (!source_buffer) {
-    // Allocate staging memory with a copy of the host data. We only initialize
-    // the portion being transferred.
-    // TODO(benvanik): use import if supported to avoid the allocation/copy.
-    // TODO(benvanik): make this device-local + host-visible? can be better for
-    // uploads as we know we are never going to read it back.
-    const iree_hal_buffer_params_t source_params = {
-        .type = IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
-                IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE,
-        .usage = IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING,
-    };
-    status = iree_hal_allocator_allocate_buffer(
-        iree_hal_device_allocator(device), source_params, data_length,
-        iree_make_const_byte_span(source.host_buffer.data + source_offset,
-                                  data_length),
-        &source_buffer);
-    source_offset = 0;
-  }
-
-  // Allocate the staging buffer for download from the device.
-  iree_hal_buffer_t* target_buffer = target.device_buffer;
-  if (!target_buffer) {
-    // Allocate uninitialized staging memory for the transfer target.
-    // We only allocate enough for the portion we are transfering.
-    // TODO(benvanik): use import if supported to avoid the allocation/copy.
-    const iree_hal_buffer_params_t target_params = {
-        .type = IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
-                IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE,
-        .usage = IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING,
-    };
-    status = iree_hal_allocator_allocate_buffer(
-        iree_hal_device_allocator(device), target_params, data_length,
-        iree_const_byte_span_empty(), &target_buffer);
-    target_offset = 0;
-  }
-
-  // Issue synchronous device copy.
-  if (iree_status_is_ok(status)) {
+  // Device to device transfers where either side can't be mapped go through
+  // the queue. The device copies directly and nothing round-trips through the
+  // host.
+  if (source.device_buffer && target.device_buffer) {
     const iree_hal_transfer_command_t transfer_command = {
         .type = IREE_HAL_TRANSFER_COMMAND_TYPE_COPY,
         .copy =
             {
-                .source_buffer = source_buffer,
+                .source_buffer = source.device_buffer,
                 .source_offset = source_offset,
-                .target_buffer = target_buffer,
+                .target_buffer = target.device_buffer,
                 .target_offset = target_offset,
                 .length = data_length,
             },
     };
-    status = iree_hal_device_transfer_and_wait(device, /*wait_semaphore=*/NULL,
-                                               /*wait_value=*/0ull, 1,
-                                               &transfer_command, timeout);
+    return iree_hal_device_transfer_and_wait(device, 1, &transfer_command,
+                                             timeout);
   }
 
-  // Read back the staging buffer into memory, if needed.
-  if (iree_status_is_ok(status) && !target.device_buffer) {
-    status = iree_hal_buffer_map_read(target_buffer, 0, target.host_buffer.data,
-                                      data_length);
+  // Prefer importing the host memory so that the device can copy directly
+  // to/from it without any staging. The device aliases the caller memory
+  // during the copy so we only do this when we are guaranteed to wait for
+  // completion: a timeout would otherwise leave the copy in-flight. Importing
+  // may pin the host pages and that is only worth it for large transfers;
+  // smaller ones are staged with a single host copy.
+  if (iree_timeout_is_infinite(timeout) &&
+      data_length >= IREE_HAL_TRANSFER_IMPORT_MIN_SIZE) {
+    iree_hal_transfer_buffer_t host = source.device_buffer ? target : source;
+    iree_device_size_t host_offset =
+        source.device_buffer ? target_offset : source_offset;
+    iree_hal_buffer_t* import_buffer = iree_hal_transfer_try_import_host_buffer(
+        device,
+        iree_make_byte_span(host.host_buffer.data + host_offset, data_length));
+    if (import_buffer) {
+      const iree_hal_transfer_command_t transfer_command = {
+          .type = IREE_HAL_TRANSFER_COMMAND_TYPE_COPY,
+          .copy =
+              {
+                  .source_buffer =
+                      source.device_buffer ? source.device_buffer
+                                           : import_buffer,
+                  .source_offset = source.device_buffer ? source_offset : 0,
+                  .target_buffer =
+                      target.device_buffer ? target.device_buffer
+                                           : import_buffer,
+                  .target_offset = target.device_buffer ? target_offset : 0,
+                  .length = data_length,
+              },
+      };
+      iree_status_t status = iree_hal_device_transfer_and_wait(
+          device, 1, &transfer_command, timeout);
+      iree_hal_buffer_release(import_buffer);
+      return status;
+    }
   }
 
-  // Discard staging buffers, if they were required.
-  if (!source.device_buffer) iree_hal_buffer_release(source_buffer);
-  if (!target.device_buffer) iree_hal_buffer_release(target_buffer);
-
-  return status;
+  // Stage through a ring of host-local device-visible chunks.
+  return iree_hal_device_transfer_staged_range(device, source, source_offset,
+                                               target, target_offset,
+                                               data_length, timeout);
 }
 
 IREE_API_EXPORT iree_status_t iree_hal_device_transfer_mappable_range(
@@ -18,11 +18,36 @@ extern "C" {
 // iree_hal_device_transfer_range implementations
 //===----------------------------------------------------------------------===//
 
+// Size in bytes of each chunk used when staging transfers between host memory
+// and device buffers that cannot be mapped or imported.
+#if !defined(IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE)
+#define IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE (4 * 1024 * 1024)
+#endif  // !IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE
+
+// Total number of staging chunks in flight at a time. Host copies into or out
+// of one chunk overlap with device copies of the others.
+#if !defined(IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT)
+#define IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT 3
+#endif  // !IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT
+
+// Minimum size in bytes of a host transfer before the host memory is imported
+// for the device to access directly. Importing may pin the host pages on every
+// call and smaller transfers are cheaper to stage with a host copy.
+#if !defined(IREE_HAL_TRANSFER_IMPORT_MIN_SIZE)
+#define IREE_HAL_TRANSFER_IMPORT_MIN_SIZE IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE
+#endif  // !IREE_HAL_TRANSFER_IMPORT_MIN_SIZE
+
 // Performs a full transfer operation on a device transfer queue.
-// This creates a transfer command buffer, submits it against the device, and
-// waits for it to complete synchronously. Implementations that can do this
+// This creates transfer command buffers, submits them against the device, and
+// waits for them to complete synchronously. Implementations that can do this
 // cheaper are encouraged to do so.
 //
+// Buffers that are all mappable are copied on the host. Device to device
+// transfers where either side is not mappable are performed on the device.
+// Large host transfers import the host memory when the device supports it and
+// otherwise host memory is staged in chunks through a small ring of staging
+// memory so that host copies overlap with device copies.
+//
 // Precondition: source and target do not overlap.
 IREE_API_EXPORT iree_status_t iree_hal_device_submit_transfer_range_and_wait(
     iree_hal_device_t* device, iree_hal_transfer_buffer_t source,
@@ -0,0 +1,191 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/buffer_transfer.h"
+
+#include <cstring>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/tooling/device_util.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+class BufferTransferTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    iree_hal_driver_t* driver = NULL;
+    iree_status_t status = iree_hal_driver_registry_try_create(
+        iree_hal_available_driver_registry(), IREE_SV("local-sync"),
+        iree_allocator_system(), &driver);
+    if (iree_status_is_not_found(status)) {
+      iree_status_free(status);
+      GTEST_SKIP() << "'local-sync' driver not available";
+    }
+    IREE_ASSERT_OK(status);
+    IREE_ASSERT_OK(iree_hal_driver_create_default_device(
+        driver, iree_allocator_system(), &device_));
+    iree_hal_driver_release(driver);
+  }
+
+  void TearDown() override { iree_hal_device_release(device_); }
+
+  // Allocates a device-local buffer that does not allow mapping so that
+  // transfers to and from it cannot take the mappable path. The heap allocator
+  // makes everything it allocates mappable so the buffer wraps host storage
+  // directly instead.
+  iree_hal_buffer_t* AllocateUnmappableBuffer(iree_device_size_t size) {
+    void* storage = NULL;
+    IREE_CHECK_OK(iree_allocator_malloc_aligned(
+        iree_allocator_system(), (iree_host_size_t)size,
+        IREE_HAL_HEAP_BUFFER_ALIGNMENT, 0, &storage));
+    iree_hal_buffer_release_callback_t release_callback = {ReleaseStorage,
+                                                           storage};
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_heap_buffer_wrap(
+        iree_hal_device_allocator(device_), IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL,
+        IREE_HAL_MEMORY_ACCESS_ALL, IREE_HAL_BUFFER_USAGE_TRANSFER, size,
+        iree_make_byte_span(storage, (iree_host_size_t)size),
+        release_callback, &buffer));
+    return buffer;
+  }
+
+  static void ReleaseStorage(void* user_data, iree_hal_buffer_t* buffer) {
+    iree_allocator_free_aligned(iree_allocator_system(), user_data);
+  }
+
+  // Uploads |source| into |buffer| and reads it back with |timeout|.
+  std::vector<uint8_t> RoundTrip(iree_hal_buffer_t* buffer,
+                                 const std::vector<uint8_t>& source,
+                                 iree_timeout_t timeout) {
+    IREE_CHECK_OK(iree_hal_device_submit_transfer_range_and_wait(
+        device_,
+        iree_hal_make_host_transfer_buffer_span((void*)source.data(),
+                                                source.size()),
+        0, iree_hal_make_device_transfer_buffer(buffer), 0, source.size(),
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, timeout));
+    std::vector<uint8_t> result(source.size());
+    IREE_CHECK_OK(iree_hal_device_submit_transfer_range_and_wait(
+        device_, iree_hal_make_device_transfer_buffer(buffer), 0,
+        iree_hal_make_host_transfer_buffer_span(result.data(), result.size()),
+        0, result.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, timeout));
+    return result;
+  }
+
+  static std::vector<uint8_t> MakePattern(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = (uint8_t)(i * 31 + 7);
+    return data;
+  }
+
+  iree_hal_device_t* device_ = NULL;
+};
+
+// Infinite timeouts allow importing the host memory directly for large
+// transfers. The host memory must meet the heap buffer alignment to be
+// importable and no staging buffers are allocated when it is.
+TEST_F(BufferTransferTest, ImportedRoundTrip) {
+  auto pattern = MakePattern(IREE_HAL_TRANSFER_IMPORT_MIN_SIZE + 3);
+  uint8_t* source = NULL;
+  uint8_t* result = NULL;
+  IREE_ASSERT_OK(iree_allocator_malloc_aligned(
+      iree_allocator_system(), pattern.size(), IREE_HAL_HEAP_BUFFER_ALIGNMENT,
+      0, (void**)&source));
+  IREE_ASSERT_OK(iree_allocator_malloc_aligned(
+      iree_allocator_system(), pattern.size(), IREE_HAL_HEAP_BUFFER_ALIGNMENT,
+      0, (void**)&result));
+  memcpy(source, pattern.data(), pattern.size());
+  memset(result, 0, pattern.size());
+  iree_hal_buffer_t* buffer = AllocateUnmappableBuffer(pattern.size());
+
+  iree_hal_allocator_statistics_t before;
+  iree_hal_allocator_query_statistics(iree_hal_device_allocator(device_),
+                                      &before);
+  IREE_ASSERT_OK(iree_hal_device_submit_transfer_range_and_wait(
+      device_, iree_hal_make_host_transfer_buffer_span(source, pattern.size()),
+      0, iree_hal_make_device_transfer_buffer(buffer), 0, pattern.size(),
+      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+  IREE_ASSERT_OK(iree_hal_device_submit_transfer_range_and_wait(
+      device_, iree_hal_make_device_transfer_buffer(buffer), 0,
+      iree_hal_make_host_transfer_buffer_span(result, pattern.size()), 0,
+      pattern.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  iree_hal_allocator_statistics_t after;
+  iree_hal_allocator_query_statistics(iree_hal_device_allocator(device_),
+                                      &after);
+  EXPECT_EQ(std::memcmp(result, pattern.data(), pattern.size()), 0);
+#if IREE_STATISTICS_ENABLE
+  // Imported host memory is wrapped and not allocated by the device allocator.
+  EXPECT_EQ(after.host_bytes_allocated, before.host_bytes_allocated);
+  EXPECT_EQ(after.device_bytes_allocated, before.device_bytes_allocated);
+#endif  // IREE_STATISTICS_ENABLE
+
+  iree_hal_buffer_release(buffer);
+  iree_allocator_free_aligned(iree_allocator_system(), result);
+  iree_allocator_free_aligned(iree_allocator_system(), source);
+}
+
+// Transfers under the import threshold are staged even with infinite timeouts.
+TEST_F(BufferTransferTest, SmallRoundTrip) {
+  auto source = MakePattern(IREE_HAL_COMMAND_BUFFER_MAX_UPDATE_SIZE * 2 + 3);
+  iree_hal_buffer_t* buffer = AllocateUnmappableBuffer(source.size());
+  EXPECT_EQ(RoundTrip(buffer, source, iree_infinite_timeout()), source);
+  iree_hal_buffer_release(buffer);
+}
+
+// Finite timeouts always stage; sizes cover a partial ring, a full ring, and
+// wrapping around the ring multiple times with a partial final chunk.
+TEST_F(BufferTransferTest, StagedRoundTrip) {
+  const iree_device_size_t sizes[] = {
+      IREE_HAL_COMMAND_BUFFER_MAX_UPDATE_SIZE + 1,
+      IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE *
+          IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT,
+      IREE_HAL_TRANSFER_STAGING_CHUNK_SIZE *
+              (IREE_HAL_TRANSFER_STAGING_CHUNK_COUNT * 2 + 1) +
+          123,
+  };
+  for (iree_device_size_t size : sizes) {
+    auto source = MakePattern(size);
+    iree_hal_buffer_t* buffer = AllocateUnmappableBuffer(source.size());
+    EXPECT_EQ(RoundTrip(buffer, source, iree_make_timeout_ms(60 * 1000)),
+              source);
+    iree_hal_buffer_release(buffer);
+  }
+}
+
+// Unmappable device to device transfers go through the queue.
+TEST_F(BufferTransferTest, DeviceToDevice) {
+  auto source = MakePattern(1024);
+  iree_hal_buffer_t* source_buffer = AllocateUnmappableBuffer(source.size());
+  iree_hal_buffer_t* target_buffer = AllocateUnmappableBuffer(source.size());
+  IREE_ASSERT_OK(iree_hal_device_submit_transfer_range_and_wait(
+      device_,
+      iree_hal_make_host_transfer_buffer_span(source.data(), source.size()), 0,
+      iree_hal_make_device_transfer_buffer(source_buffer), 0, source.size(),
+      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+  IREE_ASSERT_OK(iree_hal_device_submit_transfer_range_and_wait(
+      device_, iree_hal_make_device_transfer_buffer(source_buffer), 0,
+      iree_hal_make_device_transfer_buffer(target_buffer), 0, source.size(),
+      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+  std::vector<uint8_t> result(source.size());
+  IREE_ASSERT_OK(iree_hal_device_submit_transfer_range_and_wait(
+      device_, iree_hal_make_device_transfer_buffer(target_buffer), 0,
+      iree_hal_make_host_transfer_buffer_span(result.data(), result.size()), 0,
+      result.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  EXPECT_EQ(result, source);
+  iree_hal_buffer_release(target_buffer);
+  iree_hal_buffer_release(source_buffer);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
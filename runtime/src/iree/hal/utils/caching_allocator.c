@@ -6,11 +6,66 @@
 
 #include "iree/hal/utils/caching_allocator.h"
 
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/math.h"
 #include "iree/base/internal/synchronization.h"
 
+// NOTE: threading support is optional.
+#if IREE_SYNCHRONIZATION_DISABLE_UNSAFE
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_LOCAL
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201102L) && \
+    !__STDC_NO_THREADS__
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_LOCAL _Thread_local
+#elif defined(IREE_COMPILER_MSVC)
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_LOCAL __declspec(thread)
+#else
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_LOCAL
+#endif  // IREE_SYNCHRONIZATION_DISABLE_UNSAFE
+
 // Default capacity of a pool free list when not specified by the user.
 #define IREE_HAL_CACHING_ALLOCATOR_DEFAULT_FREE_LIST_CAPACITY 64
 
+// Default percentage of a cached buffer that may go unused when reused for a
+// smaller request. Matches the worst-case granularity of the size classes.
+#define IREE_HAL_CACHING_ALLOCATOR_DEFAULT_MAX_WASTE_PERCENTAGE 25
+
+// Default maximum size of an allocation retained in the thread caches.
+// Small allocations are the most frequent and the most sensitive to pool lock
+// contention while large allocations are better tracked by the shared pool.
+#define IREE_HAL_CACHING_ALLOCATOR_DEFAULT_MAX_THREAD_CACHE_ALLOCATION_SIZE \
+  (64 * 1024)
+
+// Number of thread caches per pool. Threads are assigned to caches round-robin
+// and threads beyond this count share caches.
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_COUNT 16
+
+// Number of buffers each thread cache can hold.
+#define IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_SLOT_COUNT 4
+
+// Number of bits used to subdivide each power-of-two size range into size
+// classes. With 2 bits each range [2^n, 2^(n+1)) is split into 4 classes.
+#define IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_SUBDIVISION_BITS 2
+
+// Total number of size classes required to cover all 64-bit sizes.
+#define IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT 256
+
+// Returns the size class of |size|. Size classes are ordered such that all
+// sizes in class N are smaller than all sizes in class N+1.
+static iree_host_size_t iree_hal_caching_allocator_size_class(
+    iree_device_size_t size) {
+  const int subdivision_bits =
+      IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_SUBDIVISION_BITS;
+  if (size < (1u << subdivision_bits)) return (iree_host_size_t)size;
+  const int log2_size =
+      63 - iree_math_count_leading_zeros_u64((uint64_t)size);
+  const iree_host_size_t subdivision =
+      (iree_host_size_t)(size >> (log2_size - subdivision_bits)) &
+      ((1u << subdivision_bits) - 1);
+  return ((iree_host_size_t)(log2_size - subdivision_bits + 1)
+          << subdivision_bits) +
+         subdivision;
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_caching_allocator_pool_t
 //===----------------------------------------------------------------------===//
@@ -28,18 +83,83 @@ void iree_hal_caching_allocator_pool_params_initialize(
   out_params->max_allocation_capacity = IREE_DEVICE_SIZE_MAX;
   out_params->max_free_allocation_count =
       IREE_HAL_CACHING_ALLOCATOR_DEFAULT_FREE_LIST_CAPACITY;
+  out_params->max_waste_percentage =
+      IREE_HAL_CACHING_ALLOCATOR_DEFAULT_MAX_WASTE_PERCENTAGE;
+  out_params->max_thread_cache_allocation_size =
+      IREE_HAL_CACHING_ALLOCATOR_DEFAULT_MAX_THREAD_CACHE_ALLOCATION_SIZE;
 }
 
+// Returns the index of the thread cache assigned to the calling thread.
+// Threads are assigned an index on first use and keep it for their lifetime so
+// that buffers released by a thread are available to it again.
+static iree_host_size_t iree_hal_caching_allocator_thread_cache_index(void) {
+  static iree_atomic_int32_t next_ordinal = IREE_ATOMIC_VAR_INIT(0);
+  static IREE_HAL_CACHING_ALLOCATOR_THREAD_LOCAL int32_t thread_ordinal = 0;
+  if (IREE_UNLIKELY(thread_ordinal == 0)) {
+    thread_ordinal = iree_atomic_fetch_add_int32(&next_ordinal, 1,
+                                                 iree_memory_order_relaxed) +
+                     1;
+  }
+  return (iree_host_size_t)(thread_ordinal - 1) %
+         IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_COUNT;
+}
+
+// A small set of free buffers that can be handed off between threads without
+// taking the pool lock. Each slot holds a retained buffer or 0 and ownership is
+// transferred by atomically exchanging the slot. The slot sizes are hints
+// written after a buffer is published and are used to select a buffer without
+// taking ownership of those that would not fit; they may be stale.
+//
+// Sized and aligned to a single cache line so that threads don't contend on
+// each other's caches.
+typedef iree_alignas(iree_hardware_destructive_interference_size) struct
+    iree_hal_caching_allocator_thread_cache_t {
+  iree_atomic_intptr_t
+      buffers[IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_SLOT_COUNT];
+  iree_atomic_int64_t sizes[IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_SLOT_COUNT];
+} iree_hal_caching_allocator_thread_cache_t;
+
+// A free buffer retained by a pool.
+// Entries are linked into both the list of their size class and the recency
+// list spanning all classes. Unused entries are kept in a singly-linked list
+// threaded through |class_next|.
+typedef struct iree_hal_caching_allocator_entry_t {
+  iree_hal_buffer_t* buffer;
+  // Size class of the buffer allocation size.
+  iree_host_size_t size_class;
+  // Neighbors in the size class list; ordered from most to least recent.
+  struct iree_hal_caching_allocator_entry_t* class_prev;
+  struct iree_hal_caching_allocator_entry_t* class_next;
+  // Neighbors in the pool recency list; ordered from most to least recent.
+  struct iree_hal_caching_allocator_entry_t* recent_prev;
+  struct iree_hal_caching_allocator_entry_t* recent_next;
+} iree_hal_caching_allocator_entry_t;
+
 // Pool of arbitrarily-sized device allocations for a particular heap.
 // This maintains a free list of blocks available for use but does not track
 // outstanding allocations.
 //
+// Small buffers are first released to and acquired from a per-thread cache in
+// front of the free list. Buffers held in thread caches are still counted as
+// allocated by the pool and are returned to the free list when the pool needs
+// to trim. They count against max_free_allocation_count along with those in
+// the free list. Releases to a thread cache check max_allocation_capacity
+// without the pool mutex and may briefly retain more than the capacity when
+// racing with other threads; acquisitions trim the pool (including the thread
+// caches) back to the capacity before allocating so the bound still holds for
+// new allocations.
+//
+// Free buffers are binned by size class so that lookups only need to visit the
+// classes that can satisfy a request instead of scanning every free buffer.
+// A request is serviced by the smallest compatible buffer that is at least as
+// large as requested and wastes no more than the configured percentage.
+//
 // Thread-safe. Pools can service requests from multiple threads concurrently by
 // way of a pool-specific mutex. The mutex will not be held during underlying
 // allocator operations such as when acquiring a new allocation as these can be
 // extremely slow and the underlying allocator is also assumed thread-safe.
-typedef iree_alignas(
-    iree_max_align_t) struct iree_hal_caching_allocator_pool_t {
+typedef iree_alignas(iree_hardware_destructive_interference_size) struct
+    iree_hal_caching_allocator_pool_t {
   // Defines which heap this pool allocates from and the pool limits.
   iree_hal_caching_allocator_pool_params_t params;
 
@@ -57,24 +177,77 @@ typedef iree_alignas(
 
   // Total size, in bytes, of all outstanding allocations made from this pool.
   // This only includes allocations we are able to pool as we otherwise cannot
-  // observe imported/exported buffers.
-  iree_device_size_t total_allocated_size;
+  // observe imported/exported buffers. Only modified with the mutex held but
+  // read without it by the thread caches.
+  iree_atomic_int64_t total_allocated_size;
 
-  // Total size, in bytes, of all free buffers currently in this pool.
+  // Total size, in bytes, of all free buffers currently in this pool free list.
+  // Buffers held in thread caches are not included.
   iree_device_size_t free_allocated_size;
 
-  // Flat MRU list of available buffers with max_free_allocation_count slots.
-  // Sorted by ascending recency (the higher the index the more recent).
-  // If we really cared about optimizing the interior removal then we'd want
-  // a linked/skip list or some bucketing but that's really for the higher
-  // level allocators to do.
+  // True if buffers may be retained in |thread_caches|.
+  bool thread_caching_enabled;
+
+  // Total number of free buffers retained in the free list and thread caches.
+  // Reserved prior to retaining a buffer so that the total never exceeds
+  // max_free_allocation_count.
+  iree_atomic_int32_t retained_count;
+
+  // Caches accessed without the pool mutex; indexed by the calling thread.
+  iree_hal_caching_allocator_thread_cache_t
+      thread_caches[IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_COUNT];
+
+#if IREE_STATISTICS_ENABLE
+  // Requests serviced by a free buffer in the pool.
+  uint64_t hit_count;
+  // Requests that required a new allocation from the underlying allocator.
+  uint64_t miss_count;
+  // Total bytes beyond the requested size in buffers reused from the pool.
+  iree_device_size_t wasted_size;
+  // Requests serviced by a thread cache; updated without the pool mutex.
+  iree_atomic_int64_t thread_cache_hit_count;
+  // Total bytes beyond the requested size in buffers reused from thread caches.
+  iree_atomic_int64_t thread_cache_wasted_size;
+#endif  // IREE_STATISTICS_ENABLE
+
+  // Most and least recently released free buffers.
+  iree_hal_caching_allocator_entry_t* recent_head;
+  iree_hal_caching_allocator_entry_t* recent_tail;
+
+  // Entries not currently holding a buffer.
+  iree_hal_caching_allocator_entry_t* unused_entries;
+
+  // One bit per size class indicating whether the class list is non-empty.
+  uint64_t class_bitmap[IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT / 64];
+
+  // Most recently released free buffer in each size class.
+  iree_hal_caching_allocator_entry_t*
+      class_heads[IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT];
+
+  // Storage for max_free_allocation_count entries.
   iree_host_size_t free_count;
-  iree_hal_buffer_t* free_buffers[];
+  iree_hal_caching_allocator_entry_t entries[];
 } iree_hal_caching_allocator_pool_t;
 
 static void iree_hal_caching_allocator_pool_trim(
     iree_hal_caching_allocator_pool_t* pool);
 
+// Returns the total size of all outstanding allocations made from |pool|.
+// May be called without the pool mutex in which case the value may be stale.
+static iree_device_size_t iree_hal_caching_allocator_pool_allocated_size(
+    iree_hal_caching_allocator_pool_t* pool) {
+  return (iree_device_size_t)iree_atomic_load_int64(
+      &pool->total_allocated_size, iree_memory_order_relaxed);
+}
+
+// Adds |delta| to the total size of outstanding allocations made from |pool|.
+// The pool mutex must be held by the caller.
+static void iree_hal_caching_allocator_pool_add_allocated_size(
+    iree_hal_caching_allocator_pool_t* pool, int64_t delta) {
+  iree_atomic_fetch_add_int64(&pool->total_allocated_size, delta,
+                              iree_memory_order_relaxed);
+}
+
 // Initializes a buffer pool in |out_pool|.
 // Buffer device storage will be allocated from |device_allocator|.
 static void iree_hal_caching_allocator_pool_initialize(
@@ -83,12 +256,25 @@ static void iree_hal_caching_allocator_pool_initialize(
     iree_hal_caching_allocator_pool_t* out_pool) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  memset(out_pool, 0, sizeof(*out_pool));
   out_pool->params = params;
   out_pool->device_allocator = device_allocator;
   iree_slim_mutex_initialize(&out_pool->mutex);
-  out_pool->total_allocated_size = 0;
+  iree_atomic_store_int64(&out_pool->total_allocated_size, 0,
+                          iree_memory_order_relaxed);
   out_pool->free_allocated_size = 0;
   out_pool->free_count = 0;
+  out_pool->thread_caching_enabled =
+      params.max_thread_cache_allocation_size > 0 &&
+      params.max_free_allocation_count > 0;
+  iree_atomic_store_int32(&out_pool->retained_count, 0,
+                          iree_memory_order_relaxed);
+  for (iree_host_size_t i = 0; i < params.max_free_allocation_count; ++i) {
+    iree_hal_caching_allocator_entry_t* entry = &out_pool->entries[i];
+    memset(entry, 0, sizeof(*entry));
+    entry->class_next = out_pool->unused_entries;
+    out_pool->unused_entries = entry;
+  }
 
   IREE_TRACE_SET_PLOT_TYPE(IREE_HAL_CACHING_ALLOCATOR_ID,
                            IREE_TRACING_PLOT_TYPE_MEMORY, /*step=*/true,
@@ -107,7 +293,7 @@ static void iree_hal_caching_allocator_pool_deinitialize(
   // Trim first to release all the buffers. There shouldn't be any live
   // allocations by the time we are deinitializing.
   iree_hal_caching_allocator_pool_trim(pool);
-  IREE_ASSERT_EQ(pool->total_allocated_size, 0,
+  IREE_ASSERT_EQ(iree_hal_caching_allocator_pool_allocated_size(pool), 0,
                  "must have released all allocations prior to deinit");
   IREE_ASSERT_EQ(pool->free_allocated_size, 0,
                  "must have released all allocations prior to deinit");
@@ -119,21 +305,67 @@ static void iree_hal_caching_allocator_pool_deinitialize(
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Reserves space for retaining one more free buffer in |pool|.
+// Returns false if max_free_allocation_count buffers are already retained.
+//
+// Thread-safe; does not acquire the pool mutex.
+static bool iree_hal_caching_allocator_pool_try_reserve_retained(
+    iree_hal_caching_allocator_pool_t* pool) {
+  int32_t count =
+      iree_atomic_load_int32(&pool->retained_count, iree_memory_order_relaxed);
+  do {
+    if ((iree_host_size_t)count >= pool->params.max_free_allocation_count) {
+      return false;
+    }
+  } while (!iree_atomic_compare_exchange_weak_int32(
+      &pool->retained_count, &count, count + 1, iree_memory_order_relaxed,
+      iree_memory_order_relaxed));
+  return true;
+}
+
+// Releases a reservation made with
+// iree_hal_caching_allocator_pool_try_reserve_retained.
+//
+// Thread-safe; does not acquire the pool mutex.
+static void iree_hal_caching_allocator_pool_unreserve_retained(
+    iree_hal_caching_allocator_pool_t* pool) {
+  iree_atomic_fetch_sub_int32(&pool->retained_count, 1,
+                              iree_memory_order_relaxed);
+}
+
 // Pushes |buffer| on to the pool free list as the most recently used.
-// The buffer will be retained in the list.
+// Ownership of the caller's reference to the buffer is transferred to the list.
+// The caller must have reserved the buffer with
+// iree_hal_caching_allocator_pool_try_reserve_retained.
 //
 // Must be called with the pool mutex held.
 static void iree_hal_caching_allocator_pool_push_buffer(
     iree_hal_caching_allocator_pool_t* pool, iree_hal_buffer_t* buffer) {
-  // Retain the buffer; the caller must release it to complete the ownership
-  // transfer.
-  iree_hal_buffer_retain(buffer);
-
   IREE_ASSERT_LT(pool->free_count, pool->params.max_free_allocation_count);
-
-  // Add to the end of the list (the most recent).
-  iree_host_size_t i = pool->free_count++;
-  pool->free_buffers[i] = buffer;
+  iree_hal_caching_allocator_entry_t* entry = pool->unused_entries;
+  pool->unused_entries = entry->class_next;
+  ++pool->free_count;
+  entry->buffer = buffer;
+  entry->size_class =
+      iree_hal_caching_allocator_size_class(buffer->allocation_size);
+
+  // Add to the front of the size class list (the most recent).
+  entry->class_prev = NULL;
+  entry->class_next = pool->class_heads[entry->size_class];
+  if (entry->class_next) entry->class_next->class_prev = entry;
+  pool->class_heads[entry->size_class] = entry;
+  pool->class_bitmap[entry->size_class / 64] |= 1ull
+                                                << (entry->size_class % 64);
+
+  // Add to the front of the recency list.
+  entry->recent_prev = NULL;
+  entry->recent_next = pool->recent_head;
+  if (pool->recent_head) {
+    pool->recent_head->recent_prev = entry;
+  } else {
+    pool->recent_tail = entry;
+  }
+  pool->recent_head = entry;
 
   // Track that we're now retaining unused memory.
   pool->free_allocated_size += buffer->allocation_size;
@@ -141,52 +373,303 @@ static void iree_hal_caching_allocator_pool_push_buffer(
                             pool->free_allocated_size);
 }
 
-// Takes the buffer in the |pool| free list at index |i| and returns ownership.
-// If the list is large this is bad but in most cases it's just a few dozen
-// elements.
+// Takes the buffer held by |entry| in the |pool| free list and returns
+// ownership.
 //
 // Must be called with the pool mutex held.
-static iree_hal_buffer_t* iree_hal_caching_allocator_pool_take_buffer_at(
-    iree_hal_caching_allocator_pool_t* pool, iree_host_size_t i) {
-  iree_hal_buffer_t* buffer = pool->free_buffers[i];
-  if (i < pool->free_count - 1) {
-    // Shift the list down to keep it dense and in ascending recency order.
-    memmove(&pool->free_buffers[i], &pool->free_buffers[i + 1],
-            (pool->free_count - i - 1) * sizeof(pool->free_buffers[0]));
+static iree_hal_buffer_t* iree_hal_caching_allocator_pool_take_entry(
+    iree_hal_caching_allocator_pool_t* pool,
+    iree_hal_caching_allocator_entry_t* entry) {
+  iree_hal_buffer_t* buffer = entry->buffer;
+
+  // Unlink from the size class list and mark the class as empty if needed.
+  if (entry->class_prev) {
+    entry->class_prev->class_next = entry->class_next;
+  } else {
+    pool->class_heads[entry->size_class] = entry->class_next;
+    if (!entry->class_next) {
+      pool->class_bitmap[entry->size_class / 64] &=
+          ~(1ull << (entry->size_class % 64));
+    }
   }
+  if (entry->class_next) entry->class_next->class_prev = entry->class_prev;
+
+  // Unlink from the recency list.
+  if (entry->recent_prev) {
+    entry->recent_prev->recent_next = entry->recent_next;
+  } else {
+    pool->recent_head = entry->recent_next;
+  }
+  if (entry->recent_next) {
+    entry->recent_next->recent_prev = entry->recent_prev;
+  } else {
+    pool->recent_tail = entry->recent_prev;
+  }
+
+  // Return the entry for reuse.
+  entry->buffer = NULL;
+  entry->class_next = pool->unused_entries;
+  pool->unused_entries = entry;
   --pool->free_count;
+  iree_hal_caching_allocator_pool_unreserve_retained(pool);
+
   pool->free_allocated_size -= buffer->allocation_size;
   IREE_TRACE_PLOT_VALUE_I64(IREE_HAL_CACHING_ALLOCATOR_ID,
                             pool->free_allocated_size);
   return buffer;
 }
 
-// Scans the |pool| free list for a buffer matching the given requirements and
-// returns ownership.
+// Returns the first non-empty size class in the inclusive range
+// [|first_class|, |last_class|] or IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT
+// if all are empty.
+//
+// Must be called with the pool mutex held.
+static iree_host_size_t iree_hal_caching_allocator_pool_find_class(
+    iree_hal_caching_allocator_pool_t* pool, iree_host_size_t first_class,
+    iree_host_size_t last_class) {
+  for (iree_host_size_t word = first_class / 64; word <= last_class / 64;
+       ++word) {
+    uint64_t bits = pool->class_bitmap[word];
+    if (word == first_class / 64) bits &= ~0ull << (first_class % 64);
+    if (!bits) continue;
+    iree_host_size_t size_class =
+        word * 64 + iree_math_count_trailing_zeros_u64(bits);
+    return size_class <= last_class
+               ? size_class
+               : IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT;
+  }
+  return IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT;
+}
+
+// Returns the largest buffer size that may be reused to service a request of
+// |allocation_size| bytes from |pool|.
+static iree_device_size_t iree_hal_caching_allocator_pool_max_reuse_size(
+    iree_hal_caching_allocator_pool_t* pool,
+    iree_device_size_t allocation_size) {
+  // Compute the largest buffer we'll accept while avoiding overflow.
+  const uint32_t waste_percentage = pool->params.max_waste_percentage;
+  const iree_device_size_t max_waste =
+      allocation_size / 100 * waste_percentage +
+      allocation_size % 100 * waste_percentage / 100;
+  return max_waste > IREE_DEVICE_SIZE_MAX - allocation_size
+             ? IREE_DEVICE_SIZE_MAX
+             : allocation_size + max_waste;
+}
+
+// Returns true if |buffer| can be reused for a request with |params| of at
+// least |allocation_size| and at most |max_size| bytes.
+static bool iree_hal_caching_allocator_buffer_is_reusable(
+    iree_hal_buffer_t* buffer, const iree_hal_buffer_params_t* params,
+    iree_device_size_t allocation_size, iree_device_size_t max_size) {
+  // NOTE: we are not currently checking alignment as we don't really have it.
+  // We assume programs will use consistent alignments for a particular heap
+  // (as the heap has a min alignment).
+  const iree_device_size_t buffer_size =
+      iree_hal_buffer_allocation_size(buffer);
+  return buffer_size >= allocation_size && buffer_size <= max_size &&
+         iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
+                           params->type) &&
+         iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer),
+                           params->usage);
+}
+
+// Finds the best free buffer in |pool| matching the given requirements and
+// returns ownership. Only size classes that may contain buffers within the
+// allowed waste of |allocation_size| are visited.
 //
 // Must be called with the pool mutex held.
 static iree_hal_buffer_t* iree_hal_caching_allocator_pool_find_and_take_buffer(
     iree_hal_caching_allocator_pool_t* pool,
     const iree_hal_buffer_params_t* params,
     iree_device_size_t allocation_size) {
-  // Walk backwards so that we check the most recently released buffers first.
-  for (int i = (int)pool->free_count - 1; i >= 0; --i) {
-    // NOTE: we are not currently checking alignment as we don't really have it.
-    // We assume programs will use consistent alignments for a particular heap
-    // (as the heap has a min alignment).
-    iree_hal_buffer_t* buffer = pool->free_buffers[i];
-    if (iree_all_bits_set(iree_hal_buffer_memory_type(buffer), params->type) &&
-        iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer),
-                          params->usage) &&
-        iree_hal_buffer_allocation_size(buffer) == allocation_size) {
-      return iree_hal_caching_allocator_pool_take_buffer_at(pool, i);
+  const iree_device_size_t max_size =
+      iree_hal_caching_allocator_pool_max_reuse_size(pool, allocation_size);
+  const iree_host_size_t last_class =
+      iree_hal_caching_allocator_size_class(max_size);
+  for (iree_host_size_t size_class = iree_hal_caching_allocator_pool_find_class(
+           pool, iree_hal_caching_allocator_size_class(allocation_size),
+           last_class);
+       size_class < IREE_HAL_CACHING_ALLOCATOR_SIZE_CLASS_COUNT;
+       size_class = iree_hal_caching_allocator_pool_find_class(
+           pool, size_class + 1, last_class)) {
+    // Classes are ordered by size so the smallest fit in the first class with
+    // any fit is the best fit. Walk from the most recently released buffer.
+    iree_hal_caching_allocator_entry_t* best_entry = NULL;
+    for (iree_hal_caching_allocator_entry_t* entry =
+             pool->class_heads[size_class];
+         entry != NULL; entry = entry->class_next) {
+      iree_hal_buffer_t* buffer = entry->buffer;
+      if (!iree_hal_caching_allocator_buffer_is_reusable(
+              buffer, params, allocation_size, max_size)) {
+        continue;
+      }
+      const iree_device_size_t buffer_size =
+          iree_hal_buffer_allocation_size(buffer);
+      if (!best_entry ||
+          buffer_size < iree_hal_buffer_allocation_size(best_entry->buffer)) {
+        best_entry = entry;
+        if (buffer_size == allocation_size) break;  // exact
+      }
+    }
+    if (best_entry) {
+      return iree_hal_caching_allocator_pool_take_entry(pool, best_entry);
     }
   }
   return NULL;  // nothing found
 }
 
+// Returns |buffer| to the |pool| free list if there is capacity remaining and
+// otherwise deallocates it. The caller must hold the only reference to the
+// buffer and ownership is transferred to the pool.
+//
+// Thread-safe; the pool mutex must not be held by the caller.
+static void iree_hal_caching_allocator_pool_release_to_free_list(
+    iree_hal_caching_allocator_pool_t* pool, iree_hal_buffer_t* buffer) {
+  iree_slim_mutex_lock(&pool->mutex);
+
+  const iree_device_size_t allocation_size =
+      iree_hal_buffer_allocation_size(buffer);
+  const bool under_capacity =
+      iree_hal_caching_allocator_pool_allocated_size(pool) - allocation_size <=
+      pool->params.max_allocation_capacity;
+  if (under_capacity &&
+      iree_hal_caching_allocator_pool_try_reserve_retained(pool)) {
+    iree_hal_caching_allocator_pool_push_buffer(pool, buffer);
+    buffer = NULL;
+  }
+
+  // If the buffer didn't fit in the pool we drop it here while we don't hold
+  // the lock as deallocations can be very expensive.
+  if (buffer) {
+    iree_slim_mutex_unlock(&pool->mutex);
+    iree_hal_allocator_deallocate_buffer(pool->device_allocator, buffer);
+    iree_slim_mutex_lock(&pool->mutex);
+    iree_hal_caching_allocator_pool_add_allocated_size(
+        pool, -(int64_t)allocation_size);
+  }
+
+  iree_slim_mutex_unlock(&pool->mutex);
+}
+
+// Tries to place |buffer| in the calling thread's cache. Ownership of the
+// caller's reference is transferred to the cache on success.
+//
+// Thread-safe; does not acquire the pool mutex.
+static bool iree_hal_caching_allocator_pool_try_cache_buffer(
+    iree_hal_caching_allocator_pool_t* pool, iree_hal_buffer_t* buffer) {
+  const iree_device_size_t allocation_size =
+      iree_hal_buffer_allocation_size(buffer);
+  if (!pool->thread_caching_enabled ||
+      allocation_size > pool->params.max_thread_cache_allocation_size) {
+    return false;
+  }
+  // Leave buffers that would put the pool over capacity to the free list so
+  // that they are deallocated.
+  if (iree_hal_caching_allocator_pool_allocated_size(pool) - allocation_size >
+      pool->params.max_allocation_capacity) {
+    return false;
+  }
+  if (!iree_hal_caching_allocator_pool_try_reserve_retained(pool)) {
+    return false;
+  }
+  iree_hal_caching_allocator_thread_cache_t* cache =
+      &pool->thread_caches[iree_hal_caching_allocator_thread_cache_index()];
+  for (iree_host_size_t i = 0;
+       i < IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_SLOT_COUNT; ++i) {
+    intptr_t expected = 0;
+    if (iree_atomic_compare_exchange_strong_intptr(
+            &cache->buffers[i], &expected, (intptr_t)buffer,
+            iree_memory_order_release, iree_memory_order_relaxed)) {
+      iree_atomic_store_int64(&cache->sizes[i], (int64_t)allocation_size,
+                              iree_memory_order_relaxed);
+      return true;
+    }
+  }
+  iree_hal_caching_allocator_pool_unreserve_retained(pool);
+  return false;
+}
+
+// Tries to take the best buffer matching the given requirements from the
+// calling thread's cache and returns ownership.
+//
+// Thread-safe; does not acquire the pool mutex.
+static iree_hal_buffer_t* iree_hal_caching_allocator_pool_try_take_cached(
+    iree_hal_caching_allocator_pool_t* pool,
+    const iree_hal_buffer_params_t* params,
+    iree_device_size_t allocation_size) {
+  if (!pool->thread_caching_enabled ||
+      allocation_size > pool->params.max_thread_cache_allocation_size) {
+    return NULL;
+  }
+  const iree_device_size_t max_size =
+      iree_hal_caching_allocator_pool_max_reuse_size(pool, allocation_size);
+  iree_hal_caching_allocator_thread_cache_t* cache =
+      &pool->thread_caches[iree_hal_caching_allocator_thread_cache_index()];
+
+  // Select the smallest buffer that fits based on the size hints.
+  const iree_host_size_t slot_count =
+      IREE_HAL_CACHING_ALLOCATOR_THREAD_CACHE_SLOT_COUNT;
+  iree_host_size_t best_slot = slot_count;
+  iree_device_size_t best_size = 0;
+  for (iree_host_size_t i = 0; i < slot_count; ++i) {
+    if (!iree_atomic_load_intptr(&cache->buffers[i],
+                                 iree_memory_order_relaxed)) {
+      continue;
+    }
+    const iree_device_size_t size = (iree_device_size_t)iree_atomic_load_int64(
+        &cache->sizes[i], iree_memory_order_relaxed);
+    if (size < allocation_size || size > max_size) continue;
+    if (best_slot == slot_count || size < best_size) {
+      best_slot = i;
+      best_size = size;
+      if (size == allocation_size) break;  // exact
+    }
+  }
+  if (best_slot == slot_count) return NULL;
+
+  // Take ownership of the buffer; another thread may have taken it first.
+  iree_hal_buffer_t* buffer = (iree_hal_buffer_t*)iree_atomic_exchange_intptr(
+      &cache->buffers[best_slot], 0, iree_memory_order_acquire);
+  if (!buffer) return NULL;
+  iree_hal_caching_allocator_pool_unreserve_retained(pool);
+  if (iree_hal_caching_allocator_buffer_is_reusable(
+          buffer, params, allocation_size, max_size)) {
+    return buffer;
+  }
+
+  // The size hint was stale; return the buffer as there may be another request
+  // it can service.
+  if (!iree_hal_caching_allocator_pool_try_cache_buffer(pool, buffer)) {
+    iree_hal_caching_allocator_pool_release_to_free_list(pool, buffer);
+  }
+  return NULL;
+}
+
+// Returns all buffers held in the thread caches of |pool| to the free list.
+// Returns true if any buffers were returned.
+//
+// Thread-safe; the pool mutex must not be held by the caller.
+static bool iree_hal_caching_allocator_pool_flush_thread_caches(
+    iree_hal_caching_allocator_pool_t* pool) {
+  bool any_flushed = false;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(pool->thread_caches); ++i) {
+    iree_hal_caching_allocator_thread_cache_t* cache = &pool->thread_caches[i];
+    for (iree_host_size_t j = 0; j < IREE_ARRAYSIZE(cache->buffers); ++j) {
+      iree_hal_buffer_t* buffer =
+          (iree_hal_buffer_t*)iree_atomic_exchange_intptr(
+              &cache->buffers[j], 0, iree_memory_order_acquire);
+      if (!buffer) continue;
+      iree_hal_caching_allocator_pool_unreserve_retained(pool);
+      iree_hal_caching_allocator_pool_release_to_free_list(pool, buffer);
+      any_flushed = true;
+    }
+  }
+  return any_flushed;
+}
+
 // Trims |pool| down to at most |target_size| of available allocations.
-// The oldest allocations will be trimmed first.
+// The oldest allocations will be trimmed first. Thread caches are flushed to
+// the free list if it does not contain enough allocations to reach the target.
 //
 // Thread-safe; multiple threads may concurrently access the |pool|.
 static void iree_hal_caching_allocator_pool_trim_to_size(
@@ -196,11 +679,20 @@ static void iree_hal_caching_allocator_pool_trim_to_size(
 
   iree_slim_mutex_lock(&pool->mutex);
 
-  while (pool->free_count > 0 && pool->total_allocated_size > target_size) {
+  while (iree_hal_caching_allocator_pool_allocated_size(pool) > target_size) {
+    if (pool->free_count == 0) {
+      // Return buffers held in thread caches to the free list and try again.
+      iree_slim_mutex_unlock(&pool->mutex);
+      const bool any_flushed =
+          iree_hal_caching_allocator_pool_flush_thread_caches(pool);
+      iree_slim_mutex_lock(&pool->mutex);
+      if (!any_flushed) break;
+      continue;
+    }
+
     // Take the oldest buffer in the list.
     iree_hal_buffer_t* dead_buffer =
-        iree_hal_caching_allocator_pool_take_buffer_at(pool,
-                                                       pool->free_count - 1);
+        iree_hal_caching_allocator_pool_take_entry(pool, pool->recent_tail);
 
     // NOTE: we've removed the buffer but have not subtracted the size from
     // the total yet - we want to do that only after releasing the buffer.
@@ -215,8 +707,10 @@ static void iree_hal_caching_allocator_pool_trim_to_size(
     iree_slim_mutex_lock(&pool->mutex);
 
     // Update accounting to represent that we've released the buffer.
-    IREE_ASSERT_GE(pool->total_allocated_size, allocation_size);
-    pool->total_allocated_size -= allocation_size;
+    IREE_ASSERT_GE(iree_hal_caching_allocator_pool_allocated_size(pool),
+                   allocation_size);
+    iree_hal_caching_allocator_pool_add_allocated_size(
+        pool, -(int64_t)allocation_size);
   }
 
   iree_slim_mutex_unlock(&pool->mutex);
@@ -244,19 +738,48 @@ static iree_status_t iree_hal_caching_allocator_pool_acquire(
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)allocation_size);
 
-  // Scan the free list to find an appropriate block.
-  // If found we pop it off the list and return it without needing to allocate.
-  iree_slim_mutex_lock(&pool->mutex);
+  // Check the thread cache first as it doesn't require the pool mutex.
   iree_hal_buffer_t* existing_buffer =
-      iree_hal_caching_allocator_pool_find_and_take_buffer(pool, params,
-                                                           allocation_size);
-  if (!existing_buffer) {
-    // We'll need to allocate so we add the size such that it'll be accounted
-    // for by other threads allocating at the same time.
-    pool->total_allocated_size += allocation_size;
+      iree_hal_caching_allocator_pool_try_take_cached(pool, params,
+                                                      allocation_size);
+  if (existing_buffer) {
+    IREE_STATISTICS({
+      iree_atomic_fetch_add_int64(&pool->thread_cache_hit_count, 1,
+                                  iree_memory_order_relaxed);
+      iree_atomic_fetch_add_int64(
+          &pool->thread_cache_wasted_size,
+          (int64_t)(iree_hal_buffer_allocation_size(existing_buffer) -
+                    allocation_size),
+          iree_memory_order_relaxed);
+    });
+  } else {
+    // Look up the free list to find an appropriate block.
+    // If found we pop it off the list and return it without needing to
+    // allocate.
+    iree_slim_mutex_lock(&pool->mutex);
+    existing_buffer = iree_hal_caching_allocator_pool_find_and_take_buffer(
+        pool, params, allocation_size);
+    if (!existing_buffer) {
+      // We'll need to allocate so we add the size such that it'll be accounted
+      // for by other threads allocating at the same time.
+      iree_hal_caching_allocator_pool_add_allocated_size(
+          pool, (int64_t)allocation_size);
+      IREE_STATISTICS(++pool->miss_count);
+    } else {
+      IREE_STATISTICS({
+        ++pool->hit_count;
+        pool->wasted_size +=
+            iree_hal_buffer_allocation_size(existing_buffer) - allocation_size;
+      });
+    }
+    iree_slim_mutex_unlock(&pool->mutex);
   }
-  iree_slim_mutex_unlock(&pool->mutex);
   if (existing_buffer) {
+    // A larger buffer may have been reused; expose only the requested size.
+    // The allocation size is unchanged so that the pool accounting remains
+    // consistent when the buffer is released back to it.
+    existing_buffer->byte_length = allocation_size;
+
     // Found a buffer - return it after writing in initial_data (if any).
     // We can only do this if the buffer supports mapping and expect unmappable
     // buffers to have been filtered out earlier up.
@@ -294,7 +817,8 @@ static iree_status_t iree_hal_caching_allocator_pool_acquire(
   } else {
     if (buffer) iree_hal_buffer_release(buffer);
     iree_slim_mutex_lock(&pool->mutex);
-    pool->total_allocated_size -= allocation_size;
+    iree_hal_caching_allocator_pool_add_allocated_size(
+        pool, -(int64_t)allocation_size);
     iree_slim_mutex_unlock(&pool->mutex);
   }
 
@@ -303,6 +827,8 @@ static iree_status_t iree_hal_caching_allocator_pool_acquire(
 }
 
 // Releases a |buffer| to the |pool| if there is capacity remaining.
+// The buffer is placed in the calling thread's cache if possible and otherwise
+// in the pool free list.
 //
 // Thread-safe; multiple threads may concurrently access the |pool|.
 static void iree_hal_caching_allocator_pool_release(
@@ -311,32 +837,16 @@ static void iree_hal_caching_allocator_pool_release(
   IREE_TRACE_ZONE_APPEND_VALUE_I64(
       z0, (int64_t)iree_hal_buffer_allocation_size(buffer));
 
-  // Try to add the buffer to the pool. If the pool is at capacity we'll just
-  // release it back to the allocator.
-  iree_slim_mutex_lock(&pool->mutex);
-
-  const iree_device_size_t allocation_size =
-      iree_hal_buffer_allocation_size(buffer);
-  const bool under_capacity = pool->total_allocated_size - allocation_size <=
-                              pool->params.max_allocation_capacity;
-  const bool under_count =
-      pool->free_count + 1 <= pool->params.max_free_allocation_count;
-  if (under_capacity && under_count) {
-    iree_hal_caching_allocator_pool_push_buffer(pool, buffer);
-    buffer = NULL;
-  }
+  // Retain the buffer on behalf of the pool; the reference is released when
+  // the buffer is reused or deallocated.
+  iree_hal_buffer_retain(buffer);
 
-  // If the buffer didn't fit in the pool we drop it here while we don't hold
-  // the lock as deallocations can be very expensive.
-  if (buffer) {
-    iree_slim_mutex_unlock(&pool->mutex);
-    iree_hal_allocator_deallocate_buffer(pool->device_allocator, buffer);
-    iree_slim_mutex_lock(&pool->mutex);
-    pool->total_allocated_size -= allocation_size;
+  // Try to add the buffer to the thread cache and otherwise the pool. If the
+  // pool is at capacity we'll just release it back to the allocator.
+  if (!iree_hal_caching_allocator_pool_try_cache_buffer(pool, buffer)) {
+    iree_hal_caching_allocator_pool_release_to_free_list(pool, buffer);
   }
 
-  iree_slim_mutex_unlock(&pool->mutex);
-
   IREE_TRACE_ZONE_END(z0);
 }
 
@@ -410,22 +920,27 @@ iree_status_t iree_hal_caching_allocator_create_with_pools(
   IREE_TRACE_ZONE_BEGIN(z0);
 
   // Allocate the allocator itself and then a trailing list of variable-length
-  // pools based on their free list sizes.
+  // pools based on their free list sizes. Pools are aligned to the destructive
+  // interference size so that their thread caches each occupy a cache line.
   iree_hal_caching_allocator_t* allocator = NULL;
   iree_host_size_t pool_list_size = pool_count * sizeof(allocator->pools[0]);
   iree_host_size_t total_size = iree_host_align(
-      iree_sizeof_struct(*allocator) + pool_list_size, iree_max_align_t);
+      iree_sizeof_struct(*allocator) + pool_list_size,
+      iree_alignof(iree_hal_caching_allocator_pool_t));
   iree_host_size_t pool_offset = total_size;
   for (iree_host_size_t i = 0; i < pool_count; ++i) {
     iree_hal_caching_allocator_pool_t* pool = NULL;
     total_size += iree_host_align(
-        sizeof(*pool) + sizeof(pool->free_buffers[0]) *
+        sizeof(*pool) + sizeof(pool->entries[0]) *
                             pool_params[i].max_free_allocation_count,
-        iree_max_align_t);
+        iree_alignof(iree_hal_caching_allocator_pool_t));
   }
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
       z0,
-      iree_allocator_malloc(host_allocator, total_size, (void**)&allocator));
+      iree_allocator_malloc_aligned(
+          host_allocator, total_size,
+          iree_alignof(iree_hal_caching_allocator_pool_t), 0,
+          (void**)&allocator));
 
   // Initialize the allocator.
   iree_hal_resource_initialize(&iree_hal_caching_allocator_vtable,
@@ -441,9 +956,9 @@ iree_status_t iree_hal_caching_allocator_create_with_pools(
     iree_hal_caching_allocator_pool_t* pool =
         (iree_hal_caching_allocator_pool_t*)pool_ptr;
     pool_ptr += iree_host_align(
-        sizeof(*pool) + sizeof(pool->free_buffers[0]) *
+        sizeof(*pool) + sizeof(pool->entries[0]) *
                             pool_params[i].max_free_allocation_count,
-        iree_max_align_t);
+        iree_alignof(iree_hal_caching_allocator_pool_t));
     allocator->pools[i] = pool;
     iree_hal_caching_allocator_pool_initialize(pool_params[i], device_allocator,
                                                pool);
@@ -564,8 +1079,11 @@ iree_status_t iree_hal_caching_allocator_create_from_spec(
                            &pool_config);
     iree_string_view_split(pool_config, ';', &max_allocation_capacity_str,
                            &pool_config);
+    iree_string_view_t max_waste_percentage_str = iree_string_view_empty();
     iree_string_view_split(pool_config, ';', &max_free_allocation_count_str,
                            &pool_config);
+    iree_string_view_split(pool_config, ';', &max_waste_percentage_str,
+                           &pool_config);
     max_allocation_size_str = iree_string_view_trim(max_allocation_size_str);
     if (!iree_string_view_is_empty(max_allocation_size_str) &&
         !iree_string_view_equal(max_allocation_size_str, IREE_SV("*"))) {
@@ -597,6 +1115,19 @@ iree_status_t iree_hal_caching_allocator_create_from_spec(
       }
       pool_params->max_free_allocation_count = max_free_allocation_count;
     }
+    max_waste_percentage_str = iree_string_view_trim(max_waste_percentage_str);
+    if (!iree_string_view_is_empty(max_waste_percentage_str) &&
+        !iree_string_view_equal(max_waste_percentage_str, IREE_SV("*"))) {
+      uint32_t max_waste_percentage = 0;
+      if (!iree_string_view_atoi_uint32(max_waste_percentage_str,
+                                        &max_waste_percentage)) {
+        return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                "invalid waste percentage '%.*s'",
+                                (int)max_waste_percentage_str.size,
+                                max_waste_percentage_str.data);
+      }
+      pool_params->max_waste_percentage = max_waste_percentage;
+    }
   } while (!iree_string_view_is_empty(config_pairs));
   return iree_hal_caching_allocator_create_with_pools(
       pool_count, pool_params_storage, device_allocator, host_allocator,
@@ -617,7 +1148,7 @@ static void iree_hal_caching_allocator_destroy(
   }
 
   iree_hal_allocator_release(allocator->device_allocator);
-  iree_allocator_free(host_allocator, allocator);
+  iree_allocator_free_aligned(host_allocator, allocator);
 
   IREE_TRACE_ZONE_END(z0);
 }
@@ -646,6 +1177,21 @@ static void iree_hal_caching_allocator_query_statistics(
       iree_hal_caching_allocator_cast(base_allocator);
   iree_hal_allocator_query_statistics(allocator->device_allocator,
                                       out_statistics);
+  IREE_STATISTICS({
+    for (iree_host_size_t i = 0; i < allocator->pool_count; ++i) {
+      iree_hal_caching_allocator_pool_t* pool = allocator->pools[i];
+      iree_slim_mutex_lock(&pool->mutex);
+      out_statistics->cache_hit_count += pool->hit_count;
+      out_statistics->cache_miss_count += pool->miss_count;
+      out_statistics->cache_bytes_wasted += pool->wasted_size;
+      iree_slim_mutex_unlock(&pool->mutex);
+      out_statistics->cache_hit_count += (uint64_t)iree_atomic_load_int64(
+          &pool->thread_cache_hit_count, iree_memory_order_relaxed);
+      out_statistics->cache_bytes_wasted +=
+          (iree_device_size_t)iree_atomic_load_int64(
+              &pool->thread_cache_wasted_size, iree_memory_order_relaxed);
+    }
+  });
 }
 
 static iree_status_t iree_hal_caching_allocator_query_memory_heaps(
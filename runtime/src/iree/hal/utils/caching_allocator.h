@@ -49,6 +49,21 @@ typedef struct iree_hal_caching_allocator_pool_params_t {
   // This is used to allocate storage for the free list and should be reasonably
   // bounded (~64-1024).
   iree_host_size_t max_free_allocation_count;
+
+  // Maximum percentage of a free allocation that may go unused when it is
+  // reused to service a smaller request. 0 requires an exact size match while
+  // larger values improve reuse when allocation sizes vary (such as with
+  // dynamic shapes) at the cost of retaining more memory per buffer.
+  uint32_t max_waste_percentage;
+
+  // Maximum size of an allocation in bytes that will be retained in per-thread
+  // caches in front of the pool. Allocations and releases serviced by a thread
+  // cache do not take the pool lock, reducing contention when many threads
+  // share the allocator. Each thread cache holds a small fixed number of
+  // buffers and caches are flushed back to the pool when it trims. Buffers in
+  // thread caches count against max_free_allocation_count and
+  // max_allocation_capacity. 0 disables the thread caches.
+  iree_device_size_t max_thread_cache_allocation_size;
 } iree_hal_caching_allocator_pool_params_t;
 
 // Initializes |out_params| to the default values using |heap| for storage.
@@ -102,9 +117,10 @@ iree_status_t iree_hal_caching_allocator_create_with_pools(
 //
 // Expected form:
 //   heap_key=max_allocation_size;max_allocation_capacity;max_free_allocation_count
+// An optional fourth value specifies the max_waste_percentage.
 // Example:
 //   device_local=1gib;1gib;8
-//   host_local=*;*;32
+//   host_local=*;*;32;0
 iree_status_t iree_hal_caching_allocator_create_from_spec(
     iree_string_view_t config_pairs, iree_hal_allocator_t* device_allocator,
     iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator);
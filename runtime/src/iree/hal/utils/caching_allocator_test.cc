@@ -0,0 +1,329 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/caching_allocator.h"
+
+#include <thread>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+class CachingAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        IREE_SV("heap"), iree_allocator_system(), iree_allocator_system(),
+        &device_allocator_));
+    iree_host_size_t heap_count = 0;
+    IREE_ASSERT_OK(iree_hal_allocator_query_memory_heaps(
+        device_allocator_, 1, &heap_, &heap_count));
+  }
+
+  void TearDown() override {
+    iree_hal_allocator_release(allocator_);
+    iree_hal_allocator_release(device_allocator_);
+  }
+
+  // Creates |allocator_| with a single pool over the heap allocator.
+  void CreateAllocator(uint32_t max_waste_percentage,
+                       iree_device_size_t max_allocation_capacity =
+                           IREE_DEVICE_SIZE_MAX,
+                       iree_device_size_t max_thread_cache_allocation_size =
+                           64 * 1024,
+                       iree_host_size_t max_free_allocation_count = 64) {
+    iree_hal_caching_allocator_pool_params_t pool_params;
+    iree_hal_caching_allocator_pool_params_initialize(heap_, &pool_params);
+    pool_params.max_allocation_capacity = max_allocation_capacity;
+    pool_params.max_waste_percentage = max_waste_percentage;
+    pool_params.max_thread_cache_allocation_size =
+        max_thread_cache_allocation_size;
+    pool_params.max_free_allocation_count = max_free_allocation_count;
+    IREE_ASSERT_OK(iree_hal_caching_allocator_create_with_pools(
+        1, &pool_params, device_allocator_, iree_allocator_system(),
+        &allocator_));
+  }
+
+  iree_hal_buffer_t* Allocate(iree_device_size_t size) {
+    iree_hal_buffer_params_t params = {0};
+    params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+    params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+        allocator_, params, size, iree_const_byte_span_empty(), &buffer));
+    return buffer;
+  }
+
+  iree_hal_allocator_statistics_t QueryStatistics() {
+    iree_hal_allocator_statistics_t statistics;
+    iree_hal_allocator_query_statistics(allocator_, &statistics);
+    return statistics;
+  }
+
+  iree_hal_allocator_t* device_allocator_ = NULL;
+  iree_hal_allocator_memory_heap_t heap_;
+  iree_hal_allocator_t* allocator_ = NULL;
+};
+
+TEST_F(CachingAllocatorTest, ReusesExactSize) {
+  CreateAllocator(/*max_waste_percentage=*/0);
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* reused_buffer = Allocate(4096);
+  EXPECT_EQ(reused_buffer, buffer);
+  EXPECT_EQ(iree_hal_buffer_byte_length(reused_buffer), 4096);
+  iree_hal_buffer_release(reused_buffer);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 1);
+  EXPECT_EQ(statistics.cache_miss_count, 1);
+  EXPECT_EQ(statistics.cache_bytes_wasted, 0);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+TEST_F(CachingAllocatorTest, ExactOnlyWithoutWaste) {
+  CreateAllocator(/*max_waste_percentage=*/0);
+  iree_hal_buffer_t* buffer = Allocate(16384);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* other_buffer = Allocate(16320);
+  EXPECT_NE(other_buffer, buffer);
+  iree_hal_buffer_release(other_buffer);
+}
+
+TEST_F(CachingAllocatorTest, ReusesLargerWithinWaste) {
+  CreateAllocator(/*max_waste_percentage=*/25);
+  iree_hal_buffer_t* buffer = Allocate(16384);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* reused_buffer = Allocate(14336);
+  EXPECT_EQ(reused_buffer, buffer);
+  EXPECT_EQ(iree_hal_buffer_byte_length(reused_buffer), 14336);
+  EXPECT_EQ(iree_hal_buffer_allocation_size(reused_buffer), 16384);
+  iree_hal_buffer_release(reused_buffer);
+
+  // The buffer returns to the pool with its full allocation size and can then
+  // service a request for the full size.
+  reused_buffer = Allocate(16384);
+  EXPECT_EQ(reused_buffer, buffer);
+  EXPECT_EQ(iree_hal_buffer_byte_length(reused_buffer), 16384);
+  iree_hal_buffer_release(reused_buffer);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 2);
+  EXPECT_EQ(statistics.cache_miss_count, 1);
+  EXPECT_EQ(statistics.cache_bytes_wasted, 2048);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+TEST_F(CachingAllocatorTest, RejectsBeyondWaste) {
+  CreateAllocator(/*max_waste_percentage=*/25);
+  iree_hal_buffer_t* buffer = Allocate(16384);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* other_buffer = Allocate(8192);
+  EXPECT_NE(other_buffer, buffer);
+  iree_hal_buffer_release(other_buffer);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 0);
+  EXPECT_EQ(statistics.cache_miss_count, 2);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+TEST_F(CachingAllocatorTest, PrefersBestFit) {
+  CreateAllocator(/*max_waste_percentage=*/50);
+  iree_hal_buffer_t* buffer_a = Allocate(20480);
+  iree_hal_buffer_t* buffer_b = Allocate(16384);
+  iree_hal_buffer_t* buffer_c = Allocate(17408);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+  iree_hal_buffer_release(buffer_c);
+
+  // The smallest buffer that fits is used regardless of release order.
+  iree_hal_buffer_t* buffer_0 = Allocate(15360);
+  EXPECT_EQ(buffer_0, buffer_b);
+  iree_hal_buffer_t* buffer_1 = Allocate(15360);
+  EXPECT_EQ(buffer_1, buffer_c);
+  iree_hal_buffer_t* buffer_2 = Allocate(15360);
+  EXPECT_EQ(buffer_2, buffer_a);
+  iree_hal_buffer_release(buffer_0);
+  iree_hal_buffer_release(buffer_1);
+  iree_hal_buffer_release(buffer_2);
+}
+
+TEST_F(CachingAllocatorTest, TrimsOldestFirst) {
+  CreateAllocator(/*max_waste_percentage=*/0,
+                  /*max_allocation_capacity=*/12288);
+  iree_hal_buffer_t* buffer_a = Allocate(4096);
+  iree_hal_buffer_t* buffer_b = Allocate(4096);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+
+  // Allocating a new buffer exceeds the capacity and must evict the least
+  // recently released buffer (a) while retaining b.
+  iree_hal_buffer_t* buffer_c = Allocate(8192);
+  iree_hal_buffer_t* reused_buffer = Allocate(4096);
+  EXPECT_EQ(reused_buffer, buffer_b);
+  iree_hal_buffer_release(reused_buffer);
+  iree_hal_buffer_release(buffer_c);
+}
+
+TEST_F(CachingAllocatorTest, ReusesWithoutThreadCache) {
+  CreateAllocator(/*max_waste_percentage=*/25, IREE_DEVICE_SIZE_MAX,
+                  /*max_thread_cache_allocation_size=*/0);
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* reused_buffer = Allocate(4000);
+  EXPECT_EQ(reused_buffer, buffer);
+  iree_hal_buffer_release(reused_buffer);
+}
+
+TEST_F(CachingAllocatorTest, TrimFlushesThreadCaches) {
+  CreateAllocator(/*max_waste_percentage=*/0);
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+  IREE_ASSERT_OK(iree_hal_allocator_trim(allocator_));
+  iree_hal_buffer_t* other_buffer = Allocate(4096);
+  iree_hal_buffer_release(other_buffer);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 0);
+  EXPECT_EQ(statistics.cache_miss_count, 2);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+// Buffers retained by the thread cache count against the free list limit.
+TEST_F(CachingAllocatorTest, ThreadCacheHonorsFreeCount) {
+  CreateAllocator(/*max_waste_percentage=*/0, IREE_DEVICE_SIZE_MAX,
+                  /*max_thread_cache_allocation_size=*/64 * 1024,
+                  /*max_free_allocation_count=*/1);
+  iree_hal_buffer_t* buffer_a = Allocate(4096);
+  iree_hal_buffer_t* buffer_b = Allocate(4096);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+  iree_hal_buffer_t* buffer_c = Allocate(4096);
+  iree_hal_buffer_t* buffer_d = Allocate(4096);
+  EXPECT_EQ(buffer_c, buffer_a);
+  iree_hal_buffer_release(buffer_c);
+  iree_hal_buffer_release(buffer_d);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 1);
+  EXPECT_EQ(statistics.cache_miss_count, 3);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+// Pools with a bounded capacity still retain small buffers in the thread
+// caches: a buffer released by one thread is not in the shared free list and is
+// only reused by the thread that released it.
+TEST_F(CachingAllocatorTest, ThreadCacheWithBoundedCapacity) {
+  CreateAllocator(/*max_waste_percentage=*/0,
+                  /*max_allocation_capacity=*/1 * 1024 * 1024);
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+  std::thread([&]() {
+    iree_hal_buffer_t* other_buffer = Allocate(4096);
+    EXPECT_NE(other_buffer, buffer);
+    iree_hal_buffer_release(other_buffer);
+  }).join();
+  iree_hal_buffer_t* reused_buffer = Allocate(4096);
+  EXPECT_EQ(reused_buffer, buffer);
+  iree_hal_buffer_release(reused_buffer);
+}
+
+// Buffers released while the pool is over capacity are not retained in the
+// thread caches.
+TEST_F(CachingAllocatorTest, ThreadCacheHonorsCapacity) {
+  CreateAllocator(/*max_waste_percentage=*/0,
+                  /*max_allocation_capacity=*/4096);
+  iree_hal_buffer_t* buffer_a = Allocate(4096);
+  iree_hal_buffer_t* buffer_b = Allocate(4096);
+  iree_hal_buffer_t* buffer_c = Allocate(4096);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_t* buffer_d = Allocate(4096);
+  iree_hal_buffer_release(buffer_d);
+  iree_hal_buffer_release(buffer_c);
+  iree_hal_buffer_release(buffer_b);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 0);
+  EXPECT_EQ(statistics.cache_miss_count, 4);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+// A pool with no free list retains nothing, including in the thread caches.
+TEST_F(CachingAllocatorTest, NoRetentionWithoutFreeList) {
+  CreateAllocator(/*max_waste_percentage=*/0, IREE_DEVICE_SIZE_MAX,
+                  /*max_thread_cache_allocation_size=*/64 * 1024,
+                  /*max_free_allocation_count=*/0);
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* other_buffer = Allocate(4096);
+  iree_hal_buffer_release(other_buffer);
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count, 0);
+  EXPECT_EQ(statistics.cache_miss_count, 2);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+// Many threads allocating and releasing concurrently with a mix of sizes that
+// are serviced by the thread caches and by the shared pool. The capacity is
+// bounded so that trims flush the thread caches while they are in use.
+TEST_F(CachingAllocatorTest, ConcurrentAllocations) {
+  CreateAllocator(/*max_waste_percentage=*/25,
+                  /*max_allocation_capacity=*/1 * 1024 * 1024);
+  static constexpr int kThreadCount = 8;
+  static constexpr int kIterationCount = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([this, i]() {
+      iree_hal_buffer_t* buffers[4] = {NULL};
+      for (int j = 0; j < kIterationCount; ++j) {
+        int slot = j % IREE_ARRAYSIZE(buffers);
+        iree_hal_buffer_release(buffers[slot]);
+        iree_device_size_t size = 1024 * (1 + (i + j) % 96);
+        buffers[slot] = Allocate(size);
+        ASSERT_EQ(iree_hal_buffer_byte_length(buffers[slot]), size);
+      }
+      for (auto* buffer : buffers) iree_hal_buffer_release(buffer);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.cache_hit_count + statistics.cache_miss_count,
+            kThreadCount * kIterationCount);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+TEST_F(CachingAllocatorTest, CreateFromSpecWithWaste) {
+  IREE_ASSERT_OK(iree_hal_caching_allocator_create_from_spec(
+      IREE_SV("*=*;*;16;0"), device_allocator_, iree_allocator_system(),
+      &allocator_));
+  iree_hal_buffer_t* buffer = Allocate(16384);
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_t* other_buffer = Allocate(16320);
+  EXPECT_NE(other_buffer, buffer);
+  iree_hal_buffer_release(other_buffer);
+}
+
+TEST_F(CachingAllocatorTest, CreateFromSpecInvalidWaste) {
+  EXPECT_THAT(Status(iree_hal_caching_allocator_create_from_spec(
+                  IREE_SV("*=*;*;16;x"), device_allocator_,
+                  iree_allocator_system(), &allocator_)),
+              StatusIs(StatusCode::kInvalidArgument));
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
@@ -727,13 +727,64 @@ static iree_status_t iree_hal_deferred_command_buffer_push_descriptor_set(
   return iree_ok_status();
 }
 
+// Resolves an indirect |binding| referencing a slot in |binding_table| to the
+// buffer provided in the table.
+static iree_status_t iree_hal_deferred_command_buffer_resolve_binding(
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_descriptor_set_binding_t* binding) {
+  if (IREE_UNLIKELY(binding->buffer_slot >= binding_table.count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "binding table slot %u out of range (table has "
+                            "%" PRIhsz " entries)",
+                            binding->buffer_slot, binding_table.count);
+  }
+  const iree_hal_buffer_binding_t* table_binding =
+      &binding_table.bindings[binding->buffer_slot];
+  if (IREE_UNLIKELY(!table_binding->buffer)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "binding table slot %u has no buffer",
+                            binding->buffer_slot);
+  }
+  binding->buffer = table_binding->buffer;
+  binding->offset += table_binding->offset;
+  if (binding->length == IREE_WHOLE_BUFFER) {
+    binding->length = table_binding->length;
+  }
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_deferred_command_buffer_apply_push_descriptor_set(
     iree_hal_command_buffer_t* target_command_buffer,
     iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_push_descriptor_set_t* cmd) {
+  // Bindings without a buffer reference the binding table and are resolved
+  // against the table provided to this replay. Direct bindings are passed
+  // through unmodified.
+  bool any_indirect = false;
+  for (iree_host_size_t i = 0; i < cmd->binding_count; ++i) {
+    if (!cmd->bindings[i].buffer) {
+      any_indirect = true;
+      break;
+    }
+  }
+  if (!any_indirect) {
+    return iree_hal_command_buffer_push_descriptor_set(
+        target_command_buffer, cmd->pipeline_layout, cmd->set,
+        cmd->binding_count, cmd->bindings);
+  }
+  iree_hal_descriptor_set_binding_t* bindings =
+      (iree_hal_descriptor_set_binding_t*)iree_alloca(
+          cmd->binding_count * sizeof(*bindings));
+  for (iree_host_size_t i = 0; i < cmd->binding_count; ++i) {
+    bindings[i] = cmd->bindings[i];
+    if (!bindings[i].buffer) {
+      IREE_RETURN_IF_ERROR(iree_hal_deferred_command_buffer_resolve_binding(
+          binding_table, &bindings[i]));
+    }
+  }
   return iree_hal_command_buffer_push_descriptor_set(
       target_command_buffer, cmd->pipeline_layout, cmd->set, cmd->binding_count,
-      cmd->bindings);
+      bindings);
 }
 
 //===----------------------------------------------------------------------===//
@@ -905,6 +956,19 @@ static const iree_hal_cmd_apply_fn_t iree_hal_cmd_apply_table[] = {
         iree_hal_deferred_command_buffer_apply_execute_commands,
 };
 
+// Replays all commands in |cmd_list| against |target_command_buffer|.
+static iree_status_t iree_hal_cmd_list_apply(
+    const iree_hal_cmd_list_t* cmd_list,
+    iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table) {
+  for (iree_hal_cmd_header_t* cmd = cmd_list->head; cmd != NULL;
+       cmd = cmd->next) {
+    IREE_RETURN_IF_ERROR(iree_hal_cmd_apply_table[cmd->type](
+        target_command_buffer, binding_table, cmd));
+  }
+  return iree_ok_status();
+}
+
 IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_command_buffer_t* target_command_buffer,
@@ -917,12 +981,8 @@ IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
 
   iree_status_t status = iree_hal_command_buffer_begin(target_command_buffer);
   if (iree_status_is_ok(status)) {
-    for (iree_hal_cmd_header_t* cmd = cmd_list->head; cmd != NULL;
-         cmd = cmd->next) {
-      status = iree_hal_cmd_apply_table[cmd->type](target_command_buffer,
-                                                   binding_table, cmd);
-      if (!iree_status_is_ok(status)) break;
-    }
+    status =
+        iree_hal_cmd_list_apply(cmd_list, target_command_buffer, binding_table);
   }
   if (iree_status_is_ok(status)) {
     status = iree_hal_command_buffer_end(target_command_buffer);
@@ -942,6 +1002,19 @@ IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply_nested(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_deferred_command_buffer_t* command_buffer =
+      iree_hal_deferred_command_buffer_cast(base_command_buffer);
+  iree_status_t status = iree_hal_cmd_list_apply(
+      &command_buffer->cmd_list, target_command_buffer, binding_table);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static const iree_hal_command_buffer_vtable_t
     iree_hal_deferred_command_buffer_vtable = {
         .destroy = iree_hal_deferred_command_buffer_destroy,
@@ -61,6 +61,19 @@ IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
     iree_hal_command_buffer_t* target_command_buffer,
     iree_hal_buffer_binding_table_t binding_table);
 
+// Replays a recorded |command_buffer| into a |target_command_buffer| that is
+// currently recording as if the commands had been recorded into it directly.
+// Used to implement iree_hal_command_buffer_execute_commands on targets that
+// have no native nesting support. Unlike iree_hal_deferred_command_buffer_apply
+// the target is not begun or ended and the recorded commands are retained
+// regardless of mode so that the command buffer may be executed again.
+// The provided |binding_table| will be used for indirect bindings referenced
+// in the command buffer.
+IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply_nested(
+    iree_hal_command_buffer_t* command_buffer,
+    iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
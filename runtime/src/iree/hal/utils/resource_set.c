@@ -7,6 +7,13 @@
 #include "iree/hal/utils/resource_set.h"
 
 #include "iree/base/internal/debugging.h"
+#include "iree/base/internal/math.h"
+
+#if defined(IREE_ARCH_X86_64)
+#include <emmintrin.h>
+#elif defined(IREE_ARCH_ARM_64)
+#include <arm_neon.h>
+#endif  // IREE_ARCH_*
 
 // Computes the total capacity in resources of a chunk allocated with a total
 // |storage_size| (including the header).
@@ -200,50 +207,140 @@ static iree_status_t iree_hal_resource_set_insert_retain(
 //     +----+----+----+----+
 //   insert resource into main list
 //
-// The intent here is that we can model this behavior with SIMD ops to perform
-// both the scan and update using comparison, extraction, and permutation. The
-// best and worst case flows will load the entire MRU into registers from a
-// single cache line, do all the scanning and shifting in registers, and then
-// store back to the single cache line.
-//
-// Today, though, we leave this as an exercise to whoever comes across this :)
-// Notes:
-//   As the MRU is a fixed size we can unroll it entirely and avoid any looping.
-//   On a 32-bit system with uint32x4_t we only need 4 registers.
-//   On a 64-bit system with uint64x2_t we also only need 4 registers - though
-//   the MRU has half as many entries and we may want to go >1 cache line.
-//
-//   If we wanted to process more than one resource at a time we can specialize
-//   the code paths to handle 1/2/4/etc resources and process in batches with
-//   an optional remainder. This would increase the ratio of work performed on
-//   the loaded MRU registers before we do the shift/store.
-//
-//   The tree sequence we likely want is something like:
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vdupq_n_u32
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vceqq_u32
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vorrq_u32
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vmaxvq_u32
-//    or
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vdupq_n_u64
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vceqq_u64
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vorrq_u64
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vreinterpretq_u64_u32
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vmaxvq_u32
-//   This would yield whether the pointer was found, but instead of maxing at
-//   the end we can use the produced mask to extract out a single register with
-//   which positions are hits and use that to then permute the registers into
-//   the proper order. At the end we could use a table instruction to remap and
-//   extract out a byte/bitmap of the indices that we need to insert into the
-//   main set.
-//
-//   The shifting can be performed with
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vextq_u32
-//    https://developer.arm.com/architectures/instruction-sets/intrinsics/vextq_u64
-//   This takes n low elements of LHS and rest from RHS and we can cascade them
-//   to shift down the whole MRU.
-//
-//   We can use SIMDE as a rosetta stone for getting neon/avx/wasm/etc:
-//   https://github.com/simd-everywhere/simde/blob/master/simde/arm/neon/ceq.h#L591
+// On 64-bit x86 and ARM targets the MRU is loaded into registers, scanned with
+// SIMD compares, shifted with lane extracts and masked blends, and stored back
+// with full-width stores. Keeping the loads and stores the same width matters:
+// scanning with wide loads after shifting with narrower stores (as memmove
+// does) stalls on store forwarding and is slower than the scalar scan. ILP32
+// variants of these targets (such as arm64_32) use the scalar path.
+#if (defined(IREE_ARCH_X86_64) || defined(IREE_ARCH_ARM_64)) && \
+    defined(IREE_PTR_SIZE_64)
+
+// The vectorized implementation is unrolled for an MRU of 8 pointers held in
+// 4 128-bit registers.
+static_assert(IREE_HAL_RESOURCE_SET_MRU_SIZE == 8,
+              "vectorized MRU expects 8 64-bit pointers");
+static_assert(sizeof(void*) == 8, "vectorized MRU expects 64-bit pointers");
+
+#if defined(IREE_ARCH_X86_64)
+
+typedef __m128i iree_hal_resource_set_mru_vec_t;
+
+// Returns a 2-bit mask of the lanes of |v| equal to |needle|.
+// SSE2 has no 64-bit compare so we compare 32-bit halves and require both
+// halves of a lane to match.
+static inline uint32_t iree_hal_resource_set_mru_vec_eq(
+    iree_hal_resource_set_mru_vec_t v, iree_hal_resource_set_mru_vec_t needle) {
+  __m128i eq32 = _mm_cmpeq_epi32(v, needle);
+  __m128i eq64 =
+      _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+  return (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(eq64));
+}
+
+// Stores lanes [base, base+1] of the MRU shifted down by one from |prev| and
+// |v| if their index is <= |shift_end| and otherwise |v| unchanged.
+static inline void iree_hal_resource_set_mru_vec_shift_store(
+    iree_hal_resource_t** target, iree_hal_resource_set_mru_vec_t prev,
+    iree_hal_resource_set_mru_vec_t v, int base, int shift_end) {
+  __m128i shifted = _mm_castpd_si128(
+      _mm_shuffle_pd(_mm_castsi128_pd(prev), _mm_castsi128_pd(v), 1));
+  __m128i update_mask =
+      _mm_cmpgt_epi32(_mm_set1_epi32(shift_end + 1),
+                      _mm_set_epi32(base + 1, base + 1, base, base));
+  _mm_storeu_si128((__m128i*)target,
+                   _mm_or_si128(_mm_and_si128(update_mask, shifted),
+                                _mm_andnot_si128(update_mask, v)));
+}
+
+#define iree_hal_resource_set_mru_vec_load(ptr) \
+  _mm_loadu_si128((const __m128i*)(ptr))
+#define iree_hal_resource_set_mru_vec_splat(resource) \
+  _mm_set1_epi64x((int64_t)(uintptr_t)(resource))
+
+#elif defined(IREE_ARCH_ARM_64)
+
+typedef uint64x2_t iree_hal_resource_set_mru_vec_t;
+
+// Returns a 2-bit mask of the lanes of |v| equal to |needle|.
+static inline uint32_t iree_hal_resource_set_mru_vec_eq(
+    iree_hal_resource_set_mru_vec_t v, iree_hal_resource_set_mru_vec_t needle) {
+  uint64x2_t eq = vceqq_u64(v, needle);
+  return (uint32_t)(vgetq_lane_u64(eq, 0) & 1) |
+         (uint32_t)(vgetq_lane_u64(eq, 1) & 2);
+}
+
+// Stores lanes [base, base+1] of the MRU shifted down by one from |prev| and
+// |v| if their index is <= |shift_end| and otherwise |v| unchanged.
+static inline void iree_hal_resource_set_mru_vec_shift_store(
+    iree_hal_resource_t** target, iree_hal_resource_set_mru_vec_t prev,
+    iree_hal_resource_set_mru_vec_t v, int base, int shift_end) {
+  uint64x2_t shifted = vextq_u64(prev, v, 1);
+  uint64x2_t lane_index =
+      vsetq_lane_u64((uint64_t)base + 1, vdupq_n_u64((uint64_t)base), 1);
+  uint64x2_t update_mask =
+      vcleq_u64(lane_index, vdupq_n_u64((uint64_t)shift_end));
+  vst1q_u64((uint64_t*)target, vbslq_u64(update_mask, shifted, v));
+}
+
+#define iree_hal_resource_set_mru_vec_load(ptr) \
+  vld1q_u64((const uint64_t*)(ptr))
+#define iree_hal_resource_set_mru_vec_splat(resource) \
+  vdupq_n_u64((uint64_t)(uintptr_t)(resource))
+
+#endif  // IREE_ARCH_*
+
+static iree_status_t iree_hal_resource_set_insert_1(
+    iree_hal_resource_set_t* set, iree_hal_resource_t* resource) {
+  // Most insertions hit the head of the MRU (the same resource used by
+  // consecutive commands) and we can skip the full scan.
+  if (set->mru[0] == resource) return iree_ok_status();
+
+  // Load the entire MRU and scan it for the resource.
+  const iree_hal_resource_set_mru_vec_t needle =
+      iree_hal_resource_set_mru_vec_splat(resource);
+  const iree_hal_resource_set_mru_vec_t v0 =
+      iree_hal_resource_set_mru_vec_load(&set->mru[0]);
+  const iree_hal_resource_set_mru_vec_t v1 =
+      iree_hal_resource_set_mru_vec_load(&set->mru[2]);
+  const iree_hal_resource_set_mru_vec_t v2 =
+      iree_hal_resource_set_mru_vec_load(&set->mru[4]);
+  const iree_hal_resource_set_mru_vec_t v3 =
+      iree_hal_resource_set_mru_vec_load(&set->mru[6]);
+  const uint32_t hit_mask = iree_hal_resource_set_mru_vec_eq(v0, needle) |
+                            iree_hal_resource_set_mru_vec_eq(v1, needle) << 2 |
+                            iree_hal_resource_set_mru_vec_eq(v2, needle) << 4 |
+                            iree_hal_resource_set_mru_vec_eq(v3, needle) << 6;
+
+  // Entries [0, shift_end] are shifted down by one to make room for the
+  // resource at the head. On a hit this overwrites the old position of the
+  // resource and on a miss the last entry is dropped.
+  int shift_end = 0;
+  if (hit_mask) {
+    shift_end = iree_math_count_trailing_zeros_u32(hit_mask);
+  } else {
+    // Miss - insert into the main list (slow path).
+    // Note that we do this before updating the MRU in case allocation fails -
+    // we don't want to keep the pointer around unless we've really retained
+    // it.
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_retain(set, resource));
+    shift_end = IREE_HAL_RESOURCE_SET_MRU_SIZE - 1;
+  }
+
+  // Shift and store the MRU with full-width stores. The resource is shifted in
+  // from the high lane of the needle.
+  iree_hal_resource_set_mru_vec_shift_store(&set->mru[0], needle, v0, 0,
+                                            shift_end);
+  iree_hal_resource_set_mru_vec_shift_store(&set->mru[2], v0, v1, 2,
+                                            shift_end);
+  iree_hal_resource_set_mru_vec_shift_store(&set->mru[4], v1, v2, 4,
+                                            shift_end);
+  iree_hal_resource_set_mru_vec_shift_store(&set->mru[6], v2, v3, 6,
+                                            shift_end);
+  return iree_ok_status();
+}
+
+#else
+
 static iree_status_t iree_hal_resource_set_insert_1(
     iree_hal_resource_set_t* set, iree_hal_resource_t* resource) {
   // Scan and hope for a hit.
@@ -272,19 +369,31 @@ static iree_status_t iree_hal_resource_set_insert_1(
   return iree_ok_status();
 }
 
+#endif  // (IREE_ARCH_X86_64 || IREE_ARCH_ARM_64) && IREE_PTR_SIZE_64
+
+// Inserts |count| resources located every |element_stride| bytes starting at
+// |elements|.
+static inline iree_status_t iree_hal_resource_set_insert_n(
+    iree_hal_resource_set_t* set, iree_host_size_t count, const void* elements,
+    iree_host_size_t element_stride) {
+  const uint8_t* element_ptr = (const uint8_t*)elements;
+  for (iree_host_size_t i = 0; i < count; ++i, element_ptr += element_stride) {
+    iree_hal_resource_t* resource = *(iree_hal_resource_t* const*)element_ptr;
+    if (IREE_UNLIKELY(!resource)) continue;
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_1(set, resource));
+  }
+  return iree_ok_status();
+}
+
 IREE_API_EXPORT iree_status_t
 iree_hal_resource_set_insert(iree_hal_resource_set_t* set,
                              iree_host_size_t count, const void* resources) {
-  // For now we process one at a time. We should have a stride that lets us
-  // amortize the cost of doing the MRU update and insertion allocation by
-  // say slicing off 4/8/16/32 resources at a time etc. Today each miss that
-  // requires a full insertion goes down the whole path of checking chunk
-  // capacity and such.
-  iree_hal_resource_t* const* typed_resources =
-      (iree_hal_resource_t* const*)resources;
-  for (iree_host_size_t i = 0; i < count; ++i) {
-    IREE_RETURN_IF_ERROR(
-        iree_hal_resource_set_insert_1(set, typed_resources[i]));
-  }
-  return iree_ok_status();
+  return iree_hal_resource_set_insert_n(set, count, resources,
+                                        sizeof(iree_hal_resource_t*));
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_resource_set_insert_strided(
+    iree_hal_resource_set_t* set, iree_host_size_t count, const void* elements,
+    iree_host_size_t element_stride) {
+  return iree_hal_resource_set_insert_n(set, count, elements, element_stride);
 }
@@ -126,6 +126,19 @@ IREE_API_EXPORT iree_status_t
 iree_hal_resource_set_insert(iree_hal_resource_set_t* set,
                              iree_host_size_t count, const void* resources);
 
+// Inserts zero or more resources into the set from a strided array of
+// elements that each begin with a resource pointer (or have one at the same
+// offset as |elements|). NULL resources are ignored.
+// This allows inserting resources referenced by arrays of structures such as
+// iree_hal_descriptor_set_binding_t without first gathering them into a list:
+//   iree_hal_resource_set_insert_strided(set, binding_count,
+//                                        &bindings[0].buffer,
+//                                        sizeof(bindings[0]));
+// Each resource will be retained for at least the lifetime of the set.
+IREE_API_EXPORT iree_status_t iree_hal_resource_set_insert_strided(
+    iree_hal_resource_set_t* set, iree_host_size_t count, const void* elements,
+    iree_host_size_t element_stride);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -203,6 +203,69 @@ static iree_status_t iree_hal_resource_set_benchmark_randomized_n(
   return iree_ok_status();
 }
 
+// Tests insertion of descriptor set bindings as performed when recording
+// push_descriptor_set commands. Bindings reference a small pool of buffers and
+// are inserted in one strided batch per command.
+//
+// user_data is the number of bindings per command.
+static iree_status_t iree_hal_resource_set_benchmark_insert_strided_n(
+    const iree_benchmark_def_t* benchmark_def,
+    iree_benchmark_state_t* benchmark_state) {
+  iree_allocator_t host_allocator = benchmark_state->host_allocator;
+
+  // Initialize the block pool we'll be serving from.
+  // Sized like we usually do it in the runtime for ~512-1024 elements.
+  iree_arena_block_pool_t block_pool;
+  iree_arena_block_pool_initialize(4096, host_allocator, &block_pool);
+
+  // Allocate a pool of resources larger than the MRU that bindings reference.
+  const uint32_t resource_count = 32;
+  iree_hal_resource_t* resources[32] = {NULL};
+  for (uint32_t i = 0; i < resource_count; ++i) {
+    IREE_CHECK_OK(iree_hal_test_resource_create(host_allocator, &resources[i]));
+  }
+
+  // Bindings are laid out like iree_hal_descriptor_set_binding_t.
+  uint32_t binding_count = (uint32_t)(uintptr_t)benchmark_def->user_data;
+  iree_hal_descriptor_set_binding_t* bindings = NULL;
+  IREE_CHECK_OK(iree_allocator_malloc(host_allocator,
+                                      sizeof(*bindings) * binding_count,
+                                      (void**)&bindings));
+  memset(bindings, 0, sizeof(*bindings) * binding_count);
+
+  iree_hal_resource_set_t* set = NULL;
+  IREE_CHECK_OK(iree_hal_resource_set_allocate(&block_pool, &set));
+
+  // The PRNG we use to select the buffers bound in each command.
+  iree_prng_xoroshiro128_state_t prng = {0};
+  iree_prng_xoroshiro128_initialize(123ull, &prng);
+
+  while (iree_benchmark_keep_running(benchmark_state, /*batch_count=*/64)) {
+    for (uint32_t i = 0; i < 64; ++i) {
+      // Most commands reuse the buffers of the prior command with a few new
+      // ones swapped in.
+      uint32_t binding_idx =
+          iree_prng_xoroshiro128plus_next_uint32(&prng) % binding_count;
+      uint32_t resource_idx =
+          iree_prng_xoroshiro128plus_next_uint32(&prng) % resource_count;
+      bindings[binding_idx].buffer =
+          (iree_hal_buffer_t*)resources[resource_idx];
+      IREE_CHECK_OK(iree_hal_resource_set_insert_strided(
+          set, binding_count, &bindings[0].buffer, sizeof(bindings[0])));
+    }
+  }
+
+  // Cleanup.
+  iree_hal_resource_set_free(set);
+  iree_allocator_free(host_allocator, bindings);
+  for (uint32_t i = 0; i < resource_count; ++i) {
+    iree_hal_resource_release(resources[i]);
+  }
+  iree_arena_block_pool_deinitialize(&block_pool);
+
+  return iree_ok_status();
+}
+
 int main(int argc, char** argv) {
   iree_benchmark_initialize(&argc, argv);
 
@@ -282,6 +345,24 @@ int main(int argc, char** argv) {
                             &benchmark_def);
   }
 
+  // iree_hal_resource_set_benchmark_insert_strided_n
+  {
+    iree_benchmark_def_t benchmark_def = {
+        .flags = IREE_BENCHMARK_FLAG_MEASURE_PROCESS_CPU_TIME |
+                 IREE_BENCHMARK_FLAG_USE_REAL_TIME,
+        .time_unit = IREE_BENCHMARK_UNIT_NANOSECOND,
+        .minimum_duration_ns = 0,
+        .iteration_count = 0,
+        .run = iree_hal_resource_set_benchmark_insert_strided_n,
+    };
+    benchmark_def.user_data = (void*)4u;
+    iree_benchmark_register(iree_make_cstring_view("insert_strided_4"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)16u;
+    iree_benchmark_register(iree_make_cstring_view("insert_strided_16"),
+                            &benchmark_def);
+  }
+
   iree_benchmark_run_specified();
   return 0;
 }
@@ -252,6 +252,50 @@ TEST_F(ResourceSetTest, RedundantInsertion) {
   EXPECT_EQ(live_bitmap, 0u);
 }
 
+// Tests strided insertion of resources embedded in structures.
+TEST_F(ResourceSetTest, InsertStrided) {
+  auto resource_set = make_resource_set(&block_pool);
+
+  // Allocate more resources than fit in the MRU so that we exercise misses.
+  iree_hal_resource_t* resources[32] = {NULL};
+  static_assert(IREE_ARRAYSIZE(resources) > IREE_HAL_RESOURCE_SET_MRU_SIZE,
+                "need to pick a value that lets us exceed the MRU capacity");
+  uint32_t live_bitmap = 0u;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(resources); ++i) {
+    IREE_ASSERT_OK(iree_hal_test_resource_create(
+        i, &live_bitmap, host_allocator, &resources[i]));
+  }
+
+  // Bindings with repeated and NULL resources interleaved with other fields.
+  struct binding_t {
+    uint32_t ordinal;
+    iree_hal_resource_t* resource;
+    uint64_t offset;
+  };
+  binding_t bindings[3 * IREE_ARRAYSIZE(resources)];
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(resources); ++i) {
+    bindings[i * 3 + 0] = {(uint32_t)i, resources[i], 0};
+    bindings[i * 3 + 1] = {(uint32_t)i, resources[i], 128};
+    bindings[i * 3 + 2] = {(uint32_t)i, NULL, 256};
+  }
+  IREE_ASSERT_OK(iree_hal_resource_set_insert_strided(
+      resource_set.get(), IREE_ARRAYSIZE(bindings), &bindings[0].resource,
+      sizeof(bindings[0])));
+  EXPECT_EQ(resource_set->mru[0], resources[31]);
+  EXPECT_EQ(resource_set->mru[1], resources[30]);
+  EXPECT_EQ(resource_set->mru[2], resources[29]);
+
+  // Release all of the resources - they should still be owned by the set.
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(resources); ++i) {
+    iree_hal_resource_release(resources[i]);
+  }
+  EXPECT_EQ(live_bitmap, 0xFFFFFFFFu);
+
+  // Ensure the set releases the resources.
+  resource_set.reset();
+  EXPECT_EQ(live_bitmap, 0u);
+}
+
 }  // namespace
 }  // namespace hal
 }  // namespace iree
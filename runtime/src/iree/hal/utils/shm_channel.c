@@ -0,0 +1,1336 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/shm_channel.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/call_once.h"
+#include "iree/base/internal/math.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/internal/threading.h"
+
+// POSIX shared memory objects are used for host-scoped channels. Android lacks
+// shm_open and other platforms only support process-scoped channels.
+#if (defined(IREE_PLATFORM_LINUX) && !defined(IREE_PLATFORM_ANDROID)) || \
+    defined(IREE_PLATFORM_APPLE)
+#define IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM 1
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM 0
+#endif  // IREE_PLATFORM_*
+
+// Maximum length of a channel name excluding the NUL terminator. POSIX only
+// guarantees NAME_MAX (255) for shm_open and macOS is limited to 31 so channel
+// IDs should be kept short when using host-scoped channels.
+#define IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH 127
+
+// Identifies an initialized shared region ('ISHM').
+#define IREE_HAL_SHM_CHANNEL_MAGIC 0x4D485349
+// Sentinel stored in the magic while the first participant initializes.
+#define IREE_HAL_SHM_CHANNEL_MAGIC_PENDING 1
+
+// Alignment of all structures within the shared region. Matches the cache line
+// size on all platforms we care about so that ranks don't false share.
+#define IREE_HAL_SHM_CHANNEL_ALIGNMENT 64
+
+//===----------------------------------------------------------------------===//
+// Shared region layout
+//===----------------------------------------------------------------------===//
+
+// Header at the start of the shared region. Everything in the region is
+// accessed by all participants concurrently and must be position independent.
+//
+// Layout:
+//   iree_hal_shm_channel_header_t header;
+//   iree_hal_shm_channel_rank_t ranks[count];
+//   uint8_t staging[count][staging_capacity];
+typedef struct iree_hal_shm_channel_header_t {
+  // IREE_HAL_SHM_CHANNEL_MAGIC once initialized by the first participant.
+  iree_atomic_int32_t magic;
+  // Total number of participants.
+  int32_t count;
+  // Size in bytes of each rank's staging area.
+  uint64_t staging_capacity;
+  // Number of participants that have attached to the region.
+  iree_atomic_int32_t attach_count;
+  // Number of participants that have arrived at the current barrier.
+  iree_atomic_int32_t barrier_count;
+  // Incremented each time all participants arrive at a barrier.
+  iree_atomic_int32_t barrier_generation;
+  // 1 + the rank of the first participant that failed a collective or 0 if
+  // none have. Once set the channel can no longer be used.
+  iree_atomic_int32_t failed_rank;
+  uint8_t reserved[IREE_HAL_SHM_CHANNEL_ALIGNMENT - 32];
+} iree_hal_shm_channel_header_t;
+static_assert(sizeof(iree_hal_shm_channel_header_t) ==
+                  IREE_HAL_SHM_CHANNEL_ALIGNMENT,
+              "header must fill exactly one cache line");
+
+// Per-rank control block used for point-to-point transfers and splits.
+typedef struct iree_hal_shm_channel_rank_t {
+  // Incremented by the owning rank each time its staging area holds a chunk
+  // for |send_target|.
+  iree_atomic_int64_t send_sequence;
+  // Set to the consumed |send_sequence| by the receiving rank once it has
+  // copied the chunk out of the staging area.
+  iree_atomic_int64_t ack_sequence;
+  // Rank the staged chunk is destined for.
+  iree_atomic_int32_t send_target;
+  // Color and key the rank requested in the current split.
+  int32_t split_color;
+  int32_t split_key;
+  int32_t reserved0;
+  // Length in bytes of the staged chunk.
+  uint64_t send_length;
+  uint8_t reserved1[IREE_HAL_SHM_CHANNEL_ALIGNMENT - 40];
+} iree_hal_shm_channel_rank_t;
+static_assert(sizeof(iree_hal_shm_channel_rank_t) ==
+                  IREE_HAL_SHM_CHANNEL_ALIGNMENT,
+              "rank control blocks must each fill one cache line");
+
+static iree_host_size_t iree_hal_shm_channel_region_size(
+    int32_t count, iree_host_size_t staging_capacity) {
+  return sizeof(iree_hal_shm_channel_header_t) +
+         count * sizeof(iree_hal_shm_channel_rank_t) +
+         count * staging_capacity;
+}
+
+//===----------------------------------------------------------------------===//
+// Process-scoped region registry
+//===----------------------------------------------------------------------===//
+
+// A region shared by participants within the same process.
+typedef struct iree_hal_shm_process_region_t {
+  struct iree_hal_shm_process_region_t* next;
+  iree_allocator_t host_allocator;
+  // Number of channels attached; guarded by the registry mutex.
+  int32_t ref_count;
+  // True if the region can be found by name. Regions are unlisted once all
+  // participants have attached so that the name can be reused.
+  bool is_listed;
+  iree_hal_shm_channel_header_t* header;
+  char name[IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH + 1];
+} iree_hal_shm_process_region_t;
+
+static iree_once_flag iree_hal_shm_process_registry_once = IREE_ONCE_FLAG_INIT;
+static iree_slim_mutex_t iree_hal_shm_process_registry_mutex;
+static iree_hal_shm_process_region_t* iree_hal_shm_process_registry_head;
+
+static void iree_hal_shm_process_registry_initialize(void) {
+  iree_slim_mutex_initialize(&iree_hal_shm_process_registry_mutex);
+}
+
+// Finds or creates the process-scoped region with the given |name|.
+static iree_status_t iree_hal_shm_process_region_acquire(
+    const char* name, iree_host_size_t region_size,
+    iree_allocator_t host_allocator,
+    iree_hal_shm_process_region_t** out_region) {
+  *out_region = NULL;
+  iree_call_once(&iree_hal_shm_process_registry_once,
+                 iree_hal_shm_process_registry_initialize);
+  iree_slim_mutex_lock(&iree_hal_shm_process_registry_mutex);
+
+  iree_hal_shm_process_region_t* region = iree_hal_shm_process_registry_head;
+  while (region && (!region->is_listed || strcmp(region->name, name) != 0)) {
+    region = region->next;
+  }
+
+  iree_status_t status = iree_ok_status();
+  if (region) {
+    ++region->ref_count;
+  } else {
+    status =
+        iree_allocator_malloc(host_allocator, sizeof(*region), (void**)&region);
+    if (iree_status_is_ok(status)) {
+      memset(region, 0, sizeof(*region));
+      status = iree_allocator_malloc_aligned(
+          host_allocator, region_size, IREE_HAL_SHM_CHANNEL_ALIGNMENT, 0,
+          (void**)&region->header);
+      if (!iree_status_is_ok(status)) {
+        iree_allocator_free(host_allocator, region);
+        region = NULL;
+      }
+    }
+    if (iree_status_is_ok(status)) {
+      memset(region->header, 0, region_size);
+      region->host_allocator = host_allocator;
+      region->ref_count = 1;
+      region->is_listed = true;
+      iree_string_view_to_cstring(iree_make_cstring_view(name), region->name,
+                                  sizeof(region->name));
+      region->next = iree_hal_shm_process_registry_head;
+      iree_hal_shm_process_registry_head = region;
+    }
+  }
+
+  iree_slim_mutex_unlock(&iree_hal_shm_process_registry_mutex);
+  *out_region = region;
+  return status;
+}
+
+// Prevents any new participants from finding |region| by name.
+static void iree_hal_shm_process_region_unlist(
+    iree_hal_shm_process_region_t* region) {
+  iree_slim_mutex_lock(&iree_hal_shm_process_registry_mutex);
+  region->is_listed = false;
+  iree_slim_mutex_unlock(&iree_hal_shm_process_registry_mutex);
+}
+
+// Releases a reference to |region| and frees it when no channels remain.
+static void iree_hal_shm_process_region_release(
+    iree_hal_shm_process_region_t* region) {
+  iree_slim_mutex_lock(&iree_hal_shm_process_registry_mutex);
+  bool should_free = --region->ref_count == 0;
+  if (should_free) {
+    iree_hal_shm_process_region_t** prev_next =
+        &iree_hal_shm_process_registry_head;
+    while (*prev_next != region) prev_next = &(*prev_next)->next;
+    *prev_next = region->next;
+  }
+  iree_slim_mutex_unlock(&iree_hal_shm_process_registry_mutex);
+  if (should_free) {
+    iree_allocator_free_aligned(region->host_allocator, region->header);
+    iree_allocator_free(region->host_allocator, region);
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// Host-scoped regions
+//===----------------------------------------------------------------------===//
+
+#if IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+
+// On Linux shm_open is a thin wrapper around opening a file in /dev/shm but
+// lives in librt on glibc prior to 2.34. Opening the file directly avoids the
+// extra link dependency for everything using the local-task driver.
+#if defined(IREE_PLATFORM_LINUX)
+#define IREE_HAL_SHM_LINUX_PATH_PREFIX "/dev/shm"
+static int iree_hal_shm_open(const char* name) {
+  char path[sizeof(IREE_HAL_SHM_LINUX_PATH_PREFIX) +
+            IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH];
+  snprintf(path, sizeof(path), IREE_HAL_SHM_LINUX_PATH_PREFIX "%s", name);
+  return open(path, O_CREAT | O_RDWR | O_CLOEXEC | O_NOFOLLOW, 0600);
+}
+static void iree_hal_shm_unlink(const char* name) {
+  char path[sizeof(IREE_HAL_SHM_LINUX_PATH_PREFIX) +
+            IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH];
+  snprintf(path, sizeof(path), IREE_HAL_SHM_LINUX_PATH_PREFIX "%s", name);
+  unlink(path);
+}
+#else
+static int iree_hal_shm_open(const char* name) {
+  return shm_open(name, O_CREAT | O_RDWR, 0600);
+}
+static void iree_hal_shm_unlink(const char* name) { shm_unlink(name); }
+#endif  // IREE_PLATFORM_LINUX
+
+// Opens (creating if needed) and maps the shared memory object |name|.
+static iree_status_t iree_hal_shm_host_region_map(
+    const char* name, iree_host_size_t region_size,
+    iree_hal_shm_channel_header_t** out_header) {
+  *out_header = NULL;
+  int fd = iree_hal_shm_open(name);
+  if (fd < 0) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "shm_open failed for '%s'", name);
+  }
+  // All participants extend the object to the same size and newly allocated
+  // pages are zero-filled. A larger existing object is left as-is and the
+  // header validation catches mismatched participants.
+  iree_status_t status = iree_ok_status();
+  struct stat object_stat;
+  if (fstat(fd, &object_stat) != 0) {
+    status = iree_make_status(iree_status_code_from_errno(errno),
+                              "fstat failed for '%s'", name);
+  } else if ((uint64_t)object_stat.st_size < region_size &&
+             ftruncate(fd, (off_t)region_size) != 0) {
+    status = iree_make_status(iree_status_code_from_errno(errno),
+                              "ftruncate of '%s' to %" PRIhsz " bytes failed",
+                              name, region_size);
+  }
+  void* base = MAP_FAILED;
+  if (iree_status_is_ok(status)) {
+    base = mmap(NULL, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+      status = iree_make_status(iree_status_code_from_errno(errno),
+                                "mmap of '%s' failed", name);
+    }
+  }
+  close(fd);
+  if (iree_status_is_ok(status)) {
+    *out_header = (iree_hal_shm_channel_header_t*)base;
+  }
+  return status;
+}
+
+static void iree_hal_shm_host_region_unmap(
+    iree_hal_shm_channel_header_t* header, iree_host_size_t region_size) {
+  munmap(header, region_size);
+}
+
+#endif  // IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+
+//===----------------------------------------------------------------------===//
+// Waiting
+//===----------------------------------------------------------------------===//
+
+// Backs off while waiting on another participant. Collectives are expected to
+// be short and have all participants arrive close together so we spin first,
+// then yield, and only then start sleeping to avoid burning cores if a peer is
+// slow (or never arrives).
+static void iree_hal_shm_channel_backoff(uint32_t* spin_count) {
+  if (*spin_count < 128) {
+    iree_processor_yield();
+  } else if (*spin_count < 1024) {
+    iree_thread_yield();
+  } else {
+    iree_wait_until(iree_time_now() + 50 * 1000);
+  }
+  ++*spin_count;
+}
+
+//===----------------------------------------------------------------------===//
+// Reductions
+//===----------------------------------------------------------------------===//
+
+// Reduces |count| elements of |source| into |target| in place.
+// The loops are written such that compilers can vectorize them.
+typedef void(IREE_API_PTR* iree_hal_shm_reduce_fn_t)(
+    void* IREE_RESTRICT target, const void* IREE_RESTRICT source,
+    iree_host_size_t count);
+
+// Divides |count| elements of |target| by |divisor| (for averages).
+typedef void(IREE_API_PTR* iree_hal_shm_finalize_fn_t)(
+    void* IREE_RESTRICT target, iree_host_size_t count, int32_t divisor);
+
+#define IREE_HAL_SHM_REDUCE_SUM(a, b) ((a) + (b))
+#define IREE_HAL_SHM_REDUCE_PRODUCT(a, b) ((a) * (b))
+#define IREE_HAL_SHM_REDUCE_MINIMUM(a, b) ((b) < (a) ? (b) : (a))
+#define IREE_HAL_SHM_REDUCE_MAXIMUM(a, b) ((b) > (a) ? (b) : (a))
+
+#define IREE_HAL_SHM_DEFINE_REDUCE_FN(name, T, OP)                            \
+  static void iree_hal_shm_reduce_##name(void* IREE_RESTRICT target_ptr,      \
+                                         const void* IREE_RESTRICT source_ptr, \
+                                         iree_host_size_t count) {            \
+    T* IREE_RESTRICT target = (T*)target_ptr;                                 \
+    const T* IREE_RESTRICT source = (const T*)source_ptr;                     \
+    for (iree_host_size_t i = 0; i < count; ++i) {                            \
+      target[i] = (T)OP(target[i], source[i]);                                \
+    }                                                                         \
+  }
+
+#define IREE_HAL_SHM_DEFINE_NATIVE_TYPE(name, T)                          \
+  IREE_HAL_SHM_DEFINE_REDUCE_FN(sum_##name, T, IREE_HAL_SHM_REDUCE_SUM)   \
+  IREE_HAL_SHM_DEFINE_REDUCE_FN(product_##name, T,                        \
+                                IREE_HAL_SHM_REDUCE_PRODUCT)              \
+  IREE_HAL_SHM_DEFINE_REDUCE_FN(minimum_##name, T,                        \
+                                IREE_HAL_SHM_REDUCE_MINIMUM)              \
+  IREE_HAL_SHM_DEFINE_REDUCE_FN(maximum_##name, T,                        \
+                                IREE_HAL_SHM_REDUCE_MAXIMUM)              \
+  static void iree_hal_shm_finalize_##name(void* IREE_RESTRICT target_ptr, \
+                                           iree_host_size_t count,         \
+                                           int32_t divisor) {              \
+    T* IREE_RESTRICT target = (T*)target_ptr;                             \
+    for (iree_host_size_t i = 0; i < count; ++i) {                        \
+      target[i] = (T)(target[i] / (T)divisor);                            \
+    }                                                                     \
+  }
+
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(i8, int8_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(u8, uint8_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(i16, int16_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(u16, uint16_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(i32, int32_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(u32, uint32_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(i64, int64_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(u64, uint64_t)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(f32, float)
+IREE_HAL_SHM_DEFINE_NATIVE_TYPE(f64, double)
+
+// Converts a bfloat16 to a float32 (bf16 is the high half of an f32).
+static inline float iree_hal_shm_bf16_to_f32(uint16_t value) {
+  uint32_t bits = (uint32_t)value << 16;
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+// Converts a float32 to a bfloat16 with round-to-nearest-even.
+static inline uint16_t iree_hal_shm_f32_to_bf16(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7FFFFFFFu) > 0x7F800000u) {
+    return (uint16_t)((bits >> 16) | 0x0040u);  // quiet NaN
+  }
+  bits += 0x7FFFu + ((bits >> 16) & 1u);
+  return (uint16_t)(bits >> 16);
+}
+
+// 16-bit floating point types are widened to f32 for each operation.
+#define IREE_HAL_SHM_DEFINE_CONVERTED_REDUCE_FN(name, OP, TO_F32, FROM_F32)   \
+  static void iree_hal_shm_reduce_##name(void* IREE_RESTRICT target_ptr,      \
+                                         const void* IREE_RESTRICT source_ptr, \
+                                         iree_host_size_t count) {            \
+    uint16_t* IREE_RESTRICT target = (uint16_t*)target_ptr;                   \
+    const uint16_t* IREE_RESTRICT source = (const uint16_t*)source_ptr;       \
+    for (iree_host_size_t i = 0; i < count; ++i) {                            \
+      target[i] = FROM_F32(OP(TO_F32(target[i]), TO_F32(source[i])));         \
+    }                                                                         \
+  }
+
+#define IREE_HAL_SHM_DEFINE_CONVERTED_TYPE(name, TO_F32, FROM_F32)          \
+  IREE_HAL_SHM_DEFINE_CONVERTED_REDUCE_FN(sum_##name,                       \
+                                          IREE_HAL_SHM_REDUCE_SUM, TO_F32,  \
+                                          FROM_F32)                         \
+  IREE_HAL_SHM_DEFINE_CONVERTED_REDUCE_FN(product_##name,                   \
+                                          IREE_HAL_SHM_REDUCE_PRODUCT,      \
+                                          TO_F32, FROM_F32)                 \
+  IREE_HAL_SHM_DEFINE_CONVERTED_REDUCE_FN(minimum_##name,                   \
+                                          IREE_HAL_SHM_REDUCE_MINIMUM,      \
+                                          TO_F32, FROM_F32)                 \
+  IREE_HAL_SHM_DEFINE_CONVERTED_REDUCE_FN(maximum_##name,                   \
+                                          IREE_HAL_SHM_REDUCE_MAXIMUM,      \
+                                          TO_F32, FROM_F32)                 \
+  static void iree_hal_shm_finalize_##name(void* IREE_RESTRICT target_ptr,   \
+                                           iree_host_size_t count,           \
+                                           int32_t divisor) {                \
+    uint16_t* IREE_RESTRICT target = (uint16_t*)target_ptr;                 \
+    for (iree_host_size_t i = 0; i < count; ++i) {                          \
+      target[i] = FROM_F32(TO_F32(target[i]) / (float)divisor);             \
+    }                                                                       \
+  }
+
+IREE_HAL_SHM_DEFINE_CONVERTED_TYPE(f16, iree_math_f16_to_f32,
+                                   iree_math_f32_to_f16)
+IREE_HAL_SHM_DEFINE_CONVERTED_TYPE(bf16, iree_hal_shm_bf16_to_f32,
+                                   iree_hal_shm_f32_to_bf16)
+
+// Selects the reduction function for |op| and the finalization function if the
+// reduction requires one (averages).
+static iree_status_t iree_hal_shm_select_reduction(
+    iree_hal_collective_op_t op, iree_hal_shm_reduce_fn_t* out_reduce_fn,
+    iree_hal_shm_finalize_fn_t* out_finalize_fn) {
+  *out_reduce_fn = NULL;
+  *out_finalize_fn = NULL;
+
+#define IREE_HAL_SHM_SELECT_TYPE(element_type, name)         \
+  case IREE_HAL_COLLECTIVE_ELEMENT_TYPE_##element_type:      \
+    switch (op.reduction) {                                  \
+      case IREE_HAL_COLLECTIVE_REDUCTION_SUM:                \
+        *out_reduce_fn = iree_hal_shm_reduce_sum_##name;     \
+        break;                                               \
+      case IREE_HAL_COLLECTIVE_REDUCTION_PRODUCT:            \
+        *out_reduce_fn = iree_hal_shm_reduce_product_##name; \
+        break;                                               \
+      case IREE_HAL_COLLECTIVE_REDUCTION_MINIMUM:            \
+        *out_reduce_fn = iree_hal_shm_reduce_minimum_##name; \
+        break;                                               \
+      case IREE_HAL_COLLECTIVE_REDUCTION_MAXIMUM:            \
+        *out_reduce_fn = iree_hal_shm_reduce_maximum_##name; \
+        break;                                               \
+      case IREE_HAL_COLLECTIVE_REDUCTION_AVERAGE:            \
+        *out_reduce_fn = iree_hal_shm_reduce_sum_##name;     \
+        *out_finalize_fn = iree_hal_shm_finalize_##name;     \
+        break;                                               \
+      default:                                               \
+        break;                                               \
+    }                                                        \
+    break;
+
+  switch (op.element_type) {
+    IREE_HAL_SHM_SELECT_TYPE(SINT_8, i8)
+    IREE_HAL_SHM_SELECT_TYPE(UINT_8, u8)
+    IREE_HAL_SHM_SELECT_TYPE(SINT_16, i16)
+    IREE_HAL_SHM_SELECT_TYPE(UINT_16, u16)
+    IREE_HAL_SHM_SELECT_TYPE(SINT_32, i32)
+    IREE_HAL_SHM_SELECT_TYPE(UINT_32, u32)
+    IREE_HAL_SHM_SELECT_TYPE(SINT_64, i64)
+    IREE_HAL_SHM_SELECT_TYPE(UINT_64, u64)
+    IREE_HAL_SHM_SELECT_TYPE(FLOAT_16, f16)
+    IREE_HAL_SHM_SELECT_TYPE(FLOAT_32, f32)
+    IREE_HAL_SHM_SELECT_TYPE(FLOAT_64, f64)
+    IREE_HAL_SHM_SELECT_TYPE(BFLOAT_16, bf16)
+    default:
+      break;
+  }
+#undef IREE_HAL_SHM_SELECT_TYPE
+
+  if (!*out_reduce_fn) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unsupported collective reduction %u on element "
+                            "type %u",
+                            op.reduction, op.element_type);
+  }
+  return iree_ok_status();
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_shm_channel_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_shm_channel_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+
+  // Parent channel this was split from, if any.
+  // This is only used to keep the parent channel live for as long as there are
+  // any split channels live (including transitive splits).
+  iree_hal_channel_t* parent_channel;
+
+  iree_hal_shm_channel_options_t options;
+
+  // This participant's rank in the channel.
+  int32_t rank;
+  // Total number of participants in the channel.
+  int32_t count;
+
+  // Number of splits performed on this channel; used to derive unique names
+  // for split channels. All participants split in the same order.
+  uint32_t split_count;
+
+  // Mapped shared region and its total size in bytes.
+  iree_hal_shm_channel_header_t* header;
+  iree_host_size_t region_size;
+  // Registry entry owning the region for process-scoped channels.
+  iree_hal_shm_process_region_t* process_region;
+
+  // Name used to rendezvous with the other participants.
+  char name[IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH + 1];
+} iree_hal_shm_channel_t;
+
+static const iree_hal_channel_vtable_t iree_hal_shm_channel_vtable;
+
+static iree_hal_shm_channel_t* iree_hal_shm_channel_cast(
+    iree_hal_channel_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_shm_channel_vtable);
+  return (iree_hal_shm_channel_t*)base_value;
+}
+
+static const iree_hal_shm_channel_t* iree_hal_shm_channel_const_cast(
+    const iree_hal_channel_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_shm_channel_vtable);
+  return (const iree_hal_shm_channel_t*)base_value;
+}
+
+IREE_API_EXPORT void iree_hal_shm_channel_options_initialize(
+    iree_hal_shm_channel_options_t* out_options) {
+  IREE_ASSERT_ARGUMENT(out_options);
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->scope = IREE_HAL_SHM_CHANNEL_SCOPE_PROCESS;
+  out_options->staging_capacity = IREE_HAL_SHM_CHANNEL_DEFAULT_STAGING_CAPACITY;
+}
+
+IREE_API_EXPORT bool iree_hal_shm_channel_isa(iree_hal_channel_t* channel) {
+  return iree_hal_resource_is(channel, &iree_hal_shm_channel_vtable);
+}
+
+static iree_hal_shm_channel_rank_t* iree_hal_shm_channel_rank_control(
+    iree_hal_shm_channel_t* channel, int32_t rank) {
+  return (iree_hal_shm_channel_rank_t*)((uint8_t*)channel->header +
+                                        sizeof(iree_hal_shm_channel_header_t)) +
+         rank;
+}
+
+static uint8_t* iree_hal_shm_channel_staging(iree_hal_shm_channel_t* channel,
+                                             int32_t rank) {
+  return (uint8_t*)channel->header + sizeof(iree_hal_shm_channel_header_t) +
+         channel->count * sizeof(iree_hal_shm_channel_rank_t) +
+         rank * channel->options.staging_capacity;
+}
+
+// Marks the channel as failed so that participants waiting on this rank in a
+// collective (or issuing any subsequent collective) fail instead of blocking
+// forever. Only the first failing rank is recorded.
+static void iree_hal_shm_channel_mark_failed(iree_hal_shm_channel_t* channel) {
+  int32_t expected = 0;
+  iree_atomic_compare_exchange_strong_int32(
+      &channel->header->failed_rank, &expected, channel->rank + 1,
+      iree_memory_order_release, iree_memory_order_relaxed);
+}
+
+// Returns an error if any participant has marked the channel as failed.
+static iree_status_t iree_hal_shm_channel_check_failed(
+    iree_hal_shm_channel_t* channel) {
+  const int32_t failed_rank = iree_atomic_load_int32(
+      &channel->header->failed_rank, iree_memory_order_acquire);
+  if (IREE_LIKELY(failed_rank == 0)) return iree_ok_status();
+  return iree_make_status(IREE_STATUS_ABORTED,
+                          "a collective failed on rank %d of channel '%s' and "
+                          "the channel can no longer be used",
+                          failed_rank - 1, channel->name);
+}
+
+// Blocks until all participants have arrived at the barrier or any participant
+// has marked the channel as failed.
+// All prior writes by any participant to the shared region are visible to all
+// participants once the barrier returns successfully.
+static iree_status_t iree_hal_shm_channel_barrier(
+    iree_hal_shm_channel_t* channel) {
+  iree_hal_shm_channel_header_t* header = channel->header;
+  const int32_t generation = iree_atomic_load_int32(
+      &header->barrier_generation, iree_memory_order_acquire);
+  if (iree_atomic_fetch_add_int32(&header->barrier_count, 1,
+                                  iree_memory_order_acq_rel) ==
+      channel->count - 1) {
+    // Last to arrive: reset for the next barrier and release everyone. The
+    // others can't reenter the barrier until the generation changes.
+    iree_atomic_store_int32(&header->barrier_count, 0,
+                            iree_memory_order_relaxed);
+    iree_atomic_store_int32(&header->barrier_generation, generation + 1,
+                            iree_memory_order_release);
+    return iree_ok_status();
+  }
+  uint32_t spin_count = 0;
+  while (iree_atomic_load_int32(&header->barrier_generation,
+                                iree_memory_order_acquire) == generation) {
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_check_failed(channel));
+    iree_hal_shm_channel_backoff(&spin_count);
+  }
+  return iree_ok_status();
+}
+
+// Attaches |channel| to its shared region (creating it if this is the first
+// participant) and waits for all other participants to attach.
+static iree_status_t iree_hal_shm_channel_attach(
+    iree_hal_shm_channel_t* channel) {
+  channel->region_size = iree_hal_shm_channel_region_size(
+      channel->count, channel->options.staging_capacity);
+  switch (channel->options.scope) {
+    case IREE_HAL_SHM_CHANNEL_SCOPE_PROCESS:
+      IREE_RETURN_IF_ERROR(iree_hal_shm_process_region_acquire(
+          channel->name, channel->region_size, channel->host_allocator,
+          &channel->process_region));
+      channel->header = channel->process_region->header;
+      break;
+    case IREE_HAL_SHM_CHANNEL_SCOPE_HOST:
+#if IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+      IREE_RETURN_IF_ERROR(iree_hal_shm_host_region_map(
+          channel->name, channel->region_size, &channel->header));
+      break;
+#else
+      return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                              "host-scoped shared memory channels are not "
+                              "supported on this platform");
+#endif  // IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+    default:
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "unknown shared memory channel scope %d",
+                              (int)channel->options.scope);
+  }
+  iree_hal_shm_channel_header_t* header = channel->header;
+
+  // The first participant to arrive initializes the header and all others
+  // wait for it to finish.
+  int32_t magic = 0;
+  if (iree_atomic_compare_exchange_strong_int32(
+          &header->magic, &magic, IREE_HAL_SHM_CHANNEL_MAGIC_PENDING,
+          iree_memory_order_acquire, iree_memory_order_acquire)) {
+    header->count = channel->count;
+    header->staging_capacity = channel->options.staging_capacity;
+    iree_atomic_store_int32(&header->magic, IREE_HAL_SHM_CHANNEL_MAGIC,
+                            iree_memory_order_release);
+  } else {
+    uint32_t spin_count = 0;
+    while (iree_atomic_load_int32(&header->magic, iree_memory_order_acquire) ==
+           IREE_HAL_SHM_CHANNEL_MAGIC_PENDING) {
+      iree_hal_shm_channel_backoff(&spin_count);
+    }
+  }
+  if (iree_atomic_load_int32(&header->magic, iree_memory_order_acquire) !=
+          IREE_HAL_SHM_CHANNEL_MAGIC ||
+      header->count != channel->count ||
+      header->staging_capacity != channel->options.staging_capacity) {
+    return iree_make_status(
+        IREE_STATUS_FAILED_PRECONDITION,
+        "shared memory channel '%s' was created with a different participant "
+        "count or staging capacity (expected %d participants with %" PRIhsz
+        " byte staging areas)",
+        channel->name, channel->count, channel->options.staging_capacity);
+  }
+
+  // Rendezvous with all other participants. The last to arrive removes the
+  // name so that a new channel with the same ID can be created once this one
+  // has been released.
+  const int32_t attach_index = iree_atomic_fetch_add_int32(
+      &header->attach_count, 1, iree_memory_order_acq_rel);
+  if (attach_index >= channel->count) {
+    return iree_make_status(IREE_STATUS_ALREADY_EXISTS,
+                            "shared memory channel '%s' already has all %d "
+                            "participants attached",
+                            channel->name, channel->count);
+  }
+  if (attach_index == channel->count - 1) {
+    if (channel->process_region) {
+      iree_hal_shm_process_region_unlist(channel->process_region);
+    }
+#if IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+    if (channel->options.scope == IREE_HAL_SHM_CHANNEL_SCOPE_HOST) {
+      iree_hal_shm_unlink(channel->name);
+    }
+#endif  // IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+  }
+  uint32_t spin_count = 0;
+  while (iree_atomic_load_int32(&header->attach_count,
+                                iree_memory_order_acquire) < channel->count) {
+    iree_hal_shm_channel_backoff(&spin_count);
+  }
+  return iree_ok_status();
+}
+
+static void iree_hal_shm_channel_detach(iree_hal_shm_channel_t* channel) {
+  if (channel->process_region) {
+    iree_hal_shm_process_region_release(channel->process_region);
+    channel->process_region = NULL;
+  }
+#if IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+  else if (channel->header) {
+    iree_hal_shm_host_region_unmap(channel->header, channel->region_size);
+  }
+#endif  // IREE_HAL_SHM_CHANNEL_HAVE_POSIX_SHM
+  channel->header = NULL;
+}
+
+static iree_status_t iree_hal_shm_channel_create_named(
+    const iree_hal_shm_channel_options_t* options, const char* name,
+    int32_t rank, int32_t count, iree_allocator_t host_allocator,
+    iree_hal_channel_t** out_channel) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_TEXT(z0, name);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, rank);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, count);
+
+  iree_hal_shm_channel_t* channel = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*channel),
+                                (void**)&channel));
+  memset(channel, 0, sizeof(*channel));
+  iree_hal_resource_initialize(&iree_hal_shm_channel_vtable,
+                               &channel->resource);
+  channel->host_allocator = host_allocator;
+  channel->options = *options;
+  channel->rank = rank;
+  channel->count = count;
+  iree_string_view_to_cstring(iree_make_cstring_view(name), channel->name,
+                              sizeof(channel->name));
+
+  iree_status_t status = iree_hal_shm_channel_attach(channel);
+  if (iree_status_is_ok(status)) {
+    *out_channel = (iree_hal_channel_t*)channel;
+  } else {
+    iree_hal_channel_release((iree_hal_channel_t*)channel);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Derives the rendezvous name from the channel ID (hex encoded as it is
+// opaque) or group (with unsupported characters replaced).
+static iree_status_t iree_hal_shm_channel_make_name(
+    iree_hal_channel_params_t params,
+    char out_name[IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH + 1]) {
+  static const char kPrefix[] = "/iree_hal_shm_";
+  static const char kHexDigits[] = "0123456789abcdef";
+  iree_host_size_t length = sizeof(kPrefix) - 1;
+  memcpy(out_name, kPrefix, length);
+  iree_host_size_t key_length = 0;
+  if (!iree_const_byte_span_is_empty(params.id)) {
+    key_length = params.id.data_length * 2;
+  } else if (!iree_string_view_is_empty(params.group)) {
+    key_length = params.group.size;
+  } else {
+    key_length = strlen("default");
+  }
+  if (length + key_length > IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "shared memory channel ID/group too long; "
+                            "%" PRIhsz " characters > %d maximum",
+                            key_length,
+                            (int)(IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH -
+                                  (sizeof(kPrefix) - 1)));
+  }
+  if (!iree_const_byte_span_is_empty(params.id)) {
+    for (iree_host_size_t i = 0; i < params.id.data_length; ++i) {
+      out_name[length++] = kHexDigits[params.id.data[i] >> 4];
+      out_name[length++] = kHexDigits[params.id.data[i] & 0xF];
+    }
+  } else if (!iree_string_view_is_empty(params.group)) {
+    for (iree_host_size_t i = 0; i < params.group.size; ++i) {
+      char c = params.group.data[i];
+      bool is_valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                      (c >= '0' && c <= '9') || c == '_' || c == '-' ||
+                      c == '.';
+      out_name[length++] = is_valid ? c : '_';
+    }
+  } else {
+    memcpy(out_name + length, "default", key_length);
+    length += key_length;
+  }
+  out_name[length] = 0;
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_shm_channel_create(
+    const iree_hal_shm_channel_options_t* options,
+    iree_hal_channel_params_t params, iree_allocator_t host_allocator,
+    iree_hal_channel_t** out_channel) {
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_channel);
+  *out_channel = NULL;
+  if (params.count <= 0 || params.rank < 0 || params.rank >= params.count) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "shared memory channels require an explicit rank "
+                            "and count; rank %d of %d is invalid",
+                            params.rank, params.count);
+  }
+  if (options->staging_capacity == 0 ||
+      options->staging_capacity % IREE_HAL_SHM_CHANNEL_ALIGNMENT != 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "staging capacity %" PRIhsz
+                            " must be a non-zero multiple of %d bytes",
+                            options->staging_capacity,
+                            IREE_HAL_SHM_CHANNEL_ALIGNMENT);
+  }
+  char name[IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH + 1];
+  IREE_RETURN_IF_ERROR(iree_hal_shm_channel_make_name(params, name));
+  return iree_hal_shm_channel_create_named(options, name, params.rank,
+                                           params.count, host_allocator,
+                                           out_channel);
+}
+
+static void iree_hal_shm_channel_destroy(iree_hal_channel_t* base_channel) {
+  iree_hal_shm_channel_t* channel = iree_hal_shm_channel_cast(base_channel);
+  iree_allocator_t host_allocator = channel->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_shm_channel_detach(channel);
+  iree_hal_channel_release(channel->parent_channel);
+  iree_allocator_free(host_allocator, channel);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_status_t iree_hal_shm_channel_split(
+    iree_hal_channel_t* base_channel, int32_t color, int32_t key,
+    iree_hal_channel_flags_t flags, iree_hal_channel_t** out_split_channel) {
+  iree_hal_shm_channel_t* channel = iree_hal_shm_channel_cast(base_channel);
+  const uint32_t split_index = channel->split_count++;
+
+  // Publish our color and key and wait for everyone else to do the same.
+  iree_hal_shm_channel_rank_t* control =
+      iree_hal_shm_channel_rank_control(channel, channel->rank);
+  control->split_color = color;
+  control->split_key = key;
+  IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+
+  // Ranks with the same color are ordered by key and then by their rank in the
+  // parent channel.
+  int32_t split_rank = 0;
+  int32_t split_count = 0;
+  for (int32_t i = 0; i < channel->count; ++i) {
+    const iree_hal_shm_channel_rank_t* other =
+        iree_hal_shm_channel_rank_control(channel, i);
+    if (other->split_color != color) continue;
+    ++split_count;
+    if (other->split_key < key ||
+        (other->split_key == key && i < channel->rank)) {
+      ++split_rank;
+    }
+  }
+
+  // Don't let anyone reuse the control blocks until everyone has read them.
+  IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+
+  if (color == IREE_HAL_CHANNEL_NO_COLOR) {
+    *out_split_channel = NULL;
+    return iree_ok_status();
+  }
+
+  char split_name[IREE_HAL_SHM_CHANNEL_MAX_NAME_LENGTH + 1];
+  int name_length =
+      snprintf(split_name, sizeof(split_name), "%s.%u.%d", channel->name,
+               split_index, color);
+  if (name_length < 0 || name_length >= (int)sizeof(split_name)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "split channel name derived from '%s' too long",
+                            channel->name);
+  }
+  iree_hal_channel_t* split_channel = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_shm_channel_create_named(
+      &channel->options, split_name, split_rank, split_count,
+      channel->host_allocator, &split_channel));
+  iree_hal_shm_channel_cast(split_channel)->parent_channel = base_channel;
+  iree_hal_channel_retain(base_channel);
+  *out_split_channel = split_channel;
+  return iree_ok_status();
+}
+
+static void iree_hal_shm_channel_query_rank_and_count(
+    const iree_hal_channel_t* base_channel, int32_t* out_rank,
+    int32_t* out_count) {
+  const iree_hal_shm_channel_t* channel =
+      iree_hal_shm_channel_const_cast(base_channel);
+  *out_rank = channel->rank;
+  *out_count = channel->count;
+}
+
+//===----------------------------------------------------------------------===//
+// Collective operations
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_hal_shm_channel_all_gather(
+    iree_hal_shm_channel_t* channel, const uint8_t* send, uint8_t* recv,
+    iree_host_size_t byte_length) {
+  uint8_t* staging = iree_hal_shm_channel_staging(channel, channel->rank);
+  const iree_host_size_t capacity = channel->options.staging_capacity;
+  for (iree_host_size_t offset = 0; offset < byte_length; offset += capacity) {
+    const iree_host_size_t length = iree_min(capacity, byte_length - offset);
+    memcpy(staging, send + offset, length);
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+    for (int32_t i = 0; i < channel->count; ++i) {
+      memcpy(recv + i * byte_length + offset,
+             iree_hal_shm_channel_staging(channel, i), length);
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+  }
+  return iree_ok_status();
+}
+
+// Reduces |send| from all ranks. Each rank reduces a disjoint 1/N portion of
+// every chunk into the staging area of rank 0 and then ranks copy out the
+// result if |recv| is provided.
+static iree_status_t iree_hal_shm_channel_reduce(
+    iree_hal_shm_channel_t* channel, const uint8_t* send, uint8_t* recv,
+    iree_host_size_t element_count, iree_host_size_t element_size,
+    iree_hal_shm_reduce_fn_t reduce_fn,
+    iree_hal_shm_finalize_fn_t finalize_fn) {
+  uint8_t* staging = iree_hal_shm_channel_staging(channel, channel->rank);
+  uint8_t* result = iree_hal_shm_channel_staging(channel, 0);
+  const iree_host_size_t chunk_elements =
+      channel->options.staging_capacity / element_size;
+  for (iree_host_size_t base = 0; base < element_count;
+       base += chunk_elements) {
+    const iree_host_size_t count =
+        iree_min(chunk_elements, element_count - base);
+    memcpy(staging, send + base * element_size, count * element_size);
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+
+    const iree_host_size_t begin = count * channel->rank / channel->count;
+    const iree_host_size_t end = count * (channel->rank + 1) / channel->count;
+    if (end > begin) {
+      for (int32_t i = 1; i < channel->count; ++i) {
+        reduce_fn(result + begin * element_size,
+                  iree_hal_shm_channel_staging(channel, i) +
+                      begin * element_size,
+                  end - begin);
+      }
+      if (finalize_fn) {
+        finalize_fn(result + begin * element_size, end - begin,
+                    channel->count);
+      }
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+
+    if (recv) {
+      memcpy(recv + base * element_size, result, count * element_size);
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+  }
+  return iree_ok_status();
+}
+
+// Exchanges the N parts of |part_count| elements in |send| such that rank i
+// receives the i-th part from every rank. With a |reduce_fn| the received
+// parts are reduced into |recv| (reduce scatter) and otherwise they are
+// concatenated in rank order (all to all).
+static iree_status_t iree_hal_shm_channel_exchange_parts(
+    iree_hal_shm_channel_t* channel, const uint8_t* send, uint8_t* recv,
+    iree_host_size_t part_count, iree_host_size_t element_size,
+    iree_hal_shm_reduce_fn_t reduce_fn,
+    iree_hal_shm_finalize_fn_t finalize_fn) {
+  uint8_t* staging = iree_hal_shm_channel_staging(channel, channel->rank);
+  const iree_host_size_t chunk_elements =
+      channel->options.staging_capacity / channel->count / element_size;
+  for (iree_host_size_t base = 0; base < part_count; base += chunk_elements) {
+    const iree_host_size_t count = iree_min(chunk_elements, part_count - base);
+    const iree_host_size_t length = count * element_size;
+    for (int32_t j = 0; j < channel->count; ++j) {
+      memcpy(staging + j * length,
+             send + (j * part_count + base) * element_size, length);
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+
+    const iree_host_size_t part_offset = channel->rank * length;
+    if (reduce_fn) {
+      // Reduce scatter: all parts for this rank are reduced into |recv|.
+      uint8_t* target = recv + base * element_size;
+      memcpy(target, iree_hal_shm_channel_staging(channel, 0) + part_offset,
+             length);
+      for (int32_t i = 1; i < channel->count; ++i) {
+        reduce_fn(target,
+                  iree_hal_shm_channel_staging(channel, i) + part_offset,
+                  count);
+      }
+      if (finalize_fn) finalize_fn(target, count, channel->count);
+    } else {
+      // All to all: the part from rank i is placed in the i-th part of |recv|.
+      for (int32_t i = 0; i < channel->count; ++i) {
+        memcpy(recv + (i * part_count + base) * element_size,
+               iree_hal_shm_channel_staging(channel, i) + part_offset, length);
+      }
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_shm_channel_broadcast(
+    iree_hal_shm_channel_t* channel, int32_t root_rank, const uint8_t* send,
+    uint8_t* recv, iree_host_size_t byte_length) {
+  uint8_t* staging = iree_hal_shm_channel_staging(channel, root_rank);
+  const iree_host_size_t capacity = channel->options.staging_capacity;
+  const bool is_root = channel->rank == root_rank;
+  for (iree_host_size_t offset = 0; offset < byte_length; offset += capacity) {
+    const iree_host_size_t length = iree_min(capacity, byte_length - offset);
+    if (is_root) memcpy(staging, send + offset, length);
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+    if (!is_root) memcpy(recv + offset, staging, length);
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_barrier(channel));
+  }
+  if (is_root && recv && recv != send) memcpy(recv, send, byte_length);
+  return iree_ok_status();
+}
+
+// Stages |length| bytes for |target_rank| without waiting for it to be
+// received. The previously posted chunk must have been acknowledged.
+static int64_t iree_hal_shm_channel_post_send(iree_hal_shm_channel_t* channel,
+                                              int32_t target_rank,
+                                              const uint8_t* data,
+                                              iree_host_size_t length) {
+  iree_hal_shm_channel_rank_t* control =
+      iree_hal_shm_channel_rank_control(channel, channel->rank);
+  memcpy(iree_hal_shm_channel_staging(channel, channel->rank), data, length);
+  iree_atomic_store_int32(&control->send_target, target_rank,
+                          iree_memory_order_relaxed);
+  control->send_length = length;
+  const int64_t sequence = iree_atomic_load_int64(&control->send_sequence,
+                                                  iree_memory_order_relaxed) +
+                           1;
+  iree_atomic_store_int64(&control->send_sequence, sequence,
+                          iree_memory_order_release);
+  return sequence;
+}
+
+// Waits until the chunk posted with |sequence| has been received.
+static iree_status_t iree_hal_shm_channel_wait_send(
+    iree_hal_shm_channel_t* channel, int64_t sequence) {
+  iree_hal_shm_channel_rank_t* control =
+      iree_hal_shm_channel_rank_control(channel, channel->rank);
+  uint32_t spin_count = 0;
+  while (iree_atomic_load_int64(&control->ack_sequence,
+                                iree_memory_order_acquire) != sequence) {
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_check_failed(channel));
+    iree_hal_shm_channel_backoff(&spin_count);
+  }
+  return iree_ok_status();
+}
+
+// Waits for |source_rank| to post a chunk for this rank and copies it out.
+static iree_status_t iree_hal_shm_channel_recv_chunk(
+    iree_hal_shm_channel_t* channel, int32_t source_rank, uint8_t* data,
+    iree_host_size_t length) {
+  iree_hal_shm_channel_rank_t* control =
+      iree_hal_shm_channel_rank_control(channel, source_rank);
+  uint32_t spin_count = 0;
+  int64_t sequence = 0;
+  for (;;) {
+    sequence = iree_atomic_load_int64(&control->send_sequence,
+                                      iree_memory_order_acquire);
+    if (sequence != iree_atomic_load_int64(&control->ack_sequence,
+                                           iree_memory_order_relaxed) &&
+        iree_atomic_load_int32(&control->send_target,
+                               iree_memory_order_relaxed) == channel->rank) {
+      break;
+    }
+    IREE_RETURN_IF_ERROR(iree_hal_shm_channel_check_failed(channel));
+    iree_hal_shm_channel_backoff(&spin_count);
+  }
+  const iree_host_size_t send_length = (iree_host_size_t)control->send_length;
+  memcpy(data, iree_hal_shm_channel_staging(channel, source_rank),
+         iree_min(length, send_length));
+  // Always acknowledge so that the sender is not left waiting on an error.
+  iree_atomic_store_int64(&control->ack_sequence, sequence,
+                          iree_memory_order_release);
+  if (send_length != length) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "rank %d sent %" PRIhsz
+                            " bytes but rank %d expected %" PRIhsz,
+                            source_rank, send_length, channel->rank, length);
+  }
+  return iree_ok_status();
+}
+
+// Sends to |target_rank| (if not -1) and receives from |source_rank| (if not
+// -1) concurrently so that ring exchanges don't deadlock.
+static iree_status_t iree_hal_shm_channel_send_recv(
+    iree_hal_shm_channel_t* channel, int32_t target_rank,
+    const uint8_t* send, int32_t source_rank, uint8_t* recv,
+    iree_host_size_t byte_length) {
+  const iree_host_size_t capacity = channel->options.staging_capacity;
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t offset = 0;
+       offset < byte_length && iree_status_is_ok(status); offset += capacity) {
+    const iree_host_size_t length = iree_min(capacity, byte_length - offset);
+    int64_t sequence = 0;
+    if (target_rank >= 0) {
+      sequence = iree_hal_shm_channel_post_send(channel, target_rank,
+                                                send + offset, length);
+    }
+    if (source_rank >= 0) {
+      status = iree_hal_shm_channel_recv_chunk(channel, source_rank,
+                                               recv + offset, length);
+    }
+    if (target_rank >= 0) {
+      status = iree_status_join(
+          status, iree_hal_shm_channel_wait_send(channel, sequence));
+    }
+  }
+  if (source_rank < 0 && recv) memset(recv, 0, byte_length);
+  return status;
+}
+
+static iree_status_t iree_hal_shm_channel_verify_rank(
+    iree_hal_shm_channel_t* channel, int32_t rank) {
+  if (rank < 0 || rank >= channel->count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "rank %d out of range of channel with %d "
+                            "participants",
+                            rank, channel->count);
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_shm_channel_verify_span(
+    const char* name, iree_host_size_t length,
+    iree_host_size_t required_length) {
+  if (length < required_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "%s range of %" PRIhsz
+                            " bytes is smaller than the required %" PRIhsz
+                            " bytes",
+                            name, length, required_length);
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_shm_channel_execute_op(
+    iree_hal_shm_channel_t* channel, iree_hal_collective_op_t op,
+    uint32_t param, iree_const_byte_span_t send, iree_byte_span_t recv,
+    iree_device_size_t element_count) {
+  const iree_host_size_t element_size =
+      (iree_host_size_t)iree_hal_collective_element_byte_count(
+          op.element_type);
+  const iree_host_size_t count = channel->count;
+  const iree_host_size_t byte_length =
+      (iree_host_size_t)element_count * element_size;
+  if (element_size == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unsupported collective element type %u",
+                            op.element_type);
+  } else if (element_size > channel->options.staging_capacity / count) {
+    // Parts of all ranks must fit in a staging area for all-to-all ops.
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "staging capacity %" PRIhsz
+                            " too small for %" PRIhsz " ranks",
+                            channel->options.staging_capacity, count);
+  }
+
+  iree_status_t status = iree_ok_status();
+  switch (op.kind) {
+    case IREE_HAL_COLLECTIVE_KIND_ALL_GATHER: {
+      status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                byte_length);
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  count * byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_all_gather(channel, send.data,
+                                                 recv.data, byte_length);
+      }
+      break;
+    }
+    case IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE:
+    case IREE_HAL_COLLECTIVE_KIND_REDUCE: {
+      const bool is_all_reduce = op.kind == IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE;
+      const bool has_recv = is_all_reduce || channel->rank == (int32_t)param;
+      iree_hal_shm_reduce_fn_t reduce_fn = NULL;
+      iree_hal_shm_finalize_fn_t finalize_fn = NULL;
+      status = iree_hal_shm_select_reduction(op, &reduce_fn, &finalize_fn);
+      if (iree_status_is_ok(status) && !is_all_reduce) {
+        status = iree_hal_shm_channel_verify_rank(channel, (int32_t)param);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status) && has_recv) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_reduce(
+            channel, send.data, has_recv ? recv.data : NULL,
+            (iree_host_size_t)element_count, element_size, reduce_fn,
+            finalize_fn);
+      }
+      break;
+    }
+    case IREE_HAL_COLLECTIVE_KIND_ALL_TO_ALL: {
+      if (element_count % count != 0) {
+        status = iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                  "all-to-all element count %" PRIu64
+                                  " not divisible by %" PRIhsz " ranks",
+                                  (uint64_t)element_count, count);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_exchange_parts(
+            channel, send.data, recv.data,
+            (iree_host_size_t)element_count / count, element_size,
+            /*reduce_fn=*/NULL, /*finalize_fn=*/NULL);
+      }
+      break;
+    }
+    case IREE_HAL_COLLECTIVE_KIND_REDUCE_SCATTER: {
+      iree_hal_shm_reduce_fn_t reduce_fn = NULL;
+      iree_hal_shm_finalize_fn_t finalize_fn = NULL;
+      status = iree_hal_shm_select_reduction(op, &reduce_fn, &finalize_fn);
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                  count * byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_exchange_parts(
+            channel, send.data, recv.data, (iree_host_size_t)element_count,
+            element_size, reduce_fn, finalize_fn);
+      }
+      break;
+    }
+    case IREE_HAL_COLLECTIVE_KIND_BROADCAST: {
+      const int32_t root_rank = (int32_t)param;
+      const bool is_root = channel->rank == root_rank;
+      status = iree_hal_shm_channel_verify_rank(channel, root_rank);
+      if (iree_status_is_ok(status) && is_root) {
+        status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status) && (!is_root || recv.data)) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_broadcast(channel, root_rank, send.data,
+                                                recv.data, byte_length);
+      }
+      break;
+    }
+    case IREE_HAL_COLLECTIVE_KIND_SEND:
+    case IREE_HAL_COLLECTIVE_KIND_RECV:
+    case IREE_HAL_COLLECTIVE_KIND_SEND_RECV: {
+      int32_t target_rank = -1;
+      int32_t source_rank = -1;
+      if (op.kind == IREE_HAL_COLLECTIVE_KIND_SEND) {
+        target_rank = (int32_t)param;
+      } else if (op.kind == IREE_HAL_COLLECTIVE_KIND_RECV) {
+        source_rank = (int32_t)param;
+      } else {
+        const uint16_t packed_target = (uint16_t)(param & 0xFFFFu);
+        const uint16_t packed_source = (uint16_t)(param >> 16);
+        target_rank = packed_target == 0xFFFFu ? -1 : (int32_t)packed_target;
+        source_rank = packed_source == 0xFFFFu ? -1 : (int32_t)packed_source;
+      }
+      if (target_rank >= 0) {
+        status = iree_hal_shm_channel_verify_rank(channel, target_rank);
+        if (iree_status_is_ok(status)) {
+          status = iree_hal_shm_channel_verify_span("send", send.data_length,
+                                                    byte_length);
+        }
+      }
+      if (iree_status_is_ok(status) && source_rank >= 0) {
+        status = iree_hal_shm_channel_verify_rank(channel, source_rank);
+      }
+      if (iree_status_is_ok(status) &&
+          (source_rank >= 0 || op.kind == IREE_HAL_COLLECTIVE_KIND_SEND_RECV)) {
+        status = iree_hal_shm_channel_verify_span("recv", recv.data_length,
+                                                  byte_length);
+      }
+      if (iree_status_is_ok(status)) {
+        status = iree_hal_shm_channel_send_recv(channel, target_rank,
+                                                send.data, source_rank,
+                                                recv.data, byte_length);
+      }
+      break;
+    }
+    default:
+      status = iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                                "unsupported collective operation %u",
+                                op.kind);
+      break;
+  }
+  return status;
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_shm_channel_execute(
+    iree_hal_channel_t* base_channel, iree_hal_collective_op_t op,
+    uint32_t param, iree_const_byte_span_t send, iree_byte_span_t recv,
+    iree_device_size_t element_count) {
+  iree_hal_shm_channel_t* channel = iree_hal_shm_channel_cast(base_channel);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, op.kind);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, element_count);
+
+  iree_status_t status = iree_hal_shm_channel_check_failed(channel);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_shm_channel_execute_op(channel, op, param, send, recv,
+                                             element_count);
+  }
+
+  // Validation is rank-local and a rank that fails (or is aborted partway
+  // through) leaves its peers waiting on contributions that will never arrive.
+  // Marking the channel as failed releases them and fails all subsequent
+  // collectives on the channel.
+  if (!iree_status_is_ok(status)) {
+    iree_hal_shm_channel_mark_failed(channel);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static const iree_hal_channel_vtable_t iree_hal_shm_channel_vtable = {
+    .destroy = iree_hal_shm_channel_destroy,
+    .split = iree_hal_shm_channel_split,
+    .query_rank_and_count = iree_hal_shm_channel_query_rank_and_count,
+};
@@ -0,0 +1,84 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_SHM_CHANNEL_H_
+#define IREE_HAL_UTILS_SHM_CHANNEL_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_shm_channel_t
+//===----------------------------------------------------------------------===//
+
+// Specifies which participants may join a shared memory channel.
+typedef enum iree_hal_shm_channel_scope_e {
+  // All ranks are within the same process (such as multiple local devices each
+  // driving one socket). Channels rendezvous through a process-wide registry.
+  IREE_HAL_SHM_CHANNEL_SCOPE_PROCESS = 0,
+  // Ranks may be in different processes on the same host. Channels rendezvous
+  // through a POSIX shared memory object named by the channel ID.
+  IREE_HAL_SHM_CHANNEL_SCOPE_HOST = 1,
+} iree_hal_shm_channel_scope_t;
+
+// Default size of the per-rank staging area used to exchange data.
+// Operations larger than this are performed in multiple chunks.
+#define IREE_HAL_SHM_CHANNEL_DEFAULT_STAGING_CAPACITY (4 * 1024 * 1024)
+
+// Options controlling how shared memory channels are created.
+typedef struct iree_hal_shm_channel_options_t {
+  // Which participants may join the channel.
+  iree_hal_shm_channel_scope_t scope;
+  // Size in bytes of the staging area each rank has in the shared region.
+  // Must be a multiple of 64 bytes. All ranks must use the same value.
+  iree_host_size_t staging_capacity;
+} iree_hal_shm_channel_options_t;
+
+// Initializes |out_options| to default values.
+IREE_API_EXPORT void iree_hal_shm_channel_options_initialize(
+    iree_hal_shm_channel_options_t* out_options);
+
+// Creates a channel for |params.rank| of |params.count| participants that
+// communicate through shared memory. All participants must use the same
+// |params.id| (or |params.group| if the ID is empty) to identify the channel
+// and creation blocks until all participants have joined.
+//
+// Collective operations are performed synchronously on the calling thread with
+// iree_hal_shm_channel_execute and block until all participants involved have
+// made their contribution. Each rank must be able to make progress
+// independently: if multiple ranks share an executor it must have enough
+// workers to run all of their collectives concurrently.
+IREE_API_EXPORT iree_status_t iree_hal_shm_channel_create(
+    const iree_hal_shm_channel_options_t* options,
+    iree_hal_channel_params_t params, iree_allocator_t host_allocator,
+    iree_hal_channel_t** out_channel);
+
+// Returns true if |channel| is a shared memory channel.
+IREE_API_EXPORT bool iree_hal_shm_channel_isa(iree_hal_channel_t* channel);
+
+// Performs the collective operation |op| on |channel| with the semantics of
+// iree_hal_command_buffer_collective. |send| and |recv| are host memory ranges
+// that must be large enough for the operation (or empty if unused by the op).
+// Blocks the caller until the operation has completed on this rank.
+//
+// If the operation fails on any rank (including failing validation of its
+// arguments) the channel is marked as failed: participants blocked waiting on
+// that rank and all subsequent operations on the channel fail with
+// IREE_STATUS_ABORTED.
+IREE_API_EXPORT iree_status_t iree_hal_shm_channel_execute(
+    iree_hal_channel_t* channel, iree_hal_collective_op_t op, uint32_t param,
+    iree_const_byte_span_t send, iree_byte_span_t recv,
+    iree_device_size_t element_count);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_SHM_CHANNEL_H_
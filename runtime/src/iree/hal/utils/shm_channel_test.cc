@@ -0,0 +1,437 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/shm_channel.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+#if defined(IREE_PLATFORM_LINUX) && !defined(IREE_PLATFORM_ANDROID)
+#include <unistd.h>
+#endif  // IREE_PLATFORM_LINUX && !IREE_PLATFORM_ANDROID
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+// Small enough that most tests below are split into multiple chunks.
+static constexpr iree_host_size_t kStagingCapacity = 256;
+
+static iree_hal_collective_op_t MakeOp(
+    iree_hal_collective_kind_t kind,
+    iree_hal_collective_element_type_t element_type,
+    iree_hal_collective_reduction_t reduction =
+        IREE_HAL_COLLECTIVE_REDUCTION_NONE) {
+  iree_hal_collective_op_t op;
+  op.packed = 0;
+  op.kind = kind;
+  op.reduction = reduction;
+  op.element_type = element_type;
+  return op;
+}
+
+template <typename T>
+static iree_const_byte_span_t ConstSpan(const std::vector<T>& values) {
+  return iree_make_const_byte_span(values.data(), values.size() * sizeof(T));
+}
+
+template <typename T>
+static iree_byte_span_t Span(std::vector<T>& values) {
+  return iree_make_byte_span(values.data(), values.size() * sizeof(T));
+}
+
+class ShmChannelTest : public ::testing::Test {
+ protected:
+  // Runs |fn| on |count| threads, each with a channel for its rank.
+  void RunRanks(const char* group, int32_t count,
+                std::function<void(iree_hal_channel_t*, int32_t)> fn,
+                iree_hal_shm_channel_scope_t scope =
+                    IREE_HAL_SHM_CHANNEL_SCOPE_PROCESS) {
+    iree_hal_shm_channel_options_t options;
+    iree_hal_shm_channel_options_initialize(&options);
+    options.scope = scope;
+    options.staging_capacity = kStagingCapacity;
+    std::vector<std::thread> threads;
+    for (int32_t rank = 0; rank < count; ++rank) {
+      threads.emplace_back([&, rank]() {
+        iree_hal_channel_params_t params = {0};
+        params.group = iree_make_cstring_view(group);
+        params.rank = rank;
+        params.count = count;
+        iree_hal_channel_t* channel = NULL;
+        IREE_ASSERT_OK(iree_hal_shm_channel_create(
+            &options, params, iree_allocator_system(), &channel));
+        fn(channel, rank);
+        iree_hal_channel_release(channel);
+      });
+    }
+    for (auto& thread : threads) thread.join();
+  }
+};
+
+TEST_F(ShmChannelTest, CreateQueryRelease) {
+  RunRanks("create", 3, [](iree_hal_channel_t* channel, int32_t rank) {
+    EXPECT_TRUE(iree_hal_shm_channel_isa(channel));
+    int32_t queried_rank = -1, queried_count = -1;
+    iree_hal_channel_query_rank_and_count(channel, &queried_rank,
+                                          &queried_count);
+    EXPECT_EQ(queried_rank, rank);
+    EXPECT_EQ(queried_count, 3);
+  });
+  // The name can be reused once the prior channel has fully rendezvoused.
+  RunRanks("create", 2, [](iree_hal_channel_t* channel, int32_t rank) {
+    EXPECT_EQ(iree_hal_channel_count(channel), 2);
+  });
+}
+
+TEST_F(ShmChannelTest, InvalidRank) {
+  iree_hal_shm_channel_options_t options;
+  iree_hal_shm_channel_options_initialize(&options);
+  iree_hal_channel_params_t params = {0};
+  params.rank = IREE_HAL_CHANNEL_RANK_DEFAULT;
+  params.count = IREE_HAL_CHANNEL_COUNT_DEFAULT;
+  iree_hal_channel_t* channel = NULL;
+  EXPECT_THAT(Status(iree_hal_shm_channel_create(
+                  &options, params, iree_allocator_system(), &channel)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_EQ(channel, nullptr);
+}
+
+TEST_F(ShmChannelTest, AllReduceSum) {
+  static constexpr int32_t kCount = 4;
+  static constexpr size_t kElementCount = 1000;  // > 1 chunk
+  RunRanks("all_reduce", kCount, [](iree_hal_channel_t* channel,
+                                    int32_t rank) {
+    std::vector<int32_t> send(kElementCount);
+    for (size_t i = 0; i < kElementCount; ++i) send[i] = (int32_t)i + rank;
+    std::vector<int32_t> recv(kElementCount, -1);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+        0, ConstSpan(send), Span(recv), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) {
+      ASSERT_EQ(recv[i], (int32_t)(i * kCount) + 0 + 1 + 2 + 3);
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, AllReduceInPlaceTypes) {
+  static constexpr int32_t kCount = 3;
+  static constexpr size_t kElementCount = 100;
+  RunRanks("all_reduce_types", kCount, [](iree_hal_channel_t* channel,
+                                          int32_t rank) {
+    // Maximum of f32 in place.
+    std::vector<float> values(kElementCount);
+    for (size_t i = 0; i < kElementCount; ++i) {
+      values[i] = (float)((i + rank) % kCount);
+    }
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_FLOAT_32,
+               IREE_HAL_COLLECTIVE_REDUCTION_MAXIMUM),
+        0, ConstSpan(values), Span(values), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) {
+      ASSERT_EQ(values[i], (float)(kCount - 1));
+    }
+
+    // Average of f64.
+    std::vector<double> doubles(kElementCount, (double)rank);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_FLOAT_64,
+               IREE_HAL_COLLECTIVE_REDUCTION_AVERAGE),
+        0, ConstSpan(doubles), Span(doubles), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) ASSERT_EQ(doubles[i], 1.0);
+
+    // Sum of bf16 (1.0 = 0x3F80, 3.0 = 0x4040).
+    std::vector<uint16_t> bf16s(kElementCount, 0x3F80);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_BFLOAT_16,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+        0, ConstSpan(bf16s), Span(bf16s), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) ASSERT_EQ(bf16s[i], 0x4040);
+  });
+}
+
+TEST_F(ShmChannelTest, Reduce) {
+  static constexpr int32_t kCount = 3;
+  static constexpr size_t kElementCount = 70;
+  RunRanks("reduce", kCount, [](iree_hal_channel_t* channel, int32_t rank) {
+    std::vector<int64_t> send(kElementCount, rank + 2);
+    std::vector<int64_t> recv(kElementCount, -1);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_64,
+               IREE_HAL_COLLECTIVE_REDUCTION_PRODUCT),
+        /*param=*/1, ConstSpan(send), Span(recv), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) {
+      ASSERT_EQ(recv[i], rank == 1 ? 2 * 3 * 4 : -1);
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, AllGather) {
+  static constexpr int32_t kCount = 4;
+  static constexpr size_t kElementCount = 300;
+  RunRanks("all_gather", kCount, [](iree_hal_channel_t* channel,
+                                    int32_t rank) {
+    std::vector<uint8_t> send(kElementCount);
+    for (size_t i = 0; i < kElementCount; ++i) send[i] = (uint8_t)(i * rank);
+    std::vector<uint8_t> recv(kElementCount * kCount);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_GATHER,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_8),
+        0, ConstSpan(send), Span(recv), kElementCount));
+    for (int32_t r = 0; r < kCount; ++r) {
+      for (size_t i = 0; i < kElementCount; ++i) {
+        ASSERT_EQ(recv[r * kElementCount + i], (uint8_t)(i * r));
+      }
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, ReduceScatter) {
+  static constexpr int32_t kCount = 4;
+  static constexpr size_t kElementCount = 50;  // per rank
+  RunRanks("reduce_scatter", kCount, [](iree_hal_channel_t* channel,
+                                        int32_t rank) {
+    std::vector<uint32_t> send(kElementCount * kCount);
+    for (size_t i = 0; i < send.size(); ++i) send[i] = (uint32_t)(i + rank);
+    std::vector<uint32_t> recv(kElementCount);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_REDUCE_SCATTER,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_32,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+        0, ConstSpan(send), Span(recv), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) {
+      ASSERT_EQ(recv[i], (uint32_t)((rank * kElementCount + i) * kCount + 6));
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, AllToAll) {
+  static constexpr int32_t kCount = 3;
+  static constexpr size_t kElementCount = 90;
+  static constexpr size_t kPartCount = kElementCount / kCount;
+  RunRanks("all_to_all", kCount, [](iree_hal_channel_t* channel,
+                                    int32_t rank) {
+    std::vector<int16_t> send(kElementCount);
+    for (size_t i = 0; i < kElementCount; ++i) {
+      send[i] = (int16_t)(rank * 1000 + i);
+    }
+    std::vector<int16_t> recv(kElementCount);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_TO_ALL,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_16),
+        0, ConstSpan(send), Span(recv), kElementCount));
+    for (int32_t r = 0; r < kCount; ++r) {
+      for (size_t i = 0; i < kPartCount; ++i) {
+        ASSERT_EQ(recv[r * kPartCount + i],
+                  (int16_t)(r * 1000 + rank * kPartCount + i));
+      }
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, Broadcast) {
+  static constexpr int32_t kCount = 3;
+  static constexpr size_t kElementCount = 200;
+  RunRanks("broadcast", kCount, [](iree_hal_channel_t* channel,
+                                   int32_t rank) {
+    std::vector<int32_t> values(kElementCount, rank == 2 ? 42 : 0);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_BROADCAST,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32),
+        /*param=*/2, ConstSpan(values), Span(values), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) ASSERT_EQ(values[i], 42);
+  });
+}
+
+TEST_F(ShmChannelTest, SendRecv) {
+  static constexpr size_t kElementCount = 150;
+  RunRanks("send_recv", 2, [](iree_hal_channel_t* channel, int32_t rank) {
+    std::vector<uint64_t> values(kElementCount);
+    for (size_t i = 0; i < kElementCount; ++i) values[i] = i * 7;
+    if (rank == 0) {
+      IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+          channel,
+          MakeOp(IREE_HAL_COLLECTIVE_KIND_SEND,
+                 IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_64),
+          /*param=*/1, ConstSpan(values), iree_byte_span_empty(),
+          kElementCount));
+    } else {
+      std::vector<uint64_t> recv(kElementCount);
+      IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+          channel,
+          MakeOp(IREE_HAL_COLLECTIVE_KIND_RECV,
+                 IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_64),
+          /*param=*/0, iree_const_byte_span_empty(), Span(recv),
+          kElementCount));
+      EXPECT_EQ(recv, values);
+    }
+  });
+}
+
+// All ranks send to the next rank and receive from the previous rank with
+// the last rank only receiving; this would deadlock if sends blocked before
+// receiving.
+TEST_F(ShmChannelTest, SendRecvRing) {
+  static constexpr int32_t kCount = 4;
+  static constexpr size_t kElementCount = 100;
+  RunRanks("send_recv_ring", kCount, [](iree_hal_channel_t* channel,
+                                        int32_t rank) {
+    std::vector<int32_t> send(kElementCount, rank + 1);
+    std::vector<int32_t> recv(kElementCount, -1);
+    uint32_t target = rank == kCount - 1 ? 0xFFFFu : (uint32_t)(rank + 1);
+    uint32_t source = rank == 0 ? 0xFFFFu : (uint32_t)(rank - 1);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_SEND_RECV,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32),
+        (source << 16) | target, ConstSpan(send), Span(recv), kElementCount));
+    for (size_t i = 0; i < kElementCount; ++i) {
+      ASSERT_EQ(recv[i], rank == 0 ? 0 : rank);
+    }
+  });
+}
+
+// A rank that rejects its arguments must not leave its peers blocked waiting
+// for its contribution: all ranks fail and the channel stays failed.
+TEST_F(ShmChannelTest, ValidationFailureAbortsPeers) {
+  static constexpr int32_t kCount = 3;
+  static constexpr size_t kElementCount = 100;
+  RunRanks("validation_failure", kCount, [](iree_hal_channel_t* channel,
+                                            int32_t rank) {
+    std::vector<int32_t> send(kElementCount, rank);
+    // Rank 1 provides a recv range that is too small.
+    std::vector<int32_t> recv(rank == 1 ? kElementCount / 2 : kElementCount);
+    iree_hal_collective_op_t op =
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM);
+    Status status(iree_hal_shm_channel_execute(
+        channel, op, 0, ConstSpan(send), Span(recv), kElementCount));
+    if (rank == 1) {
+      EXPECT_THAT(status, StatusIs(StatusCode::kOutOfRange));
+    } else {
+      EXPECT_THAT(status, StatusIs(StatusCode::kAborted));
+    }
+
+    // Subsequent valid collectives fail immediately on all ranks.
+    recv.resize(kElementCount);
+    EXPECT_THAT(Status(iree_hal_shm_channel_execute(
+                    channel, op, 0, ConstSpan(send), Span(recv),
+                    kElementCount)),
+                StatusIs(StatusCode::kAborted));
+  });
+}
+
+// Point-to-point transfers only involve two ranks but a failing receiver must
+// still release a sender waiting for its acknowledgement.
+TEST_F(ShmChannelTest, RecvFailureAbortsSender) {
+  static constexpr size_t kElementCount = 150;  // > 1 chunk
+  RunRanks("recv_failure", 2, [](iree_hal_channel_t* channel, int32_t rank) {
+    std::vector<uint32_t> values(kElementCount, 7);
+    if (rank == 0) {
+      EXPECT_THAT(Status(iree_hal_shm_channel_execute(
+                      channel,
+                      MakeOp(IREE_HAL_COLLECTIVE_KIND_SEND,
+                             IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_32),
+                      /*param=*/1, ConstSpan(values), iree_byte_span_empty(),
+                      kElementCount)),
+                  StatusIs(StatusCode::kAborted));
+    } else {
+      EXPECT_THAT(Status(iree_hal_shm_channel_execute(
+                      channel,
+                      MakeOp(IREE_HAL_COLLECTIVE_KIND_RECV,
+                             IREE_HAL_COLLECTIVE_ELEMENT_TYPE_UINT_32),
+                      /*param=*/0, iree_const_byte_span_empty(),
+                      iree_byte_span_empty(), kElementCount)),
+                  StatusIs(StatusCode::kOutOfRange));
+    }
+  });
+}
+
+TEST_F(ShmChannelTest, Split) {
+  static constexpr int32_t kCount = 4;
+  RunRanks("split", kCount, [](iree_hal_channel_t* channel, int32_t rank) {
+    // Even and odd ranks form two groups ordered by descending parent rank.
+    // Rank 3 opts out.
+    int32_t color = rank == 3 ? IREE_HAL_CHANNEL_NO_COLOR : rank % 2;
+    iree_hal_channel_t* split_channel = NULL;
+    IREE_ASSERT_OK(iree_hal_channel_split(channel, color, /*key=*/-rank,
+                                          IREE_HAL_CHANNEL_FLAG_NONE,
+                                          &split_channel));
+    if (rank == 3) {
+      EXPECT_EQ(split_channel, nullptr);
+      return;
+    }
+    ASSERT_NE(split_channel, nullptr);
+    int32_t split_rank = -1, split_count = -1;
+    iree_hal_channel_query_rank_and_count(split_channel, &split_rank,
+                                          &split_count);
+    EXPECT_EQ(split_count, rank % 2 == 0 ? 2 : 1);
+    EXPECT_EQ(split_rank, rank == 0 ? 1 : 0);
+
+    std::vector<int32_t> values(8, rank);
+    IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+        split_channel,
+        MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+               IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32,
+               IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+        0, ConstSpan(values), Span(values), values.size()));
+    for (int32_t value : values) EXPECT_EQ(value, rank % 2 == 0 ? 2 : 1);
+    iree_hal_channel_release(split_channel);
+  });
+}
+
+#if defined(IREE_PLATFORM_LINUX) && !defined(IREE_PLATFORM_ANDROID)
+// Host-scoped channels map a named shared memory object; threads in the same
+// process exercise the same paths as separate processes would.
+TEST_F(ShmChannelTest, HostScopeAllReduce) {
+  static constexpr int32_t kCount = 2;
+  static constexpr size_t kElementCount = 500;
+  std::string group = "host_all_reduce_" + std::to_string(getpid());
+  RunRanks(
+      group.c_str(), kCount,
+      [](iree_hal_channel_t* channel, int32_t rank) {
+        std::vector<int32_t> values(kElementCount, rank + 1);
+        IREE_ASSERT_OK(iree_hal_shm_channel_execute(
+            channel,
+            MakeOp(IREE_HAL_COLLECTIVE_KIND_ALL_REDUCE,
+                   IREE_HAL_COLLECTIVE_ELEMENT_TYPE_SINT_32,
+                   IREE_HAL_COLLECTIVE_REDUCTION_SUM),
+            0, ConstSpan(values), Span(values), kElementCount));
+        for (int32_t value : values) ASSERT_EQ(value, 3);
+      },
+      IREE_HAL_SHM_CHANNEL_SCOPE_HOST);
+}
+#endif  // IREE_PLATFORM_LINUX && !IREE_PLATFORM_ANDROID
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
@@ -0,0 +1,935 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/slab_allocator.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/math.h"
+#include "iree/base/internal/synchronization.h"
+
+// Minimum granularity of sub-allocations in bytes. Sub-allocation offsets and
+// sizes are aligned to the larger of this and the heap minimum alignment.
+#define IREE_HAL_SLAB_ALLOCATOR_MIN_GRANULARITY 64
+
+// Number of bits used to subdivide each power-of-two first-level bin into
+// second-level bins. Larger values reduce internal fragmentation at the cost
+// of larger bin tables.
+#define IREE_HAL_SLAB_ALLOCATOR_SL_BITS 4
+#define IREE_HAL_SLAB_ALLOCATOR_SL_COUNT (1u << IREE_HAL_SLAB_ALLOCATOR_SL_BITS)
+
+// Number of first-level bins; one per power of two.
+#define IREE_HAL_SLAB_ALLOCATOR_FL_COUNT 64
+
+// Number of blocks and buffers allocated at a time when their free lists are
+// exhausted.
+#define IREE_HAL_SLAB_ALLOCATOR_METADATA_CHUNK_CAPACITY 64
+
+// Buffer usage that cannot be serviced by sub-allocations as the buffers may
+// outlive the allocator or be shared with other processes.
+#define IREE_HAL_SLAB_ALLOCATOR_UNSUPPORTED_USAGE \
+  (IREE_HAL_BUFFER_USAGE_SHARING_EXPORT |         \
+   IREE_HAL_BUFFER_USAGE_SHARING_IMMUTABLE |      \
+   IREE_HAL_BUFFER_USAGE_SHARING_REPLICATE)
+
+void iree_hal_slab_allocator_params_initialize(
+    iree_hal_allocator_memory_heap_t heap,
+    iree_hal_slab_allocator_params_t* out_params) {
+  IREE_ASSERT_ARGUMENT(out_params);
+  memset(out_params, 0, sizeof(*out_params));
+  out_params->heap = heap;
+  out_params->slab_size = iree_min(IREE_HAL_SLAB_ALLOCATOR_DEFAULT_SLAB_SIZE,
+                                   heap.max_allocation_size);
+  out_params->max_capacity = IREE_DEVICE_SIZE_MAX;
+}
+
+//===----------------------------------------------------------------------===//
+// Slab and block bookkeeping
+//===----------------------------------------------------------------------===//
+
+// A large allocation from the underlying allocator that is sub-allocated.
+typedef struct iree_hal_slab_t {
+  // Neighbors in the allocator slab list.
+  struct iree_hal_slab_t* prev;
+  struct iree_hal_slab_t* next;
+  // Retained storage buffer allocated from the underlying allocator.
+  iree_hal_buffer_t* buffer;
+  // Total size of the slab in bytes.
+  iree_device_size_t size;
+  // True if the slab services a single oversized allocation and should be
+  // released as soon as that allocation is.
+  bool dedicated;
+} iree_hal_slab_t;
+
+// A contiguous range of a slab that is either free or allocated.
+// Blocks are stored out-of-band from the slab memory as it may not be
+// host-accessible.
+typedef struct iree_hal_slab_block_t {
+  // Slab the block is a range of.
+  iree_hal_slab_t* slab;
+  // Offset of the block in the slab in bytes.
+  iree_device_size_t offset;
+  // Size of the block in bytes.
+  iree_device_size_t size;
+  // Adjacent blocks in the slab, if any.
+  struct iree_hal_slab_block_t* prev_physical;
+  struct iree_hal_slab_block_t* next_physical;
+  // Neighbors in the free list of the block bin when free. |next_free| is also
+  // used to link unused blocks.
+  struct iree_hal_slab_block_t* prev_free;
+  struct iree_hal_slab_block_t* next_free;
+  // True if the block is available for allocation.
+  bool is_free;
+} iree_hal_slab_block_t;
+
+// A buffer sub-allocated from a slab.
+typedef struct iree_hal_slab_buffer_t {
+  iree_hal_buffer_t base;
+  // Allocated block; NULL when the buffer is unused.
+  iree_hal_slab_block_t* block;
+  // Next unused buffer in the allocator free list.
+  struct iree_hal_slab_buffer_t* next_free;
+} iree_hal_slab_buffer_t;
+
+// A chunk of block and buffer storage. Chunks are only freed when the
+// allocator is destroyed.
+typedef struct iree_hal_slab_metadata_chunk_t {
+  struct iree_hal_slab_metadata_chunk_t* next;
+  iree_hal_slab_block_t blocks[IREE_HAL_SLAB_ALLOCATOR_METADATA_CHUNK_CAPACITY];
+  iree_hal_slab_buffer_t
+      buffers[IREE_HAL_SLAB_ALLOCATOR_METADATA_CHUNK_CAPACITY];
+} iree_hal_slab_metadata_chunk_t;
+
+//===----------------------------------------------------------------------===//
+// iree_hal_slab_allocator_t
+//===----------------------------------------------------------------------===//
+
+struct iree_hal_slab_allocator_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+
+  // Underlying device allocator used to allocate slabs.
+  // We also route down to it for things we don't support (import/export/etc).
+  iree_hal_allocator_t* device_allocator;
+
+  iree_hal_slab_allocator_params_t params;
+
+  // Parameters used to allocate slabs from the underlying allocator.
+  iree_hal_buffer_params_t slab_params;
+
+  // Alignment of all block offsets and sizes in bytes.
+  iree_device_size_t granularity;
+
+  // Guards all mutable allocator state. Not held while allocating or releasing
+  // slabs from the underlying allocator.
+  iree_slim_mutex_t mutex;
+
+  // Total size of all slabs in bytes including those being allocated.
+  iree_device_size_t total_slab_size;
+
+  // All live slabs.
+  iree_hal_slab_t* slab_head;
+
+  // One bit per first-level bin indicating whether any of its second-level
+  // bins are non-empty.
+  uint64_t fl_bitmap;
+  // One bit per second-level bin indicating whether it is non-empty.
+  uint32_t sl_bitmaps[IREE_HAL_SLAB_ALLOCATOR_FL_COUNT];
+  // Free blocks in each bin.
+  iree_hal_slab_block_t* free_blocks[IREE_HAL_SLAB_ALLOCATOR_FL_COUNT]
+                                    [IREE_HAL_SLAB_ALLOCATOR_SL_COUNT];
+
+  // Unused block and buffer metadata.
+  iree_hal_slab_block_t* unused_blocks;
+  iree_hal_slab_buffer_t* unused_buffers;
+
+  // All metadata storage chunks.
+  iree_hal_slab_metadata_chunk_t* metadata_chunks;
+};
+
+static const iree_hal_allocator_vtable_t iree_hal_slab_allocator_vtable;
+static const iree_hal_buffer_vtable_t iree_hal_slab_buffer_vtable;
+
+static iree_hal_slab_allocator_t* iree_hal_slab_allocator_cast(
+    iree_hal_allocator_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_slab_allocator_vtable);
+  return (iree_hal_slab_allocator_t*)base_value;
+}
+
+// Maps a block of |size| bytes to its first and second level bin.
+static void iree_hal_slab_allocator_map_size(
+    iree_hal_slab_allocator_t* allocator, iree_device_size_t size,
+    iree_host_size_t* out_fl, iree_host_size_t* out_sl) {
+  const uint64_t units = (uint64_t)(size / allocator->granularity);
+  if (units < IREE_HAL_SLAB_ALLOCATOR_SL_COUNT) {
+    *out_fl = 0;
+    *out_sl = (iree_host_size_t)units;
+    return;
+  }
+  const int log2_units = 63 - iree_math_count_leading_zeros_u64(units);
+  *out_fl =
+      (iree_host_size_t)(log2_units - IREE_HAL_SLAB_ALLOCATOR_SL_BITS + 1);
+  *out_sl = (iree_host_size_t)(units >>
+                               (log2_units - IREE_HAL_SLAB_ALLOCATOR_SL_BITS)) &
+            (IREE_HAL_SLAB_ALLOCATOR_SL_COUNT - 1);
+}
+
+// Inserts a free |block| into the bin for its size.
+//
+// Must be called with the allocator mutex held.
+static void iree_hal_slab_allocator_insert_free_block(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_block_t* block) {
+  iree_host_size_t fl = 0, sl = 0;
+  iree_hal_slab_allocator_map_size(allocator, block->size, &fl, &sl);
+  block->is_free = true;
+  block->prev_free = NULL;
+  block->next_free = allocator->free_blocks[fl][sl];
+  if (block->next_free) block->next_free->prev_free = block;
+  allocator->free_blocks[fl][sl] = block;
+  allocator->fl_bitmap |= 1ull << fl;
+  allocator->sl_bitmaps[fl] |= 1u << sl;
+}
+
+// Removes a free |block| from the bin for its size.
+//
+// Must be called with the allocator mutex held.
+static void iree_hal_slab_allocator_remove_free_block(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_block_t* block) {
+  iree_host_size_t fl = 0, sl = 0;
+  iree_hal_slab_allocator_map_size(allocator, block->size, &fl, &sl);
+  if (block->prev_free) {
+    block->prev_free->next_free = block->next_free;
+  } else {
+    allocator->free_blocks[fl][sl] = block->next_free;
+    if (!block->next_free) {
+      allocator->sl_bitmaps[fl] &= ~(1u << sl);
+      if (!allocator->sl_bitmaps[fl]) allocator->fl_bitmap &= ~(1ull << fl);
+    }
+  }
+  if (block->next_free) block->next_free->prev_free = block->prev_free;
+  block->prev_free = NULL;
+  block->next_free = NULL;
+  block->is_free = false;
+}
+
+// Returns a free block of at least |size| bytes or NULL if none is available.
+// The size is rounded up to the next bin so that any block in the bin found
+// is large enough. If no such bin has blocks the bin |size| maps to is
+// searched for one that happens to fit such as a slab allocated for exactly
+// |size| bytes.
+//
+// Must be called with the allocator mutex held.
+static iree_hal_slab_block_t* iree_hal_slab_allocator_find_free_block(
+    iree_hal_slab_allocator_t* allocator, iree_device_size_t size) {
+  uint64_t units = (uint64_t)(size / allocator->granularity);
+  if (units >= IREE_HAL_SLAB_ALLOCATOR_SL_COUNT) {
+    const int log2_units = 63 - iree_math_count_leading_zeros_u64(units);
+    units += (1ull << (log2_units - IREE_HAL_SLAB_ALLOCATOR_SL_BITS)) - 1;
+  }
+  iree_host_size_t fl = 0, sl = 0;
+  iree_hal_slab_allocator_map_size(allocator, units * allocator->granularity,
+                                   &fl, &sl);
+
+  // Search the remaining bins of the first-level bin and then the next
+  // non-empty first-level bin.
+  uint32_t sl_map = fl < IREE_HAL_SLAB_ALLOCATOR_FL_COUNT
+                        ? allocator->sl_bitmaps[fl] & (~0u << sl)
+                        : 0;
+  if (!sl_map) {
+    const uint64_t fl_map =
+        fl + 1 < IREE_HAL_SLAB_ALLOCATOR_FL_COUNT
+            ? allocator->fl_bitmap & (~0ull << (fl + 1))
+            : 0;
+    if (fl_map) {
+      fl = iree_math_count_trailing_zeros_u64(fl_map);
+      sl_map = allocator->sl_bitmaps[fl];
+    }
+  }
+  if (sl_map) {
+    sl = iree_math_count_trailing_zeros_u32(sl_map);
+    return allocator->free_blocks[fl][sl];
+  }
+
+  // Fall back to a first-fit scan of the bin |size| maps to.
+  iree_hal_slab_allocator_map_size(allocator, size, &fl, &sl);
+  for (iree_hal_slab_block_t* block = allocator->free_blocks[fl][sl];
+       block != NULL; block = block->next_free) {
+    if (block->size >= size) return block;
+  }
+  return NULL;
+}
+
+// Ensures that at least two unused blocks and one unused buffer are available.
+//
+// Must be called with the allocator mutex held.
+static iree_status_t iree_hal_slab_allocator_reserve_metadata(
+    iree_hal_slab_allocator_t* allocator) {
+  if (allocator->unused_buffers && allocator->unused_blocks &&
+      allocator->unused_blocks->next_free) {
+    return iree_ok_status();
+  }
+  iree_hal_slab_metadata_chunk_t* chunk = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      allocator->host_allocator, sizeof(*chunk), (void**)&chunk));
+  chunk->next = allocator->metadata_chunks;
+  allocator->metadata_chunks = chunk;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(chunk->blocks); ++i) {
+    chunk->blocks[i].next_free = allocator->unused_blocks;
+    allocator->unused_blocks = &chunk->blocks[i];
+  }
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(chunk->buffers); ++i) {
+    chunk->buffers[i].next_free = allocator->unused_buffers;
+    allocator->unused_buffers = &chunk->buffers[i];
+  }
+  return iree_ok_status();
+}
+
+// Pops an unused block; metadata must have been reserved.
+//
+// Must be called with the allocator mutex held.
+static iree_hal_slab_block_t* iree_hal_slab_allocator_pop_unused_block(
+    iree_hal_slab_allocator_t* allocator) {
+  iree_hal_slab_block_t* block = allocator->unused_blocks;
+  allocator->unused_blocks = block->next_free;
+  memset(block, 0, sizeof(*block));
+  return block;
+}
+
+// Returns |block| to the unused list.
+//
+// Must be called with the allocator mutex held.
+static void iree_hal_slab_allocator_push_unused_block(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_block_t* block) {
+  block->slab = NULL;
+  block->next_free = allocator->unused_blocks;
+  allocator->unused_blocks = block;
+}
+
+// Releases a |slab| that has been unlinked from the allocator and whose blocks
+// have been returned to the unused list.
+//
+// The allocator mutex must not be held by the caller.
+static void iree_hal_slab_allocator_release_slab(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_t* slab) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)slab->size);
+  iree_hal_buffer_release(slab->buffer);
+  iree_allocator_free(allocator->host_allocator, slab);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Unlinks |slab| from the allocator and returns its single free |block| to the
+// unused list. The caller must release the slab after dropping the mutex.
+//
+// Must be called with the allocator mutex held.
+static void iree_hal_slab_allocator_unlink_slab(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_t* slab,
+    iree_hal_slab_block_t* block) {
+  if (slab->prev) {
+    slab->prev->next = slab->next;
+  } else {
+    allocator->slab_head = slab->next;
+  }
+  if (slab->next) slab->next->prev = slab->prev;
+  slab->prev = NULL;
+  slab->next = NULL;
+  iree_hal_slab_allocator_push_unused_block(allocator, block);
+  allocator->total_slab_size -= slab->size;
+}
+
+// Unlinks all slabs that have no outstanding allocations and returns them as a
+// list. Dedicated slabs are released when their allocation is so are never
+// unused.
+//
+// Must be called with the allocator mutex held.
+static iree_hal_slab_t* iree_hal_slab_allocator_unlink_unused_slabs(
+    iree_hal_slab_allocator_t* allocator) {
+  iree_hal_slab_t* unused_slabs = NULL;
+  iree_hal_slab_t* slab = allocator->slab_head;
+  while (slab) {
+    iree_hal_slab_t* next_slab = slab->next;
+    // A slab is unused if it is covered by a single free block. We find the
+    // block by looking at the bin for the full slab size.
+    iree_host_size_t fl = 0, sl = 0;
+    iree_hal_slab_allocator_map_size(allocator, slab->size, &fl, &sl);
+    for (iree_hal_slab_block_t* block = allocator->free_blocks[fl][sl];
+         block != NULL; block = block->next_free) {
+      if (block->slab == slab && block->size == slab->size) {
+        iree_hal_slab_allocator_remove_free_block(allocator, block);
+        iree_hal_slab_allocator_unlink_slab(allocator, slab, block);
+        slab->next = unused_slabs;
+        unused_slabs = slab;
+        break;
+      }
+    }
+    slab = next_slab;
+  }
+  return unused_slabs;
+}
+
+// Releases all slabs with no outstanding allocations.
+//
+// The allocator mutex must not be held by the caller.
+static void iree_hal_slab_allocator_release_unused_slabs(
+    iree_hal_slab_allocator_t* allocator) {
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_slab_t* unused_slabs =
+      iree_hal_slab_allocator_unlink_unused_slabs(allocator);
+  iree_slim_mutex_unlock(&allocator->mutex);
+  while (unused_slabs) {
+    iree_hal_slab_t* next_slab = unused_slabs->next;
+    iree_hal_slab_allocator_release_slab(allocator, unused_slabs);
+    unused_slabs = next_slab;
+  }
+}
+
+// Allocates a new slab able to hold at least |min_size| bytes and inserts it
+// into the free bins. Fails if the slab would exceed the allocator capacity.
+//
+// Must be called with the allocator mutex held; the mutex is dropped while the
+// slab is allocated from the underlying allocator.
+static iree_status_t iree_hal_slab_allocator_grow(
+    iree_hal_slab_allocator_t* allocator, iree_device_size_t min_size) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)min_size);
+
+  const bool dedicated = min_size > allocator->params.slab_size;
+  const iree_device_size_t slab_size =
+      dedicated ? min_size : allocator->params.slab_size;
+
+  // If over budget release any unused slabs (which must be too small for the
+  // request or we wouldn't be growing) and try again.
+  if (slab_size > allocator->params.max_capacity - allocator->total_slab_size) {
+    iree_hal_slab_t* unused_slabs =
+        iree_hal_slab_allocator_unlink_unused_slabs(allocator);
+    if (unused_slabs) {
+      iree_slim_mutex_unlock(&allocator->mutex);
+      while (unused_slabs) {
+        iree_hal_slab_t* next_slab = unused_slabs->next;
+        iree_hal_slab_allocator_release_slab(allocator, unused_slabs);
+        unused_slabs = next_slab;
+      }
+      iree_slim_mutex_lock(&allocator->mutex);
+    }
+  }
+  if (slab_size > allocator->params.max_capacity - allocator->total_slab_size) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(
+        IREE_STATUS_RESOURCE_EXHAUSTED,
+        "slab allocator capacity exceeded: %" PRIdsz
+        "B requested with %" PRIdsz "B of %" PRIdsz "B capacity in use",
+        min_size, allocator->total_slab_size, allocator->params.max_capacity);
+  }
+
+  // Reserve the slab size so that other threads growing concurrently account
+  // for it and then allocate without holding the lock.
+  allocator->total_slab_size += slab_size;
+  iree_slim_mutex_unlock(&allocator->mutex);
+  iree_hal_slab_t* slab = NULL;
+  iree_status_t status = iree_allocator_malloc(allocator->host_allocator,
+                                               sizeof(*slab), (void**)&slab);
+  if (iree_status_is_ok(status)) {
+    memset(slab, 0, sizeof(*slab));
+    slab->size = slab_size;
+    slab->dedicated = dedicated;
+    status = iree_hal_allocator_allocate_buffer(
+        allocator->device_allocator, allocator->slab_params, slab_size,
+        iree_const_byte_span_empty(), &slab->buffer);
+  }
+  iree_slim_mutex_lock(&allocator->mutex);
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_slab_allocator_reserve_metadata(allocator);
+  }
+  if (iree_status_is_ok(status)) {
+    slab->next = allocator->slab_head;
+    if (slab->next) slab->next->prev = slab;
+    allocator->slab_head = slab;
+    iree_hal_slab_block_t* block =
+        iree_hal_slab_allocator_pop_unused_block(allocator);
+    block->slab = slab;
+    block->offset = 0;
+    block->size = slab_size;
+    iree_hal_slab_allocator_insert_free_block(allocator, block);
+  } else {
+    allocator->total_slab_size -= slab_size;
+    if (slab) {
+      iree_slim_mutex_unlock(&allocator->mutex);
+      iree_hal_buffer_release(slab->buffer);
+      iree_allocator_free(allocator->host_allocator, slab);
+      iree_slim_mutex_lock(&allocator->mutex);
+    }
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Allocates a block of |size| bytes, growing if needed, and an unused buffer
+// to wrap it.
+//
+// Must be called with the allocator mutex held; the mutex may be dropped while
+// growing.
+static iree_status_t iree_hal_slab_allocator_allocate_block(
+    iree_hal_slab_allocator_t* allocator, iree_device_size_t size,
+    iree_hal_slab_block_t** out_block, iree_hal_slab_buffer_t** out_buffer) {
+  iree_hal_slab_block_t* block = NULL;
+  while (!(block = iree_hal_slab_allocator_find_free_block(allocator, size))) {
+    IREE_RETURN_IF_ERROR(iree_hal_slab_allocator_grow(allocator, size));
+  }
+  IREE_RETURN_IF_ERROR(iree_hal_slab_allocator_reserve_metadata(allocator));
+  iree_hal_slab_allocator_remove_free_block(allocator, block);
+
+  // Split off the remainder of the block if it is usable.
+  if (block->size - size >= allocator->granularity) {
+    iree_hal_slab_block_t* remainder =
+        iree_hal_slab_allocator_pop_unused_block(allocator);
+    remainder->slab = block->slab;
+    remainder->offset = block->offset + size;
+    remainder->size = block->size - size;
+    remainder->prev_physical = block;
+    remainder->next_physical = block->next_physical;
+    if (remainder->next_physical) {
+      remainder->next_physical->prev_physical = remainder;
+    }
+    block->next_physical = remainder;
+    block->size = size;
+    iree_hal_slab_allocator_insert_free_block(allocator, remainder);
+  }
+
+  iree_hal_slab_buffer_t* buffer = allocator->unused_buffers;
+  allocator->unused_buffers = buffer->next_free;
+  buffer->next_free = NULL;
+  buffer->block = block;
+
+  *out_block = block;
+  *out_buffer = buffer;
+  return iree_ok_status();
+}
+
+// Frees |block| and coalesces it with any free neighbors. Returns a slab that
+// must be released by the caller if the block was its last allocation and the
+// slab was dedicated to it.
+//
+// Must be called with the allocator mutex held.
+static iree_hal_slab_t* iree_hal_slab_allocator_free_block(
+    iree_hal_slab_allocator_t* allocator, iree_hal_slab_block_t* block) {
+  iree_hal_slab_block_t* prev = block->prev_physical;
+  if (prev && prev->is_free) {
+    iree_hal_slab_allocator_remove_free_block(allocator, prev);
+    prev->size += block->size;
+    prev->next_physical = block->next_physical;
+    if (prev->next_physical) prev->next_physical->prev_physical = prev;
+    iree_hal_slab_allocator_push_unused_block(allocator, block);
+    block = prev;
+  }
+  iree_hal_slab_block_t* next = block->next_physical;
+  if (next && next->is_free) {
+    iree_hal_slab_allocator_remove_free_block(allocator, next);
+    block->size += next->size;
+    block->next_physical = next->next_physical;
+    if (block->next_physical) block->next_physical->prev_physical = block;
+    iree_hal_slab_allocator_push_unused_block(allocator, next);
+  }
+
+  iree_hal_slab_t* slab = block->slab;
+  if (slab->dedicated && block->size == slab->size) {
+    iree_hal_slab_allocator_unlink_slab(allocator, slab, block);
+    return slab;
+  }
+  iree_hal_slab_allocator_insert_free_block(allocator, block);
+  return NULL;
+}
+
+iree_status_t iree_hal_slab_allocator_create(
+    const iree_hal_slab_allocator_params_t* params,
+    iree_hal_allocator_t* device_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(params);
+  IREE_ASSERT_ARGUMENT(device_allocator);
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  const iree_device_size_t granularity =
+      iree_max(IREE_HAL_SLAB_ALLOCATOR_MIN_GRANULARITY,
+               params->heap.min_alignment);
+  if (!iree_device_size_is_power_of_two(granularity)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "heap minimum alignment %" PRIdsz
+                            " must be a power of two",
+                            params->heap.min_alignment);
+  }
+  if (params->slab_size < granularity ||
+      params->slab_size > params->heap.max_allocation_size) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "slab size %" PRIdsz
+                            " must be in the range [%" PRIdsz ", %" PRIdsz "]",
+                            params->slab_size, granularity,
+                            params->heap.max_allocation_size);
+  }
+
+  // Slabs are allocated with all the properties of the heap so that they can
+  // service any request the heap could.
+  iree_hal_buffer_params_t slab_params = {
+      .usage = params->heap.allowed_usage &
+               ~IREE_HAL_SLAB_ALLOCATOR_UNSUPPORTED_USAGE,
+      .access = IREE_HAL_MEMORY_ACCESS_ALL,
+      .type = params->heap.type,
+  };
+  iree_device_size_t slab_size = params->slab_size;
+  if (!iree_all_bits_set(
+          iree_hal_allocator_query_buffer_compatibility(
+              device_allocator, slab_params, slab_size, &slab_params,
+              &slab_size),
+          IREE_HAL_BUFFER_COMPATIBILITY_ALLOCATABLE)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "underlying allocator cannot allocate slabs from the requested heap");
+  }
+
+  iree_hal_slab_allocator_t* allocator = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*allocator),
+                                (void**)&allocator));
+  memset(allocator, 0, sizeof(*allocator));
+  iree_hal_resource_initialize(&iree_hal_slab_allocator_vtable,
+                               &allocator->resource);
+  allocator->host_allocator = host_allocator;
+  allocator->device_allocator = device_allocator;
+  iree_hal_allocator_retain(allocator->device_allocator);
+  allocator->params = *params;
+  allocator->slab_params = slab_params;
+  allocator->granularity = granularity;
+  iree_slim_mutex_initialize(&allocator->mutex);
+
+  *out_allocator = (iree_hal_allocator_t*)allocator;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_slab_allocator_create_from_spec(
+    iree_string_view_t config, iree_hal_allocator_t* device_allocator,
+    iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator) {
+  // Slabs are allocated from the most preferred heap.
+  iree_hal_allocator_memory_heap_t heaps[16];
+  iree_host_size_t heap_count = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_query_memory_heaps(
+      device_allocator, IREE_ARRAYSIZE(heaps), heaps, &heap_count));
+  if (heap_count == 0) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "underlying allocator has no heaps");
+  }
+  iree_hal_slab_allocator_params_t params;
+  iree_hal_slab_allocator_params_initialize(heaps[0], &params);
+
+  iree_string_view_t slab_size_str = iree_string_view_empty();
+  iree_string_view_t max_capacity_str = iree_string_view_empty();
+  iree_string_view_split(config, ';', &slab_size_str, &max_capacity_str);
+  slab_size_str = iree_string_view_trim(slab_size_str);
+  if (!iree_string_view_is_empty(slab_size_str) &&
+      !iree_string_view_equal(slab_size_str, IREE_SV("*"))) {
+    IREE_RETURN_IF_ERROR(
+        iree_string_view_parse_device_size(slab_size_str, &params.slab_size),
+        "parsing slab_size");
+  }
+  max_capacity_str = iree_string_view_trim(max_capacity_str);
+  if (!iree_string_view_is_empty(max_capacity_str) &&
+      !iree_string_view_equal(max_capacity_str, IREE_SV("*"))) {
+    IREE_RETURN_IF_ERROR(iree_string_view_parse_device_size(
+                             max_capacity_str, &params.max_capacity),
+                         "parsing max_capacity");
+  }
+
+  return iree_hal_slab_allocator_create(&params, device_allocator,
+                                        host_allocator, out_allocator);
+}
+
+static void iree_hal_slab_allocator_destroy(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  iree_allocator_t host_allocator = allocator->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All buffers must have been released so all slabs should be unused.
+  iree_hal_slab_allocator_release_unused_slabs(allocator);
+  IREE_ASSERT_EQ(allocator->slab_head, NULL,
+                 "must have released all allocations prior to destroy");
+
+  while (allocator->metadata_chunks) {
+    iree_hal_slab_metadata_chunk_t* next_chunk =
+        allocator->metadata_chunks->next;
+    iree_allocator_free(host_allocator, allocator->metadata_chunks);
+    allocator->metadata_chunks = next_chunk;
+  }
+
+  iree_slim_mutex_deinitialize(&allocator->mutex);
+  iree_hal_allocator_release(allocator->device_allocator);
+  iree_allocator_free(host_allocator, allocator);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_allocator_t iree_hal_slab_allocator_host_allocator(
+    const iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_slab_allocator_t* allocator =
+      (iree_hal_slab_allocator_t*)base_allocator;
+  return allocator->host_allocator;
+}
+
+static iree_status_t iree_hal_slab_allocator_trim(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  iree_hal_slab_allocator_release_unused_slabs(allocator);
+  return iree_hal_allocator_trim(allocator->device_allocator);
+}
+
+static void iree_hal_slab_allocator_query_statistics(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_allocator_statistics_t* IREE_RESTRICT out_statistics) {
+  // Slabs are tracked by the underlying allocator.
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  iree_hal_allocator_query_statistics(allocator->device_allocator,
+                                      out_statistics);
+}
+
+static iree_status_t iree_hal_slab_allocator_query_memory_heaps(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_host_size_t capacity,
+    iree_hal_allocator_memory_heap_t* IREE_RESTRICT heaps,
+    iree_host_size_t* IREE_RESTRICT out_count) {
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_memory_heaps(allocator->device_allocator,
+                                               capacity, heaps, out_count);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_slab_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t* IREE_RESTRICT allocation_size) {
+  // Defer to the base allocator.
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_buffer_compatibility(
+      allocator->device_allocator, *params, *allocation_size, params,
+      allocation_size);
+}
+
+// Returns true if a request with |params| can be sub-allocated from slabs.
+static bool iree_hal_slab_allocator_can_sub_allocate(
+    iree_hal_slab_allocator_t* allocator,
+    const iree_hal_buffer_params_t* params,
+    iree_const_byte_span_t initial_data) {
+  if (iree_any_bit_set(params->usage,
+                       IREE_HAL_SLAB_ALLOCATOR_UNSUPPORTED_USAGE)) {
+    return false;
+  }
+  if (!iree_all_bits_set(allocator->slab_params.type, params->type) ||
+      !iree_all_bits_set(allocator->slab_params.usage, params->usage)) {
+    return false;
+  }
+  // Initial data is written by mapping the buffer as we have no device to
+  // schedule transfers with.
+  if (!iree_const_byte_span_is_empty(initial_data) &&
+      !iree_all_bits_set(allocator->slab_params.usage,
+                         IREE_HAL_BUFFER_USAGE_MAPPING)) {
+    return false;
+  }
+  return true;
+}
+
+static iree_status_t iree_hal_slab_allocator_allocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+
+  // Route anything we can't service down to the underlying allocator.
+  if (!iree_hal_slab_allocator_can_sub_allocate(allocator, params,
+                                                initial_data)) {
+    return iree_hal_allocator_allocate_buffer(allocator->device_allocator,
+                                              *params, allocation_size,
+                                              initial_data, out_buffer);
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)allocation_size);
+
+  const iree_device_size_t block_size = iree_device_align(
+      iree_max(allocation_size, 1), allocator->granularity);
+  iree_hal_slab_block_t* block = NULL;
+  iree_hal_slab_buffer_t* buffer = NULL;
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_status_t status = iree_hal_slab_allocator_allocate_block(
+      allocator, block_size, &block, &buffer);
+  iree_slim_mutex_unlock(&allocator->mutex);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(z0, status);
+
+  // Reference the slab the same way as subspans do so that devices resolve
+  // the allocated buffer and offset.
+  iree_hal_buffer_t* slab_buffer = block->slab->buffer;
+  iree_hal_buffer_initialize(
+      allocator->host_allocator, base_allocator, slab_buffer, allocation_size,
+      block->offset, allocation_size, iree_hal_buffer_memory_type(slab_buffer),
+      params->access, iree_hal_buffer_allowed_usage(slab_buffer),
+      &iree_hal_slab_buffer_vtable, &buffer->base);
+
+  if (!iree_const_byte_span_is_empty(initial_data)) {
+    status = iree_hal_buffer_map_write(
+        &buffer->base, 0, initial_data.data,
+        iree_min(initial_data.data_length, allocation_size));
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_buffer = &buffer->base;
+  } else {
+    iree_hal_buffer_release(&buffer->base);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_slab_allocator_deallocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT base_buffer) {
+  // Sub-allocated buffers return their block when destroyed.
+  iree_hal_buffer_destroy(base_buffer);
+}
+
+static iree_status_t iree_hal_slab_allocator_import_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  // Bypass the slab allocator and directly ask the backing implementation.
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  return iree_hal_allocator_import_buffer(allocator->device_allocator, *params,
+                                          external_buffer, release_callback,
+                                          out_buffer);
+}
+
+static iree_status_t iree_hal_slab_allocator_export_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_external_buffer_type_t requested_type,
+    iree_hal_external_buffer_flags_t requested_flags,
+    iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
+  // Sub-allocated buffers are never exportable as exportable requests are
+  // routed to the backing implementation.
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_allocator);
+  return iree_hal_allocator_export_buffer(allocator->device_allocator, buffer,
+                                          requested_type, requested_flags,
+                                          out_external_buffer);
+}
+
+static const iree_hal_allocator_vtable_t iree_hal_slab_allocator_vtable = {
+    .destroy = iree_hal_slab_allocator_destroy,
+    .host_allocator = iree_hal_slab_allocator_host_allocator,
+    .trim = iree_hal_slab_allocator_trim,
+    .query_statistics = iree_hal_slab_allocator_query_statistics,
+    .query_memory_heaps = iree_hal_slab_allocator_query_memory_heaps,
+    .query_buffer_compatibility =
+        iree_hal_slab_allocator_query_buffer_compatibility,
+    .allocate_buffer = iree_hal_slab_allocator_allocate_buffer,
+    .deallocate_buffer = iree_hal_slab_allocator_deallocate_buffer,
+    .import_buffer = iree_hal_slab_allocator_import_buffer,
+    .export_buffer = iree_hal_slab_allocator_export_buffer,
+};
+
+//===----------------------------------------------------------------------===//
+// iree_hal_slab_buffer_t
+//===----------------------------------------------------------------------===//
+
+static void iree_hal_slab_buffer_destroy(iree_hal_buffer_t* base_buffer) {
+  iree_hal_slab_buffer_t* buffer = (iree_hal_slab_buffer_t*)base_buffer;
+  iree_hal_slab_allocator_t* allocator =
+      iree_hal_slab_allocator_cast(base_buffer->device_allocator);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Drop the reference to the slab taken when the buffer was initialized. The
+  // slab itself keeps the storage alive.
+  iree_hal_buffer_release(base_buffer->allocated_buffer);
+  base_buffer->allocated_buffer = NULL;
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_slab_t* dead_slab =
+      iree_hal_slab_allocator_free_block(allocator, buffer->block);
+  buffer->block = NULL;
+  buffer->next_free = allocator->unused_buffers;
+  allocator->unused_buffers = buffer;
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  // Release dedicated slabs without holding the lock as deallocation can be
+  // slow.
+  if (dead_slab) iree_hal_slab_allocator_release_slab(allocator, dead_slab);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns the vtable of the slab storage buffer backing |buffer|.
+// Sub-allocated buffers forward all operations to their slab with absolute
+// offsets in the same way as subspan buffers do.
+static const iree_hal_buffer_vtable_t* iree_hal_slab_buffer_storage_vtable(
+    iree_hal_buffer_t* buffer) {
+  return (const iree_hal_buffer_vtable_t*)((const iree_hal_resource_t*)
+                                               buffer->allocated_buffer)
+      ->vtable;
+}
+
+static iree_status_t iree_hal_slab_buffer_map_range(
+    iree_hal_buffer_t* buffer, iree_hal_mapping_mode_t mapping_mode,
+    iree_hal_memory_access_t memory_access,
+    iree_device_size_t local_byte_offset, iree_device_size_t local_byte_length,
+    iree_hal_buffer_mapping_t* mapping) {
+  return iree_hal_slab_buffer_storage_vtable(buffer)->map_range(
+      buffer->allocated_buffer, mapping_mode, memory_access, local_byte_offset,
+      local_byte_length, mapping);
+}
+
+static iree_status_t iree_hal_slab_buffer_unmap_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length, iree_hal_buffer_mapping_t* mapping) {
+  if (!buffer->allocated_buffer) return iree_ok_status();
+  return iree_hal_slab_buffer_storage_vtable(buffer)->unmap_range(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length, mapping);
+}
+
+static iree_status_t iree_hal_slab_buffer_invalidate_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  return iree_hal_slab_buffer_storage_vtable(buffer)->invalidate_range(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length);
+}
+
+static iree_status_t iree_hal_slab_buffer_flush_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  return iree_hal_slab_buffer_storage_vtable(buffer)->flush_range(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length);
+}
+
+static const iree_hal_buffer_vtable_t iree_hal_slab_buffer_vtable = {
+    .recycle = iree_hal_buffer_recycle,
+    .destroy = iree_hal_slab_buffer_destroy,
+    .map_range = iree_hal_slab_buffer_map_range,
+    .unmap_range = iree_hal_slab_buffer_unmap_range,
+    .invalidate_range = iree_hal_slab_buffer_invalidate_range,
+    .flush_range = iree_hal_slab_buffer_flush_range,
+};
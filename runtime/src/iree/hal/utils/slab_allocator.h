@@ -0,0 +1,90 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_SLAB_ALLOCATOR_H_
+#define IREE_HAL_UTILS_SLAB_ALLOCATOR_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// A HAL buffer allocator that sub-allocates buffers from large slabs.
+//
+// Slabs are allocated from an underlying device allocator and buffers are
+// carved out of them with a two-level segregated fit (TLSF) sub-allocator.
+// Allocation and deallocation are O(1) and adjacent free ranges are coalesced.
+// Buffer handles and sub-allocator bookkeeping are recycled through free lists
+// so that steady-state allocations perform no host allocations and touch no
+// new pages.
+//
+// Sub-allocated buffers reference their slab as their allocated buffer with a
+// byte offset in the same way as subspan buffers do and can be used with any
+// device the underlying allocator services.
+//
+// Total slab memory is limited to a fixed capacity providing a hard memory
+// budget: requests that cannot be serviced within the budget fail with
+// IREE_STATUS_RESOURCE_EXHAUSTED instead of growing. Requests that slabs
+// cannot service (such as those requiring memory types the slabs do not have
+// or exportable buffers) are routed directly to the underlying allocator.
+//
+// All buffers allocated from the slab allocator must be released before it is
+// destroyed.
+//
+// Thread-safe: the allocator can be shared across multiple user-level devices
+// manipulated from multiple threads.
+typedef struct iree_hal_slab_allocator_t iree_hal_slab_allocator_t;
+
+// Default size of each slab allocated from the underlying allocator.
+#define IREE_HAL_SLAB_ALLOCATOR_DEFAULT_SLAB_SIZE (32 * 1024 * 1024)
+
+// Parameters used to configure an iree_hal_slab_allocator_t.
+// These cannot be changed once the allocator has been created.
+typedef struct iree_hal_slab_allocator_params_t {
+  // Underlying allocator heap that slabs are allocated from.
+  // Only requests compatible with the heap memory type and allowed usage are
+  // sub-allocated from slabs.
+  iree_hal_allocator_memory_heap_t heap;
+
+  // Size of each slab in bytes. Requests larger than this are placed in a
+  // dedicated slab that is released when the buffer is released.
+  iree_device_size_t slab_size;
+
+  // Maximum total size of all slabs in bytes.
+  iree_device_size_t max_capacity;
+} iree_hal_slab_allocator_params_t;
+
+// Initializes |out_params| to the default values using |heap| for storage.
+void iree_hal_slab_allocator_params_initialize(
+    iree_hal_allocator_memory_heap_t heap,
+    iree_hal_slab_allocator_params_t* out_params);
+
+// Creates a slab allocator sub-allocating from slabs allocated from
+// |device_allocator| as configured by |params|.
+iree_status_t iree_hal_slab_allocator_create(
+    const iree_hal_slab_allocator_params_t* params,
+    iree_hal_allocator_t* device_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
+// Creates a slab allocator with the given |config| string.
+// Slabs are allocated from the most preferred heap of |device_allocator|.
+// Wildcards or omitted values use the defaults.
+//
+// Expected form:
+//   slab_size;max_capacity
+// Example:
+//   64mib;1gib
+iree_status_t iree_hal_slab_allocator_create_from_spec(
+    iree_string_view_t config, iree_hal_allocator_t* device_allocator,
+    iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_SLAB_ALLOCATOR_H_
@@ -0,0 +1,270 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/slab_allocator.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+class SlabAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        IREE_SV("heap"), iree_allocator_system(), iree_allocator_system(),
+        &device_allocator_));
+    iree_host_size_t heap_count = 0;
+    IREE_ASSERT_OK(iree_hal_allocator_query_memory_heaps(
+        device_allocator_, 1, &heap_, &heap_count));
+  }
+
+  void TearDown() override {
+    iree_hal_allocator_release(allocator_);
+    iree_hal_allocator_release(device_allocator_);
+  }
+
+  // Creates |allocator_| sub-allocating from the heap allocator.
+  void CreateAllocator(iree_device_size_t slab_size,
+                       iree_device_size_t max_capacity = IREE_DEVICE_SIZE_MAX) {
+    iree_hal_slab_allocator_params_t params;
+    iree_hal_slab_allocator_params_initialize(heap_, &params);
+    params.slab_size = slab_size;
+    params.max_capacity = max_capacity;
+    IREE_ASSERT_OK(iree_hal_slab_allocator_create(
+        &params, device_allocator_, iree_allocator_system(), &allocator_));
+  }
+
+  iree_status_t TryAllocate(iree_device_size_t size,
+                            iree_hal_buffer_usage_t usage,
+                            iree_hal_buffer_t** out_buffer) {
+    iree_hal_buffer_params_t params = {0};
+    params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+    params.usage = usage;
+    return iree_hal_allocator_allocate_buffer(
+        allocator_, params, size, iree_const_byte_span_empty(), out_buffer);
+  }
+
+  iree_hal_buffer_t* Allocate(iree_device_size_t size) {
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(TryAllocate(size, IREE_HAL_BUFFER_USAGE_DEFAULT, &buffer));
+    return buffer;
+  }
+
+  // Expects the total bytes of slabs allocated from the heap allocator to be
+  // |expected_bytes|. Slab bytes are only tracked with statistics enabled.
+  void ExpectSlabBytes(iree_device_size_t expected_bytes) {
+#if IREE_STATISTICS_ENABLE
+    iree_hal_allocator_statistics_t statistics;
+    iree_hal_allocator_query_statistics(device_allocator_, &statistics);
+    EXPECT_EQ(statistics.device_bytes_allocated - statistics.device_bytes_freed,
+              expected_bytes);
+#endif  // IREE_STATISTICS_ENABLE
+  }
+
+  iree_hal_allocator_t* device_allocator_ = NULL;
+  iree_hal_allocator_memory_heap_t heap_;
+  iree_hal_allocator_t* allocator_ = NULL;
+};
+
+TEST_F(SlabAllocatorTest, SubAllocatesFromSlab) {
+  CreateAllocator(/*slab_size=*/64 * 1024);
+  iree_hal_buffer_t* buffer_a = Allocate(1000);
+  iree_hal_buffer_t* buffer_b = Allocate(4096);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer_a), 1000);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer_b), 4096);
+
+  // Both buffers share the same slab at distinct, non-overlapping offsets.
+  EXPECT_EQ(iree_hal_buffer_allocated_buffer(buffer_a),
+            iree_hal_buffer_allocated_buffer(buffer_b));
+  iree_device_size_t offset_a = iree_hal_buffer_byte_offset(buffer_a);
+  iree_device_size_t offset_b = iree_hal_buffer_byte_offset(buffer_b);
+  EXPECT_TRUE(offset_a + 1000 <= offset_b || offset_b + 4096 <= offset_a);
+  ExpectSlabBytes(64 * 1024);
+
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+}
+
+TEST_F(SlabAllocatorTest, MapsSubAllocatedContents) {
+  CreateAllocator(/*slab_size=*/64 * 1024);
+  iree_hal_buffer_t* buffer_a = Allocate(256);
+  iree_hal_buffer_t* buffer_b = Allocate(256);
+  std::vector<uint8_t> data_a(256, 0xAA);
+  std::vector<uint8_t> data_b(256, 0xBB);
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_write(buffer_a, 0, data_a.data(), data_a.size()));
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_write(buffer_b, 0, data_b.data(), data_b.size()));
+  std::vector<uint8_t> result(256);
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_read(buffer_a, 0, result.data(), result.size()));
+  EXPECT_EQ(result, data_a);
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_read(buffer_b, 0, result.data(), result.size()));
+  EXPECT_EQ(result, data_b);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+}
+
+TEST_F(SlabAllocatorTest, InitialData) {
+  CreateAllocator(/*slab_size=*/64 * 1024);
+  uint8_t data[128];
+  memset(data, 0x5C, sizeof(data));
+  iree_hal_buffer_params_t params = {0};
+  params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+  params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      allocator_, params, sizeof(data),
+      iree_make_const_byte_span(data, sizeof(data)), &buffer));
+  uint8_t result[128] = {0};
+  IREE_ASSERT_OK(iree_hal_buffer_map_read(buffer, 0, result, sizeof(result)));
+  EXPECT_EQ(memcmp(result, data, sizeof(data)), 0);
+  iree_hal_buffer_release(buffer);
+}
+
+TEST_F(SlabAllocatorTest, CoalescesFreedBlocks) {
+  CreateAllocator(/*slab_size=*/16 * 1024);
+  iree_hal_buffer_t* buffers[4] = {NULL};
+  for (auto& buffer : buffers) buffer = Allocate(4096);
+  ExpectSlabBytes(16 * 1024);
+
+  // Releasing all blocks in a non-sequential order must coalesce them such
+  // that the full slab can be reused without growing.
+  iree_hal_buffer_release(buffers[1]);
+  iree_hal_buffer_release(buffers[3]);
+  iree_hal_buffer_release(buffers[0]);
+  iree_hal_buffer_release(buffers[2]);
+  iree_hal_buffer_t* buffer = Allocate(16 * 1024);
+  EXPECT_EQ(iree_hal_buffer_byte_offset(buffer), 0);
+  ExpectSlabBytes(16 * 1024);
+  iree_hal_buffer_release(buffer);
+}
+
+TEST_F(SlabAllocatorTest, DedicatedSlabForLargeRequests) {
+  CreateAllocator(/*slab_size=*/16 * 1024);
+  iree_hal_buffer_t* buffer = Allocate(64 * 1024);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer), 64 * 1024);
+  ExpectSlabBytes(64 * 1024);
+
+  // Dedicated slabs are returned to the underlying allocator immediately.
+  iree_hal_buffer_release(buffer);
+  ExpectSlabBytes(0);
+}
+
+TEST_F(SlabAllocatorTest, ExceedsCapacity) {
+  CreateAllocator(/*slab_size=*/16 * 1024, /*max_capacity=*/32 * 1024);
+  iree_hal_buffer_t* buffer_a = Allocate(16 * 1024);
+  iree_hal_buffer_t* buffer_b = Allocate(16 * 1024);
+  iree_hal_buffer_t* buffer_c = NULL;
+  EXPECT_THAT(Status(TryAllocate(1024, IREE_HAL_BUFFER_USAGE_DEFAULT,
+                                 &buffer_c)),
+              StatusIs(StatusCode::kResourceExhausted));
+  ExpectSlabBytes(32 * 1024);
+
+  // Once memory is released it can be reused within the budget.
+  iree_hal_buffer_release(buffer_a);
+  buffer_c = Allocate(1024);
+  iree_hal_buffer_release(buffer_b);
+  iree_hal_buffer_release(buffer_c);
+}
+
+TEST_F(SlabAllocatorTest, ReleasesUnusedSlabsWhenOverCapacity) {
+  CreateAllocator(/*slab_size=*/16 * 1024, /*max_capacity=*/32 * 1024);
+  iree_hal_buffer_t* buffer_a = Allocate(16 * 1024);
+  iree_hal_buffer_t* buffer_b = Allocate(16 * 1024);
+  iree_hal_buffer_release(buffer_a);
+  iree_hal_buffer_release(buffer_b);
+
+  // The unused slabs are too small for a dedicated slab and are released to
+  // make room within the budget.
+  iree_hal_buffer_t* buffer = Allocate(32 * 1024);
+  ExpectSlabBytes(32 * 1024);
+  iree_hal_buffer_release(buffer);
+}
+
+TEST_F(SlabAllocatorTest, RoutesExportableToUnderlyingAllocator) {
+  CreateAllocator(/*slab_size=*/16 * 1024);
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_ASSERT_OK(TryAllocate(1024,
+                             IREE_HAL_BUFFER_USAGE_DEFAULT |
+                                 IREE_HAL_BUFFER_USAGE_SHARING_EXPORT,
+                             &buffer));
+  EXPECT_EQ(iree_hal_buffer_allocated_buffer(buffer), buffer);
+  EXPECT_EQ(iree_hal_buffer_allocation_size(buffer), 1024);
+  iree_hal_buffer_release(buffer);
+}
+
+TEST_F(SlabAllocatorTest, TrimReleasesUnusedSlabs) {
+  CreateAllocator(/*slab_size=*/16 * 1024);
+  iree_hal_buffer_t* buffer = Allocate(1024);
+  iree_hal_buffer_release(buffer);
+  ExpectSlabBytes(16 * 1024);
+  IREE_ASSERT_OK(iree_hal_allocator_trim(allocator_));
+  ExpectSlabBytes(0);
+}
+
+// Many threads allocating and releasing concurrently with a mix of sizes that
+// are sub-allocated and that require dedicated slabs.
+TEST_F(SlabAllocatorTest, ConcurrentAllocations) {
+  CreateAllocator(/*slab_size=*/256 * 1024);
+  static constexpr int kThreadCount = 8;
+  static constexpr int kIterationCount = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([this, i]() {
+      iree_hal_buffer_t* buffers[4] = {NULL};
+      for (int j = 0; j < kIterationCount; ++j) {
+        int slot = j % IREE_ARRAYSIZE(buffers);
+        iree_hal_buffer_release(buffers[slot]);
+        iree_device_size_t size = 1024 * (1 + (i + j) % 300);
+        buffers[slot] = Allocate(size);
+        ASSERT_EQ(iree_hal_buffer_byte_length(buffers[slot]), size);
+        IREE_ASSERT_OK(iree_hal_buffer_map_fill(buffers[slot], 0, size, &i,
+                                                sizeof(uint8_t)));
+      }
+      for (auto* buffer : buffers) iree_hal_buffer_release(buffer);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  IREE_ASSERT_OK(iree_hal_allocator_trim(allocator_));
+  ExpectSlabBytes(0);
+}
+
+TEST_F(SlabAllocatorTest, CreateFromSpec) {
+  IREE_ASSERT_OK(iree_hal_slab_allocator_create_from_spec(
+      IREE_SV("16kib;32kib"), device_allocator_, iree_allocator_system(),
+      &allocator_));
+  iree_hal_buffer_t* buffer = Allocate(1024);
+  ExpectSlabBytes(16 * 1024);
+  iree_hal_buffer_t* other_buffer = NULL;
+  EXPECT_THAT(Status(TryAllocate(64 * 1024, IREE_HAL_BUFFER_USAGE_DEFAULT,
+                                 &other_buffer)),
+              StatusIs(StatusCode::kResourceExhausted));
+  iree_hal_buffer_release(buffer);
+}
+
+TEST_F(SlabAllocatorTest, CreateFromSpecInvalid) {
+  EXPECT_THAT(Status(iree_hal_slab_allocator_create_from_spec(
+                  IREE_SV("x"), device_allocator_, iree_allocator_system(),
+                  &allocator_)),
+              StatusIs(StatusCode::kInvalidArgument));
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
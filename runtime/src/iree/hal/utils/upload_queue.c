@@ -0,0 +1,417 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/upload_queue.h"
+
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/internal/threading.h"
+
+// Maximum number of unreached wait semaphores the I/O thread waits on at once.
+// If more pending uploads are blocked the thread polls for the remainder.
+#define IREE_HAL_UPLOAD_QUEUE_MAX_WAIT_COUNT 32
+
+// Interval at which the I/O thread polls when more semaphores are pending than
+// it can wait on at once.
+#define IREE_HAL_UPLOAD_QUEUE_POLL_MS 1
+
+// A single pending upload.
+typedef struct iree_hal_upload_t {
+  struct iree_hal_upload_t* next;
+  iree_hal_fence_t* wait_fence;
+  iree_hal_fence_t* signal_fence;
+  iree_const_byte_span_t source;
+  iree_hal_upload_release_callback_t source_release_callback;
+  iree_hal_buffer_t* target_buffer;
+  iree_device_size_t target_offset;
+} iree_hal_upload_t;
+
+struct iree_hal_upload_queue_t {
+  iree_allocator_t host_allocator;
+  iree_hal_device_t* device;
+
+  // Background I/O thread processing uploads as their wait fences are reached.
+  iree_thread_t* thread;
+
+  // Guards the pending list and counters.
+  iree_slim_mutex_t mutex;
+
+  // Signaled to wake the I/O thread when uploads are enqueued or exit is
+  // requested. The I/O thread waits on it along with the wait fences of all
+  // pending uploads.
+  iree_hal_semaphore_t* wake_semaphore;
+  uint64_t wake_value IREE_GUARDED_BY(mutex);
+
+  // Posted when uploads complete and when the I/O thread exits.
+  iree_notification_t completed_notification;
+
+  // Uploads not yet started by the I/O thread in submission order.
+  iree_hal_upload_t* pending_head IREE_GUARDED_BY(mutex);
+  iree_hal_upload_t* pending_tail IREE_GUARDED_BY(mutex);
+
+  // Total number of uploads ever enqueued and completed. Used to wait for all
+  // uploads prior to a point in time to complete.
+  uint64_t enqueued_count IREE_GUARDED_BY(mutex);
+  uint64_t completed_count IREE_GUARDED_BY(mutex);
+
+  // Set when the I/O thread should exit once all pending uploads complete or
+  // fail. Uploads whose wait fences have not been reached are failed.
+  bool exit_requested IREE_GUARDED_BY(mutex);
+
+  // Set by the I/O thread when it has exited its main loop.
+  bool exited IREE_GUARDED_BY(mutex);
+};
+
+static int iree_hal_upload_queue_main(iree_hal_upload_queue_t* upload_queue);
+
+// Wakes the I/O thread so that it rescans the pending uploads.
+// Must be called with the mutex held so that signaled values are increasing.
+static void iree_hal_upload_queue_wake(iree_hal_upload_queue_t* upload_queue) {
+  // NOTE: the wake semaphore is never failed and signaling it can only fail if
+  // the device is lost, in which case the pending uploads fail on their own.
+  iree_status_ignore(iree_hal_semaphore_signal(upload_queue->wake_semaphore,
+                                               ++upload_queue->wake_value));
+}
+
+static bool iree_hal_upload_queue_has_exited(
+    iree_hal_upload_queue_t* upload_queue) {
+  iree_slim_mutex_lock(&upload_queue->mutex);
+  bool exited = upload_queue->exited;
+  iree_slim_mutex_unlock(&upload_queue->mutex);
+  return exited;
+}
+
+iree_status_t iree_hal_upload_queue_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_upload_queue_t** out_upload_queue) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(out_upload_queue);
+  *out_upload_queue = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_upload_queue_t* upload_queue = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*upload_queue),
+                                (void**)&upload_queue));
+  upload_queue->host_allocator = host_allocator;
+  upload_queue->device = device;
+  iree_hal_device_retain(device);
+  iree_slim_mutex_initialize(&upload_queue->mutex);
+  iree_notification_initialize(&upload_queue->completed_notification);
+
+  iree_status_t status = iree_hal_semaphore_create(
+      device, upload_queue->wake_value, &upload_queue->wake_semaphore);
+
+  if (iree_status_is_ok(status)) {
+    iree_thread_create_params_t thread_params;
+    memset(&thread_params, 0, sizeof(thread_params));
+    thread_params.name = iree_make_cstring_view("iree-upload");
+    thread_params.priority_class = IREE_THREAD_PRIORITY_CLASS_NORMAL;
+    status = iree_thread_create((iree_thread_entry_t)iree_hal_upload_queue_main,
+                                upload_queue, thread_params, host_allocator,
+                                &upload_queue->thread);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_upload_queue = upload_queue;
+  } else {
+    iree_hal_upload_queue_free(upload_queue);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_upload_queue_free(iree_hal_upload_queue_t* upload_queue) {
+  if (!upload_queue) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Request the thread exit after draining all pending uploads and wait for it
+  // to do so. Nothing may ever signal the wait fences of uploads that have not
+  // yet started and those are failed instead of waited on.
+  if (upload_queue->thread) {
+    iree_slim_mutex_lock(&upload_queue->mutex);
+    upload_queue->exit_requested = true;
+    iree_hal_upload_queue_wake(upload_queue);
+    iree_slim_mutex_unlock(&upload_queue->mutex);
+    iree_notification_await(
+        &upload_queue->completed_notification,
+        (iree_condition_fn_t)iree_hal_upload_queue_has_exited, upload_queue,
+        iree_infinite_timeout());
+    iree_thread_release(upload_queue->thread);
+    upload_queue->thread = NULL;
+  }
+  IREE_ASSERT(!upload_queue->pending_head);
+
+  iree_hal_semaphore_release(upload_queue->wake_semaphore);
+  iree_notification_deinitialize(&upload_queue->completed_notification);
+  iree_slim_mutex_deinitialize(&upload_queue->mutex);
+  iree_hal_device_release(upload_queue->device);
+  iree_allocator_free(upload_queue->host_allocator, upload_queue);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+iree_status_t iree_hal_upload_queue_enqueue(
+    iree_hal_upload_queue_t* upload_queue, iree_hal_fence_t* wait_fence,
+    iree_hal_fence_t* signal_fence, iree_const_byte_span_t source,
+    iree_hal_upload_release_callback_t source_release_callback,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset) {
+  IREE_ASSERT_ARGUMENT(upload_queue);
+  IREE_ASSERT_ARGUMENT(target_buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)source.data_length);
+
+  // Validate the target range now so that obvious errors are reported to the
+  // caller instead of asynchronously via the signal fence.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_buffer_validate_range(target_buffer, target_offset,
+                                         source.data_length));
+
+  iree_hal_upload_t* upload = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(upload_queue->host_allocator, sizeof(*upload),
+                                (void**)&upload));
+  upload->next = NULL;
+  upload->wait_fence = wait_fence;
+  iree_hal_fence_retain(wait_fence);
+  upload->signal_fence = signal_fence;
+  iree_hal_fence_retain(signal_fence);
+  upload->source = source;
+  upload->source_release_callback = source_release_callback;
+  upload->target_buffer = target_buffer;
+  iree_hal_buffer_retain(target_buffer);
+  upload->target_offset = target_offset;
+
+  iree_slim_mutex_lock(&upload_queue->mutex);
+  if (upload_queue->pending_tail) {
+    upload_queue->pending_tail->next = upload;
+  } else {
+    upload_queue->pending_head = upload;
+  }
+  upload_queue->pending_tail = upload;
+  ++upload_queue->enqueued_count;
+  iree_hal_upload_queue_wake(upload_queue);
+  iree_slim_mutex_unlock(&upload_queue->mutex);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+typedef struct iree_hal_upload_queue_idle_t {
+  iree_hal_upload_queue_t* upload_queue;
+  uint64_t enqueued_count;
+} iree_hal_upload_queue_idle_t;
+
+static bool iree_hal_upload_queue_is_idle(iree_hal_upload_queue_idle_t* idle) {
+  iree_slim_mutex_lock(&idle->upload_queue->mutex);
+  bool is_idle = idle->upload_queue->completed_count >= idle->enqueued_count;
+  iree_slim_mutex_unlock(&idle->upload_queue->mutex);
+  return is_idle;
+}
+
+iree_status_t iree_hal_upload_queue_wait_idle(
+    iree_hal_upload_queue_t* upload_queue, iree_timeout_t timeout) {
+  IREE_ASSERT_ARGUMENT(upload_queue);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_upload_queue_idle_t idle = {
+      .upload_queue = upload_queue,
+  };
+  iree_slim_mutex_lock(&upload_queue->mutex);
+  idle.enqueued_count = upload_queue->enqueued_count;
+  iree_slim_mutex_unlock(&upload_queue->mutex);
+
+  iree_status_t status = iree_ok_status();
+  if (!iree_notification_await(
+          &upload_queue->completed_notification,
+          (iree_condition_fn_t)iree_hal_upload_queue_is_idle, &idle,
+          timeout)) {
+    status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Performs the |upload| on the calling thread and signals or fails its signal
+// fence with the result. |status| is the result of waiting on the wait fence
+// and on failure propagates to the signal fence without performing the upload.
+static void iree_hal_upload_queue_process(iree_hal_upload_queue_t* upload_queue,
+                                          iree_hal_upload_t* upload,
+                                          iree_status_t status) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)upload->source.data_length);
+
+  // Transfer the data. This reads the source memory on this thread and for
+  // mapped sources is where pages are faulted in from storage.
+  if (iree_status_is_ok(status) && upload->source.data_length > 0) {
+    status = iree_hal_device_transfer_h2d(
+        upload_queue->device, upload->source.data, upload->target_buffer,
+        upload->target_offset, upload->source.data_length,
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  }
+
+  if (upload->source_release_callback.fn) {
+    upload->source_release_callback.fn(
+        upload->source_release_callback.user_data);
+  }
+
+  if (upload->signal_fence) {
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_fence_signal(upload->signal_fence);
+    }
+    if (!iree_status_is_ok(status)) {
+      iree_hal_fence_fail(upload->signal_fence, status);
+      status = iree_ok_status();
+    }
+  }
+  iree_status_ignore(status);
+
+  iree_hal_buffer_release(upload->target_buffer);
+  iree_hal_fence_release(upload->signal_fence);
+  iree_hal_fence_release(upload->wait_fence);
+  iree_allocator_free(upload_queue->host_allocator, upload);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Unlinks and returns the first pending upload whose wait fence has been
+// reached or has failed, or NULL if all pending uploads are blocked.
+// |out_status| receives the result of the wait fence. Requires the mutex.
+static iree_hal_upload_t* iree_hal_upload_queue_pop_ready(
+    iree_hal_upload_queue_t* upload_queue, iree_status_t* out_status) {
+  *out_status = iree_ok_status();
+  iree_hal_upload_t* prev = NULL;
+  for (iree_hal_upload_t* upload = upload_queue->pending_head; upload;
+       prev = upload, upload = upload->next) {
+    iree_status_t status = iree_hal_fence_query(upload->wait_fence);
+    if (iree_status_is_deferred(status)) {
+      iree_status_ignore(status);
+      continue;
+    }
+    if (prev) {
+      prev->next = upload->next;
+    } else {
+      upload_queue->pending_head = upload->next;
+    }
+    if (upload_queue->pending_tail == upload) upload_queue->pending_tail = prev;
+    upload->next = NULL;
+    *out_status = status;
+    return upload;
+  }
+  return NULL;
+}
+
+// Unlinks and returns the first pending upload, if any. Requires the mutex.
+static iree_hal_upload_t* iree_hal_upload_queue_pop_head(
+    iree_hal_upload_queue_t* upload_queue) {
+  iree_hal_upload_t* upload = upload_queue->pending_head;
+  if (upload) {
+    upload_queue->pending_head = upload->next;
+    if (!upload_queue->pending_head) upload_queue->pending_tail = NULL;
+    upload->next = NULL;
+  }
+  return upload;
+}
+
+// Populates |wait_list| with the wake semaphore and the unreached semaphores of
+// the wait fences of all pending uploads. Returns false if there were more than
+// the list can hold and the wait must be bounded. Requires the mutex.
+static bool iree_hal_upload_queue_gather_waits(
+    iree_hal_upload_queue_t* upload_queue,
+    iree_hal_semaphore_list_t* wait_list) {
+  wait_list->semaphores[0] = upload_queue->wake_semaphore;
+  wait_list->payload_values[0] = upload_queue->wake_value + 1;
+  wait_list->count = 1;
+  for (iree_hal_upload_t* upload = upload_queue->pending_head; upload;
+       upload = upload->next) {
+    iree_hal_semaphore_list_t fence_list =
+        iree_hal_fence_semaphore_list(upload->wait_fence);
+    for (iree_host_size_t i = 0; i < fence_list.count; ++i) {
+      uint64_t current_value = 0;
+      iree_status_t status =
+          iree_hal_semaphore_query(fence_list.semaphores[i], &current_value);
+      if (!iree_status_is_ok(status)) {
+        // Failed semaphores are picked up by the next scan.
+        iree_status_ignore(status);
+        continue;
+      }
+      if (current_value >= fence_list.payload_values[i]) continue;
+      if (wait_list->count == IREE_HAL_UPLOAD_QUEUE_MAX_WAIT_COUNT) {
+        return false;
+      }
+      wait_list->semaphores[wait_list->count] = fence_list.semaphores[i];
+      wait_list->payload_values[wait_list->count] =
+          fence_list.payload_values[i];
+      ++wait_list->count;
+    }
+  }
+  return true;
+}
+
+static int iree_hal_upload_queue_main(iree_hal_upload_queue_t* upload_queue) {
+  iree_hal_semaphore_t* wait_semaphores[IREE_HAL_UPLOAD_QUEUE_MAX_WAIT_COUNT];
+  uint64_t wait_payload_values[IREE_HAL_UPLOAD_QUEUE_MAX_WAIT_COUNT];
+  while (true) {
+    // Take the first upload that may begin. Uploads only wait on fences and a
+    // blocked upload never delays those enqueued after it: the fence it waits
+    // on may itself depend on a later upload. Once exiting nothing may ever
+    // signal the fences of blocked uploads and they are cancelled instead.
+    iree_hal_semaphore_list_t wait_list = {
+        .count = 0,
+        .semaphores = wait_semaphores,
+        .payload_values = wait_payload_values,
+    };
+    bool wait_list_complete = true;
+    iree_slim_mutex_lock(&upload_queue->mutex);
+    iree_status_t status = iree_ok_status();
+    iree_hal_upload_t* upload =
+        iree_hal_upload_queue_pop_ready(upload_queue, &status);
+    const bool exit_requested = upload_queue->exit_requested;
+    if (!upload && exit_requested) {
+      upload = iree_hal_upload_queue_pop_head(upload_queue);
+      if (upload) {
+        status = iree_make_status(
+            IREE_STATUS_CANCELLED,
+            "upload queue freed before the upload wait fence was reached");
+      }
+    } else if (!upload) {
+      wait_list_complete =
+          iree_hal_upload_queue_gather_waits(upload_queue, &wait_list);
+    }
+    iree_slim_mutex_unlock(&upload_queue->mutex);
+
+    if (upload) {
+      iree_hal_upload_queue_process(upload_queue, upload, status);
+      iree_slim_mutex_lock(&upload_queue->mutex);
+      ++upload_queue->completed_count;
+      iree_slim_mutex_unlock(&upload_queue->mutex);
+      iree_notification_post(&upload_queue->completed_notification,
+                             IREE_ALL_WAITERS);
+      continue;
+    } else if (exit_requested) {
+      break;
+    }
+
+    // Wait until new uploads are enqueued, exit is requested, or any pending
+    // upload may be able to begin. Failures are observed on the next scan.
+    iree_status_ignore(iree_hal_device_wait_semaphores(
+        upload_queue->device, IREE_HAL_WAIT_MODE_ANY, wait_list,
+        wait_list_complete
+            ? iree_infinite_timeout()
+            : iree_make_timeout_ms(IREE_HAL_UPLOAD_QUEUE_POLL_MS)));
+  }
+
+  // Post while holding the lock: the queue may be freed as soon as the waiter
+  // observes the exit and we must not touch it after unlocking.
+  iree_slim_mutex_lock(&upload_queue->mutex);
+  upload_queue->exited = true;
+  iree_notification_post(&upload_queue->completed_notification,
+                         IREE_ALL_WAITERS);
+  iree_slim_mutex_unlock(&upload_queue->mutex);
+  return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_UPLOAD_QUEUE_H_
+#define IREE_HAL_UTILS_UPLOAD_QUEUE_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Function called when the host source memory of an upload can be released.
+typedef void(IREE_API_PTR* iree_hal_upload_release_fn_t)(void* user_data);
+
+// A callback issued when the host source memory of an upload is no longer
+// required.
+typedef struct iree_hal_upload_release_callback_t {
+  // Callback function pointer.
+  iree_hal_upload_release_fn_t fn;
+  // User data passed to the callback function. Unowned.
+  void* user_data;
+} iree_hal_upload_release_callback_t;
+
+// Returns a no-op upload release callback that implies that no cleanup is
+// required.
+static inline iree_hal_upload_release_callback_t
+iree_hal_upload_release_callback_null(void) {
+  iree_hal_upload_release_callback_t callback = {NULL, NULL};
+  return callback;
+}
+
+// Host->device uploads performed asynchronously on a background I/O thread.
+//
+// Uploads are ordered with respect to device work using fences: an upload
+// begins once its wait fence has been reached and its signal fence is
+// signaled as soon as the data is resident in the target buffer. This allows
+// program initialization to issue all of its constant uploads up-front and
+// have work that depends on only a subset of them begin as soon as those are
+// available instead of blocking until every upload completes.
+//
+// Source memory is read on the I/O thread. When the source is a file mapping
+// (such as a memory-mapped module) this is where the file pages are faulted in
+// and the calling thread is never blocked on storage.
+//
+// Uploads are processed one at a time in the order their wait fences are
+// reached; an upload blocked on its wait fence never delays uploads enqueued
+// after it. Wait fences must only contain semaphores of the device the queue
+// was created with. If an upload fails (including when its wait fence fails)
+// the signal fence is failed with the same status and processing continues
+// with the other uploads.
+//
+// Thread-safe: uploads may be enqueued from any thread.
+typedef struct iree_hal_upload_queue_t iree_hal_upload_queue_t;
+
+// Creates an upload queue that transfers data into buffers of |device|.
+// The background I/O thread is created immediately and idles when no uploads
+// are pending.
+iree_status_t iree_hal_upload_queue_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_upload_queue_t** out_upload_queue);
+
+// Frees |upload_queue| after all pending uploads have been resolved.
+// Uploads whose wait fence has already been reached (or that have none) are
+// completed. Uploads still blocked on an unreached wait fence are failed with
+// IREE_STATUS_CANCELLED along with their signal fences instead of waiting on
+// a fence that may never be signaled.
+void iree_hal_upload_queue_free(iree_hal_upload_queue_t* upload_queue);
+
+// Enqueues an upload of |source| into |target_buffer| at |target_offset|.
+// The upload will not begin until |wait_fence| (if any) has been reached and
+// |signal_fence| (if any) will be signaled when the upload has completed.
+// |source_release_callback| is issued once |source| is no longer used, even
+// if the upload fails. On failure to enqueue the callback is not issued and
+// the caller retains ownership of |source|.
+iree_status_t iree_hal_upload_queue_enqueue(
+    iree_hal_upload_queue_t* upload_queue, iree_hal_fence_t* wait_fence,
+    iree_hal_fence_t* signal_fence, iree_const_byte_span_t source,
+    iree_hal_upload_release_callback_t source_release_callback,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset);
+
+// Blocks the caller until all uploads enqueued prior to the call have
+// completed or the |timeout| elapses.
+iree_status_t iree_hal_upload_queue_wait_idle(
+    iree_hal_upload_queue_t* upload_queue, iree_timeout_t timeout);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_UPLOAD_QUEUE_H_
@@ -0,0 +1,299 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/upload_queue.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/tooling/device_util.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+class UploadQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    iree_hal_driver_t* driver = NULL;
+    iree_status_t status = iree_hal_driver_registry_try_create(
+        iree_hal_available_driver_registry(), IREE_SV("local-sync"),
+        iree_allocator_system(), &driver);
+    if (iree_status_is_not_found(status)) {
+      iree_status_free(status);
+      GTEST_SKIP() << "'local-sync' driver not available";
+    }
+    IREE_ASSERT_OK(status);
+    IREE_ASSERT_OK(iree_hal_driver_create_default_device(
+        driver, iree_allocator_system(), &device_));
+    iree_hal_driver_release(driver);
+    IREE_ASSERT_OK(iree_hal_upload_queue_create(
+        device_, iree_allocator_system(), &upload_queue_));
+  }
+
+  void TearDown() override {
+    iree_hal_upload_queue_free(upload_queue_);
+    iree_hal_device_release(device_);
+  }
+
+  iree_hal_buffer_t* AllocateBuffer(iree_device_size_t size) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+    params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+        iree_hal_device_allocator(device_), params, size,
+        iree_const_byte_span_empty(), &buffer));
+    return buffer;
+  }
+
+  std::vector<uint8_t> ReadBuffer(iree_hal_buffer_t* buffer) {
+    std::vector<uint8_t> data(iree_hal_buffer_byte_length(buffer));
+    IREE_CHECK_OK(iree_hal_buffer_map_read(buffer, 0, data.data(), data.size()));
+    return data;
+  }
+
+  iree_hal_fence_t* CreateFence(iree_hal_semaphore_t* semaphore,
+                                uint64_t value) {
+    iree_hal_fence_t* fence = NULL;
+    IREE_CHECK_OK(iree_hal_fence_create_at(semaphore, value,
+                                           iree_allocator_system(), &fence));
+    return fence;
+  }
+
+  iree_hal_device_t* device_ = NULL;
+  iree_hal_upload_queue_t* upload_queue_ = NULL;
+};
+
+// Counts release callbacks issued for upload sources.
+static void CountRelease(void* user_data) {
+  reinterpret_cast<std::atomic<int>*>(user_data)->fetch_add(1);
+}
+
+TEST_F(UploadQueueTest, Upload) {
+  std::vector<uint8_t> source(1024);
+  for (size_t i = 0; i < source.size(); ++i) source[i] = (uint8_t)i;
+  iree_hal_buffer_t* buffer = AllocateBuffer(source.size() + 16);
+
+  std::atomic<int> release_count = {0};
+  iree_hal_upload_release_callback_t release_callback = {CountRelease,
+                                                         &release_count};
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, /*wait_fence=*/NULL, /*signal_fence=*/NULL,
+      iree_make_const_byte_span(source.data(), source.size()),
+      release_callback, buffer, /*target_offset=*/16));
+  IREE_ASSERT_OK(
+      iree_hal_upload_queue_wait_idle(upload_queue_, iree_infinite_timeout()));
+  EXPECT_EQ(release_count.load(), 1);
+
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data() + 16, source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+}
+
+// Tests that uploads wait for their wait fence and signal their signal fence.
+TEST_F(UploadQueueTest, FenceOrdering) {
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  iree_hal_fence_t* wait_fence = CreateFence(semaphore, 1ull);
+  iree_hal_fence_t* signal_fence = CreateFence(semaphore, 2ull);
+
+  std::vector<uint8_t> source(64, 0xCD);
+  iree_hal_buffer_t* buffer = AllocateBuffer(source.size());
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, wait_fence, signal_fence,
+      iree_make_const_byte_span(source.data(), source.size()),
+      iree_hal_upload_release_callback_null(), buffer, 0));
+
+  // The upload must not complete until the wait fence is reached.
+  EXPECT_THAT(Status(iree_hal_upload_queue_wait_idle(
+                  upload_queue_, iree_make_timeout_ms(10))),
+              StatusIs(StatusCode::kDeadlineExceeded));
+  uint64_t value = 0;
+  IREE_ASSERT_OK(iree_hal_semaphore_query(semaphore, &value));
+  EXPECT_EQ(value, 0ull);
+
+  IREE_ASSERT_OK(iree_hal_semaphore_signal(semaphore, 1ull));
+  IREE_ASSERT_OK(iree_hal_fence_wait(signal_fence, iree_infinite_timeout()));
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data(), source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_fence_release(wait_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+// Tests that a failed wait fence propagates to the signal fence.
+TEST_F(UploadQueueTest, WaitFailurePropagates) {
+  iree_hal_semaphore_t* wait_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &wait_semaphore));
+  iree_hal_semaphore_t* signal_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
+  iree_hal_fence_t* wait_fence = CreateFence(wait_semaphore, 1ull);
+  iree_hal_fence_t* signal_fence = CreateFence(signal_semaphore, 1ull);
+
+  std::vector<uint8_t> source(64, 0xCD);
+  iree_hal_buffer_t* buffer = AllocateBuffer(source.size());
+  std::atomic<int> release_count = {0};
+  iree_hal_upload_release_callback_t release_callback = {CountRelease,
+                                                         &release_count};
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, wait_fence, signal_fence,
+      iree_make_const_byte_span(source.data(), source.size()),
+      release_callback, buffer, 0));
+  iree_hal_semaphore_fail(wait_semaphore,
+                          iree_make_status(IREE_STATUS_DATA_LOSS, "failed"));
+
+  iree_status_t status =
+      iree_hal_fence_wait(signal_fence, iree_infinite_timeout());
+  EXPECT_FALSE(iree_status_is_ok(status));
+  iree_status_ignore(status);
+  IREE_ASSERT_OK(
+      iree_hal_upload_queue_wait_idle(upload_queue_, iree_infinite_timeout()));
+  EXPECT_EQ(release_count.load(), 1);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_fence_release(wait_fence);
+  iree_hal_semaphore_release(signal_semaphore);
+  iree_hal_semaphore_release(wait_semaphore);
+}
+
+// Tests that an upload blocked on its wait fence does not delay uploads
+// enqueued after it, including those that the blocked upload depends on.
+TEST_F(UploadQueueTest, BlockedUploadDoesNotDelayLater) {
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  iree_hal_fence_t* first_wait_fence = CreateFence(semaphore, 1ull);
+  iree_hal_fence_t* first_signal_fence = CreateFence(semaphore, 2ull);
+  iree_hal_fence_t* second_signal_fence = CreateFence(semaphore, 1ull);
+
+  std::vector<uint8_t> first_source(64, 0xAB);
+  std::vector<uint8_t> second_source(64, 0xCD);
+  iree_hal_buffer_t* first_buffer = AllocateBuffer(first_source.size());
+  iree_hal_buffer_t* second_buffer = AllocateBuffer(second_source.size());
+
+  // The first upload waits on the completion of the second.
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, first_wait_fence, first_signal_fence,
+      iree_make_const_byte_span(first_source.data(), first_source.size()),
+      iree_hal_upload_release_callback_null(), first_buffer, 0));
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, /*wait_fence=*/NULL, second_signal_fence,
+      iree_make_const_byte_span(second_source.data(), second_source.size()),
+      iree_hal_upload_release_callback_null(), second_buffer, 0));
+
+  IREE_ASSERT_OK(
+      iree_hal_fence_wait(first_signal_fence, iree_make_timeout_ms(10000)));
+  auto first_contents = ReadBuffer(first_buffer);
+  EXPECT_EQ(std::memcmp(first_contents.data(), first_source.data(),
+                        first_source.size()),
+            0);
+  auto second_contents = ReadBuffer(second_buffer);
+  EXPECT_EQ(std::memcmp(second_contents.data(), second_source.data(),
+                        second_source.size()),
+            0);
+
+  iree_hal_buffer_release(second_buffer);
+  iree_hal_buffer_release(first_buffer);
+  iree_hal_fence_release(second_signal_fence);
+  iree_hal_fence_release(first_signal_fence);
+  iree_hal_fence_release(first_wait_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+TEST_F(UploadQueueTest, OutOfRange) {
+  std::vector<uint8_t> source(64);
+  iree_hal_buffer_t* buffer = AllocateBuffer(32);
+  EXPECT_THAT(Status(iree_hal_upload_queue_enqueue(
+                  upload_queue_, NULL, NULL,
+                  iree_make_const_byte_span(source.data(), source.size()),
+                  iree_hal_upload_release_callback_null(), buffer, 0)),
+              StatusIs(StatusCode::kOutOfRange));
+  iree_hal_buffer_release(buffer);
+}
+
+// Tests that freeing the queue completes all pending uploads.
+TEST_F(UploadQueueTest, FreeDrainsPending) {
+  std::vector<uint8_t> source(256, 0xAB);
+  std::vector<iree_hal_buffer_t*> buffers;
+  std::atomic<int> release_count = {0};
+  iree_hal_upload_release_callback_t release_callback = {CountRelease,
+                                                         &release_count};
+  for (int i = 0; i < 32; ++i) {
+    iree_hal_buffer_t* buffer = AllocateBuffer(source.size());
+    IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+        upload_queue_, NULL, NULL,
+        iree_make_const_byte_span(source.data(), source.size()),
+        release_callback, buffer, 0));
+    buffers.push_back(buffer);
+  }
+  iree_hal_upload_queue_free(upload_queue_);
+  upload_queue_ = NULL;
+  EXPECT_EQ(release_count.load(), 32);
+  for (auto* buffer : buffers) {
+    auto contents = ReadBuffer(buffer);
+    EXPECT_EQ(std::memcmp(contents.data(), source.data(), source.size()), 0);
+    iree_hal_buffer_release(buffer);
+  }
+}
+
+// Tests that freeing the queue fails uploads blocked on wait fences that are
+// never reached instead of hanging, while still completing those that can.
+TEST_F(UploadQueueTest, FreeFailsBlocked) {
+  iree_hal_semaphore_t* wait_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &wait_semaphore));
+  iree_hal_semaphore_t* signal_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
+  iree_hal_fence_t* wait_fence = CreateFence(wait_semaphore, 1ull);
+  iree_hal_fence_t* blocked_signal_fence = CreateFence(signal_semaphore, 1ull);
+
+  std::vector<uint8_t> source(64, 0xCD);
+  iree_hal_buffer_t* blocked_buffer = AllocateBuffer(source.size());
+  iree_hal_buffer_t* buffer = AllocateBuffer(source.size());
+  std::atomic<int> release_count = {0};
+  iree_hal_upload_release_callback_t release_callback = {CountRelease,
+                                                         &release_count};
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, wait_fence, blocked_signal_fence,
+      iree_make_const_byte_span(source.data(), source.size()),
+      release_callback, blocked_buffer, 0));
+  IREE_ASSERT_OK(iree_hal_upload_queue_enqueue(
+      upload_queue_, /*wait_fence=*/NULL, /*signal_fence=*/NULL,
+      iree_make_const_byte_span(source.data(), source.size()),
+      release_callback, buffer, 0));
+
+  iree_hal_upload_queue_free(upload_queue_);
+  upload_queue_ = NULL;
+  EXPECT_EQ(release_count.load(), 2);
+
+  uint64_t value = 0;
+  EXPECT_THAT(Status(iree_hal_semaphore_query(signal_semaphore, &value)),
+              StatusIs(StatusCode::kCancelled));
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data(), source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_buffer_release(blocked_buffer);
+  iree_hal_fence_release(blocked_signal_fence);
+  iree_hal_fence_release(wait_fence);
+  iree_hal_semaphore_release(signal_semaphore);
+  iree_hal_semaphore_release(wait_semaphore);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
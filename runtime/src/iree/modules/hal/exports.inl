@@ -69,6 +69,7 @@ EXPORT_FN("device.queue.alloca", iree_hal_module_device_queue_alloca, rIrriiiI,
 EXPORT_FN("device.queue.dealloca", iree_hal_module_device_queue_dealloca, rIrrr, v)
 EXPORT_FN("device.queue.execute", iree_hal_module_device_queue_execute, rIrrCrD, v)
 EXPORT_FN("device.queue.flush", iree_hal_module_device_queue_flush, rI, v)
+EXPORT_FN("device.queue.read", iree_hal_module_device_queue_read, rIrrrIrIIi, v)
 
 EXPORT_FN("ex.shared_device", iree_hal_module_ex_shared_device, v, r)
 
@@ -13,6 +13,7 @@
 
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
+#include "iree/hal/utils/upload_queue.h"
 #include "iree/modules/hal/utils/buffer_diagnostics.h"
 #include "iree/vm/api.h"
 
@@ -38,6 +39,9 @@
 typedef struct iree_hal_module_t {
   iree_allocator_t host_allocator;
   iree_hal_module_flags_t flags;
+  // Flags as passed in by the hosting application before |flags| has
+  // IREE_HAL_MODULE_FLAG_SYNCHRONOUS forced on.
+  iree_hal_module_flags_t requested_flags;
   iree_hal_device_t* shared_device;
   // TODO(benvanik): types.
 } iree_hal_module_t;
@@ -52,6 +56,11 @@ typedef struct iree_hal_module_state_t {
   // application. All instantiations of a module share the same flags.
   iree_hal_module_flags_t flags;
 
+  // Flags as passed in by the hosting application. Operations that never
+  // yield (such as hal.device.queue.read) use these instead of |flags| to
+  // decide whether to run asynchronously.
+  iree_hal_module_flags_t requested_flags;
+
   // HACK: today we only support a single device per context - in the future
   // this should be a set of available devices that the module is able to pick
   // from - the module will then hang on to them and use them as native globals
@@ -68,6 +77,11 @@ typedef struct iree_hal_module_state_t {
   // executables like ones for training vs inference in the same model, or just
   // always use this.
   iree_hal_executable_cache_t* executable_cache;
+
+  // Background I/O queue used for hal.device.queue.read. Lazily created on
+  // first use so that programs not streaming their parameters don't pay for
+  // the thread.
+  iree_hal_upload_queue_t* upload_queue;
 } iree_hal_module_state_t;
 
 static void IREE_API_PTR iree_hal_module_destroy(void* base_module) {
@@ -88,6 +102,7 @@ iree_hal_module_alloc_state(void* self, iree_allocator_t host_allocator,
   memset(state, 0, sizeof(*state));
   state->host_allocator = host_allocator;
   state->flags = module->flags;
+  state->requested_flags = module->requested_flags;
   state->shared_device = module->shared_device;
   iree_hal_device_retain(state->shared_device);
 
@@ -107,6 +122,7 @@ iree_hal_module_free_state(void* self, iree_vm_module_state_t* module_state) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_module_state_t* state = (iree_hal_module_state_t*)module_state;
+  iree_hal_upload_queue_free(state->upload_queue);
   iree_hal_executable_cache_release(state->executable_cache);
   iree_status_ignore(state->loop_status);
   iree_hal_device_release(state->shared_device);
@@ -115,6 +131,17 @@ iree_hal_module_free_state(void* self, iree_vm_module_state_t* module_state) {
   IREE_TRACE_ZONE_END(z0);
 }
 
+static iree_status_t IREE_API_PTR
+iree_hal_module_fork_state(void* self, iree_vm_module_state_t* parent_state,
+                           iree_allocator_t host_allocator,
+                           iree_vm_module_state_t** out_module_state) {
+  // The HAL module state only holds the shared device and caches that are
+  // cheap to recreate; executables themselves are held by the calling module
+  // and shared with the parent context. The upload queue is lazily created
+  // per-context on first use.
+  return iree_hal_module_alloc_state(self, host_allocator, out_module_state);
+}
+
 static iree_status_t IREE_API_PTR iree_hal_module_notify(
     void* self, iree_vm_module_state_t* module_state, iree_vm_signal_t signal) {
   iree_hal_module_state_t* state = (iree_hal_module_state_t*)module_state;
@@ -1027,6 +1054,100 @@ IREE_VM_ABI_EXPORT(iree_hal_module_device_queue_flush,  //
   return iree_hal_device_queue_flush(device, queue_affinity);
 }
 
+static void iree_hal_module_queue_read_release(void* user_data) {
+  iree_vm_buffer_release((iree_vm_buffer_t*)user_data);
+}
+
+// Performs a queue read synchronously on the calling thread.
+static iree_status_t iree_hal_module_queue_read_inline(
+    iree_hal_device_t* device, iree_hal_fence_t* wait_fence,
+    iree_hal_fence_t* signal_fence, iree_const_byte_span_t source,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset) {
+  // A failure to wait (including a failed wait fence) propagates to the
+  // signal fence the same as it would when processed asynchronously.
+  iree_status_t status =
+      iree_hal_fence_wait(wait_fence, iree_infinite_timeout());
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_device_transfer_h2d(
+        device, source.data, target_buffer, target_offset, source.data_length,
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  }
+  if (!signal_fence) return status;
+  if (iree_status_is_ok(status)) {
+    return iree_hal_fence_signal(signal_fence);
+  }
+  iree_hal_fence_fail(signal_fence, iree_status_clone(status));
+  return status;
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_device_queue_read,  //
+                   iree_hal_module_state_t,            //
+                   rIrrrIrIIi, v) {
+  iree_hal_device_t* device = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_device_check_deref(args->r0, &device));
+  // NOTE: the queue affinity is ignored as host->device transfers are not yet
+  // queue-specific; all reads are ordered solely by their fences.
+  iree_hal_fence_t* wait_fence = iree_hal_fence_deref(args->r2);
+  iree_hal_fence_t* signal_fence = iree_hal_fence_deref(args->r3);
+  iree_vm_buffer_t* source = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(args->r4, &source));
+  iree_device_size_t source_offset = iree_hal_cast_device_size(args->i5);
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_check_deref(args->r6, &target_buffer));
+  iree_device_size_t target_offset = iree_hal_cast_device_size(args->i7);
+  iree_device_size_t length = iree_hal_cast_device_size(args->i8);
+  uint32_t flags = (uint32_t)args->i9;
+  if (flags != 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unsupported queue read flags 0x%08X", flags);
+  }
+
+  iree_host_size_t buffer_length = source->data.data_length;
+  if (length < 0 || source_offset < 0 || source_offset > buffer_length ||
+      source_offset + length > buffer_length) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "byte range out of bounds (requested %" PRIdsz
+                            "-%" PRIdsz " of available %" PRIhsz ")",
+                            source_offset, (source_offset + length - 1),
+                            buffer_length);
+  }
+  iree_const_byte_span_t source_span = iree_make_const_byte_span(
+      source->data.data + source_offset, (iree_host_size_t)length);
+
+  // When the application requested synchronous execution perform the read
+  // inline. The read never yields so the forced synchronous mode used for
+  // yielding ops does not apply. The upload queue transfers into buffers of
+  // the shared device and reads targeting any other device are also performed
+  // inline.
+  if (iree_all_bits_set(state->requested_flags,
+                        IREE_HAL_MODULE_FLAG_SYNCHRONOUS) ||
+      device != state->shared_device) {
+    return iree_hal_module_queue_read_inline(device, wait_fence, signal_fence,
+                                             source_span, target_buffer,
+                                             target_offset);
+  }
+
+  // Hand off the read to the background I/O thread. The source buffer is
+  // retained until the read completes as it may be a view into a file mapping
+  // that is only paged in during the read.
+  if (!state->upload_queue) {
+    IREE_RETURN_IF_ERROR(iree_hal_upload_queue_create(
+        state->shared_device, state->host_allocator, &state->upload_queue));
+  }
+  iree_vm_buffer_retain(source);
+  const iree_hal_upload_release_callback_t release_callback = {
+      .fn = iree_hal_module_queue_read_release,
+      .user_data = source,
+  };
+  iree_status_t status = iree_hal_upload_queue_enqueue(
+      state->upload_queue, wait_fence, signal_fence, source_span,
+      release_callback, target_buffer, target_offset);
+  if (!iree_status_is_ok(status)) {
+    iree_vm_buffer_release(source);
+  }
+  return status;
+}
+
 //===--------------------------------------------------------------------===//
 // iree_hal_executable_t
 //===--------------------------------------------------------------------===//
@@ -1466,6 +1587,7 @@ IREE_API_EXPORT iree_status_t iree_hal_module_create(
       .alloc_state = iree_hal_module_alloc_state,
       .free_state = iree_hal_module_free_state,
       .notify = iree_hal_module_notify,
+      .fork_state = iree_hal_module_fork_state,
   };
 
   // Allocate shared module state.
@@ -1487,6 +1609,7 @@ IREE_API_EXPORT iree_status_t iree_hal_module_create(
   module->host_allocator = host_allocator;
   // TODO(benvanik): fix vm yield with result storage.
   module->flags = flags | IREE_HAL_MODULE_FLAG_SYNCHRONOUS;
+  module->requested_flags = flags;
   module->shared_device = device;
   iree_hal_device_retain(module->shared_device);
 
@@ -0,0 +1,429 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Tests HAL module exports that are not yet produced by the compiler by
+// invoking them directly and the cloning of HAL types when forking contexts.
+
+#include "iree/modules/hal/module.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/tooling/device_util.h"
+#include "iree/vm/api.h"
+
+namespace iree {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+class HALModuleTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    IREE_ASSERT_OK(iree_vm_instance_create(
+        IREE_VM_TYPE_CAPACITY_DEFAULT, iree_allocator_system(), &instance_));
+    IREE_ASSERT_OK(iree_hal_module_register_all_types(instance_));
+  }
+
+  static void TearDownTestSuite() { iree_vm_instance_release(instance_); }
+
+  void SetUp() override {
+    iree_hal_driver_t* driver = NULL;
+    iree_status_t status = iree_hal_driver_registry_try_create(
+        iree_hal_available_driver_registry(), IREE_SV("local-sync"),
+        iree_allocator_system(), &driver);
+    if (iree_status_is_not_found(status)) {
+      iree_status_free(status);
+      GTEST_SKIP() << "'local-sync' driver not available";
+    }
+    IREE_ASSERT_OK(status);
+    IREE_ASSERT_OK(iree_hal_driver_create_default_device(
+        driver, iree_allocator_system(), &device_));
+    IREE_ASSERT_OK(iree_hal_driver_create_default_device(
+        driver, iree_allocator_system(), &other_device_));
+    iree_hal_driver_release(driver);
+  }
+
+  void TearDown() override {
+    iree_vm_context_release(context_);
+    iree_vm_module_release(hal_module_);
+    iree_hal_device_release(other_device_);
+    iree_hal_device_release(device_);
+  }
+
+  // Creates the HAL module with |flags| and a context containing it.
+  void CreateContext(iree_hal_module_flags_t flags) {
+    IREE_ASSERT_OK(iree_hal_module_create(
+        instance_, device_, flags, iree_allocator_system(), &hal_module_));
+    IREE_ASSERT_OK(iree_vm_context_create_with_modules(
+        instance_, IREE_VM_CONTEXT_FLAG_NONE, 1, &hal_module_,
+        iree_allocator_system(), &context_));
+  }
+
+  iree_hal_buffer_t* AllocateBuffer(iree_hal_device_t* device,
+                                    iree_device_size_t size) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+        iree_hal_device_allocator(device), params, size,
+        iree_const_byte_span_empty(), &buffer));
+    return buffer;
+  }
+
+  std::vector<uint8_t> ReadBuffer(iree_hal_buffer_t* buffer) {
+    std::vector<uint8_t> data(iree_hal_buffer_byte_length(buffer));
+    IREE_CHECK_OK(
+        iree_hal_buffer_map_read(buffer, 0, data.data(), data.size()));
+    return data;
+  }
+
+  iree_hal_fence_t* CreateFence(iree_hal_semaphore_t* semaphore,
+                                uint64_t value) {
+    iree_hal_fence_t* fence = NULL;
+    IREE_CHECK_OK(iree_hal_fence_create_at(semaphore, value,
+                                           iree_allocator_system(), &fence));
+    return fence;
+  }
+
+  // Invokes hal.device.queue.read to copy all of |source| into |target_buffer|
+  // at |target_offset|.
+  iree_status_t QueueRead(iree_hal_device_t* device,
+                          iree_hal_fence_t* wait_fence,
+                          iree_hal_fence_t* signal_fence,
+                          const std::vector<uint8_t>& source,
+                          iree_hal_buffer_t* target_buffer,
+                          iree_device_size_t target_offset) {
+    return QueueReadRange(device, wait_fence, signal_fence, source,
+                          /*source_offset=*/0, target_buffer, target_offset,
+                          (int64_t)source.size());
+  }
+
+  // Invokes hal.device.queue.read to copy |length| bytes of |source| starting
+  // at |source_offset| into |target_buffer| at |target_offset|.
+  iree_status_t QueueReadRange(iree_hal_device_t* device,
+                               iree_hal_fence_t* wait_fence,
+                               iree_hal_fence_t* signal_fence,
+                               const std::vector<uint8_t>& source,
+                               int64_t source_offset,
+                               iree_hal_buffer_t* target_buffer,
+                               iree_device_size_t target_offset,
+                               int64_t length) {
+    iree_vm_function_t function;
+    IREE_RETURN_IF_ERROR(iree_vm_module_lookup_function_by_name(
+        hal_module_, IREE_VM_FUNCTION_LINKAGE_EXPORT,
+        IREE_SV("device.queue.read"), &function));
+
+    iree_vm_buffer_t* source_buffer = NULL;
+    IREE_RETURN_IF_ERROR(iree_vm_buffer_create(
+        IREE_VM_BUFFER_ACCESS_ORIGIN_HOST | IREE_VM_BUFFER_ACCESS_MUTABLE,
+        source.size(), /*alignment=*/0, iree_allocator_system(),
+        &source_buffer));
+    memcpy(iree_vm_buffer_data(source_buffer), source.data(), source.size());
+
+    vm::ref<iree_vm_list_t> inputs;
+    IREE_RETURN_IF_ERROR(iree_vm_list_create(iree_vm_make_undefined_type_def(),
+                                             10, iree_allocator_system(),
+                                             &inputs));
+    iree_vm_ref_t device_ref = iree_hal_device_retain_ref(device);
+    iree_vm_value_t queue_affinity =
+        iree_vm_value_make_i64(IREE_HAL_QUEUE_AFFINITY_ANY);
+    iree_vm_ref_t wait_fence_ref = iree_hal_fence_retain_ref(wait_fence);
+    iree_vm_ref_t signal_fence_ref = iree_hal_fence_retain_ref(signal_fence);
+    iree_vm_ref_t source_ref = iree_vm_buffer_move_ref(source_buffer);
+    iree_vm_value_t source_offset_value = iree_vm_value_make_i64(source_offset);
+    iree_vm_ref_t target_ref = iree_hal_buffer_retain_ref(target_buffer);
+    iree_vm_value_t target_offset_value =
+        iree_vm_value_make_i64((int64_t)target_offset);
+    iree_vm_value_t length_value = iree_vm_value_make_i64(length);
+    iree_vm_value_t flags = iree_vm_value_make_i32(0);
+    IREE_CHECK_OK(iree_vm_list_push_ref_move(inputs.get(), &device_ref));
+    IREE_CHECK_OK(iree_vm_list_push_value(inputs.get(), &queue_affinity));
+    IREE_CHECK_OK(iree_vm_list_push_ref_move(inputs.get(), &wait_fence_ref));
+    IREE_CHECK_OK(iree_vm_list_push_ref_move(inputs.get(), &signal_fence_ref));
+    IREE_CHECK_OK(iree_vm_list_push_ref_move(inputs.get(), &source_ref));
+    IREE_CHECK_OK(iree_vm_list_push_value(inputs.get(), &source_offset_value));
+    IREE_CHECK_OK(iree_vm_list_push_ref_move(inputs.get(), &target_ref));
+    IREE_CHECK_OK(iree_vm_list_push_value(inputs.get(), &target_offset_value));
+    IREE_CHECK_OK(iree_vm_list_push_value(inputs.get(), &length_value));
+    IREE_CHECK_OK(iree_vm_list_push_value(inputs.get(), &flags));
+
+    return iree_vm_invoke(context_, function, IREE_VM_INVOCATION_FLAG_NONE,
+                          /*policy=*/nullptr, inputs.get(),
+                          /*outputs=*/nullptr, iree_allocator_system());
+  }
+
+  static iree_vm_instance_t* instance_;
+
+  iree_hal_device_t* device_ = NULL;
+  iree_hal_device_t* other_device_ = NULL;
+  iree_vm_module_t* hal_module_ = NULL;
+  iree_vm_context_t* context_ = NULL;
+};
+iree_vm_instance_t* HALModuleTest::instance_ = NULL;
+
+// Synchronous modules perform the read inline and the signal fence is reached
+// by the time the call returns.
+TEST_F(HALModuleTest, QueueReadInline) {
+  CreateContext(IREE_HAL_MODULE_FLAG_SYNCHRONOUS);
+
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  iree_hal_fence_t* signal_fence = CreateFence(semaphore, 1ull);
+
+  std::vector<uint8_t> source(256);
+  for (size_t i = 0; i < source.size(); ++i) source[i] = (uint8_t)i;
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, source.size() + 16);
+  IREE_ASSERT_OK(QueueRead(device_, /*wait_fence=*/NULL, signal_fence, source,
+                           buffer, /*target_offset=*/16));
+
+  IREE_EXPECT_OK(iree_hal_fence_query(signal_fence));
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data() + 16, source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+// A failed wait fence fails the inline read and its signal fence.
+TEST_F(HALModuleTest, QueueReadInlineWaitFailure) {
+  CreateContext(IREE_HAL_MODULE_FLAG_SYNCHRONOUS);
+
+  iree_hal_semaphore_t* wait_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &wait_semaphore));
+  iree_hal_semaphore_t* signal_semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
+  iree_hal_fence_t* wait_fence = CreateFence(wait_semaphore, 1ull);
+  iree_hal_fence_t* signal_fence = CreateFence(signal_semaphore, 1ull);
+  iree_hal_semaphore_fail(wait_semaphore,
+                          iree_make_status(IREE_STATUS_DATA_LOSS, "failed"));
+
+  std::vector<uint8_t> source(64, 0xCD);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, source.size());
+  iree_status_t status =
+      QueueRead(device_, wait_fence, signal_fence, source, buffer, 0);
+  EXPECT_FALSE(iree_status_is_ok(status));
+  iree_status_ignore(status);
+
+  uint64_t value = 0;
+  status = iree_hal_semaphore_query(signal_semaphore, &value);
+  EXPECT_FALSE(iree_status_is_ok(status));
+  iree_status_ignore(status);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_fence_release(wait_fence);
+  iree_hal_semaphore_release(signal_semaphore);
+  iree_hal_semaphore_release(wait_semaphore);
+}
+
+// Asynchronous modules hand the read off to the upload queue and return before
+// the wait fence is reached.
+TEST_F(HALModuleTest, QueueReadAsync) {
+  CreateContext(IREE_HAL_MODULE_FLAG_NONE);
+
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  iree_hal_fence_t* wait_fence = CreateFence(semaphore, 1ull);
+  iree_hal_fence_t* signal_fence = CreateFence(semaphore, 2ull);
+
+  std::vector<uint8_t> source(256, 0xAB);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, source.size());
+  IREE_ASSERT_OK(QueueRead(device_, wait_fence, signal_fence, source, buffer,
+                           /*target_offset=*/0));
+
+  // Nothing can have been read yet as the wait fence has not been reached.
+  uint64_t value = 0;
+  IREE_ASSERT_OK(iree_hal_semaphore_query(semaphore, &value));
+  EXPECT_EQ(value, 0ull);
+
+  IREE_ASSERT_OK(iree_hal_semaphore_signal(semaphore, 1ull));
+  IREE_ASSERT_OK(iree_hal_fence_wait(signal_fence, iree_infinite_timeout()));
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data(), source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_fence_release(wait_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+// Reads targeting a device other than the one the module was created with are
+// performed inline on that device even when the module is asynchronous.
+TEST_F(HALModuleTest, QueueReadOtherDevice) {
+  CreateContext(IREE_HAL_MODULE_FLAG_NONE);
+
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(other_device_, 0ull, &semaphore));
+  iree_hal_fence_t* signal_fence = CreateFence(semaphore, 1ull);
+
+  std::vector<uint8_t> source(128, 0x5A);
+  iree_hal_buffer_t* buffer = AllocateBuffer(other_device_, source.size());
+  IREE_ASSERT_OK(QueueRead(other_device_, /*wait_fence=*/NULL, signal_fence,
+                           source, buffer, /*target_offset=*/0));
+
+  IREE_EXPECT_OK(iree_hal_fence_query(signal_fence));
+  auto contents = ReadBuffer(buffer);
+  EXPECT_EQ(std::memcmp(contents.data(), source.data(), source.size()), 0);
+
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+// Out of bounds target ranges are rejected before anything is enqueued.
+TEST_F(HALModuleTest, QueueReadOutOfRange) {
+  CreateContext(IREE_HAL_MODULE_FLAG_NONE);
+  std::vector<uint8_t> source(64);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, 32);
+  EXPECT_THAT(Status(QueueRead(device_, NULL, NULL, source, buffer, 0)),
+              StatusIs(StatusCode::kOutOfRange));
+  iree_hal_buffer_release(buffer);
+}
+
+// Out of bounds source ranges are rejected before anything is enqueued.
+TEST_F(HALModuleTest, QueueReadSourceOutOfRange) {
+  CreateContext(IREE_HAL_MODULE_FLAG_NONE);
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &semaphore));
+  iree_hal_fence_t* signal_fence = CreateFence(semaphore, 1ull);
+  std::vector<uint8_t> source(64);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, 128);
+  EXPECT_THAT(Status(QueueReadRange(device_, NULL, signal_fence, source,
+                                    /*source_offset=*/32, buffer, 0,
+                                    /*length=*/64)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(Status(QueueReadRange(device_, NULL, signal_fence, source,
+                                    /*source_offset=*/-1, buffer, 0,
+                                    /*length=*/16)),
+              StatusIs(StatusCode::kInvalidArgument));
+  uint64_t value = 0;
+  IREE_ASSERT_OK(iree_hal_semaphore_query(semaphore, &value));
+  EXPECT_EQ(value, 0ull);
+  iree_hal_buffer_release(buffer);
+  iree_hal_fence_release(signal_fence);
+  iree_hal_semaphore_release(semaphore);
+}
+
+// Clones |ref| as iree_vm_context_fork does for objects referenced by globals.
+static iree_status_t CloneForFork(iree_vm_ref_t* ref, iree_vm_ref_t* out_ref) {
+  const iree_vm_ref_type_descriptor_t* descriptor =
+      iree_vm_ref_type_descriptor(ref->type);
+  if (!descriptor->clone) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED, "type has no clone");
+  }
+  void* clone_ptr = NULL;
+  IREE_RETURN_IF_ERROR(
+      descriptor->clone(ref->ptr, iree_allocator_system(), &clone_ptr));
+  return iree_vm_ref_wrap_assign(clone_ptr, ref->type, out_ref);
+}
+
+// Writable buffers are copied for forked contexts so that neither observes
+// in-place changes made by the other.
+TEST_F(HALModuleTest, ForkClonesWritableBuffer) {
+  std::vector<uint8_t> source(64, 0xAB);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, source.size());
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_write(buffer, 0, source.data(), source.size()));
+  iree_vm_ref_t buffer_ref = iree_hal_buffer_move_ref(buffer);
+
+  iree_vm_ref_t clone_ref = {0};
+  IREE_ASSERT_OK(CloneForFork(&buffer_ref, &clone_ref));
+  iree_hal_buffer_t* clone = iree_hal_buffer_deref(clone_ref);
+  ASSERT_NE(clone, nullptr);
+  EXPECT_NE(clone, buffer);
+  EXPECT_EQ(ReadBuffer(clone), source);
+
+  IREE_ASSERT_OK(iree_hal_buffer_map_zero(clone, 0, IREE_WHOLE_BUFFER));
+  EXPECT_EQ(ReadBuffer(buffer), source);
+
+  iree_vm_ref_release(&clone_ref);
+  iree_vm_ref_release(&buffer_ref);
+}
+
+// Buffers that cannot be written are shared with forked contexts.
+TEST_F(HALModuleTest, ForkSharesReadOnlyBuffer) {
+  std::vector<uint8_t> source(64, 0xAB);
+  iree_hal_buffer_params_t params = {0};
+  params.type =
+      IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_HOST_VISIBLE;
+  params.access = IREE_HAL_MEMORY_ACCESS_READ;
+  params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      iree_hal_device_allocator(device_), params, source.size(),
+      iree_make_const_byte_span(source.data(), source.size()), &buffer));
+  iree_vm_ref_t buffer_ref = iree_hal_buffer_move_ref(buffer);
+
+  iree_vm_ref_t clone_ref = {0};
+  IREE_ASSERT_OK(CloneForFork(&buffer_ref, &clone_ref));
+  EXPECT_EQ(clone_ref.ptr, buffer_ref.ptr);
+
+  iree_vm_ref_release(&clone_ref);
+  iree_vm_ref_release(&buffer_ref);
+}
+
+// Writable buffers that cannot be copied into a new allocation fail the fork
+// instead of being silently shared.
+TEST_F(HALModuleTest, ForkFailsUncopyableWritableBuffer) {
+  std::vector<uint8_t> storage(64);
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_heap_buffer_wrap(
+      iree_hal_device_allocator(device_), IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL,
+      IREE_HAL_MEMORY_ACCESS_ALL, IREE_HAL_BUFFER_USAGE_TRANSFER,
+      storage.size(), iree_make_byte_span(storage.data(), storage.size()),
+      iree_hal_buffer_release_callback_null(), &buffer));
+  iree_vm_ref_t buffer_ref = iree_hal_buffer_move_ref(buffer);
+
+  iree_vm_ref_t clone_ref = {0};
+  EXPECT_THAT(Status(CloneForFork(&buffer_ref, &clone_ref)),
+              StatusIs(StatusCode::kFailedPrecondition));
+  EXPECT_EQ(clone_ref.ptr, nullptr);
+
+  iree_vm_ref_release(&buffer_ref);
+}
+
+// Buffer views are recreated over copies of their writable buffers.
+TEST_F(HALModuleTest, ForkClonesBufferView) {
+  std::vector<uint8_t> source(64, 0xAB);
+  iree_hal_buffer_t* buffer = AllocateBuffer(device_, source.size());
+  IREE_ASSERT_OK(
+      iree_hal_buffer_map_write(buffer, 0, source.data(), source.size()));
+  const iree_hal_dim_t shape[2] = {4, 4};
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  IREE_ASSERT_OK(iree_hal_buffer_view_create(
+      buffer, IREE_ARRAYSIZE(shape), shape, IREE_HAL_ELEMENT_TYPE_INT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, iree_allocator_system(),
+      &buffer_view));
+  iree_hal_buffer_release(buffer);
+  iree_vm_ref_t buffer_view_ref = iree_hal_buffer_view_move_ref(buffer_view);
+
+  iree_vm_ref_t clone_ref = {0};
+  IREE_ASSERT_OK(CloneForFork(&buffer_view_ref, &clone_ref));
+  iree_hal_buffer_view_t* clone = iree_hal_buffer_view_deref(clone_ref);
+  ASSERT_NE(clone, nullptr);
+  EXPECT_NE(clone, buffer_view);
+  EXPECT_NE(iree_hal_buffer_view_buffer(clone), buffer);
+  EXPECT_EQ(iree_hal_buffer_view_shape_rank(clone), 2);
+  EXPECT_EQ(iree_hal_buffer_view_element_type(clone),
+            IREE_HAL_ELEMENT_TYPE_INT_32);
+  EXPECT_EQ(ReadBuffer(iree_hal_buffer_view_buffer(clone)), source);
+
+  iree_vm_ref_release(&clone_ref);
+  iree_vm_ref_release(&buffer_view_ref);
+}
+
+}  // namespace
+}  // namespace iree
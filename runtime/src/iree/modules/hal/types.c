@@ -30,25 +30,100 @@ IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_semaphore, iree_hal_semaphore_t);
 // Type registration
 //===----------------------------------------------------------------------===//
 
-#define IREE_VM_REGISTER_HAL_C_TYPE(instance, type, name, destroy_fn,   \
-                                    registration)                       \
+#define IREE_VM_REGISTER_HAL_C_TYPE_WITH_CLONE(                         \
+    instance, type, name, destroy_fn, clone_fn, registration)           \
   static const iree_vm_ref_type_descriptor_t registration##_storage = { \
       .type_name = IREE_SVL(name),                                      \
       .offsetof_counter = offsetof(iree_hal_resource_t, ref_count) /    \
                           IREE_VM_REF_COUNTER_ALIGNMENT,                \
       .destroy = (iree_vm_ref_destroy_t)destroy_fn,                     \
+      .clone = clone_fn,                                                \
   };                                                                    \
   IREE_RETURN_IF_ERROR(iree_vm_instance_register_type(                  \
       instance, &registration##_storage, &registration));
 
+#define IREE_VM_REGISTER_HAL_C_TYPE(instance, type, name, destroy_fn,       \
+                                    registration)                           \
+  IREE_VM_REGISTER_HAL_C_TYPE_WITH_CLONE(instance, type, name, destroy_fn, \
+                                         NULL, registration)
+
+// Clones |ptr| for a forked VM context. Buffers that cannot be written are
+// shared with the parent context. Writable buffers have their contents copied
+// into a new buffer allocated from the same allocator; buffers that cannot be
+// mapped would require device work to copy and instead fail the fork.
+static iree_status_t iree_hal_buffer_clone_for_fork(
+    void* ptr, iree_allocator_t host_allocator, void** out_ptr) {
+  iree_hal_buffer_t* buffer = (iree_hal_buffer_t*)ptr;
+  if (!iree_all_bits_set(iree_hal_buffer_allowed_access(buffer),
+                         IREE_HAL_MEMORY_ACCESS_WRITE)) {
+    iree_hal_buffer_retain(buffer);
+    *out_ptr = buffer;
+    return iree_ok_status();
+  }
+
+  iree_hal_allocator_t* device_allocator =
+      iree_hal_buffer_allocated_buffer(buffer)->device_allocator;
+  if (!device_allocator ||
+      !iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) ||
+      !iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer),
+                         IREE_HAL_BUFFER_USAGE_MAPPING_SCOPED)) {
+    return iree_make_status(
+        IREE_STATUS_FAILED_PRECONDITION,
+        "writable buffers must be host mappable and owned by an allocator in "
+        "order to be cloned when forking a context");
+  }
+
+  iree_hal_buffer_params_t params = {
+      .type = iree_hal_buffer_memory_type(buffer),
+      .access = iree_hal_buffer_allowed_access(buffer),
+      .usage = iree_hal_buffer_allowed_usage(buffer),
+  };
+  iree_hal_buffer_t* clone = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      device_allocator, params, iree_hal_buffer_byte_length(buffer),
+      iree_const_byte_span_empty(), &clone));
+  iree_status_t status = iree_hal_buffer_map_copy(
+      buffer, 0, clone, 0, iree_hal_buffer_byte_length(buffer));
+  if (iree_status_is_ok(status)) {
+    *out_ptr = clone;
+  } else {
+    iree_hal_buffer_release(clone);
+  }
+  return status;
+}
+
+// Clones |ptr| for a forked VM context. Views of buffers that are cloned are
+// recreated with the same metadata and otherwise shared with the parent.
+static iree_status_t iree_hal_buffer_view_clone_for_fork(
+    void* ptr, iree_allocator_t host_allocator, void** out_ptr) {
+  iree_hal_buffer_view_t* buffer_view = (iree_hal_buffer_view_t*)ptr;
+  iree_hal_buffer_t* buffer = iree_hal_buffer_view_buffer(buffer_view);
+  iree_hal_buffer_t* clone_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_clone_for_fork(buffer, host_allocator,
+                                                      (void**)&clone_buffer));
+  iree_status_t status = iree_ok_status();
+  if (clone_buffer == buffer) {
+    iree_hal_buffer_view_retain(buffer_view);
+    *out_ptr = buffer_view;
+  } else {
+    status = iree_hal_buffer_view_create_like(
+        clone_buffer, buffer_view, host_allocator,
+        (iree_hal_buffer_view_t**)out_ptr);
+  }
+  iree_hal_buffer_release(clone_buffer);
+  return status;
+}
+
 static iree_status_t iree_hal_module_register_common_types(
     iree_vm_instance_t* instance) {
-  IREE_VM_REGISTER_HAL_C_TYPE(instance, iree_hal_buffer_t, "hal.buffer",
-                              iree_hal_buffer_recycle,
-                              iree_hal_buffer_registration);
-  IREE_VM_REGISTER_HAL_C_TYPE(instance, iree_hal_buffer_view_t,
-                              "hal.buffer_view", iree_hal_buffer_view_destroy,
-                              iree_hal_buffer_view_registration);
+  IREE_VM_REGISTER_HAL_C_TYPE_WITH_CLONE(
+      instance, iree_hal_buffer_t, "hal.buffer", iree_hal_buffer_recycle,
+      iree_hal_buffer_clone_for_fork, iree_hal_buffer_registration);
+  IREE_VM_REGISTER_HAL_C_TYPE_WITH_CLONE(
+      instance, iree_hal_buffer_view_t, "hal.buffer_view",
+      iree_hal_buffer_view_destroy, iree_hal_buffer_view_clone_for_fork,
+      iree_hal_buffer_view_registration);
   return iree_ok_status();
 }
 
@@ -233,13 +233,13 @@ iree_runtime_session_append_bytecode_module_from_file(
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_TEXT(z0, file_path);
 
-  // TODO(#3909): actually map the memory here. For now we just load the
-  // contents.
+  // Map the file into memory; rodata segments referenced by the module are
+  // only paged in from the file when first accessed.
   iree_file_contents_t* flatbuffer_contents = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_file_read_contents(file_path,
-                                  iree_runtime_session_host_allocator(session),
-                                  &flatbuffer_contents));
+      z0, iree_file_map_contents(file_path,
+                                 iree_runtime_session_host_allocator(session),
+                                 &flatbuffer_contents));
 
   // Create the module from the file contents. The contents are consumed
   // regardless of whether the module can be loaded or not.
@@ -162,6 +162,9 @@ iree_runtime_session_append_bytecode_module_from_memory(
     iree_allocator_t flatbuffer_allocator);
 
 // Appends a bytecode module to the context loaded from the given |file_path|.
+// The file is memory mapped (where supported) such that large rodata segments
+// are only paged in when first accessed and are shared with other processes
+// loading the same file.
 //
 // NOTE: only valid if the context is not yet frozen; see
 // iree_vm_context_freeze for more information.
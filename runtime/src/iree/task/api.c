@@ -24,6 +24,15 @@ IREE_FLAG(
     "when latency is the #1 priority (vs. thermals, system-wide scheduling,\n"
     "etc).");
 
+IREE_FLAG(
+    string, task_worker_idle_policy, "power",
+    "Controls how workers spin when they run out of work:\n"
+    "  'power': spin for at most --task_worker_spin_us= and shrink the spin\n"
+    "           window when spinning does not find work.\n"
+    "  'latency': always spin for the full --task_worker_spin_us= window\n"
+    "             (or a default window if 0) before sleeping. Reduces wake\n"
+    "             latency between dispatches at the cost of CPU and power.");
+
 IREE_FLAG(
     int32_t, task_worker_stack_size, 128 * 1024,
     "Minimum size in bytes of each worker thread stack.\n"
@@ -44,16 +53,39 @@ IREE_FLAG(
     "only use a specific maximum amount of local memory and the runtime must\n"
     "be configured to make at least that amount of local memory available.");
 
+IREE_FLAG(
+    bool, task_worker_numa_placement, false,
+    "Binds worker local memory and executor task pools to the NUMA node the\n"
+    "workers are pinned to and has workers prefer stealing work from other\n"
+    "workers on the same node before crossing nodes. Only has an effect on\n"
+    "systems with multiple NUMA nodes.");
+
 iree_status_t iree_task_executor_options_initialize_from_flags(
     iree_task_executor_options_t* out_options) {
   IREE_ASSERT_ARGUMENT(out_options);
   iree_task_executor_options_initialize(out_options);
   out_options->worker_spin_ns =
       (iree_duration_t)FLAG_task_worker_spin_us * 1000;
+  iree_string_view_t idle_policy =
+      iree_make_cstring_view(FLAG_task_worker_idle_policy);
+  if (iree_string_view_equal(idle_policy, IREE_SV("power"))) {
+    out_options->worker_idle_policy = IREE_TASK_EXECUTOR_IDLE_POLICY_POWER;
+  } else if (iree_string_view_equal(idle_policy, IREE_SV("latency"))) {
+    out_options->worker_idle_policy = IREE_TASK_EXECUTOR_IDLE_POLICY_LATENCY;
+  } else {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unknown --task_worker_idle_policy= value '%s'; "
+                            "expected 'power' or 'latency'",
+                            FLAG_task_worker_idle_policy);
+  }
   out_options->worker_stack_size =
       (iree_host_size_t)FLAG_task_worker_stack_size;
   out_options->worker_local_memory_size =
       (iree_host_size_t)FLAG_task_worker_local_memory;
+  if (FLAG_task_worker_numa_placement) {
+    out_options->numa_flags |= IREE_TASK_EXECUTOR_NUMA_FLAG_BIND_MEMORY |
+                               IREE_TASK_EXECUTOR_NUMA_FLAG_PREFER_LOCAL_THEFT;
+  }
   return iree_ok_status();
 }
 
@@ -179,6 +211,28 @@ static void iree_task_flags_print_action_flag(iree_string_view_t flag_name,
   fprintf(file, "# --%.*s\n", (int)flag_name.size, flag_name.data);
 }
 
+// Prints a |label|ed list of the groups set in |mask| to |file|.
+static void iree_task_flags_print_group_mask(
+    FILE* file, const char* label, iree_task_topology_group_mask_t mask) {
+  fprintf(file, "# %s: ", label);
+  if (mask == 0) {
+    fprintf(file, "(none)\n");
+  } else if (mask == IREE_TASK_TOPOLOGY_GROUP_MASK_ALL) {
+    fprintf(file, "(all/undefined)\n");
+  } else {
+    fprintf(file, "%d group(s): ", iree_math_count_ones_u64(mask));
+    for (iree_host_size_t ic = 0, jc = 0;
+         ic < IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT; ++ic) {
+      if ((mask >> ic) & 1) {
+        if (jc > 0) fprintf(file, ", ");
+        fprintf(file, "%" PRIhsz, ic);
+        ++jc;
+      }
+    }
+    fprintf(file, "\n");
+  }
+}
+
 static iree_status_t iree_task_flags_dump_task_topologies(
     iree_string_view_t flag_name, void* storage, iree_string_view_t value) {
   // Select which nodes in the machine we will be creating topologies for.
@@ -215,6 +269,12 @@ static iree_status_t iree_task_flags_dump_task_topologies(
       const iree_task_topology_group_t* group = &topology.groups[j];
       fprintf(stdout, "# group[%d]: '%s'\n", group->group_index, group->name);
       fprintf(stdout, "#      processor: %u\n", group->processor_index);
+      fprintf(stdout, "#           node: ");
+      if (group->node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+        fprintf(stdout, "(any)\n");
+      } else {
+        fprintf(stdout, "%u\n", group->node_id);
+      }
       fprintf(stdout, "#       affinity: ");
       if (group->ideal_thread_affinity.specified) {
         fprintf(stdout, "group=%u, id=%u, smt=%u",
@@ -225,25 +285,10 @@ static iree_status_t iree_task_flags_dump_task_topologies(
         fprintf(stdout, "(unspecified)");
       }
       fprintf(stdout, "\n");
-      fprintf(stdout, "#  cache sharing: ");
-      if (group->constructive_sharing_mask == 0) {
-        fprintf(stdout, "(none)\n");
-      } else if (group->constructive_sharing_mask ==
-                 IREE_TASK_TOPOLOGY_GROUP_MASK_ALL) {
-        fprintf(stdout, "(all/undefined)\n");
-      } else {
-        fprintf(stdout, "%d group(s): ",
-                iree_math_count_ones_u64(group->constructive_sharing_mask));
-        for (iree_host_size_t ic = 0, jc = 0;
-             ic < IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT; ++ic) {
-          if ((group->constructive_sharing_mask >> ic) & 1) {
-            if (jc > 0) fprintf(stdout, ", ");
-            fprintf(stdout, "%" PRIhsz, ic);
-            ++jc;
-          }
-        }
-        fprintf(stdout, "\n");
-      }
+      iree_task_flags_print_group_mask(stdout, "  cache sharing",
+                                       group->constructive_sharing_mask);
+      iree_task_flags_print_group_mask(stdout, "cluster sharing",
+                                       group->cluster_sharing_mask);
       fprintf(stdout, "#\n");
     }
   }
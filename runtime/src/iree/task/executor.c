@@ -24,6 +24,22 @@
 
 static void iree_task_executor_destroy(iree_task_executor_t* executor);
 
+// Returns the NUMA node shared by all groups in |topology| or
+// IREE_TASK_TOPOLOGY_NODE_ID_ANY if the groups span nodes (or have none).
+static iree_task_topology_node_id_t iree_task_executor_select_home_node(
+    const iree_task_topology_t* topology) {
+  iree_host_size_t group_count = iree_task_topology_group_count(topology);
+  if (!group_count) return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+  iree_task_topology_node_id_t node_id =
+      iree_task_topology_get_group(topology, 0)->node_id;
+  for (iree_host_size_t i = 1; i < group_count; ++i) {
+    if (iree_task_topology_get_group(topology, i)->node_id != node_id) {
+      return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+    }
+  }
+  return node_id;
+}
+
 void iree_task_executor_options_initialize(
     iree_task_executor_options_t* out_options) {
   memset(out_options, 0, sizeof(*out_options));
@@ -79,6 +95,11 @@ iree_status_t iree_task_executor_create(iree_task_executor_options_t options,
   executor->allocator = allocator;
   executor->scheduling_mode = options.scheduling_mode;
   executor->worker_spin_ns = options.worker_spin_ns;
+  executor->worker_idle_policy = options.worker_idle_policy;
+  if (options.worker_idle_policy == IREE_TASK_EXECUTOR_IDLE_POLICY_LATENCY &&
+      options.worker_spin_ns == IREE_DURATION_ZERO) {
+    executor->worker_spin_ns = IREE_TASK_WORKER_LATENCY_SPIN_NS;
+  }
   iree_atomic_task_slist_initialize(&executor->incoming_ready_slist);
   iree_slim_mutex_initialize(&executor->coordinator_mutex);
 
@@ -124,12 +145,20 @@ iree_status_t iree_task_executor_create(iree_task_executor_options_t options,
   // Pool used for all fanout tasks. These only live within the executor and
   // since we know the precise lifetime of them we can keep them entirely within
   // the system here.
+  //
+  // When binding memory the pool is placed on the node all workers share, if
+  // they do; executors spanning nodes leave placement up to the OS.
   if (iree_status_is_ok(status)) {
-    status = iree_task_pool_initialize(
+    iree_task_topology_node_id_t pool_node_id =
+        iree_all_bits_set(options.numa_flags,
+                          IREE_TASK_EXECUTOR_NUMA_FLAG_BIND_MEMORY)
+            ? iree_task_executor_select_home_node(topology)
+            : IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+    status = iree_task_pool_initialize_on_node(
         allocator,
         iree_max(sizeof(iree_task_fence_t), sizeof(iree_task_dispatch_shard_t)),
         worker_count * IREE_TASK_EXECUTOR_INITIAL_SHARD_RESERVATION_PER_WORKER,
-        &executor->transient_task_pool);
+        pool_node_id, &executor->transient_task_pool);
   }
 
   // Wait handling polling and waiting use a dedicated thread to ensure that
@@ -158,12 +187,32 @@ iree_status_t iree_task_executor_create(iree_task_executor_options_t options,
 
     for (iree_host_size_t i = 0; i < worker_count; ++i) {
       iree_task_worker_t* worker = &executor->workers[i];
+      const iree_task_topology_group_t* group =
+          iree_task_topology_get_group(topology, i);
+      iree_byte_span_t local_memory = iree_make_byte_span(
+          worker_local_memory, options.worker_local_memory_size);
+      if (iree_all_bits_set(options.numa_flags,
+                            IREE_TASK_EXECUTOR_NUMA_FLAG_BIND_MEMORY)) {
+        iree_task_topology_bind_memory_to_numa_node(
+            local_memory.data, local_memory.data_length, group->node_id);
+      }
+      // Without a node preference the node level covers all workers so that
+      // thieves go straight from their cluster to the rest of the machine.
+      iree_task_affinity_set_t
+          sharing_masks[IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT];
+      for (int level = 0; level < IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT;
+           ++level) {
+        sharing_masks[level] = iree_task_topology_group_sharing_mask(
+            topology, i, (iree_task_topology_sharing_level_t)level);
+      }
+      if (!iree_all_bits_set(options.numa_flags,
+                             IREE_TASK_EXECUTOR_NUMA_FLAG_PREFER_LOCAL_THEFT)) {
+        sharing_masks[IREE_TASK_TOPOLOGY_SHARING_LEVEL_NODE] =
+            IREE_TASK_TOPOLOGY_GROUP_MASK_ALL;
+      }
       status = iree_task_worker_initialize(
-          executor, i, iree_task_topology_get_group(topology, i),
-          options.worker_stack_size,
-          iree_make_byte_span(worker_local_memory,
-                              options.worker_local_memory_size),
-          &seed_prng, worker);
+          executor, i, group, sharing_masks, options.worker_stack_size,
+          local_memory, &seed_prng, worker);
       worker_local_memory += options.worker_local_memory_size;
       if (!iree_status_is_ok(status)) break;
     }
@@ -546,10 +595,12 @@ static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
 // Returns a task that is available (has not yet begun processing at all).
 // May steal multiple tasks and add them to the |local_task_queue|.
 //
-// We do a scan through ideal victims indicated by the
-// |constructive_sharing_mask|; these are the workers most likely to have some
-// cache benefits to taking their work as they share some level of the cache
-// hierarchy and should be better to steal from than any random worker.
+// We scan through victims level by level using the cumulative |sharing_masks|:
+// first the workers sharing L1/L2 caches, then those sharing the L3/cluster,
+// then those on the same NUMA node, and finally the rest of the machine. The
+// closer the victim the more likely we are to have some cache benefits to
+// taking their work and the less traffic we generate across the interconnect
+// (such as the fabric between CCXs on chiplet designs or between sockets).
 //
 // To prevent biasing any particular victim we use a fast prng function to
 // select where in the set of potential victims defined by the topology
@@ -558,8 +609,8 @@ static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
 // our search and then go in-order.
 iree_task_t* iree_task_executor_try_steal_task(
     iree_task_executor_t* executor,
-    iree_task_affinity_set_t constructive_sharing_mask,
-    uint32_t max_theft_attempts, iree_prng_minilcg128_state_t* theft_prng,
+    const iree_task_affinity_set_t* sharing_masks, uint32_t max_theft_attempts,
+    iree_prng_minilcg128_state_t* theft_prng,
     iree_task_queue_t* local_task_queue) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
@@ -582,22 +633,22 @@ iree_task_t* iree_task_executor_try_steal_task(
   int rotation_offset = iree_prng_minilcg128_next_uint8(theft_prng) &
                         (8 * sizeof(iree_task_affinity_set_t) - 1);
 
-  // Try first with the workers we may have some caches shared with. This
-  // helps to prevent cache invalidations/availability updates as it's likely
-  // that we won't need to go back to main memory (or higher cache tiers) in the
-  // event that the thief and victim are running close to each other in time.
-  iree_task_t* task = iree_task_executor_try_steal_task_from_affinity_set(
-      executor, victim_mask & constructive_sharing_mask, max_theft_attempts,
-      rotation_offset, local_task_queue);
-  if (task) {
-    IREE_TRACE_ZONE_APPEND_TEXT(z0, "local");
-  } else {
+  // Walk out from the closest level. Each level includes the ones before it so
+  // we drop the workers we've already tried before moving on. Levels that add
+  // no new workers (such as the node level on single-node systems) cost only
+  // the mask check.
+  iree_task_t* task = NULL;
+  for (int level = 0;
+       level < IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT && victim_mask; ++level) {
     task = iree_task_executor_try_steal_task_from_affinity_set(
-        executor, victim_mask & ~constructive_sharing_mask, max_theft_attempts,
+        executor, victim_mask & sharing_masks[level], max_theft_attempts,
         rotation_offset, local_task_queue);
     if (task) {
-      IREE_TRACE_ZONE_APPEND_TEXT(z0, "non-local");
+      // iree_task_topology_sharing_level_t the victim was found at.
+      IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, level);
+      break;
     }
+    victim_mask &= ~sharing_masks[level];
   }
 
   IREE_TRACE_ZONE_END(z0);
@@ -268,11 +268,45 @@ enum iree_task_scheduling_mode_bits_t {
 };
 typedef uint32_t iree_task_scheduling_mode_t;
 
+// A bitfield controlling how the executor accounts for the NUMA nodes its
+// workers are placed on (as specified by iree_task_topology_group_t::node_id).
+// These only have an effect on systems reporting multiple NUMA nodes and when
+// the topology groups have node IDs assigned.
+enum iree_task_executor_numa_flag_bits_t {
+  IREE_TASK_EXECUTOR_NUMA_FLAG_NONE = 0u,
+  // Binds each worker's local memory to the node of the worker and the
+  // executor task pools to the node shared by all workers (if any). This avoids
+  // remote memory traffic when the executor is created on a thread running on
+  // a different node than the workers.
+  IREE_TASK_EXECUTOR_NUMA_FLAG_BIND_MEMORY = 1u << 0,
+  // Workers that run out of work try to steal from other workers on their own
+  // node before stealing from workers on remote nodes.
+  IREE_TASK_EXECUTOR_NUMA_FLAG_PREFER_LOCAL_THEFT = 1u << 1,
+};
+typedef uint32_t iree_task_executor_numa_flags_t;
+
+// Defines how workers behave when they run out of work.
+typedef enum iree_task_executor_idle_policy_e {
+  // Workers spin for at most worker_spin_ns (default 0: not at all) before
+  // sleeping. The spin window adapts: it shrinks toward a small minimum each
+  // time spinning fails to find work and grows back as spins succeed, limiting
+  // the power wasted when work arrives infrequently.
+  IREE_TASK_EXECUTOR_IDLE_POLICY_POWER = 0,
+  // Workers always spin for the full window before sleeping. The window is
+  // worker_spin_ns or IREE_TASK_WORKER_LATENCY_SPIN_NS if unspecified. This
+  // trades CPU time and thermals for the lowest wake latency between
+  // dependent dispatches and should only be used when latency is critical.
+  IREE_TASK_EXECUTOR_IDLE_POLICY_LATENCY = 1,
+} iree_task_executor_idle_policy_t;
+
 // Options controlling task executor behavior.
 typedef struct iree_task_executor_options_t {
   // Specifies the schedule mode used for worker and workload balancing.
   iree_task_scheduling_mode_t scheduling_mode;
 
+  // Controls NUMA-aware memory placement and work stealing.
+  iree_task_executor_numa_flags_t numa_flags;
+
   // Base value added to each executor-local worker index.
   // This allows workers to uniquely identify themselves in multi-executor
   // configurations.
@@ -286,8 +320,17 @@ typedef struct iree_task_executor_options_t {
   // spinning is often extremely harmful to system health. Only set to non-zero
   // values when latency is the #1 priority (over thermals, system-wide
   // scheduling, and the environment).
+  //
+  // Workers spin with exponential backoff for the first half of the window and
+  // yield their timeslice between polls for the second half before going to
+  // sleep. Spinning workers are not registered as waiters and posting work to
+  // them does not require a syscall.
   iree_duration_t worker_spin_ns;
 
+  // Controls how the spin window is applied; see
+  // iree_task_executor_idle_policy_t.
+  iree_task_executor_idle_policy_t worker_idle_policy;
+
   // Minimum size in bytes of each worker thread stack.
   // The underlying platform may allocate more stack space but _should_
   // guarantee that the available stack space is near this amount. Note that the
@@ -38,10 +38,13 @@ struct iree_task_executor_t {
   // TODO(benvanik): make mutable; currently always the same reserved value.
   iree_task_scheduling_mode_t scheduling_mode;
 
-  // Time each worker should spin before parking itself to wait for more work.
-  // IREE_DURATION_ZERO is used to disable spinning.
+  // Maximum time each worker should spin before parking itself to wait for
+  // more work. IREE_DURATION_ZERO is used to disable spinning.
   iree_duration_t worker_spin_ns;
 
+  // Whether workers adapt their spin window or always use worker_spin_ns.
+  iree_task_executor_idle_policy_t worker_idle_policy;
+
   // State used by the work-stealing operations performed by donated threads.
   // This is **NOT SYNCHRONIZED** and relies on the fact that we actually don't
   // much care about the precise selection of workers enough to mind any tears
@@ -157,10 +160,12 @@ void iree_task_executor_coordinate(iree_task_executor_t* executor,
 // Tries to steal an entire task from a sibling worker (based on topology).
 // Returns a task that is available (has not yet begun processing at all).
 // May steal multiple tasks and add them to the |local_task_queue|.
+// Victims are tried level by level from the cumulative |sharing_masks| indexed
+// by iree_task_topology_sharing_level_t.
 iree_task_t* iree_task_executor_try_steal_task(
     iree_task_executor_t* executor,
-    iree_task_affinity_set_t constructive_sharing_mask,
-    uint32_t max_theft_attempts, iree_prng_minilcg128_state_t* theft_prng,
+    const iree_task_affinity_set_t* sharing_masks, uint32_t max_theft_attempts,
+    iree_prng_minilcg128_state_t* theft_prng,
     iree_task_queue_t* local_task_queue);
 
 #ifdef __cplusplus
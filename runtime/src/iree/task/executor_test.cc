@@ -35,6 +35,27 @@ TEST(ExecutorTest, Lifetime) {
   iree_task_topology_deinitialize(&topology);
 }
 
+// Tests that NUMA placement options work with whatever topology the machine
+// reports. Placement is best-effort so this also passes on single-node systems.
+TEST(ExecutorTest, LifetimeNumaPlacement) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_physical_cores(
+      iree_task_topology_query_current_node(), /*max_core_count=*/4,
+      &topology);
+
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.numa_flags = IREE_TASK_EXECUTOR_NUMA_FLAG_BIND_MEMORY |
+                       IREE_TASK_EXECUTOR_NUMA_FLAG_PREFER_LOCAL_THEFT;
+  options.worker_local_memory_size = 64 * 1024;
+  iree_task_executor_t* executor = NULL;
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
+                                           iree_allocator_system(), &executor));
+  iree_task_executor_release(executor);
+
+  iree_task_topology_deinitialize(&topology);
+}
+
 // Tests lifetime when issuing submissions before exiting.
 // This tries to catch races in shutdown with pending work.
 TEST(ExecutorTest, LifetimeStress) {
@@ -133,4 +154,55 @@ TEST(ExecutorTest, SubmissionStress) {
   iree_task_topology_deinitialize(&topology);
 }
 
+// Tests serialized submission with workers spinning for the full latency
+// window before sleeping. Posts landing while workers spin must be picked up
+// without the workers ever registering as waiters.
+TEST(ExecutorTest, SubmissionStressLatencyPolicy) {
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_idle_policy = IREE_TASK_EXECUTOR_IDLE_POLICY_LATENCY;
+  options.worker_spin_ns = 50 * 1000;
+  options.worker_local_memory_size = 64 * 1024;
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(/*group_count=*/4, &topology);
+  iree_task_executor_t* executor = NULL;
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
+                                           iree_allocator_system(), &executor));
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
+
+  for (int i = 0; i < 1000; ++i) {
+    static std::atomic<int> received_value = {0};
+    iree_task_call_t call;
+    iree_task_call_initialize(
+        &scope,
+        iree_task_make_call_closure(
+            [](void* user_context, iree_task_t* task,
+               iree_task_submission_t* pending_submission) {
+              received_value = (int)(uintptr_t)user_context;
+              return iree_ok_status();
+            },
+            (void*)(uintptr_t)i),
+        &call);
+
+    iree_task_fence_t* fence = NULL;
+    IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor, &scope, &fence));
+    iree_task_set_completion_task(&call.header, &fence->header);
+
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &call.header);
+    iree_task_executor_submit(executor, &submission);
+    iree_task_executor_flush(executor);
+    IREE_ASSERT_OK(
+        iree_task_scope_wait_idle(&scope, IREE_TIME_INFINITE_FUTURE));
+
+    EXPECT_EQ(received_value, i) << "call did not correlate to loop";
+  }
+
+  iree_task_scope_deinitialize(&scope);
+  iree_task_executor_release(executor);
+  iree_task_topology_deinitialize(&topology);
+}
+
 }  // namespace
@@ -59,9 +59,21 @@ static iree_status_t iree_task_pool_grow(iree_task_pool_t* pool,
     aligned_block_size = IREE_TASK_POOL_MIN_BLOCK_SIZE;
   }
   iree_task_allocation_header_t* allocation = NULL;
-  IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_allocator_malloc(pool->allocator, aligned_block_size,
-                                (void**)&allocation));
+  if (pool->node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_allocator_malloc(pool->allocator, aligned_block_size,
+                                  (void**)&allocation));
+  } else {
+    // Page-align the block so that all of it can be bound to the node. This
+    // must happen before we stitch the tasks below so that the pages are
+    // faulted in on the node instead of migrated later.
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_allocator_malloc_aligned(
+                pool->allocator, aligned_block_size,
+                IREE_TASK_POOL_BLOCK_ALIGNMENT, 0, (void**)&allocation));
+    iree_task_topology_bind_memory_to_numa_node(allocation, aligned_block_size,
+                                                pool->node_id);
+  }
 
   // Insert the allocation into the tracking list. Nothing reads the list until
   // the pool is trimmed/deinitialized so it's safe to do now prior to
@@ -111,16 +123,37 @@ static iree_status_t iree_task_pool_grow(iree_task_pool_t* pool,
   return iree_ok_status();
 }
 
+// Frees a block allocated by iree_task_pool_grow.
+static void iree_task_pool_free_block(iree_task_pool_t* pool,
+                                      iree_task_allocation_header_t* block) {
+  if (pool->node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+    iree_allocator_free(pool->allocator, block);
+  } else {
+    iree_allocator_free_aligned(pool->allocator, block);
+  }
+}
+
 iree_status_t iree_task_pool_initialize(iree_allocator_t allocator,
                                         iree_host_size_t task_size,
                                         iree_host_size_t initial_capacity,
                                         iree_task_pool_t* out_pool) {
+  return iree_task_pool_initialize_on_node(allocator, task_size,
+                                           initial_capacity,
+                                           IREE_TASK_TOPOLOGY_NODE_ID_ANY,
+                                           out_pool);
+}
+
+iree_status_t iree_task_pool_initialize_on_node(
+    iree_allocator_t allocator, iree_host_size_t task_size,
+    iree_host_size_t initial_capacity, iree_task_topology_node_id_t node_id,
+    iree_task_pool_t* out_pool) {
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, task_size);
   IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, initial_capacity);
 
   out_pool->allocator = allocator;
   out_pool->task_size = task_size;
+  out_pool->node_id = node_id;
   iree_atomic_task_allocation_slist_initialize(&out_pool->allocations_slist);
   iree_atomic_task_slist_initialize(&out_pool->available_slist);
   iree_status_t status =
@@ -140,7 +173,7 @@ void iree_task_pool_deinitialize(iree_task_pool_t* pool) {
     while (allocation) {
       iree_task_allocation_header_t* next =
           iree_atomic_task_allocation_slist_get_next(allocation);
-      iree_allocator_free(pool->allocator, allocation);
+      iree_task_pool_free_block(pool, allocation);
       allocation = next;
     }
   }
@@ -170,7 +203,7 @@ void iree_task_pool_trim(iree_task_pool_t* pool) {
     do {
       iree_task_allocation_header_t* next =
           iree_atomic_task_allocation_slist_get_next(allocation_head);
-      iree_allocator_free(pool->allocator, allocation_head);
+      iree_task_pool_free_block(pool, allocation_head);
       allocation_head = next;
     } while (allocation_head != NULL);
   }
@@ -13,6 +13,7 @@
 #include "iree/base/api.h"
 #include "iree/task/list.h"
 #include "iree/task/task.h"
+#include "iree/task/topology.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,10 @@ typedef struct iree_task_pool_t {
   // Task size, in bytes.
   iree_host_size_t task_size;
 
+  // NUMA node allocation blocks are bound to or IREE_TASK_TOPOLOGY_NODE_ID_ANY
+  // to leave placement up to the OS.
+  iree_task_topology_node_id_t node_id;
+
   // NOTE: we don't track current usage count as that would introduce additional
   // contention as tasks are acquired/released. If we end up finding a lot of
   // memory idling here we can add a threshold over which we reclaim it, but the
@@ -76,6 +81,15 @@ iree_status_t iree_task_pool_initialize(iree_allocator_t allocator,
                                         iree_host_size_t initial_capacity,
                                         iree_task_pool_t* out_pool);
 
+// Initializes a task pool like iree_task_pool_initialize but with all
+// allocation blocks (including those from later growth) page-aligned and bound
+// to NUMA node |node_id|. Binding is best-effort and may have no effect on
+// platforms without NUMA support.
+iree_status_t iree_task_pool_initialize_on_node(
+    iree_allocator_t allocator, iree_host_size_t task_size,
+    iree_host_size_t initial_capacity, iree_task_topology_node_id_t node_id,
+    iree_task_pool_t* out_pool);
+
 // Deinitializes a task pool and releases all task allocations back to the
 // allocator specified during initialization. All tasks must have already been
 // released back to the pool.
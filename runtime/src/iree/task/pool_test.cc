@@ -7,6 +7,7 @@
 #include "iree/task/pool.h"
 
 #include <cstdint>
+#include <cstring>
 
 #include "iree/testing/gtest.h"
 #include "iree/testing/status_matchers.h"
@@ -56,6 +57,29 @@ TEST(PoolTest, AcquireRelease) {
   iree_task_pool_deinitialize(&pool);
 }
 
+// Tests that node-bound pools behave like normal pools. Binding is best-effort
+// so this passes on systems without NUMA support (or with a single node).
+TEST(PoolTest, AcquireReleaseOnNode) {
+  iree_task_pool_t pool;
+  IREE_ASSERT_OK(iree_task_pool_initialize_on_node(
+      iree_allocator_system(), sizeof(iree_test_task_t), 2,
+      /*node_id=*/0, &pool));
+
+  // Acquire more tasks than the initial capacity to force growth.
+  iree_test_task_t* tasks[300] = {NULL};
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(tasks); ++i) {
+    IREE_ASSERT_OK(iree_task_pool_acquire(&pool, (iree_task_t**)&tasks[i]));
+    EXPECT_TRUE(tasks[i] != NULL);
+    memset(tasks[i]->payload, 0xCD, sizeof(tasks[i]->payload));
+  }
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(tasks); ++i) {
+    iree_task_pool_release(&pool, (iree_task_t*)tasks[i]);
+  }
+
+  iree_task_pool_trim(&pool);
+  iree_task_pool_deinitialize(&pool);
+}
+
 TEST(PoolTest, Trim) {
   // Start with 2 preallocated tasks so we can test both acquiring existing and
   // growing to allocate new tasks.
@@ -9,6 +9,246 @@
 #include <stddef.h>
 #include <string.h>
 
+#if IREE_TASK_QUEUE_LOCK_FREE
+
+//===----------------------------------------------------------------------===//
+// Lock-free Chase-Lev deque
+//===----------------------------------------------------------------------===//
+// See "Correct and Efficient Work-Stealing for Weak Memory Models" for the
+// memory ordering requirements of each operation. The ring is never resized:
+// the overflow list handles anything that does not fit.
+
+static_assert((IREE_TASK_QUEUE_CAPACITY & (IREE_TASK_QUEUE_CAPACITY - 1)) == 0,
+              "IREE_TASK_QUEUE_CAPACITY must be a power of two");
+
+static inline iree_task_t* iree_task_queue_load_slot(iree_task_queue_t* queue,
+                                                     int64_t index) {
+  return (iree_task_t*)iree_atomic_load_intptr(
+      &queue->slots[index & (IREE_TASK_QUEUE_CAPACITY - 1)],
+      iree_memory_order_relaxed);
+}
+
+static inline void iree_task_queue_store_slot(iree_task_queue_t* queue,
+                                              int64_t index,
+                                              iree_task_t* task) {
+  iree_atomic_store_intptr(
+      &queue->slots[index & (IREE_TASK_QUEUE_CAPACITY - 1)], (intptr_t)task,
+      iree_memory_order_relaxed);
+}
+
+// Moves as many tasks from the front of the FIFO |list| as will fit into the
+// deque such that they are popped before any existing tasks in the deque.
+// Must only be called from the owning worker's thread.
+static void iree_task_queue_push_front_list(iree_task_queue_t* queue,
+                                            iree_task_list_t* list) {
+  const int64_t bottom =
+      iree_atomic_load_int64(&queue->bottom, iree_memory_order_relaxed);
+  const int64_t top =
+      iree_atomic_load_int64(&queue->top, iree_memory_order_acquire);
+  int64_t capacity = IREE_TASK_QUEUE_CAPACITY - (bottom - top);
+  int64_t count = 0;
+  for (iree_task_t* task = list->head; task && count < capacity;
+       task = task->next_task) {
+    ++count;
+  }
+  if (count == 0) return;
+
+  // The front of the FIFO is at the bottom of the deque so we write the tasks
+  // in reverse. Thieves can't observe the slots until we publish |bottom|.
+  for (int64_t i = count - 1; i >= 0; --i) {
+    iree_task_queue_store_slot(queue, bottom + i,
+                               iree_task_list_pop_front(list));
+  }
+  iree_atomic_store_int64(&queue->bottom, bottom + count,
+                          iree_memory_order_release);
+}
+
+// Takes the task at the front of the FIFO from the bottom of the deque.
+// Must only be called from the owning worker's thread.
+static iree_task_t* iree_task_queue_take(iree_task_queue_t* queue) {
+  const int64_t bottom =
+      iree_atomic_load_int64(&queue->bottom, iree_memory_order_relaxed) - 1;
+  iree_atomic_store_int64(&queue->bottom, bottom, iree_memory_order_relaxed);
+  iree_atomic_thread_fence(iree_memory_order_seq_cst);
+  int64_t top = iree_atomic_load_int64(&queue->top, iree_memory_order_relaxed);
+  iree_task_t* task = NULL;
+  if (top <= bottom) {
+    task = iree_task_queue_load_slot(queue, bottom);
+    if (top == bottom) {
+      // Last task in the deque; race thieves for it.
+      if (!iree_atomic_compare_exchange_strong_int64(
+              &queue->top, &top, top + 1, iree_memory_order_seq_cst,
+              iree_memory_order_relaxed)) {
+        task = NULL;
+      }
+      iree_atomic_store_int64(&queue->bottom, bottom + 1,
+                              iree_memory_order_relaxed);
+    }
+  } else {
+    iree_atomic_store_int64(&queue->bottom, bottom + 1,
+                            iree_memory_order_relaxed);
+  }
+  return task;
+}
+
+// Steals the task at the back of the FIFO from the top of the deque.
+// Returns NULL if the deque is empty or another thread won the race for the
+// task. Safe to call from any thread.
+static iree_task_t* iree_task_queue_steal(iree_task_queue_t* queue) {
+  int64_t top = iree_atomic_load_int64(&queue->top, iree_memory_order_acquire);
+  iree_atomic_thread_fence(iree_memory_order_seq_cst);
+  const int64_t bottom =
+      iree_atomic_load_int64(&queue->bottom, iree_memory_order_acquire);
+  if (top >= bottom) return NULL;
+  iree_task_t* task = iree_task_queue_load_slot(queue, top);
+  if (!iree_atomic_compare_exchange_strong_int64(&queue->top, &top, top + 1,
+                                                 iree_memory_order_seq_cst,
+                                                 iree_memory_order_relaxed)) {
+    return NULL;
+  }
+  return task;
+}
+
+// Appends the FIFO |list| to the back of the queue.
+// Must only be called from the owning worker's thread.
+static void iree_task_queue_append(iree_task_queue_t* queue,
+                                   iree_task_list_t* list) {
+  if (iree_task_list_is_empty(list)) return;
+
+  // If there are already tasks spilled then the new ones go after them.
+  if (!iree_task_list_is_empty(&queue->overflow_list)) {
+    iree_task_list_append(&queue->overflow_list, list);
+    return;
+  }
+
+  // Only the thieves can get at the back of the deque so take back any tasks
+  // we still have and lay them out again followed by the new ones. Thieves may
+  // get some of them while we do this but that's what they're for.
+  iree_task_list_t combined_list;
+  iree_task_list_initialize(&combined_list);
+  iree_task_t* task = NULL;
+  while ((task = iree_task_queue_take(queue)) != NULL) {
+    iree_task_list_push_back(&combined_list, task);
+  }
+  iree_task_list_append(&combined_list, list);
+  iree_task_queue_push_front_list(queue, &combined_list);
+  iree_task_list_append(&queue->overflow_list, &combined_list);
+}
+
+void iree_task_queue_initialize(iree_task_queue_t* out_queue) {
+  memset(out_queue, 0, sizeof(*out_queue));
+  iree_task_list_initialize(&out_queue->overflow_list);
+}
+
+void iree_task_queue_deinitialize(iree_task_queue_t* queue) {
+  iree_task_list_t list;
+  iree_task_list_initialize(&list);
+  iree_task_t* task = NULL;
+  while ((task = iree_task_queue_take(queue)) != NULL) {
+    iree_task_list_push_back(&list, task);
+  }
+  iree_task_list_append(&list, &queue->overflow_list);
+  iree_task_list_discard(&list);
+}
+
+bool iree_task_queue_is_empty(iree_task_queue_t* queue) {
+  const int64_t top =
+      iree_atomic_load_int64(&queue->top, iree_memory_order_relaxed);
+  const int64_t bottom =
+      iree_atomic_load_int64(&queue->bottom, iree_memory_order_relaxed);
+  return bottom <= top && iree_task_list_is_empty(&queue->overflow_list);
+}
+
+void iree_task_queue_push_front(iree_task_queue_t* queue, iree_task_t* task) {
+  const int64_t bottom =
+      iree_atomic_load_int64(&queue->bottom, iree_memory_order_relaxed);
+  const int64_t top =
+      iree_atomic_load_int64(&queue->top, iree_memory_order_acquire);
+  if (bottom - top >= IREE_TASK_QUEUE_CAPACITY) {
+    // Full; spill the task at the back of the deque to the front of the
+    // overflow list to make room. We use the thief path as only it can get at
+    // the back of the deque. If we lose the race a thief made room for us.
+    iree_task_t* spilled_task = iree_task_queue_steal(queue);
+    if (spilled_task) {
+      iree_task_list_push_front(&queue->overflow_list, spilled_task);
+    }
+  }
+  iree_task_list_t list;
+  iree_task_list_initialize(&list);
+  iree_task_list_push_back(&list, task);
+  iree_task_queue_push_front_list(queue, &list);
+  IREE_ASSERT(iree_task_list_is_empty(&list));
+}
+
+void iree_task_queue_append_from_lifo_list_unsafe(iree_task_queue_t* queue,
+                                                  iree_task_list_t* list) {
+  iree_task_list_reverse(list);
+  iree_task_queue_append(queue, list);
+}
+
+iree_task_t* iree_task_queue_flush_from_lifo_slist(
+    iree_task_queue_t* queue, iree_atomic_task_slist_t* source_slist) {
+  iree_task_list_t suffix;
+  iree_task_list_initialize(&suffix);
+  if (iree_atomic_task_slist_flush(
+          source_slist, IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_FIFO,
+          &suffix.head, &suffix.tail)) {
+    iree_task_queue_append(queue, &suffix);
+  }
+  return iree_task_queue_pop_front(queue);
+}
+
+iree_task_t* iree_task_queue_pop_front(iree_task_queue_t* queue) {
+  iree_task_t* next_task = iree_task_queue_take(queue);
+  while (!next_task && !iree_task_list_is_empty(&queue->overflow_list)) {
+    // Refill the (now empty) deque from the overflow list. Thieves may empty it
+    // again before we get to take anything in which case we go around again.
+    iree_task_queue_push_front_list(queue, &queue->overflow_list);
+    next_task = iree_task_queue_take(queue);
+  }
+  return next_task;
+}
+
+iree_task_t* iree_task_queue_try_steal(iree_task_queue_t* source_queue,
+                                       iree_task_queue_t* target_queue,
+                                       iree_host_size_t max_tasks) {
+  // Try to take up to half of the tasks from the back of the source queue.
+  // Like the locked queue we always take the last task if there is only one.
+  const int64_t top =
+      iree_atomic_load_int64(&source_queue->top, iree_memory_order_relaxed);
+  const int64_t bottom =
+      iree_atomic_load_int64(&source_queue->bottom, iree_memory_order_relaxed);
+  const int64_t available_count = bottom - top;
+  if (available_count <= 0) return NULL;
+  iree_host_size_t steal_count =
+      (iree_host_size_t)(available_count - available_count / 2);
+  steal_count = iree_min(steal_count, max_tasks);
+
+  // Tasks are stolen from the back of the FIFO so pushing each to the front of
+  // the stolen list retains their original order.
+  iree_task_list_t stolen_tasks;
+  iree_task_list_initialize(&stolen_tasks);
+  for (iree_host_size_t i = 0; i < steal_count; ++i) {
+    iree_task_t* task = iree_task_queue_steal(source_queue);
+    if (!task) break;  // empty or lost a race; don't keep fighting
+    iree_task_list_push_front(&stolen_tasks, task);
+  }
+
+  // Add any stolen tasks to the target queue and pop off the head for return.
+  iree_task_t* next_task = NULL;
+  if (!iree_task_list_is_empty(&stolen_tasks)) {
+    iree_task_queue_append(target_queue, &stolen_tasks);
+    next_task = iree_task_queue_pop_front(target_queue);
+  }
+  return next_task;
+}
+
+#else
+
+//===----------------------------------------------------------------------===//
+// Futex-guarded task list
+//===----------------------------------------------------------------------===//
+
 void iree_task_queue_initialize(iree_task_queue_t* out_queue) {
   memset(out_queue, 0, sizeof(*out_queue));
   iree_slim_mutex_initialize(&out_queue->mutex);
@@ -89,3 +329,5 @@ iree_task_t* iree_task_queue_try_steal(iree_task_queue_t* source_queue,
   }
   return next_task;
 }
+
+#endif  // IREE_TASK_QUEUE_LOCK_FREE
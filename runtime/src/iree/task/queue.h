@@ -10,9 +10,11 @@
 #include <stdbool.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/base/internal/synchronization.h"
 #include "iree/task/list.h"
 #include "iree/task/task.h"
+#include "iree/task/tuning.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -102,12 +104,45 @@ extern "C" {
 // list we can't easily just walk backward and we don't want to be introducing
 // cache line contention as thieves start touching the same tasks as the worker
 // is while processing.
+//
+// When IREE_TASK_QUEUE_LOCK_FREE is set the queue is instead implemented as the
+// classic bounded atomic deque from the papers above with the same API. The
+// front of the FIFO lives at the bottom of the deque so the owner pops without
+// contention and thieves take from the top (the back of the FIFO) one task at
+// a time with a CAS on the top index. Appending tasks to the back of the FIFO
+// requires the owner to briefly take back its remaining tasks and lay them out
+// again along with the new ones; in practice the queue is almost always empty
+// when this happens as workers only flush their mailbox once they run dry.
+// Any tasks that do not fit in the IREE_TASK_QUEUE_CAPACITY ring are kept in
+// an owner-only overflow list following those in the ring and are moved into
+// the ring as it drains.
 typedef struct iree_task_queue_t {
+#if IREE_TASK_QUEUE_LOCK_FREE
+  // Index of the back of the queue where thieves steal tasks from.
+  // Only ever increases and is modified by thieves and by the owner when it
+  // races with thieves for the last task.
+  iree_atomic_int64_t top;
+  // Keeps thieves hammering |top| off of the owner's cache line.
+  uint8_t _top_padding[iree_hardware_destructive_interference_size -
+                       sizeof(iree_atomic_int64_t)];
+
+  // Index one past the front of the queue where the owner pushes/pops tasks.
+  // Only modified by the owner.
+  iree_atomic_int64_t bottom;
+
+  // FIFO task list of tasks following those in |slots| that did not fit.
+  // Only accessed by the owner.
+  iree_task_list_t overflow_list;
+
+  // Ring buffer of iree_task_t* indexed by top/bottom modulo the capacity.
+  iree_atomic_intptr_t slots[IREE_TASK_QUEUE_CAPACITY];
+#else
   // Must be held when manipulating the queue. >90% accesses are by the owner.
   iree_slim_mutex_t mutex;
 
   // FIFO task list.
   iree_task_list_t list IREE_GUARDED_BY(mutex);
+#endif  // IREE_TASK_QUEUE_LOCK_FREE
 } iree_task_queue_t;
 
 // Initializes a work-stealing task queue in-place.
@@ -0,0 +1,145 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Benchmarks the worker-local iree_task_queue_t under owner-only use and under
+// heavy theft. The queue implementation is selected at compile time with
+// IREE_TASK_QUEUE_LOCK_FREE (see iree/task/tuning.h); build this benchmark with
+// -DIREE_TASK_QUEUE_LOCK_FREE=0 and =1 and compare the results. Each result is
+// labeled with the implementation it was built with.
+
+#include <atomic>
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "iree/base/internal/prng.h"
+#include "iree/task/queue.h"
+
+namespace {
+
+static const char* QueueImplementationName() {
+#if IREE_TASK_QUEUE_LOCK_FREE
+  return "lock-free";
+#else
+  return "mutex";
+#endif  // IREE_TASK_QUEUE_LOCK_FREE
+}
+
+// Emulates the tiny amount of work done by small dispatch tiles.
+static void RunTask(iree_task_t* task) {
+  int value = (int)(uintptr_t)task;
+  for (int i = 0; i < 8; ++i) {
+    ++value;
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+//==============================================================================
+// Owner-only push/pop
+//==============================================================================
+
+// Measures the common case of a worker flushing a batch of tasks into its queue
+// and running through them with no thieves.
+void BM_QueueOwnerOnly(benchmark::State& state) {
+  const int batch_size = (int)state.range(0);
+  iree_task_t* tasks = new iree_task_t[batch_size]();
+  iree_task_queue_t queue;
+  iree_task_queue_initialize(&queue);
+  for (auto _ : state) {
+    iree_task_list_t list = {0};
+    for (int i = 0; i < batch_size; ++i) {
+      iree_task_list_push_front(&list, &tasks[i]);
+    }
+    iree_task_queue_append_from_lifo_list_unsafe(&queue, &list);
+    while (iree_task_t* task = iree_task_queue_pop_front(&queue)) {
+      RunTask(task);
+    }
+  }
+  iree_task_queue_deinitialize(&queue);
+  delete[] tasks;
+  state.SetItemsProcessed(state.iterations() * batch_size);
+  state.SetLabel(QueueImplementationName());
+}
+BENCHMARK(BM_QueueOwnerOnly)->Arg(16)->Arg(256)->Arg(4096);
+
+//==============================================================================
+// Heavy theft
+//==============================================================================
+
+// Maximum number of benchmark threads; matches the executor worker limit.
+static constexpr int kMaxThreadCount = 64;
+
+// Tasks produced by thread 0 in each refill. Kept small relative to the thread
+// count to emulate tiny dispatches that are mostly stolen.
+static constexpr int kProducerBatchSize = 64;
+
+struct TheftState {
+  iree_task_queue_t queues[kMaxThreadCount];
+  iree_task_t tasks[kProducerBatchSize];
+  std::atomic<int> pending_count;
+};
+static TheftState theft_state;
+
+// Thread 0 is the only producer and all other threads steal from it (and from
+// each other) to emulate a highly imbalanced workload where every worker but
+// one is constantly trying to steal.
+void BM_QueueTheft(benchmark::State& state) {
+  const int thread_index = (int)state.thread_index();
+  const int thread_count = (int)state.threads();
+  iree_task_queue_t* queue = &theft_state.queues[thread_index];
+  iree_task_queue_initialize(queue);
+  if (thread_index == 0) theft_state.pending_count = 0;
+  iree_prng_minilcg128_state_t prng;
+  iree_prng_minilcg128_initialize(thread_index + 1, &prng);
+
+  int64_t executed_count = 0;
+  for (auto _ : state) {
+    if (thread_index == 0 && theft_state.pending_count.load() == 0) {
+      theft_state.pending_count = kProducerBatchSize;
+      iree_task_list_t list = {0};
+      for (int i = 0; i < kProducerBatchSize; ++i) {
+        iree_task_list_push_front(&list, &theft_state.tasks[i]);
+      }
+      iree_task_queue_append_from_lifo_list_unsafe(queue, &list);
+    }
+    iree_task_t* task = iree_task_queue_pop_front(queue);
+    if (!task && thread_count > 1) {
+      // Favor the producer but also steal from other thieves.
+      int victim_index = iree_prng_minilcg128_next_uint8(&prng) % thread_count;
+      if (victim_index == thread_index) victim_index = 0;
+      if (victim_index != thread_index) {
+        task = iree_task_queue_try_steal(&theft_state.queues[victim_index],
+                                         queue, kProducerBatchSize);
+      }
+    }
+    if (task) {
+      RunTask(task);
+      theft_state.pending_count.fetch_sub(1);
+      ++executed_count;
+    }
+  }
+
+  // Run any tasks left in our queue so that thread 0 can reuse them.
+  while (iree_task_t* task = iree_task_queue_pop_front(queue)) {
+    RunTask(task);
+    theft_state.pending_count.fetch_sub(1);
+    ++executed_count;
+  }
+  iree_task_queue_deinitialize(queue);
+
+  state.SetItemsProcessed(executed_count);
+  state.SetLabel(QueueImplementationName());
+}
+BENCHMARK(BM_QueueTheft)
+    ->UseRealTime()
+    ->Threads(1)
+    ->Threads(2)
+    ->Threads(4)
+    ->Threads(8)
+    ->Threads(16)
+    ->Threads(32)
+    ->Threads(64);
+
+}  // namespace
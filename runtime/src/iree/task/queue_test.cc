@@ -6,6 +6,10 @@
 
 #include "iree/task/queue.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "iree/testing/gtest.h"
 
 namespace {
@@ -319,4 +323,107 @@ TEST(QueueTest, TryStealAll) {
   iree_task_queue_deinitialize(&target_queue);
 }
 
+// Tests that queues holding more tasks than IREE_TASK_QUEUE_CAPACITY (when
+// bounded) retain their FIFO order across both ends.
+TEST(QueueTest, AppendListOverCapacity) {
+  iree_task_queue_t queue;
+  iree_task_queue_initialize(&queue);
+
+  const int task_count = IREE_TASK_QUEUE_CAPACITY * 2 + 3;
+  std::vector<iree_task_t> tasks(task_count + 1);
+  iree_task_list_t list = {0};
+  for (int i = 0; i < task_count; ++i) {
+    iree_task_list_push_front(&list, &tasks[i]);
+  }
+  iree_task_queue_append_from_lifo_list_unsafe(&queue, &list);
+  EXPECT_TRUE(iree_task_list_is_empty(&list));
+
+  // Pushing to the front of a full queue must keep the task at the front.
+  iree_task_queue_push_front(&queue, &tasks[task_count]);
+  EXPECT_EQ(&tasks[task_count], iree_task_queue_pop_front(&queue));
+
+  // Steal from the back of the queue.
+  iree_task_queue_t target_queue;
+  iree_task_queue_initialize(&target_queue);
+  iree_task_t* stolen_task =
+      iree_task_queue_try_steal(&queue, &target_queue, 1);
+  EXPECT_NE(nullptr, stolen_task);
+  EXPECT_TRUE(iree_task_queue_is_empty(&target_queue));
+
+  // Remaining tasks must come out in order with the stolen task missing.
+  for (int i = 0; i < task_count; ++i) {
+    if (&tasks[i] == stolen_task) continue;
+    EXPECT_EQ(&tasks[i], iree_task_queue_pop_front(&queue));
+  }
+  EXPECT_TRUE(iree_task_queue_is_empty(&queue));
+  EXPECT_FALSE(iree_task_queue_pop_front(&queue));
+
+  iree_task_queue_deinitialize(&target_queue);
+  iree_task_queue_deinitialize(&queue);
+}
+
+// Tests that every task is received exactly once when thieves are stealing
+// from a queue while its owner is appending and popping.
+TEST(QueueTest, ConcurrentTheft) {
+  static constexpr int kThiefCount = 4;
+  static constexpr int kBatchCount = 200;
+  static constexpr int kBatchSize = 64;
+  const int task_count = kBatchCount * kBatchSize;
+  std::vector<iree_task_t> tasks(task_count);
+  std::vector<std::atomic<int>> received_counts(task_count);
+  for (auto& count : received_counts) count = 0;
+  auto receive_task = [&](iree_task_t* task) {
+    ++received_counts[task - tasks.data()];
+  };
+
+  iree_task_queue_t source_queue;
+  iree_task_queue_initialize(&source_queue);
+  std::atomic<bool> owner_done = {false};
+
+  std::vector<std::thread> thieves;
+  for (int i = 0; i < kThiefCount; ++i) {
+    thieves.emplace_back([&]() {
+      iree_task_queue_t target_queue;
+      iree_task_queue_initialize(&target_queue);
+      while (true) {
+        // Read before trying so that we don't miss the final tasks.
+        bool done = owner_done.load();
+        iree_task_t* task =
+            iree_task_queue_try_steal(&source_queue, &target_queue, 8);
+        if (!task && done) break;
+        while (task) {
+          receive_task(task);
+          task = iree_task_queue_pop_front(&target_queue);
+        }
+      }
+      iree_task_queue_deinitialize(&target_queue);
+    });
+  }
+
+  for (int batch = 0; batch < kBatchCount; ++batch) {
+    iree_task_list_t list = {0};
+    for (int i = 0; i < kBatchSize; ++i) {
+      iree_task_list_push_front(&list, &tasks[batch * kBatchSize + i]);
+    }
+    iree_task_queue_append_from_lifo_list_unsafe(&source_queue, &list);
+    // Pop only some so that the queue is usually non-empty when appending.
+    for (int i = 0; i < kBatchSize / 2; ++i) {
+      iree_task_t* task = iree_task_queue_pop_front(&source_queue);
+      if (!task) break;
+      receive_task(task);
+    }
+  }
+  while (iree_task_t* task = iree_task_queue_pop_front(&source_queue)) {
+    receive_task(task);
+  }
+  owner_done = true;
+  for (auto& thief : thieves) thief.join();
+
+  for (int i = 0; i < task_count; ++i) {
+    EXPECT_EQ(1, received_counts[i].load()) << "task " << i;
+  }
+
+  iree_task_queue_deinitialize(&source_queue);
+}
+
 }  // namespace
@@ -576,8 +576,8 @@ void iree_task_dispatch_issue(iree_task_dispatch_t* dispatch_task,
     // indirection buffer have been satisfied and its safe to read. We perform
     // the indirection here and convert the dispatch to a direct one such that
     // following code can read the value.
-    // TODO(benvanik): non-one-shot command buffers won't be able to do this as
-    // the intent is that they can be dynamic per execution.
+    // NOTE: reusable command buffers restore the indirect dispatch from their
+    // recorded copy prior to each execution.
     const uint32_t* source_ptr = dispatch_task->workgroup_count.ptr;
     memcpy(dispatch_task->workgroup_count.value, source_ptr,
            sizeof(dispatch_task->workgroup_count.value));
@@ -620,6 +620,33 @@ void iree_task_dispatch_issue(iree_task_dispatch_t* dispatch_task,
         IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION;
   }
 
+  // Shards may grow their reservations if tiles are cheap but never so large
+  // that each shard would not get several reservations; otherwise the last
+  // reservations taken would leave the other workers idle.
+  dispatch_task->max_tiles_per_reservation =
+      dispatch_task->tiles_per_reservation;
+  if (IREE_TASK_DISPATCH_TARGET_RESERVATION_DURATION_NS > 0 &&
+      dispatch_task->tiles_per_reservation > 1) {
+    uint32_t fair_share_limit =
+        (uint32_t)(dispatch_task->tile_count / (shard_count * 4));
+    fair_share_limit =
+        iree_min(fair_share_limit,
+                 IREE_TASK_DISPATCH_MAX_ADAPTIVE_TILES_PER_RESERVATION);
+    dispatch_task->max_tiles_per_reservation =
+        iree_max(dispatch_task->tiles_per_reservation, fair_share_limit);
+  }
+
+  // Pick a roughly square block shape (favoring width) clipped to the grid.
+  uint32_t block_height = 1;
+  const uint32_t block_size = IREE_TASK_DISPATCH_TILE_BLOCK_SIZE;
+  while (block_height * 2 <= workgroup_count[1] &&
+         block_height * block_height * 4 <= block_size) {
+    block_height *= 2;
+  }
+  dispatch_task->tile_block_size[0] =
+      iree_min(block_size / block_height, workgroup_count[0]);
+  dispatch_task->tile_block_size[1] = block_height;
+
   // Randomize starting worker.
   iree_host_size_t worker_offset = iree_task_post_batch_select_worker(
       post_batch, dispatch_task->header.affinity_set);
@@ -709,6 +736,105 @@ iree_task_dispatch_shard_t* iree_task_dispatch_shard_allocate(
   return shard_task;
 }
 
+// Position of a shard within the blocked traversal of a dispatch grid.
+// Tile indices are mapped to workgroups by walking each block of
+// iree_task_dispatch_t::tile_block_size workgroups in row-major order, each row
+// of blocks from left to right, and each z slice from top to bottom.
+typedef struct iree_task_tile_cursor_t {
+  // Current workgroup.
+  uint32_t xyz[3];
+  // [x, y] origin of the block containing the current workgroup.
+  uint32_t block_origin[2];
+  // [x, y] size of the current block after clipping to the grid.
+  uint32_t block_size[2];
+} iree_task_tile_cursor_t;
+
+// Positions |cursor| at the workgroup for |tile_index|.
+// This is relatively expensive and only performed once per reservation; tiles
+// within the reservation are walked with iree_task_tile_cursor_step.
+static void iree_task_tile_cursor_seek(const uint32_t workgroup_count[3],
+                                       const uint32_t tile_block_size[2],
+                                       uint32_t tile_index,
+                                       iree_task_tile_cursor_t* cursor) {
+  const uint32_t count_x = workgroup_count[0];
+  const uint32_t count_y = workgroup_count[1];
+  const uint32_t block_w = tile_block_size[0];
+  const uint32_t block_h = tile_block_size[1];
+
+  // Z slice.
+  const uint32_t slice_size = count_x * count_y;
+  const uint32_t z = tile_index / slice_size;
+  uint32_t i = tile_index - z * slice_size;
+
+  // Row of blocks; all but the last row are full height.
+  const uint32_t block_row = i / (count_x * block_h);
+  i -= block_row * count_x * block_h;
+  const uint32_t origin_y = block_row * block_h;
+  const uint32_t size_y = iree_min(block_h, count_y - origin_y);
+
+  // Block within the row; all but the last block are full width.
+  const uint32_t block_column = i / (block_w * size_y);
+  i -= block_column * block_w * size_y;
+  const uint32_t origin_x = block_column * block_w;
+  const uint32_t size_x = iree_min(block_w, count_x - origin_x);
+
+  cursor->xyz[0] = origin_x + i % size_x;
+  cursor->xyz[1] = origin_y + i / size_x;
+  cursor->xyz[2] = z;
+  cursor->block_origin[0] = origin_x;
+  cursor->block_origin[1] = origin_y;
+  cursor->block_size[0] = size_x;
+  cursor->block_size[1] = size_y;
+}
+
+// Advances |cursor| to the workgroup of the next tile index.
+static inline void iree_task_tile_cursor_step(
+    const uint32_t workgroup_count[3], const uint32_t tile_block_size[2],
+    iree_task_tile_cursor_t* cursor) {
+  if (++cursor->xyz[0] < cursor->block_origin[0] + cursor->block_size[0]) {
+    return;
+  }
+  cursor->xyz[0] = cursor->block_origin[0];
+  if (++cursor->xyz[1] < cursor->block_origin[1] + cursor->block_size[1]) {
+    return;
+  }
+
+  // Move to the next block in the row, the next row of blocks, or the next
+  // z slice.
+  cursor->block_origin[0] += tile_block_size[0];
+  if (cursor->block_origin[0] >= workgroup_count[0]) {
+    cursor->block_origin[0] = 0;
+    cursor->block_origin[1] += tile_block_size[1];
+    if (cursor->block_origin[1] >= workgroup_count[1]) {
+      cursor->block_origin[1] = 0;
+      ++cursor->xyz[2];
+    }
+  }
+  cursor->block_size[0] = iree_min(
+      tile_block_size[0], workgroup_count[0] - cursor->block_origin[0]);
+  cursor->block_size[1] = iree_min(
+      tile_block_size[1], workgroup_count[1] - cursor->block_origin[1]);
+  cursor->xyz[0] = cursor->block_origin[0];
+  cursor->xyz[1] = cursor->block_origin[1];
+}
+
+// Returns the number of tiles to reserve next given that the last reservation
+// of |tile_count| tiles took |duration_ns| to execute.
+static uint32_t iree_task_dispatch_adapt_reservation(
+    const iree_task_dispatch_t* dispatch_task, uint32_t tile_count,
+    iree_duration_t duration_ns) {
+  const iree_duration_t target_ns =
+      IREE_TASK_DISPATCH_TARGET_RESERVATION_DURATION_NS;
+  uint32_t next_count = tile_count;
+  if (duration_ns < target_ns / 2) {
+    next_count = tile_count * 2;
+  } else if (duration_ns > target_ns * 2) {
+    next_count = tile_count / 2;
+  }
+  return iree_max(1u, iree_min(next_count,
+                               dispatch_task->max_tiles_per_reservation));
+}
+
 void iree_task_dispatch_shard_execute(
     iree_task_dispatch_shard_t* task, iree_cpu_processor_id_t processor_id,
     uint32_t worker_id, iree_byte_span_t worker_local_memory,
@@ -745,8 +871,8 @@ void iree_task_dispatch_shard_execute(
          sizeof(tile_context.workgroup_size));
   memcpy(&tile_context.workgroup_count, dispatch_task->workgroup_count.value,
          sizeof(tile_context.workgroup_count));
-  uint32_t workgroup_count_x = tile_context.workgroup_count[0];
-  uint32_t workgroup_count_y = tile_context.workgroup_count[1];
+  const uint32_t* workgroup_count = tile_context.workgroup_count;
+  const uint32_t* tile_block_size = dispatch_task->tile_block_size;
   tile_context.worker_id = worker_id;
   tile_context.local_memory = local_memory;
 
@@ -762,7 +888,9 @@ void iree_task_dispatch_shard_execute(
 
   // Loop over all tiles until they are all processed.
   const uint32_t tile_count = dispatch_task->tile_count;
-  const uint32_t tiles_per_reservation = dispatch_task->tiles_per_reservation;
+  uint32_t tiles_per_reservation = dispatch_task->tiles_per_reservation;
+  const bool adaptive_reservation = dispatch_task->max_tiles_per_reservation >
+                                    dispatch_task->tiles_per_reservation;
   // relaxed order because we only care about atomic increments, not about
   // ordering of tile_index accesses w.r.t. other memory accesses.
   uint32_t tile_base = iree_atomic_fetch_add_int32(&dispatch_task->tile_index,
@@ -771,16 +899,21 @@ void iree_task_dispatch_shard_execute(
   while (tile_base < tile_count) {
     const uint32_t tile_range =
         iree_min(tile_base + tiles_per_reservation, tile_count);
+    iree_time_t reservation_start_ns =
+        adaptive_reservation ? iree_time_now() : 0;
+
+    // Only the first tile in the reservation needs the full index->xyz
+    // mapping; the rest are stepped to incrementally.
+    iree_task_tile_cursor_t cursor;
+    iree_task_tile_cursor_seek(workgroup_count, tile_block_size, tile_base,
+                               &cursor);
     for (uint32_t tile_index = tile_base; tile_index < tile_range;
          ++tile_index) {
-      // TODO(benvanik): faster math here, especially knowing we pull off N
-      // sequential indices per reservation.
-      uint32_t tile_i = tile_index;
-      tile_context.workgroup_xyz[0] = tile_i % workgroup_count_x;
-      tile_i /= workgroup_count_x;
-      tile_context.workgroup_xyz[1] = tile_i % workgroup_count_y;
-      tile_i /= workgroup_count_y;
-      tile_context.workgroup_xyz[2] = tile_i;
+      if (tile_index != tile_base) {
+        iree_task_tile_cursor_step(workgroup_count, tile_block_size, &cursor);
+      }
+      memcpy(tile_context.workgroup_xyz, cursor.xyz,
+             sizeof(tile_context.workgroup_xyz));
 
       IREE_TRACE_ZONE_BEGIN_NAMED(z_tile,
                                   "iree_task_dispatch_shard_execute_tile");
@@ -814,6 +947,13 @@ void iree_task_dispatch_shard_execute(
       }
     }
 
+    // Resize the next reservation based on how long this one took.
+    if (adaptive_reservation) {
+      tiles_per_reservation = iree_task_dispatch_adapt_reservation(
+          dispatch_task, tile_range - tile_base,
+          iree_time_now() - reservation_start_ns);
+    }
+
     // Try to grab the next slice of tiles.
     tile_base = iree_atomic_fetch_add_int32(&dispatch_task->tile_index,
                                             tiles_per_reservation,
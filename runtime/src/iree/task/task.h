@@ -641,11 +641,20 @@ typedef iree_alignas(iree_max_align_t) struct iree_task_dispatch_t {
   // The total number of tiles in the dispatch bounding tile_index.
   uint32_t tile_count;
 
-  // Maximum number of tiles to fetch per tile reservation from the grid.
+  // Initial number of tiles to fetch per tile reservation from the grid.
   // Bounded by IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION and a
   // reasonable number chosen based on the tile and shard counts.
   uint32_t tiles_per_reservation;
 
+  // Upper bound on the number of tiles shards may adaptively reserve at a time.
+  // Equal to |tiles_per_reservation| when adaptation is disabled.
+  uint32_t max_tiles_per_reservation;
+
+  // [x, y] dimensions of the blocks of workgroups the grid is traversed in.
+  // Tile indices walk each block in row-major order before moving on to the
+  // next block in the row of blocks. Blocks on the grid edges are clipped.
+  uint32_t tile_block_size[2];
+
   // The tail tile index; the next reservation will start from here.
   // This is used by shards to slice off the work to perform in their inner
   // loop. Ideally we'd have no destructive interference with other shared data
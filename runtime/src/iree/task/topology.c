@@ -11,14 +11,148 @@
 
 #include "iree/base/api.h"
 
+#if defined(IREE_PLATFORM_LINUX)
+#include <dirent.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // IREE_PLATFORM_LINUX
+
+//===----------------------------------------------------------------------===//
+// NUMA queries
+//===----------------------------------------------------------------------===//
+
+#if defined(IREE_PLATFORM_LINUX) && defined(SYS_mbind) && defined(SYS_getcpu)
+
+// Reads up to |buffer_capacity| - 1 bytes of the file at |path| into |buffer|
+// and NUL terminates it. Returns false if the file could not be read.
+static bool iree_task_topology_read_sysfs_file(const char* path,
+                                               iree_host_size_t buffer_capacity,
+                                               char* buffer) {
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  size_t length = fread(buffer, 1, buffer_capacity - 1, file);
+  fclose(file);
+  buffer[length] = 0;
+  return length > 0;
+}
+
+iree_host_size_t iree_task_topology_query_numa_node_count(void) {
+  // The online list is in the kernel cpulist format (`0`, `0-3`, `0,2-3`).
+  // Node IDs may be sparse but are used directly as bit indices by callers so
+  // we return one more than the largest ID present.
+  char buffer[256];
+  if (!iree_task_topology_read_sysfs_file("/sys/devices/system/node/online",
+                                          sizeof(buffer), buffer)) {
+    return 0;
+  }
+  iree_host_size_t node_count = 0;
+  const char* p = buffer;
+  while (*p) {
+    char* end = NULL;
+    unsigned long value = strtoul(p, &end, 10);
+    if (end == p) {
+      ++p;  // skip separators (`,`, `-`, `\n`)
+      continue;
+    }
+    node_count = iree_max(node_count, (iree_host_size_t)value + 1);
+    p = end;
+  }
+  return node_count;
+}
+
+iree_task_topology_node_id_t iree_task_topology_query_processor_numa_node(
+    uint32_t processor_id) {
+  // Each processor directory contains a `nodeN` link to the node it belongs
+  // to. This avoids needing to parse the cpulist of every node.
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u", processor_id);
+  DIR* dir = opendir(path);
+  if (!dir) return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+  iree_task_topology_node_id_t node_id = IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+  struct dirent* entry = NULL;
+  while ((entry = readdir(dir)) != NULL) {
+    unsigned int value = 0;
+    char suffix = 0;
+    if (sscanf(entry->d_name, "node%u%c", &value, &suffix) == 1) {
+      node_id = (iree_task_topology_node_id_t)value;
+      break;
+    }
+  }
+  closedir(dir);
+  return node_id;
+}
+
+iree_task_topology_node_id_t iree_task_topology_query_current_numa_node(void) {
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0) {
+    return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+  }
+  return (iree_task_topology_node_id_t)node;
+}
+
+void iree_task_topology_bind_memory_to_numa_node(
+    void* ptr, iree_host_size_t length, iree_task_topology_node_id_t node_id) {
+  // Our node masks are 64-bit everywhere else so we don't bother with more.
+  if (node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY || node_id >= 64) return;
+  long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size <= 0) return;
+
+  // mbind requires a page-aligned base so trim the range to the pages it fully
+  // contains. Partial pages at either end may be shared with other data that
+  // we don't want to move.
+  uintptr_t begin = iree_host_align((uintptr_t)ptr, (uintptr_t)page_size);
+  uintptr_t end = ((uintptr_t)ptr + length) & ~((uintptr_t)page_size - 1);
+  if (end <= begin) return;
+
+  // Values from linux/mempolicy.h; we avoid the include as it is not available
+  // in all sysroots (and libnuma definitely isn't).
+  const int mpol_preferred = 1;
+  const unsigned int mpol_mf_move = 1u << 1;
+  unsigned long node_mask[64 / (8 * sizeof(unsigned long))] = {0};
+  node_mask[node_id / (8 * sizeof(unsigned long))] |=
+      1ul << (node_id % (8 * sizeof(unsigned long)));
+
+  // NOTE: the kernel treats maxnode as one past the last valid bit.
+  // Failures (EPERM under seccomp, ENOSYS, etc) are ignored as placement is
+  // only a performance hint.
+  syscall(SYS_mbind, (void*)begin, (unsigned long)(end - begin),
+          mpol_preferred, node_mask, (unsigned long)(64 + 1), mpol_mf_move);
+}
+
+#else
+
+iree_host_size_t iree_task_topology_query_numa_node_count(void) { return 0; }
+
+iree_task_topology_node_id_t iree_task_topology_query_processor_numa_node(
+    uint32_t processor_id) {
+  return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+}
+
+iree_task_topology_node_id_t iree_task_topology_query_current_numa_node(void) {
+  return IREE_TASK_TOPOLOGY_NODE_ID_ANY;
+}
+
+void iree_task_topology_bind_memory_to_numa_node(
+    void* ptr, iree_host_size_t length, iree_task_topology_node_id_t node_id) {}
+
+#endif  // IREE_PLATFORM_LINUX && SYS_mbind && SYS_getcpu
+
+//===----------------------------------------------------------------------===//
+// Topology
+//===----------------------------------------------------------------------===//
+
 void iree_task_topology_group_initialize(
     uint8_t group_index, iree_task_topology_group_t* out_group) {
   memset(out_group, 0, sizeof(*out_group));
   out_group->group_index = group_index;
   snprintf(out_group->name, IREE_ARRAYSIZE(out_group->name), "iree-worker-%u",
            group_index);
+  out_group->node_id = IREE_TASK_TOPOLOGY_NODE_ID_ANY;
   iree_thread_affinity_set_any(&out_group->ideal_thread_affinity);
   out_group->constructive_sharing_mask = IREE_TASK_TOPOLOGY_GROUP_MASK_ALL;
+  out_group->cluster_sharing_mask = IREE_TASK_TOPOLOGY_GROUP_MASK_ALL;
 }
 
 void iree_task_topology_initialize(iree_task_topology_t* out_topology) {
@@ -76,6 +210,34 @@ iree_status_t iree_task_topology_push_group(
   return iree_ok_status();
 }
 
+iree_task_topology_group_mask_t iree_task_topology_group_sharing_mask(
+    const iree_task_topology_t* topology, iree_host_size_t group_index,
+    iree_task_topology_sharing_level_t level) {
+  const iree_task_topology_group_t* group = &topology->groups[group_index];
+  switch (level) {
+    case IREE_TASK_TOPOLOGY_SHARING_LEVEL_CACHE:
+      return group->constructive_sharing_mask;
+    case IREE_TASK_TOPOLOGY_SHARING_LEVEL_CLUSTER:
+      return group->constructive_sharing_mask | group->cluster_sharing_mask;
+    case IREE_TASK_TOPOLOGY_SHARING_LEVEL_NODE: {
+      if (group->node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+        return IREE_TASK_TOPOLOGY_GROUP_MASK_ALL;
+      }
+      iree_task_topology_group_mask_t mask =
+          group->constructive_sharing_mask | group->cluster_sharing_mask;
+      for (iree_host_size_t i = 0; i < topology->group_count; ++i) {
+        if (i == group_index) continue;
+        if (topology->groups[i].node_id == group->node_id) {
+          mask |= 1ull << i;
+        }
+      }
+      return mask;
+    }
+    default:
+      return IREE_TASK_TOPOLOGY_GROUP_MASK_ALL;
+  }
+}
+
 void iree_task_topology_initialize_from_group_count(
     iree_host_size_t group_count, iree_task_topology_t* out_topology) {
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -37,6 +37,30 @@ iree_host_size_t iree_task_topology_query_node_count(void);
 // is not available on the platform.
 iree_task_topology_node_id_t iree_task_topology_query_current_node(void);
 
+// Returns the number of NUMA nodes reported by the operating system or 0 if the
+// platform does not expose NUMA information. Unlike
+// iree_task_topology_query_node_count this never falls back to processor
+// clusters and node IDs are those used by the OS memory policy APIs.
+iree_host_size_t iree_task_topology_query_numa_node_count(void);
+
+// Returns the NUMA node the OS logical processor |processor_id| is attached to
+// or IREE_TASK_TOPOLOGY_NODE_ID_ANY if it cannot be determined.
+iree_task_topology_node_id_t iree_task_topology_query_processor_numa_node(
+    uint32_t processor_id);
+
+// Returns the NUMA node of the processor the calling thread is running on or
+// IREE_TASK_TOPOLOGY_NODE_ID_ANY if it cannot be determined.
+iree_task_topology_node_id_t iree_task_topology_query_current_numa_node(void);
+
+// Requests that the pages backing |length| bytes at |ptr| be placed on NUMA
+// node |node_id|, migrating any pages that have already been touched.
+// Only pages entirely contained within the range are affected so callers
+// should page-align allocations they want fully bound. This is a best-effort
+// hint: it is a no-op if |node_id| is IREE_TASK_TOPOLOGY_NODE_ID_ANY, if the
+// platform does not support memory policies, or if the request fails.
+void iree_task_topology_bind_memory_to_numa_node(
+    void* ptr, iree_host_size_t length, iree_task_topology_node_id_t node_id);
+
 //===----------------------------------------------------------------------===//
 // Topology group (worker thread(s) assigned to a processor)
 //===----------------------------------------------------------------------===//
@@ -45,6 +69,21 @@ iree_task_topology_node_id_t iree_task_topology_query_current_node(void);
 // caches. For example, a value of 0b1100 indicates that group 2 and 3 share.
 typedef uint64_t iree_task_topology_group_mask_t;
 
+// Levels of the memory hierarchy groups may share, ordered nearest first.
+// Work stealing walks the levels in order so that victims sharing closer
+// levels are preferred.
+typedef enum iree_task_topology_sharing_level_e {
+  // Groups sharing L1/L2 caches (constructive_sharing_mask).
+  IREE_TASK_TOPOLOGY_SHARING_LEVEL_CACHE = 0,
+  // Groups sharing the last-level cache or cluster (cluster_sharing_mask).
+  IREE_TASK_TOPOLOGY_SHARING_LEVEL_CLUSTER,
+  // Groups attached to the same NUMA node (node_id).
+  IREE_TASK_TOPOLOGY_SHARING_LEVEL_NODE,
+  // All groups in the topology.
+  IREE_TASK_TOPOLOGY_SHARING_LEVEL_ALL,
+  IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT,
+} iree_task_topology_sharing_level_t;
+
 #define IREE_TASK_TOPOLOGY_GROUP_MASK_ALL UINT64_MAX
 #define IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT \
   (sizeof(iree_task_topology_group_mask_t) * 8)
@@ -63,6 +102,12 @@ typedef struct iree_task_topology_group_t {
   // Processor index in the cpuinfo set.
   uint32_t processor_index;
 
+  // NUMA node (or processor cluster on single-node systems) the group's
+  // processor belongs to or IREE_TASK_TOPOLOGY_NODE_ID_ANY if unknown.
+  // Workers use this to place their memory and to prefer stealing from other
+  // workers on the same node.
+  iree_task_topology_node_id_t node_id;
+
   // Ideal thread affinity for threads within this group.
   // All threads within the group share the same affinity and this is what
   // allows us to model Simultaneous Multi-Threading (SMT) (aka hyperthreading).
@@ -74,6 +119,12 @@ typedef struct iree_task_topology_group_t {
   // workers in a group all share an L2 cache then the groups indicated here may
   // all share the same L3 cache.
   iree_task_topology_group_mask_t constructive_sharing_mask;
+
+  // A bitmask of other group indices that share the last-level cache (L3) or,
+  // on systems without one, the same processor cluster. This is a superset of
+  // constructive_sharing_mask and on chiplet designs corresponds to a single
+  // CCX: stealing within it avoids pulling cache lines across the fabric.
+  iree_task_topology_group_mask_t cluster_sharing_mask;
 } iree_task_topology_group_t;
 
 // Initializes |out_group| with a |group_index| derived name.
@@ -139,6 +190,15 @@ const iree_task_topology_group_t* iree_task_topology_get_group(
 iree_status_t iree_task_topology_push_group(
     iree_task_topology_t* topology, const iree_task_topology_group_t* group);
 
+// Returns the mask of other groups in |topology| that share |level| with the
+// group at |group_index|. Levels are cumulative: each includes all groups of
+// the levels before it. Groups with unknown sharing (masks of
+// IREE_TASK_TOPOLOGY_GROUP_MASK_ALL or no node) share every level with all
+// groups.
+iree_task_topology_group_mask_t iree_task_topology_group_sharing_mask(
+    const iree_task_topology_t* topology, iree_host_size_t group_index,
+    iree_task_topology_sharing_level_t level);
+
 //===----------------------------------------------------------------------===//
 // Topology initialization helpers
 //===----------------------------------------------------------------------===//
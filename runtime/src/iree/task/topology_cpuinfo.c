@@ -25,12 +25,25 @@ static void iree_task_topology_initialize_fallback(
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Returns true if the OS reports more than one NUMA node. When it does the
+// node IDs used by the topology are NUMA node IDs; otherwise we fall back to
+// processor clusters (or nothing) so that single-node systems such as
+// big.LITTLE mobile SoCs can still select subsets of cores by node.
+static bool iree_task_topology_uses_numa_nodes(void) {
+  return iree_task_topology_query_numa_node_count() > 1;
+}
+
 #if defined(IREE_TASK_CPUINFO_DISABLED)
 
-iree_host_size_t iree_task_topology_query_node_count(void) { return 1; }
+iree_host_size_t iree_task_topology_query_node_count(void) {
+  return iree_max(1u, iree_task_topology_query_numa_node_count());
+}
 
 iree_task_topology_node_id_t iree_task_topology_query_current_node(void) {
-  return 0;
+  if (!iree_task_topology_uses_numa_nodes()) return 0;
+  iree_task_topology_node_id_t node_id =
+      iree_task_topology_query_current_numa_node();
+  return node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY ? 0 : node_id;
 }
 
 void iree_task_topology_initialize_from_physical_cores(
@@ -50,6 +63,9 @@ static bool iree_task_topology_is_cpuinfo_available() {
 // TODO(benvanik): change to a system API and move to iree/base/allocator.h so
 // it can be used there for binding memory to nodes.
 iree_host_size_t iree_task_topology_query_node_count(void) {
+  if (iree_task_topology_uses_numa_nodes()) {
+    return iree_task_topology_query_numa_node_count();
+  }
   if (!iree_task_topology_is_cpuinfo_available()) return 1;
   // NOTE: this may span across packages!
   return cpuinfo_get_clusters_count();
@@ -74,12 +90,33 @@ static const struct cpuinfo_core* iree_task_topology_get_current_core() {
 }
 
 iree_task_topology_node_id_t iree_task_topology_query_current_node(void) {
+  if (iree_task_topology_uses_numa_nodes()) {
+    iree_task_topology_node_id_t node_id =
+        iree_task_topology_query_current_numa_node();
+    if (node_id != IREE_TASK_TOPOLOGY_NODE_ID_ANY) return node_id;
+  }
   if (!iree_task_topology_is_cpuinfo_available()) return 0;
   const struct cpuinfo_core* current_core =
       iree_task_topology_get_current_core();
   return current_core ? current_core->cluster->cluster_id : 0;
 }
 
+// Returns the node ID of |core|: its NUMA node if |use_numa_nodes| and the OS
+// can tell us and otherwise its cpuinfo cluster.
+static iree_task_topology_node_id_t iree_task_topology_get_core_node_id(
+    const struct cpuinfo_core* core, bool use_numa_nodes) {
+#if defined(__linux__)
+  if (use_numa_nodes) {
+    const struct cpuinfo_processor* processor =
+        cpuinfo_get_processor(core->processor_start);
+    iree_task_topology_node_id_t node_id =
+        iree_task_topology_query_processor_numa_node(processor->linux_id);
+    if (node_id != IREE_TASK_TOPOLOGY_NODE_ID_ANY) return node_id;
+  }
+#endif  // __linux__
+  return core->cluster->cluster_id;
+}
+
 // Returns |core_id| rotated by the calling base core ID.
 // On many systems the kernel will have already assigned a randomized starting
 // core for thread distribution and we can just reuse that.
@@ -148,23 +185,48 @@ static uint64_t iree_task_topology_calculate_cache_bits(
 
 // Constructs a constructive sharing mask for all *processors* that share the
 // same cache as the specified |processor|.
+//
+// Only the lower-latency L1/L2 caches are included here; L3 is tracked
+// separately by iree_task_topology_calculate_cluster_sharing_mask so that
+// work stealing can prefer the closest siblings before widening the search.
 static uint64_t iree_task_topology_calculate_constructive_sharing_mask(
     const struct cpuinfo_processor* processor) {
   uint64_t mask = 0;
   mask |= iree_task_topology_calculate_cache_bits(processor->cache.l1i);
   mask |= iree_task_topology_calculate_cache_bits(processor->cache.l1d);
   mask |= iree_task_topology_calculate_cache_bits(processor->cache.l2);
-  // TODO(benvanik): include L3 here too (for systems that have it)? Or use L3
-  // info purely for distribution and focus the group mask on lower-latency
-  // caches?
+  return mask;
+}
+
+// Constructs a mask of all *processors* that share the last-level cache with
+// the specified |processor|. On chiplet designs the L3 is per-CCX and this is
+// the boundary beyond which cache lines must cross the fabric. Systems without
+// an L3 (many mobile SoCs) fall back to the processor cluster, which usually
+// shares an L2/system cache and a clock/power domain.
+static uint64_t iree_task_topology_calculate_cluster_sharing_mask(
+    const struct cpuinfo_processor* processor) {
+  if (processor->cache.l3) {
+    return iree_task_topology_calculate_cache_bits(processor->cache.l3);
+  }
+  const struct cpuinfo_cluster* cluster = processor->cluster;
+  uint64_t mask = 0;
+  for (uint32_t processor_i = 0; processor_i < cluster->processor_count;
+       ++processor_i) {
+    uint32_t i = cluster->processor_start + processor_i;
+    if (i < IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT) {
+      mask |= 1ull << i;
+    }
+  }
   return mask;
 }
 
 // Populates |our_group| with the information from |core|.
 static void iree_task_topology_group_initialize_from_core(
-    uint32_t group_index, const struct cpuinfo_core* core,
+    uint32_t group_index, const struct cpuinfo_core* core, bool use_numa_nodes,
     iree_task_topology_group_t* out_group) {
   iree_task_topology_group_initialize(group_index, out_group);
+  out_group->node_id =
+      iree_task_topology_get_core_node_id(core, use_numa_nodes);
 
   // Guess: always pick the first processor in a core.
   // When pinning to threads we'll take into account whether the core is SMT
@@ -178,53 +240,73 @@ static void iree_task_topology_group_initialize_from_core(
       processor, &out_group->ideal_thread_affinity);
 }
 
-// Fixes constructive_sharing_mask values such that they represent other chosen
-// topology groups instead of processor indices. We do this so that code using
-// the topology groups doesn't need to know anything about which physical
-// processor IDs a particular group is mapped to.
+// Converts a mask of *processors* into a mask of the other groups in
+// |topology| (excluding |group_index|) that are mapped to those processors.
+static iree_task_topology_group_mask_t
+iree_task_topology_processor_bits_to_group_mask(
+    const iree_task_topology_t* topology, iree_host_size_t group_index,
+    uint64_t processor_bits) {
+  iree_task_topology_group_mask_t group_mask = 0;
+  for (iree_host_size_t j = 0; j < topology->group_count; ++j) {
+    if (group_index == j) continue;
+    const iree_task_topology_group_t* other_group = &topology->groups[j];
+    uint64_t group_processor_bits =
+        iree_math_rotl_u64(1ull, other_group->processor_index);
+    if (processor_bits & group_processor_bits) {
+      group_mask |= iree_math_rotl_u64(1ull, other_group->group_index);
+    }
+  }
+  return group_mask;
+}
+
+// Fixes constructive_sharing_mask and cluster_sharing_mask values such that
+// they represent other chosen topology groups instead of processor indices. We
+// do this so that code using the topology groups doesn't need to know anything
+// about which physical processor IDs a particular group is mapped to.
 static void iree_task_topology_fixup_constructive_sharing_masks(
     iree_task_topology_t* topology) {
   // O(n^2), but n is always <= 64 (and often <= 8).
   for (iree_host_size_t i = 0; i < topology->group_count; ++i) {
     iree_task_topology_group_t* group = &topology->groups[i];
+    const struct cpuinfo_processor* processor =
+        cpuinfo_get_processor(group->processor_index);
 
     // Compute the processors that we can constructively share with.
-    uint64_t constructive_sharing_mask =
-        iree_task_topology_calculate_constructive_sharing_mask(
-            cpuinfo_get_processor(group->processor_index));
-
-    iree_task_topology_group_mask_t group_mask = 0;
-    for (iree_host_size_t j = 0; j < topology->group_count; ++j) {
-      if (i == j) continue;
-      const iree_task_topology_group_t* other_group = &topology->groups[j];
-      uint64_t group_processor_bits =
-          iree_math_rotl_u64(1ull, other_group->processor_index);
-      if (constructive_sharing_mask & group_processor_bits) {
-        group_mask |= iree_math_rotl_u64(1ull, other_group->group_index);
-      }
-    }
-
-    group->constructive_sharing_mask = group_mask;
+    group->constructive_sharing_mask =
+        iree_task_topology_processor_bits_to_group_mask(
+            topology, i,
+            iree_task_topology_calculate_constructive_sharing_mask(processor));
+
+    // The cluster always includes the constructive sharing groups so that
+    // each level is a superset of the one before it.
+    group->cluster_sharing_mask =
+        group->constructive_sharing_mask |
+        iree_task_topology_processor_bits_to_group_mask(
+            topology, i,
+            iree_task_topology_calculate_cluster_sharing_mask(processor));
   }
 }
 
 // Returns true if the given |core| passes the filter and should be included.
 // |user_data| is the value passed alongside the filter function.
+// |use_numa_nodes| indicates whether node IDs refer to NUMA nodes.
 typedef bool (*iree_task_topology_core_filter_t)(
-    const struct cpuinfo_core* core, uintptr_t user_data);
+    const struct cpuinfo_core* core, bool use_numa_nodes, uintptr_t user_data);
 
 // Matches all cores.
 static bool iree_task_topology_core_filter_all(const struct cpuinfo_core* core,
+                                               bool use_numa_nodes,
                                                uintptr_t user_data) {
   return true;
 }
 
-// Matches all cores that have the provided cluster ID.
-static bool iree_task_topology_core_filter_by_cluster_id(
-    const struct cpuinfo_core* core, uintptr_t user_data) {
-  uint32_t cluster_id = (uint32_t)user_data;
-  if (cluster_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) return true;
-  return core->cluster->cluster_id == cluster_id;
+// Matches all cores that have the provided node ID.
+static bool iree_task_topology_core_filter_by_node_id(
+    const struct cpuinfo_core* core, bool use_numa_nodes, uintptr_t user_data) {
+  iree_task_topology_node_id_t node_id =
+      (iree_task_topology_node_id_t)user_data;
+  if (node_id == IREE_TASK_TOPOLOGY_NODE_ID_ANY) return true;
+  return iree_task_topology_get_core_node_id(core, use_numa_nodes) == node_id;
 }
 
 // Initializes a topology with one group for each core that matches |filter_fn|.
@@ -243,11 +325,14 @@ static void iree_task_topology_initialize_from_physical_cores_with_filter(
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, max_core_count);
 
+  // Queried once as each check requires a trip through sysfs.
+  const bool use_numa_nodes = iree_task_topology_uses_numa_nodes();
+
   // Count cores that match the filter.
   iree_host_size_t core_count = 0;
   for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
     const struct cpuinfo_core* core = cpuinfo_get_core(i);
-    if (filter_fn(core, filter_fn_data)) ++core_count;
+    if (filter_fn(core, use_numa_nodes, filter_fn_data)) ++core_count;
   }
   core_count = iree_min(core_count, max_core_count);
 
@@ -266,9 +351,9 @@ static void iree_task_topology_initialize_from_physical_cores_with_filter(
     // want to have our workers stealing their time.
     const struct cpuinfo_core* core =
         cpuinfo_get_core(iree_task_topology_rotate_from_base_core(core_i));
-    if (filter_fn(core, filter_fn_data)) {
+    if (filter_fn(core, use_numa_nodes, filter_fn_data)) {
       iree_task_topology_group_initialize_from_core(
-          group_i, core, &out_topology->groups[group_i]);
+          group_i, core, use_numa_nodes, &out_topology->groups[group_i]);
       ++group_i;
     }
   }
@@ -281,7 +366,7 @@ void iree_task_topology_initialize_from_physical_cores(
     iree_task_topology_node_id_t node_id, iree_host_size_t max_core_count,
     iree_task_topology_t* out_topology) {
   iree_task_topology_initialize_from_physical_cores_with_filter(
-      iree_task_topology_core_filter_by_cluster_id, (uintptr_t)node_id,
+      iree_task_topology_core_filter_by_node_id, (uintptr_t)node_id,
       max_core_count, out_topology);
 }
 
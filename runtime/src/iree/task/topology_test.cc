@@ -117,6 +117,75 @@ TEST(TopologyTest, FromGroupCount) {
   iree_task_topology_deinitialize(&topology);
 }
 
+// Tests that sharing levels are cumulative and derived from the group masks
+// and node IDs. Models 2 nodes each with 2 L3 clusters of 2 cores with private
+// L2 caches:
+//   node 0: clusters {0,1} {2,3}  node 1: clusters {4,5} {6,7}
+TEST(TopologyTest, SharingLevels) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize(&topology);
+  for (iree_host_size_t i = 0; i < 8; ++i) {
+    iree_task_topology_group_t group;
+    iree_task_topology_group_initialize(i, &group);
+    group.node_id = i / 4;
+    group.constructive_sharing_mask = 0;
+    group.cluster_sharing_mask = (0x3ull << (i & ~1)) & ~(1ull << i);
+    IREE_ASSERT_OK(iree_task_topology_push_group(&topology, &group));
+  }
+
+  EXPECT_EQ(0ull, iree_task_topology_group_sharing_mask(
+                      &topology, 0, IREE_TASK_TOPOLOGY_SHARING_LEVEL_CACHE));
+  EXPECT_EQ(0b00000010ull,
+            iree_task_topology_group_sharing_mask(
+                &topology, 0, IREE_TASK_TOPOLOGY_SHARING_LEVEL_CLUSTER));
+  EXPECT_EQ(0b00001110ull,
+            iree_task_topology_group_sharing_mask(
+                &topology, 0, IREE_TASK_TOPOLOGY_SHARING_LEVEL_NODE));
+  EXPECT_EQ(0b10110000ull,
+            iree_task_topology_group_sharing_mask(
+                &topology, 6, IREE_TASK_TOPOLOGY_SHARING_LEVEL_NODE));
+  EXPECT_EQ(IREE_TASK_TOPOLOGY_GROUP_MASK_ALL,
+            iree_task_topology_group_sharing_mask(
+                &topology, 6, IREE_TASK_TOPOLOGY_SHARING_LEVEL_ALL));
+
+  iree_task_topology_deinitialize(&topology);
+}
+
+// Tests that groups without topology information share every level.
+TEST(TopologyTest, SharingLevelsUnknown) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(4, &topology);
+  for (int level = 0; level < IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT;
+       ++level) {
+    EXPECT_EQ(IREE_TASK_TOPOLOGY_GROUP_MASK_ALL,
+              iree_task_topology_group_sharing_mask(
+                  &topology, 1, (iree_task_topology_sharing_level_t)level));
+  }
+  iree_task_topology_deinitialize(&topology);
+}
+
+// Verifies that the NUMA queries are consistent with each other. Machines
+// without NUMA information (or non-Linux platforms) report 0 nodes.
+TEST(TopologyTest, NumaQueries) {
+  iree_host_size_t numa_node_count = iree_task_topology_query_numa_node_count();
+  iree_task_topology_node_id_t current_node_id =
+      iree_task_topology_query_current_numa_node();
+  iree_task_topology_node_id_t processor_node_id =
+      iree_task_topology_query_processor_numa_node(0);
+  if (numa_node_count == 0) {
+    EXPECT_EQ(IREE_TASK_TOPOLOGY_NODE_ID_ANY, processor_node_id);
+  } else {
+    if (current_node_id != IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+      EXPECT_LT(current_node_id, numa_node_count);
+    }
+    if (processor_node_id != IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+      EXPECT_LT(processor_node_id, numa_node_count);
+    }
+  }
+  EXPECT_LT(iree_task_topology_query_current_node(),
+            iree_task_topology_query_node_count());
+}
+
 // Verifies only that the |topology| is usable.
 // If we actually checked the contents here then we'd just be validating that
 // cpuinfo was working and the tests would become machine-dependent.
@@ -144,4 +213,25 @@ TEST(TopologyTest, FromPhysicalCores) {
   iree_task_topology_deinitialize(&topology);
 }
 
+TEST(TopologyTest, FromPhysicalCoresOnCurrentNode) {
+  static constexpr iree_host_size_t kMaxGroupCount = 4;
+  iree_task_topology_node_id_t node_id =
+      iree_task_topology_query_current_node();
+  iree_task_topology_t topology;
+  iree_task_topology_initialize(&topology);
+  iree_task_topology_initialize_from_physical_cores(node_id, kMaxGroupCount,
+                                                    &topology);
+  EnsureTopologyValid(kMaxGroupCount, &topology);
+  for (iree_host_size_t i = 0; i < iree_task_topology_group_count(&topology);
+       ++i) {
+    const iree_task_topology_group_t* group =
+        iree_task_topology_get_group(&topology, i);
+    // Groups without processor information (cpuinfo unavailable) have no node.
+    if (group->node_id != IREE_TASK_TOPOLOGY_NODE_ID_ANY) {
+      EXPECT_EQ(node_id, group->node_id);
+    }
+  }
+  iree_task_topology_deinitialize(&topology);
+}
+
 }  // namespace
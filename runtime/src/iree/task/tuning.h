@@ -94,6 +94,64 @@ extern "C" {
 // memory).
 #define IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION (8)
 
+// Spin window in nanoseconds used by workers under
+// IREE_TASK_EXECUTOR_IDLE_POLICY_LATENCY when no explicit worker_spin_ns is
+// specified. This should cover the typical gap between dependent dispatches so
+// that workers pick up the next dispatch without a futex sleep/wake round trip.
+#define IREE_TASK_WORKER_LATENCY_SPIN_NS (100 * 1000)
+
+// Minimum spin window in nanoseconds that adaptive spinning will shrink to
+// under IREE_TASK_EXECUTOR_IDLE_POLICY_POWER after repeated spins that found
+// no work. A small nonzero window lets the worker notice when work starts
+// arriving quickly again and grow its window back.
+#define IREE_TASK_WORKER_MIN_SPIN_NS (2 * 1000)
+
+// Maximum number of processor yield (pause) instructions issued between polls
+// while spinning. The pause count starts at 1 and doubles up to this value on
+// each unsuccessful poll to reduce contention on the polled cache lines and
+// pressure on an SMT sibling.
+#define IREE_TASK_WORKER_MAX_SPIN_PAUSE_COUNT (64)
+
+// Number of workgroups in each 2D block of the dispatch grid traversed by
+// shards. Tiles are handed out in row-major order within blocks of roughly
+// square shape and blocks are walked in row-major order across the grid such
+// that consecutive tiles (and thus the tiles within a reservation) share
+// operand rows and columns. Must be a power of two; 1 walks the grid in plain
+// row-major order.
+#define IREE_TASK_DISPATCH_TILE_BLOCK_SIZE (16)
+
+// Target duration of a single tile reservation in nanoseconds.
+// Shards measure how long their reservations take to execute and grow or shrink
+// the number of tiles they reserve at a time to approach this duration: cheap
+// tiles are reserved in larger runs to amortize the reservation and keep
+// neighboring workgroups on the same core while expensive tiles are reserved
+// in smaller runs to keep the tail of the dispatch balanced across workers.
+// Setting this to 0 disables adaptation and all reservations use the initial
+// size bounded by IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION.
+#define IREE_TASK_DISPATCH_TARGET_RESERVATION_DURATION_NS (50 * 1000)
+
+// Maximum number of tiles adaptive reservations may grow to.
+// The effective maximum for a dispatch is further bounded such that each shard
+// can expect to perform several reservations.
+#define IREE_TASK_DISPATCH_MAX_ADAPTIVE_TILES_PER_RESERVATION (64)
+
+// Selects the implementation of the worker-local iree_task_queue_t:
+//   0: an unbounded task list guarded by a futex (default). Cheap for the
+//      owning worker but every operation takes the lock, including thefts.
+//   1: a bounded lock-free Chase-Lev deque. The owner pushes and pops without
+//      contention and thieves only ever contend on a single atomic index.
+//      Tasks exceeding IREE_TASK_QUEUE_CAPACITY spill into an owner-only
+//      list that cannot be stolen from until it is moved back into the deque.
+// Use task/queue_benchmark built with each setting to compare the two.
+#if !defined(IREE_TASK_QUEUE_LOCK_FREE)
+#define IREE_TASK_QUEUE_LOCK_FREE 0
+#endif  // !IREE_TASK_QUEUE_LOCK_FREE
+
+// Number of tasks that can be stored in the lock-free task queue deque before
+// spilling into the overflow list. Must be a power of two. Each worker has one
+// queue and each slot is a pointer so this is on the order of a few KB/worker.
+#define IREE_TASK_QUEUE_CAPACITY (256)
+
 // Whether to enable per-tile colors for each tile tracing zone based on the
 // tile grid xyz. Not cheap and can be disabled to reduce tracing overhead.
 // TODO(#4017): make per-tile color tracing fast enough to always have on.
@@ -24,27 +24,31 @@ static int iree_task_worker_main(iree_task_worker_t* worker);
 iree_status_t iree_task_worker_initialize(
     iree_task_executor_t* executor, iree_host_size_t worker_index,
     const iree_task_topology_group_t* topology_group,
-    iree_host_size_t stack_size, iree_byte_span_t local_memory,
-    iree_prng_splitmix64_state_t* seed_prng, iree_task_worker_t* out_worker) {
+    const iree_task_affinity_set_t* sharing_masks, iree_host_size_t stack_size,
+    iree_byte_span_t local_memory, iree_prng_splitmix64_state_t* seed_prng,
+    iree_task_worker_t* out_worker) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   out_worker->executor = executor;
   out_worker->worker_index = executor->worker_base_index + worker_index;
   out_worker->worker_bit = iree_task_affinity_for_worker(worker_index);
   out_worker->ideal_thread_affinity = topology_group->ideal_thread_affinity;
-  out_worker->constructive_sharing_mask =
-      topology_group->constructive_sharing_mask;
+  memcpy(out_worker->sharing_masks, sharing_masks,
+         sizeof(out_worker->sharing_masks));
   out_worker->max_theft_attempts =
       executor->worker_count / IREE_TASK_EXECUTOR_MAX_THEFT_ATTEMPTS_DIVISOR;
   iree_prng_minilcg128_initialize(iree_prng_splitmix64_next(seed_prng),
                                   &out_worker->theft_prng);
   out_worker->local_memory = local_memory;
+  out_worker->spin_window_ns = executor->worker_spin_ns;
   out_worker->processor_id = 0;
   out_worker->processor_tag = 0;
 
   iree_notification_initialize(&out_worker->wake_notification);
   iree_notification_initialize(&out_worker->state_notification);
   iree_atomic_task_slist_initialize(&out_worker->mailbox_slist);
+  iree_atomic_store_int32(&out_worker->mailbox_post_count, 0,
+                          iree_memory_order_relaxed);
   iree_task_queue_initialize(&out_worker->local_task_queue);
 
   iree_task_worker_state_t initial_state = IREE_TASK_WORKER_STATE_RUNNING;
@@ -128,9 +132,8 @@ void iree_task_worker_deinitialize(iree_task_worker_t* worker) {
 
   // Release unfinished tasks by flushing the mailbox (which if we're here can't
   // get anything more posted to it) and then discarding everything we still
-  // have a reference to.
+  // have a reference to (the queue discards its tasks when deinitialized).
   iree_atomic_task_slist_discard(&worker->mailbox_slist);
-  iree_task_list_discard(&worker->local_task_queue.list);
 
   iree_notification_deinitialize(&worker->wake_notification);
   iree_notification_deinitialize(&worker->state_notification);
@@ -146,6 +149,8 @@ void iree_task_worker_post_tasks(iree_task_worker_t* worker,
   // is concatenated with its current order preserved (which should be LIFO).
   iree_atomic_task_slist_concat(&worker->mailbox_slist, list->head, list->tail);
   memset(list, 0, sizeof(*list));
+  iree_atomic_fetch_add_int32(&worker->mailbox_post_count, 1,
+                              iree_memory_order_release);
 }
 
 iree_task_t* iree_task_worker_try_steal_task(iree_task_worker_t* worker,
@@ -231,9 +236,8 @@ static bool iree_task_worker_pump_once(
   // the first task in the queue is popped off and returned.
   if (!task) {
     task = iree_task_executor_try_steal_task(
-        worker->executor, worker->constructive_sharing_mask,
-        worker->max_theft_attempts, &worker->theft_prng,
-        &worker->local_task_queue);
+        worker->executor, worker->sharing_masks, worker->max_theft_attempts,
+        &worker->theft_prng, &worker->local_task_queue);
   }
 #endif  // IREE_TASK_EXECUTOR_MAX_THEFT_ATTEMPTS_DIVISOR > 0
 
@@ -256,6 +260,70 @@ static void iree_task_worker_update_processor_id(iree_task_worker_t* worker) {
   iree_cpu_requery_processor_id(&worker->processor_tag, &worker->processor_id);
 }
 
+// Spins for up to the worker's current spin window waiting for tasks to be
+// posted to the worker since the mailbox post count was |base_post_count| or
+// for the worker to be asked to exit. Returns true if the caller should pump
+// again or false if nothing arrived and it should sleep.
+//
+// The caller must not be registered as a waiter on the wake_notification so
+// that posters don't need to issue a futex wake while we spin. This is only a
+// fast path: the caller still performs its regular prepare/pump/commit cycle
+// after spinning and will catch anything we miss here.
+//
+// The first half of the window is spent polling with exponentially backed-off
+// processor yields and the second half yielding the thread between polls so
+// that we give up the core if the system is oversubscribed.
+static bool iree_task_worker_spin_for_work(iree_task_worker_t* worker,
+                                           int32_t base_post_count) {
+  const iree_duration_t spin_ns = worker->spin_window_ns;
+  if (spin_ns <= 0) return false;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, spin_ns);
+
+  const iree_time_t start_ns = iree_time_now();
+  const iree_time_t yield_deadline_ns = start_ns + spin_ns / 2;
+  const iree_time_t spin_deadline_ns = start_ns + spin_ns;
+  uint32_t pause_count = 1;
+  bool found_work = false;
+  iree_time_t now_ns = start_ns;
+  do {
+    if (now_ns < yield_deadline_ns) {
+      for (uint32_t i = 0; i < pause_count; ++i) iree_processor_yield();
+      pause_count =
+          iree_min(pause_count * 2, IREE_TASK_WORKER_MAX_SPIN_PAUSE_COUNT);
+    } else {
+      iree_thread_yield();
+    }
+    if (iree_atomic_load_int32(&worker->mailbox_post_count,
+                               iree_memory_order_acquire) != base_post_count ||
+        iree_atomic_load_int32(&worker->state, iree_memory_order_acquire) ==
+            IREE_TASK_WORKER_STATE_EXITING) {
+      found_work = true;
+      break;
+    }
+    now_ns = iree_time_now();
+  } while (now_ns < spin_deadline_ns);
+
+  // Grow the window when spinning pays off. Under the power policy shrink it
+  // when it doesn't so that workers with infrequent work quickly converge on
+  // sleeping instead of burning cycles.
+  iree_task_executor_t* executor = worker->executor;
+  if (found_work) {
+    worker->spin_window_ns =
+        iree_min(worker->spin_window_ns * 2, executor->worker_spin_ns);
+  } else if (executor->worker_idle_policy ==
+             IREE_TASK_EXECUTOR_IDLE_POLICY_POWER) {
+    worker->spin_window_ns =
+        iree_max(worker->spin_window_ns / 2,
+                 iree_min((iree_duration_t)IREE_TASK_WORKER_MIN_SPIN_NS,
+                          executor->worker_spin_ns));
+  }
+
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, found_work);
+  IREE_TRACE_ZONE_END(z0);
+  return found_work;
+}
+
 // Alternates between pumping ready tasks in the worker queue and waiting
 // for more tasks to arrive. Only returns when the worker has been asked by
 // the executor to exit.
@@ -265,6 +333,10 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
   // be able to process it with the proper processor ID immediately.
   iree_task_worker_update_processor_id(worker);
 
+  // Whether the worker has spun since it last found work. We only spin once per
+  // idle period: if nothing arrives the next time we run out of work we sleep.
+  bool has_spun = false;
+
   // Pump the thread loop to process more tasks.
   while (true) {
     // If we fail to find any work to do we'll wait at the end of this loop.
@@ -274,6 +346,9 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
     // structures we use.
     iree_wait_token_t wait_token =
         iree_notification_prepare_wait(&worker->wake_notification);
+    // Anything posted after this point will be noticed by the spin below.
+    const int32_t base_post_count = iree_atomic_load_int32(
+        &worker->mailbox_post_count, iree_memory_order_acquire);
     // The masks are accessed with 'relaxed' order because they are just hints.
     iree_task_affinity_set_t old_idle_mask =
         iree_atomic_task_affinity_set_fetch_and(
@@ -303,6 +378,7 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
 
     while (iree_task_worker_pump_once(worker, &pending_submission)) {
       // All work done ^, which will return false when the worker should wait.
+      has_spun = false;
     }
 
     bool schedule_dirty = false;
@@ -342,16 +418,25 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
         !iree_task_queue_is_empty(&worker->local_task_queue)) {
       // Have more work to do; loop around to try another pump.
       iree_notification_cancel_wait(&worker->wake_notification);
+      has_spun = false;
+    } else if (!has_spun && worker->spin_window_ns > 0) {
+      // Spin in userspace for a bit in case more work is about to arrive (such
+      // as the next dispatch in a chain). We stop being a waiter while we do
+      // so that posters don't make a syscall to wake us. Either way we loop
+      // around and pump again before actually waiting.
+      iree_notification_cancel_wait(&worker->wake_notification);
+      has_spun = !iree_task_worker_spin_for_work(worker, base_post_count);
     } else {
-      // Spin/wait in the kernel. We don't care if the condition fails as we're
-      // just using it as a pulse.
+      // Wait in the kernel. We don't care if the condition fails as we're
+      // just using it as a pulse. Any spinning happened above.
       IREE_TRACE_ZONE_BEGIN_NAMED(z_wait,
                                   "iree_task_worker_main_pump_wake_wait");
       iree_notification_commit_wait(
           &worker->wake_notification, wait_token,
-          /*spin_ns=*/worker->executor->worker_spin_ns,
+          /*spin_ns=*/IREE_DURATION_ZERO,
           /*deadline_ns=*/IREE_TIME_INFINITE_FUTURE);
       IREE_TRACE_ZONE_END(z_wait);
+      has_spun = false;
 
       // Woke from a wait - query the processor ID in case we migrated during
       // the sleep.
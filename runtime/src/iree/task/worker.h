@@ -74,6 +74,12 @@ typedef struct iree_task_worker_t {
   //         notification.
   iree_notification_t wake_notification;
 
+  // Incremented each time tasks are posted to mailbox_slist. Spinning workers
+  // poll this to notice new work without registering as a waiter on
+  // wake_notification, which allows posters to skip the futex wake.
+  // LAYOUT: written by posters along with mailbox_slist and wake_notification.
+  iree_atomic_int32_t mailbox_post_count;
+
   // Notification signaled when the worker changes any state.
   iree_notification_t state_notification;
 
@@ -91,12 +97,13 @@ typedef struct iree_task_worker_t {
   // Ideal thread affinity for the worker thread.
   iree_thread_affinity_t ideal_thread_affinity;
 
-  // A bitmask of other group indices that share some level of the cache
-  // hierarchy. Workers of this group are more likely to constructively share
-  // some cache levels higher up with these other groups. For example, if the
-  // workers in a group all share an L2 cache then the groups indicated here may
-  // all share the same L3 cache.
-  iree_task_affinity_set_t constructive_sharing_mask;
+  // Bitmasks of other workers sharing each level of the memory hierarchy,
+  // indexed by iree_task_topology_sharing_level_t. Levels are cumulative and
+  // thieves try them in order so that victims that share closer caches (L2,
+  // then the L3/cluster, then the NUMA node) are preferred over the rest of
+  // the machine.
+  iree_task_affinity_set_t
+      sharing_masks[IREE_TASK_TOPOLOGY_SHARING_LEVEL_COUNT];
 
   // Maximum number of attempts to make when trying to steal tasks from other
   // workers. This could be 64 (try stealing from all workers) or just a handful
@@ -107,6 +114,11 @@ typedef struct iree_task_worker_t {
   // Only ever touched by the worker thread as it steals work.
   iree_prng_minilcg128_state_t theft_prng;
 
+  // Current duration the worker spins for new work before sleeping. Adapted
+  // between IREE_TASK_WORKER_MIN_SPIN_NS and the executor worker_spin_ns based
+  // on whether recent spins found work. Only touched by the worker thread.
+  iree_duration_t spin_window_ns;
+
   // Thread handle of the worker. If the thread has exited the handle will
   // remain valid so that the executor can query its state.
   iree_thread_t* thread;
@@ -159,8 +171,9 @@ static_assert(offsetof(iree_task_worker_t, local_task_queue) >=
 iree_status_t iree_task_worker_initialize(
     iree_task_executor_t* executor, iree_host_size_t worker_index,
     const iree_task_topology_group_t* topology_group,
-    iree_host_size_t stack_size, iree_byte_span_t local_memory,
-    iree_prng_splitmix64_state_t* seed_prng, iree_task_worker_t* out_worker);
+    const iree_task_affinity_set_t* sharing_masks, iree_host_size_t stack_size,
+    iree_byte_span_t local_memory, iree_prng_splitmix64_state_t* seed_prng,
+    iree_task_worker_t* out_worker);
 
 // Requests that the worker begin exiting (if it hasn't already).
 // If the worker is actively processing tasks it will wait until it has
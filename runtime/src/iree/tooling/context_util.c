@@ -41,9 +41,8 @@ static iree_status_t iree_tooling_load_bytecode_module(
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_TEXT(z0, path.data, path.size);
 
-  // Fetch the file contents into memory.
-  // We could map the memory here if we wanted to and were coming from a file
-  // on disk.
+  // Map the file contents into memory when coming from a file on disk so that
+  // rodata segments are only paged in when used and shared across processes.
   iree_file_contents_t* file_contents = NULL;
   if (iree_string_view_equal(path, IREE_SV("-"))) {
     IREE_RETURN_AND_END_ZONE_IF_ERROR(
@@ -52,7 +51,7 @@ static iree_status_t iree_tooling_load_bytecode_module(
     char path_str[2048] = {0};
     iree_string_view_to_cstring(path, path_str, sizeof(path_str));
     IREE_RETURN_AND_END_ZONE_IF_ERROR(
-        z0, iree_file_read_contents(path_str, host_allocator, &file_contents));
+        z0, iree_file_map_contents(path_str, host_allocator, &file_contents));
   }
 
   // Try to load the module as bytecode (all we have today that we can use).
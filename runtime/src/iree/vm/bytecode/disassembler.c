@@ -1588,6 +1588,46 @@ iree_status_t iree_vm_bytecode_disassemble_op(
       break;
     }
 
+#define DISASM_OP_CORE_COND_BRANCH_CMP(op_name, reg_type, op_mnemonic)       \
+  DISASM_OP(CORE, op_name) {                                               \
+    uint16_t lhs_reg = VM_ParseOperandReg##reg_type("lhs");                \
+    uint16_t rhs_reg = VM_ParseOperandReg##reg_type("rhs");                \
+    int32_t true_block_pc = VM_ParseBranchTarget("true_dest");             \
+    const iree_vm_register_remap_list_t* true_remap_list =                 \
+        VM_ParseBranchOperands("true_operands");                           \
+    int32_t false_block_pc = VM_ParseBranchTarget("false_dest");           \
+    const iree_vm_register_remap_list_t* false_remap_list =                \
+        VM_ParseBranchOperands("false_operands");                          \
+    IREE_RETURN_IF_ERROR(                                                  \
+        iree_string_builder_append_cstring(b, op_mnemonic " "));           \
+    EMIT_##reg_type##_REG_NAME(lhs_reg);                                   \
+    EMIT_OPTIONAL_VALUE_##reg_type(regs->i32[lhs_reg]);                    \
+    IREE_RETURN_IF_ERROR(iree_string_builder_append_cstring(b, ", "));     \
+    EMIT_##reg_type##_REG_NAME(rhs_reg);                                   \
+    EMIT_OPTIONAL_VALUE_##reg_type(regs->i32[rhs_reg]);                    \
+    IREE_RETURN_IF_ERROR(                                                  \
+        iree_string_builder_append_format(b, ", ^%08X(", true_block_pc));  \
+    EMIT_REMAP_LIST(true_remap_list);                                      \
+    IREE_RETURN_IF_ERROR(                                                  \
+        iree_string_builder_append_format(b, "), ^%08X(", false_block_pc)); \
+    EMIT_REMAP_LIST(false_remap_list);                                     \
+    IREE_RETURN_IF_ERROR(iree_string_builder_append_cstring(b, ")"));      \
+    break;                                                                 \
+  }
+
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchEQI32, I32, "vm.cond_br.eq.i32");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchNEI32, I32, "vm.cond_br.ne.i32");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32S, I32,
+                                   "vm.cond_br.lt.i32.s");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32U, I32,
+                                   "vm.cond_br.lt.i32.u");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchEQI64, I64, "vm.cond_br.eq.i64");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchNEI64, I64, "vm.cond_br.ne.i64");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64S, I64,
+                                   "vm.cond_br.lt.i64.s");
+    DISASM_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64U, I64,
+                                   "vm.cond_br.lt.i64.u");
+
     DISASM_OP(CORE, Call) {
       int32_t function_ordinal = VM_ParseFuncAttr("callee");
       const iree_vm_register_list_t* src_reg_list =
@@ -14,6 +14,7 @@
 #include "iree/vm/bytecode/disassembler.h"
 #include "iree/vm/bytecode/dispatch_util.h"
 #include "iree/vm/bytecode/module_impl.h"
+#include "iree/vm/bytecode/verifier.h"
 #include "iree/vm/ops.h"
 
 //===----------------------------------------------------------------------===//
@@ -30,9 +31,16 @@
 static void iree_vm_bytecode_dispatch_remap_branch_registers(
     int32_t* IREE_RESTRICT regs_i32, iree_vm_ref_t* IREE_RESTRICT regs_ref,
     const iree_vm_register_remap_list_t* IREE_RESTRICT remap_list) {
-  for (int i = 0; i < remap_list->size; ++i) {
-    // TODO(benvanik): change encoding to avoid this branching.
-    // Could write two arrays: one for prims and one for refs.
+  // The compiler emits all primitive pairs before any ref pairs so the leading
+  // run of primitives can be copied without handling refs. Lists that
+  // interleave the two are still handled by the general loop below.
+  int i = 0;
+  for (; i < remap_list->size; ++i) {
+    uint16_t src_reg = remap_list->pairs[i].src_reg;
+    if (src_reg & IREE_REF_REGISTER_TYPE_BIT) break;
+    regs_i32[remap_list->pairs[i].dst_reg] = regs_i32[src_reg];
+  }
+  for (; i < remap_list->size; ++i) {
     uint16_t src_reg = remap_list->pairs[i].src_reg;
     uint16_t dst_reg = remap_list->pairs[i].dst_reg;
     if (src_reg & IREE_REF_REGISTER_TYPE_BIT) {
@@ -105,6 +113,15 @@ static iree_status_t iree_vm_bytecode_function_enter(
   const iree_vm_FunctionDescriptor_t* target_descriptor =
       &module->function_descriptor_table[function.ordinal];
 
+#if IREE_VM_BYTECODE_VERIFICATION_ENABLE
+  // Verify the function on first entry if verification was deferred during
+  // module creation.
+  if (IREE_UNLIKELY(module->function_verified_flags)) {
+    IREE_RETURN_IF_ERROR(
+        iree_vm_bytecode_function_verify_once(module, function.ordinal));
+  }
+#endif  // IREE_VM_BYTECODE_VERIFICATION_ENABLE
+
   // We first compute the frame size of the callee and the masks we'll use to
   // bounds check register access. This lets us allocate the entire frame
   // (header, frame, and register storage) as a single pointer bump below.
@@ -534,21 +551,16 @@ static iree_status_t iree_vm_bytecode_verify_import(
   return iree_ok_status();
 }
 
-// Calls an imported function from another module.
+// Calls the non-variadic function described by |import|.
 // Marshals the |src_reg_list| registers into ABI storage and results into
 // |dst_reg_list|.
-static iree_status_t iree_vm_bytecode_call_import(
-    iree_vm_stack_t* stack, const iree_vm_bytecode_module_state_t* module_state,
-    uint32_t import_ordinal, const iree_vm_registers_t caller_registers,
+static iree_status_t iree_vm_bytecode_call_resolved_import(
+    iree_vm_stack_t* stack, const iree_vm_bytecode_import_t* import,
+    const iree_vm_registers_t caller_registers,
     const iree_vm_register_list_t* IREE_RESTRICT src_reg_list,
     const iree_vm_register_list_t* IREE_RESTRICT dst_reg_list,
     iree_vm_stack_frame_t* IREE_RESTRICT* out_caller_frame,
     iree_vm_registers_t* out_caller_registers) {
-  // Prepare |call| by looking up the import information.
-  const iree_vm_bytecode_import_t* import = NULL;
-  IREE_RETURN_IF_ERROR(iree_vm_bytecode_verify_import(stack, module_state,
-                                                      import_ordinal, &import));
-
   iree_vm_function_call_t call;
   memset(&call, 0, sizeof(call));
   call.function = import->function;
@@ -570,6 +582,25 @@ static iree_status_t iree_vm_bytecode_call_import(
                                             out_caller_registers);
 }
 
+// Calls an imported function from another module.
+// Marshals the |src_reg_list| registers into ABI storage and results into
+// |dst_reg_list|.
+static iree_status_t iree_vm_bytecode_call_import(
+    iree_vm_stack_t* stack, const iree_vm_bytecode_module_state_t* module_state,
+    uint32_t import_ordinal, const iree_vm_registers_t caller_registers,
+    const iree_vm_register_list_t* IREE_RESTRICT src_reg_list,
+    const iree_vm_register_list_t* IREE_RESTRICT dst_reg_list,
+    iree_vm_stack_frame_t* IREE_RESTRICT* out_caller_frame,
+    iree_vm_registers_t* out_caller_registers) {
+  // Prepare |call| by looking up the import information.
+  const iree_vm_bytecode_import_t* import = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_verify_import(stack, module_state,
+                                                      import_ordinal, &import));
+  return iree_vm_bytecode_call_resolved_import(
+      stack, import, caller_registers, src_reg_list, dst_reg_list,
+      out_caller_frame, out_caller_registers);
+}
+
 // Calls a variadic imported function from another module.
 // Marshals the |src_reg_list| registers into ABI storage and results into
 // |dst_reg_list|. |segment_size_list| contains the counts within each segment.
@@ -1628,6 +1659,48 @@ static iree_status_t iree_vm_bytecode_dispatch(
       }
     });
 
+    // Fused comparison and conditional branch superinstructions.
+    // Equivalent to a comparison producing the condition of a vm.cond_br but
+    // dispatched as a single instruction.
+#define DISPATCH_OP_CORE_COND_BRANCH_CMP(op_name, type, reg_type, op_func) \
+  DISPATCH_OP(CORE, op_name, {                                           \
+    type lhs = VM_DecOperandReg##reg_type("lhs");                        \
+    type rhs = VM_DecOperandReg##reg_type("rhs");                        \
+    int32_t true_block_pc = VM_DecBranchTarget("true_dest");             \
+    const iree_vm_register_remap_list_t* true_remap_list =               \
+        VM_DecBranchOperands("true_operands");                           \
+    int32_t false_block_pc = VM_DecBranchTarget("false_dest");           \
+    const iree_vm_register_remap_list_t* false_remap_list =              \
+        VM_DecBranchOperands("false_operands");                          \
+    const iree_vm_register_remap_list_t* remap_list = false_remap_list;  \
+    pc = false_block_pc + IREE_VM_BLOCK_MARKER_SIZE;                     \
+    if (op_func(lhs, rhs)) {                                             \
+      pc = true_block_pc + IREE_VM_BLOCK_MARKER_SIZE;                    \
+      remap_list = true_remap_list;                                      \
+    }                                                                    \
+    if (IREE_UNLIKELY(remap_list->size > 0)) {                           \
+      iree_vm_bytecode_dispatch_remap_branch_registers(regs_i32, regs_ref, \
+                                                       remap_list);      \
+    }                                                                    \
+  });
+
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchEQI32, int32_t, I32,
+                                     vm_cmp_eq_i32);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchNEI32, int32_t, I32,
+                                     vm_cmp_ne_i32);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32S, int32_t, I32,
+                                     vm_cmp_lt_i32s);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32U, int32_t, I32,
+                                     vm_cmp_lt_i32u);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchEQI64, int64_t, I64,
+                                     vm_cmp_eq_i64);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchNEI64, int64_t, I64,
+                                     vm_cmp_ne_i64);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64S, int64_t, I64,
+                                     vm_cmp_lt_i64s);
+    DISPATCH_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64U, int64_t, I64,
+                                     vm_cmp_lt_i64u);
+
     DISPATCH_OP(CORE, Call, {
       int32_t function_ordinal = VM_DecFuncAttr("callee");
       const iree_vm_register_list_t* src_reg_list =
@@ -1639,11 +1712,21 @@ static iree_status_t iree_vm_bytecode_dispatch(
       // NOTE: we assume validation has ensured these functions exist.
       // TODO(benvanik): something more clever than just a high bit?
       int is_import = (function_ordinal & 0x80000000u) != 0;
+      const iree_vm_bytecode_native_function_t* native_function =
+          is_import ? NULL
+                    : iree_vm_bytecode_module_lookup_native_function(
+                          module, (uint16_t)function_ordinal);
       if (is_import) {
         // Call import (and possible yield).
         IREE_RETURN_IF_ERROR(iree_vm_bytecode_call_import(
             stack, module_state, function_ordinal, regs, src_reg_list,
             dst_reg_list, &current_frame, &regs));
+      } else if (native_function) {
+        // Call the native implementation of the function as if it were an
+        // import from another module.
+        IREE_RETURN_IF_ERROR(iree_vm_bytecode_call_resolved_import(
+            stack, &native_function->call, regs, src_reg_list, dst_reg_list,
+            &current_frame, &regs));
       } else {
         // Switch execution to the target function and continue running in the
         // bytecode dispatcher.
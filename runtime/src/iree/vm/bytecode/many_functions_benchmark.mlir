@@ -0,0 +1,4101 @@
+// Module with thousands of small functions for measuring module creation and
+// verification costs that scale with the function count. Each function has
+// the same shape with a distinct constant so that none can be deduplicated.
+vm.module @many_functions_benchmark {
+  vm.export @func_0
+  vm.func @func_0(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1
+  vm.func @func_1(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2
+  vm.func @func_2(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 3 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_3
+  vm.func @func_3(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 4 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_4
+  vm.func @func_4(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 5 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_5
+  vm.func @func_5(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 6 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_6
+  vm.func @func_6(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 7 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_7
+  vm.func @func_7(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 8 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_8
+  vm.func @func_8(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 9 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_9
+  vm.func @func_9(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 10 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_10
+  vm.func @func_10(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 11 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_11
+  vm.func @func_11(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 12 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_12
+  vm.func @func_12(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 13 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_13
+  vm.func @func_13(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 14 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_14
+  vm.func @func_14(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 15 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_15
+  vm.func @func_15(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 16 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_16
+  vm.func @func_16(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 17 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_17
+  vm.func @func_17(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 18 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_18
+  vm.func @func_18(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 19 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_19
+  vm.func @func_19(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 20 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_20
+  vm.func @func_20(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 21 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_21
+  vm.func @func_21(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 22 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_22
+  vm.func @func_22(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 23 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_23
+  vm.func @func_23(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 24 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_24
+  vm.func @func_24(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 25 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_25
+  vm.func @func_25(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 26 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_26
+  vm.func @func_26(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 27 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_27
+  vm.func @func_27(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 28 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_28
+  vm.func @func_28(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 29 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_29
+  vm.func @func_29(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 30 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_30
+  vm.func @func_30(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 31 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_31
+  vm.func @func_31(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 32 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_32
+  vm.func @func_32(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 33 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_33
+  vm.func @func_33(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 34 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_34
+  vm.func @func_34(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 35 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_35
+  vm.func @func_35(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 36 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_36
+  vm.func @func_36(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 37 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_37
+  vm.func @func_37(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 38 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_38
+  vm.func @func_38(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 39 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_39
+  vm.func @func_39(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 40 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_40
+  vm.func @func_40(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 41 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_41
+  vm.func @func_41(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 42 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_42
+  vm.func @func_42(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 43 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_43
+  vm.func @func_43(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 44 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_44
+  vm.func @func_44(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 45 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_45
+  vm.func @func_45(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 46 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_46
+  vm.func @func_46(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 47 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_47
+  vm.func @func_47(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 48 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_48
+  vm.func @func_48(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 49 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_49
+  vm.func @func_49(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 50 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_50
+  vm.func @func_50(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 51 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_51
+  vm.func @func_51(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 52 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_52
+  vm.func @func_52(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 53 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_53
+  vm.func @func_53(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 54 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_54
+  vm.func @func_54(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 55 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_55
+  vm.func @func_55(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 56 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_56
+  vm.func @func_56(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 57 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_57
+  vm.func @func_57(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 58 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_58
+  vm.func @func_58(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 59 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_59
+  vm.func @func_59(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 60 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_60
+  vm.func @func_60(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 61 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_61
+  vm.func @func_61(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 62 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_62
+  vm.func @func_62(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 63 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_63
+  vm.func @func_63(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 64 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_64
+  vm.func @func_64(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 65 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_65
+  vm.func @func_65(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 66 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_66
+  vm.func @func_66(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 67 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_67
+  vm.func @func_67(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 68 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_68
+  vm.func @func_68(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 69 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_69
+  vm.func @func_69(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 70 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_70
+  vm.func @func_70(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 71 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_71
+  vm.func @func_71(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 72 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_72
+  vm.func @func_72(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 73 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_73
+  vm.func @func_73(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 74 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_74
+  vm.func @func_74(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 75 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_75
+  vm.func @func_75(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 76 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_76
+  vm.func @func_76(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 77 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_77
+  vm.func @func_77(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 78 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_78
+  vm.func @func_78(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 79 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_79
+  vm.func @func_79(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 80 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_80
+  vm.func @func_80(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 81 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_81
+  vm.func @func_81(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 82 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_82
+  vm.func @func_82(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 83 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_83
+  vm.func @func_83(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 84 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_84
+  vm.func @func_84(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 85 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_85
+  vm.func @func_85(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 86 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_86
+  vm.func @func_86(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 87 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_87
+  vm.func @func_87(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 88 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_88
+  vm.func @func_88(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 89 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_89
+  vm.func @func_89(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 90 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_90
+  vm.func @func_90(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 91 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_91
+  vm.func @func_91(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 92 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_92
+  vm.func @func_92(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 93 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_93
+  vm.func @func_93(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 94 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_94
+  vm.func @func_94(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 95 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_95
+  vm.func @func_95(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 96 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_96
+  vm.func @func_96(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 97 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_97
+  vm.func @func_97(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 98 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_98
+  vm.func @func_98(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 99 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_99
+  vm.func @func_99(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 100 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_100
+  vm.func @func_100(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 101 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_101
+  vm.func @func_101(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 102 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_102
+  vm.func @func_102(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 103 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_103
+  vm.func @func_103(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 104 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_104
+  vm.func @func_104(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 105 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_105
+  vm.func @func_105(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 106 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_106
+  vm.func @func_106(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 107 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_107
+  vm.func @func_107(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 108 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_108
+  vm.func @func_108(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 109 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_109
+  vm.func @func_109(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 110 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_110
+  vm.func @func_110(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 111 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_111
+  vm.func @func_111(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 112 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_112
+  vm.func @func_112(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 113 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_113
+  vm.func @func_113(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 114 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_114
+  vm.func @func_114(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 115 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_115
+  vm.func @func_115(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 116 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_116
+  vm.func @func_116(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 117 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_117
+  vm.func @func_117(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 118 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_118
+  vm.func @func_118(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 119 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_119
+  vm.func @func_119(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 120 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_120
+  vm.func @func_120(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 121 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_121
+  vm.func @func_121(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 122 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_122
+  vm.func @func_122(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 123 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_123
+  vm.func @func_123(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 124 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_124
+  vm.func @func_124(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 125 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_125
+  vm.func @func_125(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 126 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_126
+  vm.func @func_126(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 127 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_127
+  vm.func @func_127(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 128 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_128
+  vm.func @func_128(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 129 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_129
+  vm.func @func_129(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 130 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_130
+  vm.func @func_130(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 131 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_131
+  vm.func @func_131(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 132 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_132
+  vm.func @func_132(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 133 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_133
+  vm.func @func_133(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 134 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_134
+  vm.func @func_134(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 135 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_135
+  vm.func @func_135(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 136 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_136
+  vm.func @func_136(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 137 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_137
+  vm.func @func_137(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 138 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_138
+  vm.func @func_138(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 139 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_139
+  vm.func @func_139(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 140 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_140
+  vm.func @func_140(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 141 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_141
+  vm.func @func_141(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 142 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_142
+  vm.func @func_142(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 143 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_143
+  vm.func @func_143(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 144 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_144
+  vm.func @func_144(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 145 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_145
+  vm.func @func_145(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 146 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_146
+  vm.func @func_146(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 147 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_147
+  vm.func @func_147(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 148 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_148
+  vm.func @func_148(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 149 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_149
+  vm.func @func_149(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 150 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_150
+  vm.func @func_150(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 151 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_151
+  vm.func @func_151(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 152 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_152
+  vm.func @func_152(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 153 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_153
+  vm.func @func_153(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 154 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_154
+  vm.func @func_154(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 155 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_155
+  vm.func @func_155(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 156 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_156
+  vm.func @func_156(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 157 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_157
+  vm.func @func_157(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 158 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_158
+  vm.func @func_158(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 159 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_159
+  vm.func @func_159(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 160 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_160
+  vm.func @func_160(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 161 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_161
+  vm.func @func_161(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 162 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_162
+  vm.func @func_162(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 163 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_163
+  vm.func @func_163(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 164 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_164
+  vm.func @func_164(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 165 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_165
+  vm.func @func_165(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 166 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_166
+  vm.func @func_166(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 167 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_167
+  vm.func @func_167(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 168 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_168
+  vm.func @func_168(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 169 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_169
+  vm.func @func_169(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 170 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_170
+  vm.func @func_170(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 171 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_171
+  vm.func @func_171(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 172 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_172
+  vm.func @func_172(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 173 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_173
+  vm.func @func_173(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 174 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_174
+  vm.func @func_174(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 175 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_175
+  vm.func @func_175(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 176 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_176
+  vm.func @func_176(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 177 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_177
+  vm.func @func_177(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 178 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_178
+  vm.func @func_178(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 179 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_179
+  vm.func @func_179(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 180 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_180
+  vm.func @func_180(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 181 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_181
+  vm.func @func_181(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 182 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_182
+  vm.func @func_182(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 183 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_183
+  vm.func @func_183(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 184 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_184
+  vm.func @func_184(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 185 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_185
+  vm.func @func_185(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 186 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_186
+  vm.func @func_186(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 187 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_187
+  vm.func @func_187(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 188 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_188
+  vm.func @func_188(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 189 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_189
+  vm.func @func_189(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 190 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_190
+  vm.func @func_190(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 191 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_191
+  vm.func @func_191(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 192 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_192
+  vm.func @func_192(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 193 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_193
+  vm.func @func_193(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 194 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_194
+  vm.func @func_194(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 195 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_195
+  vm.func @func_195(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 196 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_196
+  vm.func @func_196(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 197 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_197
+  vm.func @func_197(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 198 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_198
+  vm.func @func_198(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 199 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_199
+  vm.func @func_199(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 200 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_200
+  vm.func @func_200(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 201 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_201
+  vm.func @func_201(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 202 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_202
+  vm.func @func_202(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 203 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_203
+  vm.func @func_203(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 204 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_204
+  vm.func @func_204(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 205 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_205
+  vm.func @func_205(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 206 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_206
+  vm.func @func_206(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 207 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_207
+  vm.func @func_207(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 208 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_208
+  vm.func @func_208(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 209 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_209
+  vm.func @func_209(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 210 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_210
+  vm.func @func_210(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 211 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_211
+  vm.func @func_211(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 212 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_212
+  vm.func @func_212(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 213 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_213
+  vm.func @func_213(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 214 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_214
+  vm.func @func_214(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 215 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_215
+  vm.func @func_215(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 216 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_216
+  vm.func @func_216(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 217 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_217
+  vm.func @func_217(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 218 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_218
+  vm.func @func_218(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 219 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_219
+  vm.func @func_219(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 220 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_220
+  vm.func @func_220(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 221 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_221
+  vm.func @func_221(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 222 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_222
+  vm.func @func_222(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 223 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_223
+  vm.func @func_223(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 224 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_224
+  vm.func @func_224(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 225 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_225
+  vm.func @func_225(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 226 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_226
+  vm.func @func_226(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 227 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_227
+  vm.func @func_227(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 228 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_228
+  vm.func @func_228(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 229 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_229
+  vm.func @func_229(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 230 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_230
+  vm.func @func_230(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 231 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_231
+  vm.func @func_231(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 232 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_232
+  vm.func @func_232(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 233 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_233
+  vm.func @func_233(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 234 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_234
+  vm.func @func_234(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 235 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_235
+  vm.func @func_235(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 236 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_236
+  vm.func @func_236(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 237 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_237
+  vm.func @func_237(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 238 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_238
+  vm.func @func_238(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 239 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_239
+  vm.func @func_239(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 240 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_240
+  vm.func @func_240(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 241 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_241
+  vm.func @func_241(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 242 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_242
+  vm.func @func_242(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 243 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_243
+  vm.func @func_243(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 244 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_244
+  vm.func @func_244(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 245 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_245
+  vm.func @func_245(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 246 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_246
+  vm.func @func_246(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 247 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_247
+  vm.func @func_247(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 248 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_248
+  vm.func @func_248(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 249 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_249
+  vm.func @func_249(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 250 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_250
+  vm.func @func_250(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 251 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_251
+  vm.func @func_251(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 252 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_252
+  vm.func @func_252(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 253 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_253
+  vm.func @func_253(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 254 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_254
+  vm.func @func_254(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 255 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_255
+  vm.func @func_255(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 256 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_256
+  vm.func @func_256(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 257 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_257
+  vm.func @func_257(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 258 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_258
+  vm.func @func_258(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 259 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_259
+  vm.func @func_259(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 260 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_260
+  vm.func @func_260(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 261 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_261
+  vm.func @func_261(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 262 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_262
+  vm.func @func_262(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 263 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_263
+  vm.func @func_263(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 264 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_264
+  vm.func @func_264(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 265 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_265
+  vm.func @func_265(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 266 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_266
+  vm.func @func_266(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 267 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_267
+  vm.func @func_267(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 268 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_268
+  vm.func @func_268(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 269 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_269
+  vm.func @func_269(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 270 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_270
+  vm.func @func_270(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 271 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_271
+  vm.func @func_271(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 272 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_272
+  vm.func @func_272(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 273 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_273
+  vm.func @func_273(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 274 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_274
+  vm.func @func_274(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 275 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_275
+  vm.func @func_275(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 276 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_276
+  vm.func @func_276(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 277 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_277
+  vm.func @func_277(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 278 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_278
+  vm.func @func_278(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 279 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_279
+  vm.func @func_279(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 280 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_280
+  vm.func @func_280(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 281 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_281
+  vm.func @func_281(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 282 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_282
+  vm.func @func_282(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 283 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_283
+  vm.func @func_283(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 284 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_284
+  vm.func @func_284(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 285 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_285
+  vm.func @func_285(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 286 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_286
+  vm.func @func_286(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 287 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_287
+  vm.func @func_287(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 288 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_288
+  vm.func @func_288(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 289 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_289
+  vm.func @func_289(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 290 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_290
+  vm.func @func_290(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 291 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_291
+  vm.func @func_291(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 292 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_292
+  vm.func @func_292(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 293 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_293
+  vm.func @func_293(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 294 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_294
+  vm.func @func_294(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 295 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_295
+  vm.func @func_295(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 296 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_296
+  vm.func @func_296(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 297 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_297
+  vm.func @func_297(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 298 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_298
+  vm.func @func_298(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 299 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_299
+  vm.func @func_299(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 300 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_300
+  vm.func @func_300(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 301 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_301
+  vm.func @func_301(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 302 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_302
+  vm.func @func_302(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 303 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_303
+  vm.func @func_303(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 304 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_304
+  vm.func @func_304(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 305 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_305
+  vm.func @func_305(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 306 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_306
+  vm.func @func_306(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 307 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_307
+  vm.func @func_307(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 308 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_308
+  vm.func @func_308(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 309 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_309
+  vm.func @func_309(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 310 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_310
+  vm.func @func_310(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 311 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_311
+  vm.func @func_311(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 312 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_312
+  vm.func @func_312(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 313 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_313
+  vm.func @func_313(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 314 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_314
+  vm.func @func_314(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 315 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_315
+  vm.func @func_315(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 316 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_316
+  vm.func @func_316(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 317 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_317
+  vm.func @func_317(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 318 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_318
+  vm.func @func_318(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 319 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_319
+  vm.func @func_319(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 320 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_320
+  vm.func @func_320(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 321 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_321
+  vm.func @func_321(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 322 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_322
+  vm.func @func_322(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 323 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_323
+  vm.func @func_323(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 324 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_324
+  vm.func @func_324(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 325 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_325
+  vm.func @func_325(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 326 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_326
+  vm.func @func_326(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 327 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_327
+  vm.func @func_327(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 328 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_328
+  vm.func @func_328(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 329 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_329
+  vm.func @func_329(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 330 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_330
+  vm.func @func_330(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 331 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_331
+  vm.func @func_331(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 332 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_332
+  vm.func @func_332(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 333 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_333
+  vm.func @func_333(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 334 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_334
+  vm.func @func_334(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 335 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_335
+  vm.func @func_335(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 336 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_336
+  vm.func @func_336(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 337 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_337
+  vm.func @func_337(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 338 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_338
+  vm.func @func_338(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 339 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_339
+  vm.func @func_339(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 340 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_340
+  vm.func @func_340(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 341 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_341
+  vm.func @func_341(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 342 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_342
+  vm.func @func_342(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 343 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_343
+  vm.func @func_343(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 344 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_344
+  vm.func @func_344(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 345 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_345
+  vm.func @func_345(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 346 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_346
+  vm.func @func_346(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 347 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_347
+  vm.func @func_347(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 348 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_348
+  vm.func @func_348(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 349 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_349
+  vm.func @func_349(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 350 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_350
+  vm.func @func_350(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 351 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_351
+  vm.func @func_351(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 352 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_352
+  vm.func @func_352(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 353 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_353
+  vm.func @func_353(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 354 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_354
+  vm.func @func_354(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 355 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_355
+  vm.func @func_355(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 356 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_356
+  vm.func @func_356(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 357 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_357
+  vm.func @func_357(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 358 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_358
+  vm.func @func_358(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 359 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_359
+  vm.func @func_359(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 360 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_360
+  vm.func @func_360(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 361 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_361
+  vm.func @func_361(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 362 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_362
+  vm.func @func_362(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 363 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_363
+  vm.func @func_363(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 364 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_364
+  vm.func @func_364(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 365 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_365
+  vm.func @func_365(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 366 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_366
+  vm.func @func_366(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 367 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_367
+  vm.func @func_367(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 368 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_368
+  vm.func @func_368(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 369 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_369
+  vm.func @func_369(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 370 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_370
+  vm.func @func_370(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 371 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_371
+  vm.func @func_371(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 372 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_372
+  vm.func @func_372(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 373 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_373
+  vm.func @func_373(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 374 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_374
+  vm.func @func_374(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 375 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_375
+  vm.func @func_375(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 376 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_376
+  vm.func @func_376(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 377 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_377
+  vm.func @func_377(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 378 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_378
+  vm.func @func_378(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 379 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_379
+  vm.func @func_379(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 380 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_380
+  vm.func @func_380(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 381 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_381
+  vm.func @func_381(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 382 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_382
+  vm.func @func_382(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 383 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_383
+  vm.func @func_383(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 384 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_384
+  vm.func @func_384(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 385 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_385
+  vm.func @func_385(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 386 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_386
+  vm.func @func_386(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 387 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_387
+  vm.func @func_387(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 388 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_388
+  vm.func @func_388(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 389 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_389
+  vm.func @func_389(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 390 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_390
+  vm.func @func_390(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 391 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_391
+  vm.func @func_391(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 392 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_392
+  vm.func @func_392(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 393 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_393
+  vm.func @func_393(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 394 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_394
+  vm.func @func_394(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 395 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_395
+  vm.func @func_395(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 396 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_396
+  vm.func @func_396(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 397 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_397
+  vm.func @func_397(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 398 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_398
+  vm.func @func_398(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 399 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_399
+  vm.func @func_399(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 400 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_400
+  vm.func @func_400(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 401 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_401
+  vm.func @func_401(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 402 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_402
+  vm.func @func_402(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 403 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_403
+  vm.func @func_403(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 404 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_404
+  vm.func @func_404(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 405 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_405
+  vm.func @func_405(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 406 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_406
+  vm.func @func_406(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 407 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_407
+  vm.func @func_407(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 408 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_408
+  vm.func @func_408(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 409 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_409
+  vm.func @func_409(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 410 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_410
+  vm.func @func_410(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 411 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_411
+  vm.func @func_411(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 412 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_412
+  vm.func @func_412(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 413 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_413
+  vm.func @func_413(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 414 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_414
+  vm.func @func_414(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 415 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_415
+  vm.func @func_415(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 416 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_416
+  vm.func @func_416(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 417 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_417
+  vm.func @func_417(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 418 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_418
+  vm.func @func_418(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 419 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_419
+  vm.func @func_419(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 420 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_420
+  vm.func @func_420(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 421 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_421
+  vm.func @func_421(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 422 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_422
+  vm.func @func_422(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 423 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_423
+  vm.func @func_423(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 424 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_424
+  vm.func @func_424(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 425 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_425
+  vm.func @func_425(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 426 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_426
+  vm.func @func_426(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 427 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_427
+  vm.func @func_427(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 428 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_428
+  vm.func @func_428(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 429 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_429
+  vm.func @func_429(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 430 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_430
+  vm.func @func_430(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 431 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_431
+  vm.func @func_431(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 432 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_432
+  vm.func @func_432(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 433 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_433
+  vm.func @func_433(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 434 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_434
+  vm.func @func_434(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 435 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_435
+  vm.func @func_435(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 436 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_436
+  vm.func @func_436(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 437 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_437
+  vm.func @func_437(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 438 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_438
+  vm.func @func_438(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 439 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_439
+  vm.func @func_439(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 440 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_440
+  vm.func @func_440(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 441 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_441
+  vm.func @func_441(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 442 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_442
+  vm.func @func_442(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 443 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_443
+  vm.func @func_443(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 444 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_444
+  vm.func @func_444(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 445 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_445
+  vm.func @func_445(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 446 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_446
+  vm.func @func_446(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 447 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_447
+  vm.func @func_447(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 448 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_448
+  vm.func @func_448(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 449 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_449
+  vm.func @func_449(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 450 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_450
+  vm.func @func_450(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 451 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_451
+  vm.func @func_451(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 452 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_452
+  vm.func @func_452(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 453 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_453
+  vm.func @func_453(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 454 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_454
+  vm.func @func_454(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 455 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_455
+  vm.func @func_455(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 456 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_456
+  vm.func @func_456(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 457 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_457
+  vm.func @func_457(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 458 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_458
+  vm.func @func_458(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 459 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_459
+  vm.func @func_459(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 460 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_460
+  vm.func @func_460(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 461 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_461
+  vm.func @func_461(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 462 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_462
+  vm.func @func_462(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 463 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_463
+  vm.func @func_463(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 464 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_464
+  vm.func @func_464(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 465 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_465
+  vm.func @func_465(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 466 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_466
+  vm.func @func_466(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 467 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_467
+  vm.func @func_467(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 468 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_468
+  vm.func @func_468(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 469 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_469
+  vm.func @func_469(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 470 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_470
+  vm.func @func_470(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 471 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_471
+  vm.func @func_471(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 472 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_472
+  vm.func @func_472(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 473 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_473
+  vm.func @func_473(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 474 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_474
+  vm.func @func_474(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 475 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_475
+  vm.func @func_475(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 476 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_476
+  vm.func @func_476(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 477 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_477
+  vm.func @func_477(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 478 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_478
+  vm.func @func_478(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 479 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_479
+  vm.func @func_479(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 480 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_480
+  vm.func @func_480(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 481 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_481
+  vm.func @func_481(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 482 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_482
+  vm.func @func_482(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 483 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_483
+  vm.func @func_483(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 484 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_484
+  vm.func @func_484(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 485 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_485
+  vm.func @func_485(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 486 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_486
+  vm.func @func_486(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 487 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_487
+  vm.func @func_487(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 488 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_488
+  vm.func @func_488(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 489 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_489
+  vm.func @func_489(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 490 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_490
+  vm.func @func_490(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 491 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_491
+  vm.func @func_491(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 492 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_492
+  vm.func @func_492(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 493 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_493
+  vm.func @func_493(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 494 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_494
+  vm.func @func_494(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 495 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_495
+  vm.func @func_495(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 496 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_496
+  vm.func @func_496(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 497 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_497
+  vm.func @func_497(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 498 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_498
+  vm.func @func_498(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 499 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_499
+  vm.func @func_499(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 500 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_500
+  vm.func @func_500(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 501 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_501
+  vm.func @func_501(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 502 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_502
+  vm.func @func_502(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 503 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_503
+  vm.func @func_503(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 504 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_504
+  vm.func @func_504(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 505 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_505
+  vm.func @func_505(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 506 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_506
+  vm.func @func_506(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 507 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_507
+  vm.func @func_507(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 508 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_508
+  vm.func @func_508(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 509 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_509
+  vm.func @func_509(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 510 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_510
+  vm.func @func_510(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 511 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_511
+  vm.func @func_511(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 512 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_512
+  vm.func @func_512(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 513 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_513
+  vm.func @func_513(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 514 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_514
+  vm.func @func_514(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 515 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_515
+  vm.func @func_515(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 516 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_516
+  vm.func @func_516(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 517 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_517
+  vm.func @func_517(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 518 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_518
+  vm.func @func_518(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 519 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_519
+  vm.func @func_519(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 520 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_520
+  vm.func @func_520(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 521 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_521
+  vm.func @func_521(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 522 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_522
+  vm.func @func_522(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 523 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_523
+  vm.func @func_523(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 524 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_524
+  vm.func @func_524(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 525 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_525
+  vm.func @func_525(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 526 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_526
+  vm.func @func_526(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 527 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_527
+  vm.func @func_527(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 528 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_528
+  vm.func @func_528(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 529 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_529
+  vm.func @func_529(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 530 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_530
+  vm.func @func_530(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 531 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_531
+  vm.func @func_531(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 532 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_532
+  vm.func @func_532(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 533 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_533
+  vm.func @func_533(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 534 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_534
+  vm.func @func_534(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 535 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_535
+  vm.func @func_535(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 536 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_536
+  vm.func @func_536(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 537 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_537
+  vm.func @func_537(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 538 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_538
+  vm.func @func_538(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 539 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_539
+  vm.func @func_539(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 540 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_540
+  vm.func @func_540(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 541 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_541
+  vm.func @func_541(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 542 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_542
+  vm.func @func_542(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 543 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_543
+  vm.func @func_543(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 544 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_544
+  vm.func @func_544(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 545 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_545
+  vm.func @func_545(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 546 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_546
+  vm.func @func_546(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 547 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_547
+  vm.func @func_547(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 548 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_548
+  vm.func @func_548(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 549 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_549
+  vm.func @func_549(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 550 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_550
+  vm.func @func_550(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 551 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_551
+  vm.func @func_551(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 552 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_552
+  vm.func @func_552(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 553 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_553
+  vm.func @func_553(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 554 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_554
+  vm.func @func_554(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 555 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_555
+  vm.func @func_555(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 556 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_556
+  vm.func @func_556(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 557 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_557
+  vm.func @func_557(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 558 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_558
+  vm.func @func_558(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 559 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_559
+  vm.func @func_559(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 560 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_560
+  vm.func @func_560(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 561 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_561
+  vm.func @func_561(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 562 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_562
+  vm.func @func_562(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 563 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_563
+  vm.func @func_563(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 564 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_564
+  vm.func @func_564(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 565 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_565
+  vm.func @func_565(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 566 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_566
+  vm.func @func_566(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 567 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_567
+  vm.func @func_567(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 568 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_568
+  vm.func @func_568(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 569 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_569
+  vm.func @func_569(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 570 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_570
+  vm.func @func_570(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 571 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_571
+  vm.func @func_571(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 572 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_572
+  vm.func @func_572(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 573 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_573
+  vm.func @func_573(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 574 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_574
+  vm.func @func_574(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 575 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_575
+  vm.func @func_575(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 576 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_576
+  vm.func @func_576(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 577 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_577
+  vm.func @func_577(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 578 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_578
+  vm.func @func_578(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 579 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_579
+  vm.func @func_579(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 580 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_580
+  vm.func @func_580(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 581 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_581
+  vm.func @func_581(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 582 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_582
+  vm.func @func_582(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 583 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_583
+  vm.func @func_583(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 584 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_584
+  vm.func @func_584(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 585 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_585
+  vm.func @func_585(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 586 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_586
+  vm.func @func_586(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 587 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_587
+  vm.func @func_587(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 588 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_588
+  vm.func @func_588(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 589 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_589
+  vm.func @func_589(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 590 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_590
+  vm.func @func_590(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 591 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_591
+  vm.func @func_591(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 592 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_592
+  vm.func @func_592(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 593 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_593
+  vm.func @func_593(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 594 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_594
+  vm.func @func_594(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 595 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_595
+  vm.func @func_595(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 596 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_596
+  vm.func @func_596(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 597 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_597
+  vm.func @func_597(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 598 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_598
+  vm.func @func_598(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 599 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_599
+  vm.func @func_599(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 600 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_600
+  vm.func @func_600(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 601 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_601
+  vm.func @func_601(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 602 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_602
+  vm.func @func_602(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 603 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_603
+  vm.func @func_603(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 604 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_604
+  vm.func @func_604(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 605 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_605
+  vm.func @func_605(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 606 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_606
+  vm.func @func_606(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 607 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_607
+  vm.func @func_607(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 608 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_608
+  vm.func @func_608(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 609 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_609
+  vm.func @func_609(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 610 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_610
+  vm.func @func_610(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 611 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_611
+  vm.func @func_611(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 612 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_612
+  vm.func @func_612(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 613 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_613
+  vm.func @func_613(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 614 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_614
+  vm.func @func_614(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 615 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_615
+  vm.func @func_615(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 616 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_616
+  vm.func @func_616(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 617 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_617
+  vm.func @func_617(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 618 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_618
+  vm.func @func_618(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 619 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_619
+  vm.func @func_619(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 620 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_620
+  vm.func @func_620(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 621 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_621
+  vm.func @func_621(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 622 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_622
+  vm.func @func_622(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 623 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_623
+  vm.func @func_623(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 624 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_624
+  vm.func @func_624(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 625 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_625
+  vm.func @func_625(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 626 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_626
+  vm.func @func_626(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 627 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_627
+  vm.func @func_627(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 628 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_628
+  vm.func @func_628(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 629 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_629
+  vm.func @func_629(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 630 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_630
+  vm.func @func_630(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 631 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_631
+  vm.func @func_631(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 632 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_632
+  vm.func @func_632(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 633 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_633
+  vm.func @func_633(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 634 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_634
+  vm.func @func_634(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 635 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_635
+  vm.func @func_635(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 636 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_636
+  vm.func @func_636(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 637 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_637
+  vm.func @func_637(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 638 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_638
+  vm.func @func_638(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 639 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_639
+  vm.func @func_639(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 640 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_640
+  vm.func @func_640(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 641 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_641
+  vm.func @func_641(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 642 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_642
+  vm.func @func_642(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 643 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_643
+  vm.func @func_643(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 644 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_644
+  vm.func @func_644(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 645 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_645
+  vm.func @func_645(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 646 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_646
+  vm.func @func_646(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 647 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_647
+  vm.func @func_647(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 648 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_648
+  vm.func @func_648(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 649 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_649
+  vm.func @func_649(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 650 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_650
+  vm.func @func_650(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 651 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_651
+  vm.func @func_651(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 652 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_652
+  vm.func @func_652(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 653 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_653
+  vm.func @func_653(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 654 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_654
+  vm.func @func_654(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 655 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_655
+  vm.func @func_655(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 656 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_656
+  vm.func @func_656(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 657 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_657
+  vm.func @func_657(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 658 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_658
+  vm.func @func_658(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 659 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_659
+  vm.func @func_659(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 660 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_660
+  vm.func @func_660(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 661 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_661
+  vm.func @func_661(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 662 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_662
+  vm.func @func_662(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 663 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_663
+  vm.func @func_663(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 664 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_664
+  vm.func @func_664(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 665 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_665
+  vm.func @func_665(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 666 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_666
+  vm.func @func_666(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 667 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_667
+  vm.func @func_667(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 668 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_668
+  vm.func @func_668(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 669 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_669
+  vm.func @func_669(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 670 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_670
+  vm.func @func_670(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 671 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_671
+  vm.func @func_671(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 672 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_672
+  vm.func @func_672(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 673 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_673
+  vm.func @func_673(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 674 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_674
+  vm.func @func_674(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 675 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_675
+  vm.func @func_675(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 676 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_676
+  vm.func @func_676(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 677 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_677
+  vm.func @func_677(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 678 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_678
+  vm.func @func_678(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 679 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_679
+  vm.func @func_679(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 680 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_680
+  vm.func @func_680(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 681 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_681
+  vm.func @func_681(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 682 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_682
+  vm.func @func_682(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 683 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_683
+  vm.func @func_683(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 684 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_684
+  vm.func @func_684(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 685 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_685
+  vm.func @func_685(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 686 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_686
+  vm.func @func_686(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 687 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_687
+  vm.func @func_687(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 688 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_688
+  vm.func @func_688(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 689 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_689
+  vm.func @func_689(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 690 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_690
+  vm.func @func_690(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 691 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_691
+  vm.func @func_691(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 692 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_692
+  vm.func @func_692(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 693 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_693
+  vm.func @func_693(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 694 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_694
+  vm.func @func_694(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 695 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_695
+  vm.func @func_695(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 696 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_696
+  vm.func @func_696(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 697 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_697
+  vm.func @func_697(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 698 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_698
+  vm.func @func_698(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 699 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_699
+  vm.func @func_699(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 700 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_700
+  vm.func @func_700(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 701 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_701
+  vm.func @func_701(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 702 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_702
+  vm.func @func_702(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 703 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_703
+  vm.func @func_703(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 704 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_704
+  vm.func @func_704(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 705 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_705
+  vm.func @func_705(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 706 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_706
+  vm.func @func_706(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 707 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_707
+  vm.func @func_707(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 708 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_708
+  vm.func @func_708(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 709 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_709
+  vm.func @func_709(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 710 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_710
+  vm.func @func_710(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 711 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_711
+  vm.func @func_711(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 712 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_712
+  vm.func @func_712(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 713 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_713
+  vm.func @func_713(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 714 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_714
+  vm.func @func_714(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 715 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_715
+  vm.func @func_715(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 716 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_716
+  vm.func @func_716(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 717 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_717
+  vm.func @func_717(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 718 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_718
+  vm.func @func_718(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 719 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_719
+  vm.func @func_719(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 720 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_720
+  vm.func @func_720(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 721 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_721
+  vm.func @func_721(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 722 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_722
+  vm.func @func_722(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 723 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_723
+  vm.func @func_723(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 724 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_724
+  vm.func @func_724(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 725 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_725
+  vm.func @func_725(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 726 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_726
+  vm.func @func_726(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 727 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_727
+  vm.func @func_727(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 728 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_728
+  vm.func @func_728(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 729 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_729
+  vm.func @func_729(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 730 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_730
+  vm.func @func_730(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 731 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_731
+  vm.func @func_731(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 732 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_732
+  vm.func @func_732(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 733 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_733
+  vm.func @func_733(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 734 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_734
+  vm.func @func_734(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 735 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_735
+  vm.func @func_735(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 736 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_736
+  vm.func @func_736(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 737 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_737
+  vm.func @func_737(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 738 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_738
+  vm.func @func_738(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 739 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_739
+  vm.func @func_739(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 740 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_740
+  vm.func @func_740(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 741 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_741
+  vm.func @func_741(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 742 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_742
+  vm.func @func_742(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 743 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_743
+  vm.func @func_743(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 744 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_744
+  vm.func @func_744(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 745 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_745
+  vm.func @func_745(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 746 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_746
+  vm.func @func_746(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 747 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_747
+  vm.func @func_747(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 748 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_748
+  vm.func @func_748(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 749 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_749
+  vm.func @func_749(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 750 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_750
+  vm.func @func_750(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 751 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_751
+  vm.func @func_751(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 752 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_752
+  vm.func @func_752(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 753 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_753
+  vm.func @func_753(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 754 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_754
+  vm.func @func_754(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 755 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_755
+  vm.func @func_755(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 756 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_756
+  vm.func @func_756(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 757 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_757
+  vm.func @func_757(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 758 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_758
+  vm.func @func_758(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 759 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_759
+  vm.func @func_759(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 760 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_760
+  vm.func @func_760(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 761 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_761
+  vm.func @func_761(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 762 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_762
+  vm.func @func_762(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 763 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_763
+  vm.func @func_763(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 764 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_764
+  vm.func @func_764(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 765 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_765
+  vm.func @func_765(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 766 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_766
+  vm.func @func_766(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 767 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_767
+  vm.func @func_767(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 768 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_768
+  vm.func @func_768(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 769 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_769
+  vm.func @func_769(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 770 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_770
+  vm.func @func_770(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 771 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_771
+  vm.func @func_771(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 772 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_772
+  vm.func @func_772(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 773 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_773
+  vm.func @func_773(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 774 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_774
+  vm.func @func_774(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 775 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_775
+  vm.func @func_775(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 776 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_776
+  vm.func @func_776(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 777 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_777
+  vm.func @func_777(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 778 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_778
+  vm.func @func_778(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 779 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_779
+  vm.func @func_779(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 780 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_780
+  vm.func @func_780(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 781 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_781
+  vm.func @func_781(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 782 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_782
+  vm.func @func_782(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 783 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_783
+  vm.func @func_783(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 784 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_784
+  vm.func @func_784(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 785 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_785
+  vm.func @func_785(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 786 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_786
+  vm.func @func_786(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 787 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_787
+  vm.func @func_787(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 788 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_788
+  vm.func @func_788(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 789 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_789
+  vm.func @func_789(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 790 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_790
+  vm.func @func_790(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 791 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_791
+  vm.func @func_791(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 792 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_792
+  vm.func @func_792(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 793 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_793
+  vm.func @func_793(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 794 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_794
+  vm.func @func_794(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 795 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_795
+  vm.func @func_795(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 796 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_796
+  vm.func @func_796(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 797 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_797
+  vm.func @func_797(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 798 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_798
+  vm.func @func_798(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 799 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_799
+  vm.func @func_799(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 800 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_800
+  vm.func @func_800(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 801 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_801
+  vm.func @func_801(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 802 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_802
+  vm.func @func_802(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 803 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_803
+  vm.func @func_803(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 804 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_804
+  vm.func @func_804(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 805 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_805
+  vm.func @func_805(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 806 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_806
+  vm.func @func_806(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 807 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_807
+  vm.func @func_807(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 808 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_808
+  vm.func @func_808(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 809 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_809
+  vm.func @func_809(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 810 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_810
+  vm.func @func_810(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 811 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_811
+  vm.func @func_811(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 812 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_812
+  vm.func @func_812(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 813 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_813
+  vm.func @func_813(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 814 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_814
+  vm.func @func_814(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 815 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_815
+  vm.func @func_815(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 816 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_816
+  vm.func @func_816(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 817 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_817
+  vm.func @func_817(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 818 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_818
+  vm.func @func_818(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 819 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_819
+  vm.func @func_819(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 820 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_820
+  vm.func @func_820(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 821 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_821
+  vm.func @func_821(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 822 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_822
+  vm.func @func_822(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 823 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_823
+  vm.func @func_823(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 824 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_824
+  vm.func @func_824(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 825 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_825
+  vm.func @func_825(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 826 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_826
+  vm.func @func_826(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 827 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_827
+  vm.func @func_827(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 828 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_828
+  vm.func @func_828(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 829 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_829
+  vm.func @func_829(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 830 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_830
+  vm.func @func_830(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 831 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_831
+  vm.func @func_831(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 832 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_832
+  vm.func @func_832(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 833 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_833
+  vm.func @func_833(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 834 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_834
+  vm.func @func_834(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 835 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_835
+  vm.func @func_835(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 836 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_836
+  vm.func @func_836(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 837 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_837
+  vm.func @func_837(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 838 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_838
+  vm.func @func_838(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 839 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_839
+  vm.func @func_839(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 840 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_840
+  vm.func @func_840(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 841 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_841
+  vm.func @func_841(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 842 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_842
+  vm.func @func_842(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 843 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_843
+  vm.func @func_843(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 844 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_844
+  vm.func @func_844(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 845 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_845
+  vm.func @func_845(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 846 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_846
+  vm.func @func_846(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 847 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_847
+  vm.func @func_847(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 848 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_848
+  vm.func @func_848(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 849 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_849
+  vm.func @func_849(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 850 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_850
+  vm.func @func_850(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 851 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_851
+  vm.func @func_851(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 852 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_852
+  vm.func @func_852(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 853 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_853
+  vm.func @func_853(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 854 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_854
+  vm.func @func_854(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 855 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_855
+  vm.func @func_855(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 856 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_856
+  vm.func @func_856(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 857 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_857
+  vm.func @func_857(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 858 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_858
+  vm.func @func_858(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 859 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_859
+  vm.func @func_859(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 860 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_860
+  vm.func @func_860(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 861 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_861
+  vm.func @func_861(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 862 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_862
+  vm.func @func_862(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 863 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_863
+  vm.func @func_863(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 864 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_864
+  vm.func @func_864(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 865 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_865
+  vm.func @func_865(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 866 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_866
+  vm.func @func_866(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 867 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_867
+  vm.func @func_867(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 868 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_868
+  vm.func @func_868(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 869 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_869
+  vm.func @func_869(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 870 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_870
+  vm.func @func_870(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 871 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_871
+  vm.func @func_871(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 872 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_872
+  vm.func @func_872(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 873 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_873
+  vm.func @func_873(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 874 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_874
+  vm.func @func_874(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 875 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_875
+  vm.func @func_875(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 876 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_876
+  vm.func @func_876(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 877 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_877
+  vm.func @func_877(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 878 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_878
+  vm.func @func_878(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 879 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_879
+  vm.func @func_879(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 880 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_880
+  vm.func @func_880(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 881 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_881
+  vm.func @func_881(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 882 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_882
+  vm.func @func_882(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 883 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_883
+  vm.func @func_883(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 884 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_884
+  vm.func @func_884(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 885 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_885
+  vm.func @func_885(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 886 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_886
+  vm.func @func_886(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 887 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_887
+  vm.func @func_887(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 888 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_888
+  vm.func @func_888(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 889 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_889
+  vm.func @func_889(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 890 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_890
+  vm.func @func_890(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 891 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_891
+  vm.func @func_891(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 892 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_892
+  vm.func @func_892(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 893 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_893
+  vm.func @func_893(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 894 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_894
+  vm.func @func_894(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 895 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_895
+  vm.func @func_895(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 896 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_896
+  vm.func @func_896(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 897 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_897
+  vm.func @func_897(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 898 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_898
+  vm.func @func_898(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 899 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_899
+  vm.func @func_899(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 900 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_900
+  vm.func @func_900(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 901 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_901
+  vm.func @func_901(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 902 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_902
+  vm.func @func_902(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 903 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_903
+  vm.func @func_903(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 904 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_904
+  vm.func @func_904(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 905 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_905
+  vm.func @func_905(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 906 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_906
+  vm.func @func_906(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 907 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_907
+  vm.func @func_907(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 908 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_908
+  vm.func @func_908(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 909 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_909
+  vm.func @func_909(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 910 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_910
+  vm.func @func_910(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 911 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_911
+  vm.func @func_911(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 912 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_912
+  vm.func @func_912(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 913 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_913
+  vm.func @func_913(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 914 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_914
+  vm.func @func_914(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 915 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_915
+  vm.func @func_915(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 916 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_916
+  vm.func @func_916(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 917 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_917
+  vm.func @func_917(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 918 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_918
+  vm.func @func_918(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 919 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_919
+  vm.func @func_919(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 920 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_920
+  vm.func @func_920(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 921 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_921
+  vm.func @func_921(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 922 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_922
+  vm.func @func_922(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 923 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_923
+  vm.func @func_923(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 924 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_924
+  vm.func @func_924(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 925 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_925
+  vm.func @func_925(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 926 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_926
+  vm.func @func_926(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 927 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_927
+  vm.func @func_927(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 928 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_928
+  vm.func @func_928(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 929 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_929
+  vm.func @func_929(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 930 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_930
+  vm.func @func_930(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 931 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_931
+  vm.func @func_931(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 932 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_932
+  vm.func @func_932(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 933 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_933
+  vm.func @func_933(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 934 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_934
+  vm.func @func_934(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 935 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_935
+  vm.func @func_935(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 936 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_936
+  vm.func @func_936(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 937 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_937
+  vm.func @func_937(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 938 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_938
+  vm.func @func_938(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 939 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_939
+  vm.func @func_939(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 940 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_940
+  vm.func @func_940(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 941 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_941
+  vm.func @func_941(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 942 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_942
+  vm.func @func_942(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 943 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_943
+  vm.func @func_943(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 944 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_944
+  vm.func @func_944(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 945 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_945
+  vm.func @func_945(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 946 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_946
+  vm.func @func_946(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 947 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_947
+  vm.func @func_947(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 948 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_948
+  vm.func @func_948(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 949 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_949
+  vm.func @func_949(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 950 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_950
+  vm.func @func_950(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 951 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_951
+  vm.func @func_951(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 952 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_952
+  vm.func @func_952(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 953 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_953
+  vm.func @func_953(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 954 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_954
+  vm.func @func_954(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 955 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_955
+  vm.func @func_955(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 956 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_956
+  vm.func @func_956(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 957 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_957
+  vm.func @func_957(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 958 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_958
+  vm.func @func_958(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 959 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_959
+  vm.func @func_959(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 960 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_960
+  vm.func @func_960(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 961 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_961
+  vm.func @func_961(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 962 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_962
+  vm.func @func_962(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 963 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_963
+  vm.func @func_963(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 964 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_964
+  vm.func @func_964(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 965 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_965
+  vm.func @func_965(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 966 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_966
+  vm.func @func_966(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 967 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_967
+  vm.func @func_967(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 968 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_968
+  vm.func @func_968(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 969 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_969
+  vm.func @func_969(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 970 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_970
+  vm.func @func_970(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 971 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_971
+  vm.func @func_971(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 972 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_972
+  vm.func @func_972(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 973 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_973
+  vm.func @func_973(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 974 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_974
+  vm.func @func_974(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 975 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_975
+  vm.func @func_975(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 976 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_976
+  vm.func @func_976(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 977 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_977
+  vm.func @func_977(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 978 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_978
+  vm.func @func_978(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 979 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_979
+  vm.func @func_979(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 980 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_980
+  vm.func @func_980(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 981 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_981
+  vm.func @func_981(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 982 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_982
+  vm.func @func_982(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 983 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_983
+  vm.func @func_983(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 984 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_984
+  vm.func @func_984(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 985 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_985
+  vm.func @func_985(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 986 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_986
+  vm.func @func_986(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 987 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_987
+  vm.func @func_987(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 988 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_988
+  vm.func @func_988(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 989 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_989
+  vm.func @func_989(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 990 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_990
+  vm.func @func_990(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 991 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_991
+  vm.func @func_991(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 992 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_992
+  vm.func @func_992(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 993 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_993
+  vm.func @func_993(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 994 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_994
+  vm.func @func_994(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 995 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_995
+  vm.func @func_995(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 996 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_996
+  vm.func @func_996(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 997 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_997
+  vm.func @func_997(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 998 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_998
+  vm.func @func_998(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 999 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_999
+  vm.func @func_999(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1000 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1000
+  vm.func @func_1000(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1001 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1001
+  vm.func @func_1001(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1002 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1002
+  vm.func @func_1002(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1003 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1003
+  vm.func @func_1003(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1004 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1004
+  vm.func @func_1004(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1005 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1005
+  vm.func @func_1005(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1006 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1006
+  vm.func @func_1006(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1007 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1007
+  vm.func @func_1007(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1008 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1008
+  vm.func @func_1008(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1009 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1009
+  vm.func @func_1009(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1010 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1010
+  vm.func @func_1010(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1011 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1011
+  vm.func @func_1011(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1012 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1012
+  vm.func @func_1012(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1013 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1013
+  vm.func @func_1013(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1014 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1014
+  vm.func @func_1014(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1015 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1015
+  vm.func @func_1015(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1016 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1016
+  vm.func @func_1016(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1017 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1017
+  vm.func @func_1017(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1018 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1018
+  vm.func @func_1018(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1019 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1019
+  vm.func @func_1019(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1020 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1020
+  vm.func @func_1020(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1021 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1021
+  vm.func @func_1021(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1022 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1022
+  vm.func @func_1022(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1023 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1023
+  vm.func @func_1023(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1024 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1024
+  vm.func @func_1024(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1025 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1025
+  vm.func @func_1025(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1026 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1026
+  vm.func @func_1026(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1027 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1027
+  vm.func @func_1027(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1028 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1028
+  vm.func @func_1028(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1029 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1029
+  vm.func @func_1029(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1030 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1030
+  vm.func @func_1030(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1031 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1031
+  vm.func @func_1031(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1032 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1032
+  vm.func @func_1032(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1033 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1033
+  vm.func @func_1033(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1034 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1034
+  vm.func @func_1034(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1035 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1035
+  vm.func @func_1035(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1036 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1036
+  vm.func @func_1036(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1037 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1037
+  vm.func @func_1037(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1038 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1038
+  vm.func @func_1038(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1039 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1039
+  vm.func @func_1039(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1040 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1040
+  vm.func @func_1040(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1041 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1041
+  vm.func @func_1041(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1042 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1042
+  vm.func @func_1042(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1043 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1043
+  vm.func @func_1043(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1044 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1044
+  vm.func @func_1044(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1045 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1045
+  vm.func @func_1045(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1046 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1046
+  vm.func @func_1046(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1047 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1047
+  vm.func @func_1047(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1048 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1048
+  vm.func @func_1048(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1049 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1049
+  vm.func @func_1049(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1050 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1050
+  vm.func @func_1050(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1051 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1051
+  vm.func @func_1051(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1052 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1052
+  vm.func @func_1052(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1053 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1053
+  vm.func @func_1053(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1054 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1054
+  vm.func @func_1054(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1055 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1055
+  vm.func @func_1055(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1056 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1056
+  vm.func @func_1056(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1057 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1057
+  vm.func @func_1057(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1058 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1058
+  vm.func @func_1058(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1059 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1059
+  vm.func @func_1059(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1060 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1060
+  vm.func @func_1060(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1061 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1061
+  vm.func @func_1061(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1062 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1062
+  vm.func @func_1062(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1063 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1063
+  vm.func @func_1063(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1064 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1064
+  vm.func @func_1064(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1065 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1065
+  vm.func @func_1065(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1066 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1066
+  vm.func @func_1066(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1067 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1067
+  vm.func @func_1067(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1068 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1068
+  vm.func @func_1068(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1069 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1069
+  vm.func @func_1069(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1070 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1070
+  vm.func @func_1070(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1071 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1071
+  vm.func @func_1071(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1072 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1072
+  vm.func @func_1072(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1073 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1073
+  vm.func @func_1073(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1074 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1074
+  vm.func @func_1074(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1075 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1075
+  vm.func @func_1075(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1076 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1076
+  vm.func @func_1076(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1077 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1077
+  vm.func @func_1077(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1078 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1078
+  vm.func @func_1078(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1079 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1079
+  vm.func @func_1079(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1080 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1080
+  vm.func @func_1080(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1081 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1081
+  vm.func @func_1081(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1082 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1082
+  vm.func @func_1082(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1083 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1083
+  vm.func @func_1083(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1084 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1084
+  vm.func @func_1084(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1085 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1085
+  vm.func @func_1085(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1086 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1086
+  vm.func @func_1086(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1087 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1087
+  vm.func @func_1087(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1088 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1088
+  vm.func @func_1088(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1089 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1089
+  vm.func @func_1089(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1090 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1090
+  vm.func @func_1090(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1091 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1091
+  vm.func @func_1091(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1092 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1092
+  vm.func @func_1092(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1093 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1093
+  vm.func @func_1093(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1094 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1094
+  vm.func @func_1094(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1095 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1095
+  vm.func @func_1095(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1096 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1096
+  vm.func @func_1096(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1097 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1097
+  vm.func @func_1097(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1098 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1098
+  vm.func @func_1098(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1099 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1099
+  vm.func @func_1099(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1100 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1100
+  vm.func @func_1100(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1101 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1101
+  vm.func @func_1101(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1102 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1102
+  vm.func @func_1102(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1103 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1103
+  vm.func @func_1103(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1104 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1104
+  vm.func @func_1104(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1105 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1105
+  vm.func @func_1105(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1106 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1106
+  vm.func @func_1106(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1107 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1107
+  vm.func @func_1107(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1108 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1108
+  vm.func @func_1108(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1109 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1109
+  vm.func @func_1109(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1110 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1110
+  vm.func @func_1110(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1111 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1111
+  vm.func @func_1111(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1112 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1112
+  vm.func @func_1112(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1113 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1113
+  vm.func @func_1113(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1114 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1114
+  vm.func @func_1114(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1115 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1115
+  vm.func @func_1115(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1116 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1116
+  vm.func @func_1116(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1117 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1117
+  vm.func @func_1117(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1118 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1118
+  vm.func @func_1118(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1119 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1119
+  vm.func @func_1119(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1120 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1120
+  vm.func @func_1120(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1121 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1121
+  vm.func @func_1121(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1122 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1122
+  vm.func @func_1122(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1123 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1123
+  vm.func @func_1123(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1124 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1124
+  vm.func @func_1124(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1125 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1125
+  vm.func @func_1125(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1126 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1126
+  vm.func @func_1126(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1127 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1127
+  vm.func @func_1127(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1128 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1128
+  vm.func @func_1128(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1129 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1129
+  vm.func @func_1129(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1130 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1130
+  vm.func @func_1130(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1131 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1131
+  vm.func @func_1131(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1132 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1132
+  vm.func @func_1132(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1133 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1133
+  vm.func @func_1133(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1134 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1134
+  vm.func @func_1134(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1135 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1135
+  vm.func @func_1135(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1136 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1136
+  vm.func @func_1136(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1137 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1137
+  vm.func @func_1137(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1138 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1138
+  vm.func @func_1138(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1139 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1139
+  vm.func @func_1139(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1140 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1140
+  vm.func @func_1140(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1141 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1141
+  vm.func @func_1141(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1142 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1142
+  vm.func @func_1142(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1143 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1143
+  vm.func @func_1143(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1144 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1144
+  vm.func @func_1144(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1145 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1145
+  vm.func @func_1145(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1146 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1146
+  vm.func @func_1146(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1147 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1147
+  vm.func @func_1147(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1148 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1148
+  vm.func @func_1148(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1149 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1149
+  vm.func @func_1149(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1150 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1150
+  vm.func @func_1150(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1151 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1151
+  vm.func @func_1151(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1152 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1152
+  vm.func @func_1152(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1153 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1153
+  vm.func @func_1153(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1154 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1154
+  vm.func @func_1154(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1155 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1155
+  vm.func @func_1155(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1156 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1156
+  vm.func @func_1156(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1157 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1157
+  vm.func @func_1157(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1158 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1158
+  vm.func @func_1158(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1159 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1159
+  vm.func @func_1159(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1160 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1160
+  vm.func @func_1160(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1161 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1161
+  vm.func @func_1161(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1162 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1162
+  vm.func @func_1162(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1163 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1163
+  vm.func @func_1163(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1164 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1164
+  vm.func @func_1164(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1165 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1165
+  vm.func @func_1165(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1166 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1166
+  vm.func @func_1166(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1167 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1167
+  vm.func @func_1167(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1168 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1168
+  vm.func @func_1168(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1169 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1169
+  vm.func @func_1169(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1170 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1170
+  vm.func @func_1170(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1171 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1171
+  vm.func @func_1171(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1172 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1172
+  vm.func @func_1172(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1173 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1173
+  vm.func @func_1173(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1174 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1174
+  vm.func @func_1174(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1175 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1175
+  vm.func @func_1175(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1176 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1176
+  vm.func @func_1176(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1177 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1177
+  vm.func @func_1177(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1178 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1178
+  vm.func @func_1178(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1179 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1179
+  vm.func @func_1179(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1180 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1180
+  vm.func @func_1180(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1181 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1181
+  vm.func @func_1181(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1182 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1182
+  vm.func @func_1182(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1183 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1183
+  vm.func @func_1183(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1184 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1184
+  vm.func @func_1184(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1185 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1185
+  vm.func @func_1185(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1186 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1186
+  vm.func @func_1186(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1187 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1187
+  vm.func @func_1187(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1188 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1188
+  vm.func @func_1188(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1189 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1189
+  vm.func @func_1189(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1190 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1190
+  vm.func @func_1190(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1191 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1191
+  vm.func @func_1191(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1192 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1192
+  vm.func @func_1192(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1193 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1193
+  vm.func @func_1193(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1194 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1194
+  vm.func @func_1194(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1195 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1195
+  vm.func @func_1195(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1196 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1196
+  vm.func @func_1196(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1197 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1197
+  vm.func @func_1197(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1198 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1198
+  vm.func @func_1198(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1199 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1199
+  vm.func @func_1199(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1200 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1200
+  vm.func @func_1200(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1201 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1201
+  vm.func @func_1201(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1202 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1202
+  vm.func @func_1202(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1203 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1203
+  vm.func @func_1203(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1204 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1204
+  vm.func @func_1204(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1205 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1205
+  vm.func @func_1205(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1206 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1206
+  vm.func @func_1206(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1207 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1207
+  vm.func @func_1207(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1208 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1208
+  vm.func @func_1208(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1209 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1209
+  vm.func @func_1209(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1210 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1210
+  vm.func @func_1210(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1211 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1211
+  vm.func @func_1211(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1212 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1212
+  vm.func @func_1212(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1213 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1213
+  vm.func @func_1213(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1214 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1214
+  vm.func @func_1214(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1215 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1215
+  vm.func @func_1215(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1216 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1216
+  vm.func @func_1216(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1217 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1217
+  vm.func @func_1217(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1218 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1218
+  vm.func @func_1218(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1219 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1219
+  vm.func @func_1219(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1220 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1220
+  vm.func @func_1220(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1221 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1221
+  vm.func @func_1221(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1222 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1222
+  vm.func @func_1222(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1223 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1223
+  vm.func @func_1223(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1224 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1224
+  vm.func @func_1224(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1225 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1225
+  vm.func @func_1225(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1226 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1226
+  vm.func @func_1226(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1227 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1227
+  vm.func @func_1227(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1228 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1228
+  vm.func @func_1228(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1229 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1229
+  vm.func @func_1229(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1230 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1230
+  vm.func @func_1230(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1231 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1231
+  vm.func @func_1231(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1232 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1232
+  vm.func @func_1232(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1233 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1233
+  vm.func @func_1233(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1234 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1234
+  vm.func @func_1234(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1235 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1235
+  vm.func @func_1235(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1236 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1236
+  vm.func @func_1236(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1237 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1237
+  vm.func @func_1237(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1238 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1238
+  vm.func @func_1238(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1239 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1239
+  vm.func @func_1239(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1240 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1240
+  vm.func @func_1240(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1241 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1241
+  vm.func @func_1241(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1242 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1242
+  vm.func @func_1242(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1243 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1243
+  vm.func @func_1243(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1244 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1244
+  vm.func @func_1244(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1245 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1245
+  vm.func @func_1245(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1246 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1246
+  vm.func @func_1246(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1247 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1247
+  vm.func @func_1247(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1248 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1248
+  vm.func @func_1248(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1249 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1249
+  vm.func @func_1249(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1250 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1250
+  vm.func @func_1250(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1251 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1251
+  vm.func @func_1251(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1252 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1252
+  vm.func @func_1252(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1253 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1253
+  vm.func @func_1253(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1254 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1254
+  vm.func @func_1254(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1255 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1255
+  vm.func @func_1255(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1256 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1256
+  vm.func @func_1256(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1257 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1257
+  vm.func @func_1257(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1258 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1258
+  vm.func @func_1258(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1259 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1259
+  vm.func @func_1259(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1260 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1260
+  vm.func @func_1260(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1261 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1261
+  vm.func @func_1261(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1262 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1262
+  vm.func @func_1262(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1263 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1263
+  vm.func @func_1263(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1264 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1264
+  vm.func @func_1264(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1265 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1265
+  vm.func @func_1265(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1266 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1266
+  vm.func @func_1266(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1267 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1267
+  vm.func @func_1267(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1268 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1268
+  vm.func @func_1268(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1269 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1269
+  vm.func @func_1269(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1270 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1270
+  vm.func @func_1270(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1271 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1271
+  vm.func @func_1271(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1272 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1272
+  vm.func @func_1272(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1273 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1273
+  vm.func @func_1273(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1274 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1274
+  vm.func @func_1274(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1275 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1275
+  vm.func @func_1275(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1276 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1276
+  vm.func @func_1276(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1277 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1277
+  vm.func @func_1277(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1278 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1278
+  vm.func @func_1278(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1279 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1279
+  vm.func @func_1279(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1280 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1280
+  vm.func @func_1280(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1281 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1281
+  vm.func @func_1281(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1282 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1282
+  vm.func @func_1282(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1283 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1283
+  vm.func @func_1283(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1284 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1284
+  vm.func @func_1284(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1285 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1285
+  vm.func @func_1285(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1286 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1286
+  vm.func @func_1286(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1287 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1287
+  vm.func @func_1287(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1288 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1288
+  vm.func @func_1288(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1289 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1289
+  vm.func @func_1289(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1290 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1290
+  vm.func @func_1290(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1291 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1291
+  vm.func @func_1291(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1292 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1292
+  vm.func @func_1292(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1293 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1293
+  vm.func @func_1293(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1294 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1294
+  vm.func @func_1294(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1295 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1295
+  vm.func @func_1295(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1296 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1296
+  vm.func @func_1296(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1297 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1297
+  vm.func @func_1297(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1298 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1298
+  vm.func @func_1298(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1299 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1299
+  vm.func @func_1299(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1300 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1300
+  vm.func @func_1300(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1301 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1301
+  vm.func @func_1301(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1302 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1302
+  vm.func @func_1302(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1303 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1303
+  vm.func @func_1303(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1304 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1304
+  vm.func @func_1304(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1305 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1305
+  vm.func @func_1305(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1306 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1306
+  vm.func @func_1306(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1307 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1307
+  vm.func @func_1307(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1308 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1308
+  vm.func @func_1308(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1309 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1309
+  vm.func @func_1309(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1310 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1310
+  vm.func @func_1310(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1311 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1311
+  vm.func @func_1311(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1312 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1312
+  vm.func @func_1312(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1313 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1313
+  vm.func @func_1313(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1314 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1314
+  vm.func @func_1314(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1315 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1315
+  vm.func @func_1315(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1316 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1316
+  vm.func @func_1316(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1317 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1317
+  vm.func @func_1317(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1318 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1318
+  vm.func @func_1318(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1319 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1319
+  vm.func @func_1319(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1320 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1320
+  vm.func @func_1320(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1321 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1321
+  vm.func @func_1321(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1322 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1322
+  vm.func @func_1322(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1323 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1323
+  vm.func @func_1323(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1324 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1324
+  vm.func @func_1324(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1325 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1325
+  vm.func @func_1325(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1326 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1326
+  vm.func @func_1326(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1327 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1327
+  vm.func @func_1327(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1328 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1328
+  vm.func @func_1328(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1329 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1329
+  vm.func @func_1329(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1330 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1330
+  vm.func @func_1330(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1331 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1331
+  vm.func @func_1331(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1332 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1332
+  vm.func @func_1332(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1333 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1333
+  vm.func @func_1333(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1334 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1334
+  vm.func @func_1334(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1335 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1335
+  vm.func @func_1335(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1336 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1336
+  vm.func @func_1336(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1337 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1337
+  vm.func @func_1337(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1338 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1338
+  vm.func @func_1338(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1339 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1339
+  vm.func @func_1339(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1340 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1340
+  vm.func @func_1340(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1341 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1341
+  vm.func @func_1341(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1342 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1342
+  vm.func @func_1342(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1343 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1343
+  vm.func @func_1343(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1344 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1344
+  vm.func @func_1344(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1345 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1345
+  vm.func @func_1345(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1346 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1346
+  vm.func @func_1346(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1347 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1347
+  vm.func @func_1347(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1348 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1348
+  vm.func @func_1348(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1349 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1349
+  vm.func @func_1349(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1350 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1350
+  vm.func @func_1350(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1351 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1351
+  vm.func @func_1351(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1352 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1352
+  vm.func @func_1352(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1353 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1353
+  vm.func @func_1353(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1354 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1354
+  vm.func @func_1354(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1355 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1355
+  vm.func @func_1355(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1356 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1356
+  vm.func @func_1356(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1357 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1357
+  vm.func @func_1357(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1358 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1358
+  vm.func @func_1358(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1359 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1359
+  vm.func @func_1359(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1360 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1360
+  vm.func @func_1360(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1361 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1361
+  vm.func @func_1361(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1362 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1362
+  vm.func @func_1362(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1363 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1363
+  vm.func @func_1363(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1364 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1364
+  vm.func @func_1364(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1365 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1365
+  vm.func @func_1365(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1366 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1366
+  vm.func @func_1366(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1367 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1367
+  vm.func @func_1367(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1368 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1368
+  vm.func @func_1368(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1369 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1369
+  vm.func @func_1369(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1370 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1370
+  vm.func @func_1370(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1371 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1371
+  vm.func @func_1371(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1372 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1372
+  vm.func @func_1372(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1373 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1373
+  vm.func @func_1373(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1374 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1374
+  vm.func @func_1374(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1375 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1375
+  vm.func @func_1375(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1376 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1376
+  vm.func @func_1376(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1377 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1377
+  vm.func @func_1377(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1378 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1378
+  vm.func @func_1378(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1379 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1379
+  vm.func @func_1379(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1380 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1380
+  vm.func @func_1380(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1381 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1381
+  vm.func @func_1381(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1382 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1382
+  vm.func @func_1382(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1383 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1383
+  vm.func @func_1383(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1384 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1384
+  vm.func @func_1384(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1385 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1385
+  vm.func @func_1385(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1386 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1386
+  vm.func @func_1386(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1387 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1387
+  vm.func @func_1387(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1388 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1388
+  vm.func @func_1388(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1389 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1389
+  vm.func @func_1389(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1390 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1390
+  vm.func @func_1390(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1391 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1391
+  vm.func @func_1391(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1392 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1392
+  vm.func @func_1392(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1393 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1393
+  vm.func @func_1393(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1394 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1394
+  vm.func @func_1394(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1395 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1395
+  vm.func @func_1395(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1396 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1396
+  vm.func @func_1396(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1397 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1397
+  vm.func @func_1397(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1398 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1398
+  vm.func @func_1398(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1399 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1399
+  vm.func @func_1399(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1400 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1400
+  vm.func @func_1400(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1401 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1401
+  vm.func @func_1401(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1402 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1402
+  vm.func @func_1402(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1403 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1403
+  vm.func @func_1403(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1404 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1404
+  vm.func @func_1404(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1405 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1405
+  vm.func @func_1405(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1406 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1406
+  vm.func @func_1406(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1407 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1407
+  vm.func @func_1407(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1408 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1408
+  vm.func @func_1408(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1409 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1409
+  vm.func @func_1409(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1410 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1410
+  vm.func @func_1410(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1411 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1411
+  vm.func @func_1411(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1412 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1412
+  vm.func @func_1412(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1413 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1413
+  vm.func @func_1413(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1414 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1414
+  vm.func @func_1414(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1415 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1415
+  vm.func @func_1415(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1416 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1416
+  vm.func @func_1416(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1417 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1417
+  vm.func @func_1417(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1418 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1418
+  vm.func @func_1418(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1419 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1419
+  vm.func @func_1419(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1420 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1420
+  vm.func @func_1420(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1421 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1421
+  vm.func @func_1421(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1422 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1422
+  vm.func @func_1422(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1423 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1423
+  vm.func @func_1423(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1424 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1424
+  vm.func @func_1424(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1425 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1425
+  vm.func @func_1425(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1426 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1426
+  vm.func @func_1426(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1427 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1427
+  vm.func @func_1427(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1428 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1428
+  vm.func @func_1428(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1429 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1429
+  vm.func @func_1429(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1430 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1430
+  vm.func @func_1430(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1431 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1431
+  vm.func @func_1431(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1432 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1432
+  vm.func @func_1432(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1433 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1433
+  vm.func @func_1433(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1434 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1434
+  vm.func @func_1434(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1435 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1435
+  vm.func @func_1435(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1436 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1436
+  vm.func @func_1436(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1437 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1437
+  vm.func @func_1437(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1438 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1438
+  vm.func @func_1438(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1439 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1439
+  vm.func @func_1439(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1440 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1440
+  vm.func @func_1440(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1441 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1441
+  vm.func @func_1441(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1442 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1442
+  vm.func @func_1442(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1443 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1443
+  vm.func @func_1443(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1444 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1444
+  vm.func @func_1444(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1445 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1445
+  vm.func @func_1445(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1446 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1446
+  vm.func @func_1446(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1447 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1447
+  vm.func @func_1447(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1448 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1448
+  vm.func @func_1448(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1449 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1449
+  vm.func @func_1449(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1450 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1450
+  vm.func @func_1450(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1451 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1451
+  vm.func @func_1451(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1452 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1452
+  vm.func @func_1452(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1453 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1453
+  vm.func @func_1453(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1454 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1454
+  vm.func @func_1454(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1455 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1455
+  vm.func @func_1455(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1456 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1456
+  vm.func @func_1456(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1457 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1457
+  vm.func @func_1457(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1458 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1458
+  vm.func @func_1458(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1459 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1459
+  vm.func @func_1459(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1460 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1460
+  vm.func @func_1460(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1461 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1461
+  vm.func @func_1461(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1462 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1462
+  vm.func @func_1462(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1463 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1463
+  vm.func @func_1463(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1464 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1464
+  vm.func @func_1464(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1465 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1465
+  vm.func @func_1465(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1466 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1466
+  vm.func @func_1466(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1467 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1467
+  vm.func @func_1467(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1468 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1468
+  vm.func @func_1468(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1469 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1469
+  vm.func @func_1469(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1470 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1470
+  vm.func @func_1470(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1471 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1471
+  vm.func @func_1471(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1472 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1472
+  vm.func @func_1472(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1473 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1473
+  vm.func @func_1473(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1474 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1474
+  vm.func @func_1474(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1475 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1475
+  vm.func @func_1475(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1476 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1476
+  vm.func @func_1476(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1477 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1477
+  vm.func @func_1477(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1478 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1478
+  vm.func @func_1478(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1479 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1479
+  vm.func @func_1479(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1480 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1480
+  vm.func @func_1480(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1481 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1481
+  vm.func @func_1481(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1482 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1482
+  vm.func @func_1482(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1483 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1483
+  vm.func @func_1483(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1484 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1484
+  vm.func @func_1484(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1485 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1485
+  vm.func @func_1485(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1486 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1486
+  vm.func @func_1486(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1487 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1487
+  vm.func @func_1487(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1488 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1488
+  vm.func @func_1488(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1489 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1489
+  vm.func @func_1489(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1490 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1490
+  vm.func @func_1490(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1491 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1491
+  vm.func @func_1491(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1492 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1492
+  vm.func @func_1492(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1493 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1493
+  vm.func @func_1493(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1494 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1494
+  vm.func @func_1494(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1495 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1495
+  vm.func @func_1495(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1496 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1496
+  vm.func @func_1496(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1497 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1497
+  vm.func @func_1497(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1498 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1498
+  vm.func @func_1498(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1499 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1499
+  vm.func @func_1499(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1500 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1500
+  vm.func @func_1500(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1501 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1501
+  vm.func @func_1501(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1502 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1502
+  vm.func @func_1502(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1503 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1503
+  vm.func @func_1503(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1504 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1504
+  vm.func @func_1504(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1505 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1505
+  vm.func @func_1505(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1506 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1506
+  vm.func @func_1506(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1507 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1507
+  vm.func @func_1507(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1508 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1508
+  vm.func @func_1508(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1509 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1509
+  vm.func @func_1509(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1510 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1510
+  vm.func @func_1510(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1511 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1511
+  vm.func @func_1511(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1512 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1512
+  vm.func @func_1512(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1513 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1513
+  vm.func @func_1513(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1514 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1514
+  vm.func @func_1514(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1515 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1515
+  vm.func @func_1515(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1516 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1516
+  vm.func @func_1516(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1517 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1517
+  vm.func @func_1517(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1518 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1518
+  vm.func @func_1518(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1519 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1519
+  vm.func @func_1519(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1520 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1520
+  vm.func @func_1520(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1521 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1521
+  vm.func @func_1521(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1522 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1522
+  vm.func @func_1522(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1523 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1523
+  vm.func @func_1523(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1524 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1524
+  vm.func @func_1524(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1525 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1525
+  vm.func @func_1525(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1526 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1526
+  vm.func @func_1526(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1527 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1527
+  vm.func @func_1527(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1528 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1528
+  vm.func @func_1528(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1529 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1529
+  vm.func @func_1529(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1530 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1530
+  vm.func @func_1530(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1531 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1531
+  vm.func @func_1531(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1532 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1532
+  vm.func @func_1532(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1533 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1533
+  vm.func @func_1533(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1534 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1534
+  vm.func @func_1534(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1535 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1535
+  vm.func @func_1535(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1536 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1536
+  vm.func @func_1536(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1537 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1537
+  vm.func @func_1537(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1538 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1538
+  vm.func @func_1538(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1539 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1539
+  vm.func @func_1539(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1540 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1540
+  vm.func @func_1540(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1541 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1541
+  vm.func @func_1541(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1542 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1542
+  vm.func @func_1542(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1543 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1543
+  vm.func @func_1543(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1544 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1544
+  vm.func @func_1544(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1545 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1545
+  vm.func @func_1545(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1546 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1546
+  vm.func @func_1546(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1547 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1547
+  vm.func @func_1547(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1548 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1548
+  vm.func @func_1548(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1549 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1549
+  vm.func @func_1549(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1550 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1550
+  vm.func @func_1550(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1551 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1551
+  vm.func @func_1551(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1552 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1552
+  vm.func @func_1552(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1553 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1553
+  vm.func @func_1553(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1554 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1554
+  vm.func @func_1554(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1555 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1555
+  vm.func @func_1555(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1556 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1556
+  vm.func @func_1556(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1557 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1557
+  vm.func @func_1557(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1558 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1558
+  vm.func @func_1558(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1559 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1559
+  vm.func @func_1559(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1560 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1560
+  vm.func @func_1560(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1561 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1561
+  vm.func @func_1561(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1562 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1562
+  vm.func @func_1562(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1563 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1563
+  vm.func @func_1563(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1564 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1564
+  vm.func @func_1564(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1565 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1565
+  vm.func @func_1565(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1566 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1566
+  vm.func @func_1566(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1567 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1567
+  vm.func @func_1567(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1568 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1568
+  vm.func @func_1568(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1569 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1569
+  vm.func @func_1569(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1570 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1570
+  vm.func @func_1570(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1571 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1571
+  vm.func @func_1571(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1572 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1572
+  vm.func @func_1572(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1573 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1573
+  vm.func @func_1573(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1574 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1574
+  vm.func @func_1574(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1575 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1575
+  vm.func @func_1575(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1576 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1576
+  vm.func @func_1576(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1577 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1577
+  vm.func @func_1577(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1578 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1578
+  vm.func @func_1578(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1579 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1579
+  vm.func @func_1579(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1580 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1580
+  vm.func @func_1580(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1581 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1581
+  vm.func @func_1581(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1582 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1582
+  vm.func @func_1582(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1583 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1583
+  vm.func @func_1583(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1584 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1584
+  vm.func @func_1584(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1585 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1585
+  vm.func @func_1585(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1586 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1586
+  vm.func @func_1586(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1587 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1587
+  vm.func @func_1587(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1588 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1588
+  vm.func @func_1588(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1589 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1589
+  vm.func @func_1589(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1590 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1590
+  vm.func @func_1590(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1591 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1591
+  vm.func @func_1591(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1592 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1592
+  vm.func @func_1592(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1593 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1593
+  vm.func @func_1593(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1594 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1594
+  vm.func @func_1594(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1595 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1595
+  vm.func @func_1595(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1596 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1596
+  vm.func @func_1596(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1597 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1597
+  vm.func @func_1597(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1598 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1598
+  vm.func @func_1598(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1599 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1599
+  vm.func @func_1599(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1600 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1600
+  vm.func @func_1600(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1601 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1601
+  vm.func @func_1601(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1602 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1602
+  vm.func @func_1602(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1603 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1603
+  vm.func @func_1603(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1604 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1604
+  vm.func @func_1604(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1605 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1605
+  vm.func @func_1605(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1606 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1606
+  vm.func @func_1606(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1607 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1607
+  vm.func @func_1607(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1608 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1608
+  vm.func @func_1608(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1609 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1609
+  vm.func @func_1609(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1610 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1610
+  vm.func @func_1610(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1611 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1611
+  vm.func @func_1611(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1612 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1612
+  vm.func @func_1612(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1613 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1613
+  vm.func @func_1613(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1614 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1614
+  vm.func @func_1614(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1615 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1615
+  vm.func @func_1615(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1616 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1616
+  vm.func @func_1616(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1617 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1617
+  vm.func @func_1617(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1618 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1618
+  vm.func @func_1618(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1619 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1619
+  vm.func @func_1619(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1620 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1620
+  vm.func @func_1620(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1621 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1621
+  vm.func @func_1621(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1622 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1622
+  vm.func @func_1622(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1623 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1623
+  vm.func @func_1623(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1624 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1624
+  vm.func @func_1624(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1625 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1625
+  vm.func @func_1625(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1626 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1626
+  vm.func @func_1626(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1627 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1627
+  vm.func @func_1627(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1628 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1628
+  vm.func @func_1628(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1629 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1629
+  vm.func @func_1629(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1630 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1630
+  vm.func @func_1630(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1631 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1631
+  vm.func @func_1631(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1632 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1632
+  vm.func @func_1632(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1633 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1633
+  vm.func @func_1633(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1634 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1634
+  vm.func @func_1634(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1635 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1635
+  vm.func @func_1635(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1636 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1636
+  vm.func @func_1636(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1637 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1637
+  vm.func @func_1637(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1638 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1638
+  vm.func @func_1638(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1639 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1639
+  vm.func @func_1639(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1640 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1640
+  vm.func @func_1640(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1641 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1641
+  vm.func @func_1641(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1642 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1642
+  vm.func @func_1642(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1643 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1643
+  vm.func @func_1643(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1644 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1644
+  vm.func @func_1644(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1645 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1645
+  vm.func @func_1645(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1646 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1646
+  vm.func @func_1646(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1647 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1647
+  vm.func @func_1647(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1648 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1648
+  vm.func @func_1648(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1649 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1649
+  vm.func @func_1649(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1650 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1650
+  vm.func @func_1650(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1651 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1651
+  vm.func @func_1651(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1652 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1652
+  vm.func @func_1652(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1653 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1653
+  vm.func @func_1653(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1654 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1654
+  vm.func @func_1654(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1655 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1655
+  vm.func @func_1655(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1656 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1656
+  vm.func @func_1656(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1657 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1657
+  vm.func @func_1657(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1658 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1658
+  vm.func @func_1658(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1659 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1659
+  vm.func @func_1659(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1660 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1660
+  vm.func @func_1660(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1661 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1661
+  vm.func @func_1661(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1662 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1662
+  vm.func @func_1662(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1663 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1663
+  vm.func @func_1663(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1664 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1664
+  vm.func @func_1664(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1665 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1665
+  vm.func @func_1665(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1666 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1666
+  vm.func @func_1666(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1667 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1667
+  vm.func @func_1667(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1668 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1668
+  vm.func @func_1668(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1669 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1669
+  vm.func @func_1669(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1670 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1670
+  vm.func @func_1670(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1671 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1671
+  vm.func @func_1671(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1672 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1672
+  vm.func @func_1672(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1673 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1673
+  vm.func @func_1673(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1674 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1674
+  vm.func @func_1674(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1675 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1675
+  vm.func @func_1675(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1676 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1676
+  vm.func @func_1676(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1677 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1677
+  vm.func @func_1677(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1678 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1678
+  vm.func @func_1678(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1679 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1679
+  vm.func @func_1679(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1680 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1680
+  vm.func @func_1680(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1681 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1681
+  vm.func @func_1681(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1682 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1682
+  vm.func @func_1682(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1683 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1683
+  vm.func @func_1683(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1684 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1684
+  vm.func @func_1684(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1685 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1685
+  vm.func @func_1685(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1686 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1686
+  vm.func @func_1686(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1687 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1687
+  vm.func @func_1687(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1688 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1688
+  vm.func @func_1688(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1689 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1689
+  vm.func @func_1689(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1690 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1690
+  vm.func @func_1690(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1691 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1691
+  vm.func @func_1691(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1692 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1692
+  vm.func @func_1692(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1693 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1693
+  vm.func @func_1693(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1694 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1694
+  vm.func @func_1694(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1695 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1695
+  vm.func @func_1695(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1696 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1696
+  vm.func @func_1696(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1697 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1697
+  vm.func @func_1697(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1698 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1698
+  vm.func @func_1698(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1699 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1699
+  vm.func @func_1699(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1700 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1700
+  vm.func @func_1700(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1701 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1701
+  vm.func @func_1701(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1702 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1702
+  vm.func @func_1702(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1703 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1703
+  vm.func @func_1703(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1704 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1704
+  vm.func @func_1704(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1705 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1705
+  vm.func @func_1705(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1706 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1706
+  vm.func @func_1706(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1707 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1707
+  vm.func @func_1707(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1708 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1708
+  vm.func @func_1708(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1709 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1709
+  vm.func @func_1709(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1710 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1710
+  vm.func @func_1710(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1711 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1711
+  vm.func @func_1711(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1712 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1712
+  vm.func @func_1712(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1713 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1713
+  vm.func @func_1713(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1714 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1714
+  vm.func @func_1714(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1715 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1715
+  vm.func @func_1715(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1716 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1716
+  vm.func @func_1716(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1717 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1717
+  vm.func @func_1717(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1718 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1718
+  vm.func @func_1718(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1719 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1719
+  vm.func @func_1719(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1720 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1720
+  vm.func @func_1720(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1721 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1721
+  vm.func @func_1721(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1722 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1722
+  vm.func @func_1722(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1723 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1723
+  vm.func @func_1723(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1724 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1724
+  vm.func @func_1724(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1725 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1725
+  vm.func @func_1725(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1726 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1726
+  vm.func @func_1726(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1727 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1727
+  vm.func @func_1727(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1728 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1728
+  vm.func @func_1728(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1729 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1729
+  vm.func @func_1729(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1730 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1730
+  vm.func @func_1730(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1731 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1731
+  vm.func @func_1731(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1732 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1732
+  vm.func @func_1732(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1733 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1733
+  vm.func @func_1733(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1734 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1734
+  vm.func @func_1734(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1735 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1735
+  vm.func @func_1735(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1736 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1736
+  vm.func @func_1736(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1737 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1737
+  vm.func @func_1737(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1738 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1738
+  vm.func @func_1738(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1739 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1739
+  vm.func @func_1739(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1740 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1740
+  vm.func @func_1740(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1741 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1741
+  vm.func @func_1741(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1742 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1742
+  vm.func @func_1742(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1743 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1743
+  vm.func @func_1743(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1744 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1744
+  vm.func @func_1744(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1745 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1745
+  vm.func @func_1745(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1746 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1746
+  vm.func @func_1746(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1747 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1747
+  vm.func @func_1747(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1748 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1748
+  vm.func @func_1748(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1749 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1749
+  vm.func @func_1749(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1750 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1750
+  vm.func @func_1750(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1751 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1751
+  vm.func @func_1751(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1752 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1752
+  vm.func @func_1752(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1753 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1753
+  vm.func @func_1753(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1754 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1754
+  vm.func @func_1754(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1755 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1755
+  vm.func @func_1755(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1756 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1756
+  vm.func @func_1756(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1757 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1757
+  vm.func @func_1757(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1758 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1758
+  vm.func @func_1758(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1759 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1759
+  vm.func @func_1759(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1760 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1760
+  vm.func @func_1760(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1761 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1761
+  vm.func @func_1761(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1762 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1762
+  vm.func @func_1762(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1763 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1763
+  vm.func @func_1763(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1764 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1764
+  vm.func @func_1764(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1765 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1765
+  vm.func @func_1765(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1766 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1766
+  vm.func @func_1766(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1767 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1767
+  vm.func @func_1767(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1768 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1768
+  vm.func @func_1768(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1769 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1769
+  vm.func @func_1769(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1770 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1770
+  vm.func @func_1770(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1771 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1771
+  vm.func @func_1771(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1772 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1772
+  vm.func @func_1772(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1773 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1773
+  vm.func @func_1773(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1774 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1774
+  vm.func @func_1774(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1775 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1775
+  vm.func @func_1775(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1776 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1776
+  vm.func @func_1776(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1777 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1777
+  vm.func @func_1777(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1778 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1778
+  vm.func @func_1778(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1779 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1779
+  vm.func @func_1779(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1780 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1780
+  vm.func @func_1780(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1781 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1781
+  vm.func @func_1781(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1782 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1782
+  vm.func @func_1782(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1783 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1783
+  vm.func @func_1783(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1784 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1784
+  vm.func @func_1784(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1785 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1785
+  vm.func @func_1785(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1786 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1786
+  vm.func @func_1786(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1787 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1787
+  vm.func @func_1787(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1788 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1788
+  vm.func @func_1788(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1789 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1789
+  vm.func @func_1789(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1790 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1790
+  vm.func @func_1790(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1791 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1791
+  vm.func @func_1791(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1792 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1792
+  vm.func @func_1792(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1793 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1793
+  vm.func @func_1793(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1794 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1794
+  vm.func @func_1794(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1795 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1795
+  vm.func @func_1795(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1796 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1796
+  vm.func @func_1796(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1797 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1797
+  vm.func @func_1797(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1798 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1798
+  vm.func @func_1798(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1799 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1799
+  vm.func @func_1799(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1800 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1800
+  vm.func @func_1800(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1801 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1801
+  vm.func @func_1801(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1802 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1802
+  vm.func @func_1802(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1803 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1803
+  vm.func @func_1803(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1804 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1804
+  vm.func @func_1804(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1805 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1805
+  vm.func @func_1805(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1806 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1806
+  vm.func @func_1806(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1807 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1807
+  vm.func @func_1807(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1808 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1808
+  vm.func @func_1808(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1809 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1809
+  vm.func @func_1809(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1810 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1810
+  vm.func @func_1810(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1811 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1811
+  vm.func @func_1811(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1812 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1812
+  vm.func @func_1812(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1813 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1813
+  vm.func @func_1813(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1814 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1814
+  vm.func @func_1814(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1815 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1815
+  vm.func @func_1815(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1816 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1816
+  vm.func @func_1816(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1817 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1817
+  vm.func @func_1817(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1818 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1818
+  vm.func @func_1818(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1819 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1819
+  vm.func @func_1819(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1820 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1820
+  vm.func @func_1820(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1821 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1821
+  vm.func @func_1821(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1822 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1822
+  vm.func @func_1822(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1823 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1823
+  vm.func @func_1823(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1824 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1824
+  vm.func @func_1824(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1825 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1825
+  vm.func @func_1825(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1826 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1826
+  vm.func @func_1826(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1827 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1827
+  vm.func @func_1827(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1828 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1828
+  vm.func @func_1828(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1829 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1829
+  vm.func @func_1829(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1830 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1830
+  vm.func @func_1830(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1831 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1831
+  vm.func @func_1831(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1832 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1832
+  vm.func @func_1832(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1833 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1833
+  vm.func @func_1833(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1834 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1834
+  vm.func @func_1834(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1835 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1835
+  vm.func @func_1835(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1836 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1836
+  vm.func @func_1836(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1837 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1837
+  vm.func @func_1837(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1838 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1838
+  vm.func @func_1838(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1839 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1839
+  vm.func @func_1839(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1840 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1840
+  vm.func @func_1840(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1841 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1841
+  vm.func @func_1841(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1842 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1842
+  vm.func @func_1842(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1843 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1843
+  vm.func @func_1843(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1844 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1844
+  vm.func @func_1844(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1845 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1845
+  vm.func @func_1845(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1846 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1846
+  vm.func @func_1846(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1847 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1847
+  vm.func @func_1847(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1848 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1848
+  vm.func @func_1848(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1849 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1849
+  vm.func @func_1849(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1850 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1850
+  vm.func @func_1850(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1851 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1851
+  vm.func @func_1851(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1852 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1852
+  vm.func @func_1852(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1853 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1853
+  vm.func @func_1853(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1854 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1854
+  vm.func @func_1854(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1855 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1855
+  vm.func @func_1855(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1856 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1856
+  vm.func @func_1856(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1857 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1857
+  vm.func @func_1857(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1858 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1858
+  vm.func @func_1858(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1859 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1859
+  vm.func @func_1859(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1860 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1860
+  vm.func @func_1860(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1861 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1861
+  vm.func @func_1861(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1862 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1862
+  vm.func @func_1862(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1863 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1863
+  vm.func @func_1863(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1864 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1864
+  vm.func @func_1864(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1865 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1865
+  vm.func @func_1865(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1866 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1866
+  vm.func @func_1866(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1867 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1867
+  vm.func @func_1867(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1868 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1868
+  vm.func @func_1868(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1869 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1869
+  vm.func @func_1869(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1870 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1870
+  vm.func @func_1870(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1871 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1871
+  vm.func @func_1871(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1872 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1872
+  vm.func @func_1872(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1873 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1873
+  vm.func @func_1873(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1874 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1874
+  vm.func @func_1874(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1875 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1875
+  vm.func @func_1875(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1876 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1876
+  vm.func @func_1876(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1877 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1877
+  vm.func @func_1877(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1878 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1878
+  vm.func @func_1878(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1879 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1879
+  vm.func @func_1879(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1880 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1880
+  vm.func @func_1880(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1881 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1881
+  vm.func @func_1881(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1882 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1882
+  vm.func @func_1882(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1883 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1883
+  vm.func @func_1883(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1884 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1884
+  vm.func @func_1884(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1885 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1885
+  vm.func @func_1885(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1886 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1886
+  vm.func @func_1886(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1887 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1887
+  vm.func @func_1887(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1888 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1888
+  vm.func @func_1888(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1889 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1889
+  vm.func @func_1889(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1890 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1890
+  vm.func @func_1890(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1891 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1891
+  vm.func @func_1891(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1892 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1892
+  vm.func @func_1892(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1893 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1893
+  vm.func @func_1893(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1894 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1894
+  vm.func @func_1894(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1895 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1895
+  vm.func @func_1895(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1896 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1896
+  vm.func @func_1896(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1897 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1897
+  vm.func @func_1897(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1898 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1898
+  vm.func @func_1898(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1899 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1899
+  vm.func @func_1899(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1900 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1900
+  vm.func @func_1900(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1901 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1901
+  vm.func @func_1901(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1902 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1902
+  vm.func @func_1902(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1903 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1903
+  vm.func @func_1903(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1904 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1904
+  vm.func @func_1904(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1905 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1905
+  vm.func @func_1905(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1906 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1906
+  vm.func @func_1906(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1907 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1907
+  vm.func @func_1907(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1908 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1908
+  vm.func @func_1908(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1909 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1909
+  vm.func @func_1909(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1910 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1910
+  vm.func @func_1910(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1911 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1911
+  vm.func @func_1911(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1912 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1912
+  vm.func @func_1912(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1913 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1913
+  vm.func @func_1913(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1914 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1914
+  vm.func @func_1914(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1915 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1915
+  vm.func @func_1915(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1916 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1916
+  vm.func @func_1916(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1917 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1917
+  vm.func @func_1917(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1918 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1918
+  vm.func @func_1918(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1919 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1919
+  vm.func @func_1919(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1920 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1920
+  vm.func @func_1920(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1921 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1921
+  vm.func @func_1921(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1922 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1922
+  vm.func @func_1922(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1923 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1923
+  vm.func @func_1923(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1924 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1924
+  vm.func @func_1924(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1925 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1925
+  vm.func @func_1925(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1926 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1926
+  vm.func @func_1926(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1927 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1927
+  vm.func @func_1927(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1928 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1928
+  vm.func @func_1928(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1929 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1929
+  vm.func @func_1929(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1930 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1930
+  vm.func @func_1930(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1931 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1931
+  vm.func @func_1931(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1932 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1932
+  vm.func @func_1932(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1933 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1933
+  vm.func @func_1933(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1934 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1934
+  vm.func @func_1934(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1935 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1935
+  vm.func @func_1935(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1936 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1936
+  vm.func @func_1936(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1937 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1937
+  vm.func @func_1937(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1938 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1938
+  vm.func @func_1938(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1939 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1939
+  vm.func @func_1939(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1940 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1940
+  vm.func @func_1940(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1941 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1941
+  vm.func @func_1941(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1942 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1942
+  vm.func @func_1942(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1943 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1943
+  vm.func @func_1943(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1944 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1944
+  vm.func @func_1944(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1945 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1945
+  vm.func @func_1945(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1946 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1946
+  vm.func @func_1946(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1947 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1947
+  vm.func @func_1947(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1948 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1948
+  vm.func @func_1948(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1949 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1949
+  vm.func @func_1949(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1950 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1950
+  vm.func @func_1950(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1951 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1951
+  vm.func @func_1951(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1952 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1952
+  vm.func @func_1952(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1953 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1953
+  vm.func @func_1953(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1954 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1954
+  vm.func @func_1954(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1955 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1955
+  vm.func @func_1955(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1956 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1956
+  vm.func @func_1956(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1957 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1957
+  vm.func @func_1957(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1958 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1958
+  vm.func @func_1958(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1959 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1959
+  vm.func @func_1959(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1960 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1960
+  vm.func @func_1960(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1961 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1961
+  vm.func @func_1961(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1962 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1962
+  vm.func @func_1962(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1963 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1963
+  vm.func @func_1963(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1964 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1964
+  vm.func @func_1964(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1965 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1965
+  vm.func @func_1965(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1966 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1966
+  vm.func @func_1966(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1967 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1967
+  vm.func @func_1967(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1968 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1968
+  vm.func @func_1968(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1969 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1969
+  vm.func @func_1969(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1970 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1970
+  vm.func @func_1970(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1971 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1971
+  vm.func @func_1971(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1972 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1972
+  vm.func @func_1972(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1973 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1973
+  vm.func @func_1973(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1974 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1974
+  vm.func @func_1974(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1975 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1975
+  vm.func @func_1975(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1976 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1976
+  vm.func @func_1976(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1977 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1977
+  vm.func @func_1977(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1978 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1978
+  vm.func @func_1978(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1979 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1979
+  vm.func @func_1979(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1980 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1980
+  vm.func @func_1980(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1981 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1981
+  vm.func @func_1981(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1982 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1982
+  vm.func @func_1982(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1983 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1983
+  vm.func @func_1983(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1984 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1984
+  vm.func @func_1984(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1985 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1985
+  vm.func @func_1985(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1986 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1986
+  vm.func @func_1986(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1987 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1987
+  vm.func @func_1987(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1988 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1988
+  vm.func @func_1988(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1989 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1989
+  vm.func @func_1989(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1990 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1990
+  vm.func @func_1990(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1991 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1991
+  vm.func @func_1991(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1992 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1992
+  vm.func @func_1992(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1993 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1993
+  vm.func @func_1993(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1994 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1994
+  vm.func @func_1994(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1995 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1995
+  vm.func @func_1995(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1996 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1996
+  vm.func @func_1996(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1997 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1997
+  vm.func @func_1997(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1998 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1998
+  vm.func @func_1998(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 1999 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_1999
+  vm.func @func_1999(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2000 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2000
+  vm.func @func_2000(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2001 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2001
+  vm.func @func_2001(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2002 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2002
+  vm.func @func_2002(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2003 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2003
+  vm.func @func_2003(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2004 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2004
+  vm.func @func_2004(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2005 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2005
+  vm.func @func_2005(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2006 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2006
+  vm.func @func_2006(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2007 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2007
+  vm.func @func_2007(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2008 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2008
+  vm.func @func_2008(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2009 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2009
+  vm.func @func_2009(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2010 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2010
+  vm.func @func_2010(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2011 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2011
+  vm.func @func_2011(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2012 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2012
+  vm.func @func_2012(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2013 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2013
+  vm.func @func_2013(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2014 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2014
+  vm.func @func_2014(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2015 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2015
+  vm.func @func_2015(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2016 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2016
+  vm.func @func_2016(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2017 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2017
+  vm.func @func_2017(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2018 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2018
+  vm.func @func_2018(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2019 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2019
+  vm.func @func_2019(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2020 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2020
+  vm.func @func_2020(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2021 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2021
+  vm.func @func_2021(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2022 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2022
+  vm.func @func_2022(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2023 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2023
+  vm.func @func_2023(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2024 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2024
+  vm.func @func_2024(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2025 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2025
+  vm.func @func_2025(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2026 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2026
+  vm.func @func_2026(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2027 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2027
+  vm.func @func_2027(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2028 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2028
+  vm.func @func_2028(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2029 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2029
+  vm.func @func_2029(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2030 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2030
+  vm.func @func_2030(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2031 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2031
+  vm.func @func_2031(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2032 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2032
+  vm.func @func_2032(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2033 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2033
+  vm.func @func_2033(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2034 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2034
+  vm.func @func_2034(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2035 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2035
+  vm.func @func_2035(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2036 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2036
+  vm.func @func_2036(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2037 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2037
+  vm.func @func_2037(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2038 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2038
+  vm.func @func_2038(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2039 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2039
+  vm.func @func_2039(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2040 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2040
+  vm.func @func_2040(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2041 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2041
+  vm.func @func_2041(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2042 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2042
+  vm.func @func_2042(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2043 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2043
+  vm.func @func_2043(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2044 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2044
+  vm.func @func_2044(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2045 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2045
+  vm.func @func_2045(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2046 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2046
+  vm.func @func_2046(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2047 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+  vm.export @func_2047
+  vm.func @func_2047(%arg0 : i32, %arg1 : i32) -> i32 { %c = vm.const.i32 2048 %0 = vm.add.i32 %arg0, %c : i32 %1 = vm.mul.i32 %0, %arg1 : i32 %2 = vm.cmp.lt.i32.s %1, %arg0 : i32 vm.cond_br %2, ^bb1, ^bb2 ^bb1: vm.return %1 : i32 ^bb2: %3 = vm.sub.i32 %1, %arg1 : i32 vm.return %3 : i32 }
+}
@@ -152,6 +152,11 @@ static void iree_vm_bytecode_module_destroy(void* self) {
     iree_vm_buffer_deinitialize(ref);
   }
 
+  iree_allocator_free(module->native_library_allocator,
+                      (void*)module->native_library);
+  module->native_library = NULL;
+  module->native_library_allocator = iree_allocator_null();
+
   module->def = NULL;
   iree_allocator_free(module->archive_allocator,
                       (void*)module->archive_contents.data);
@@ -685,6 +690,213 @@ static void iree_vm_bytecode_module_free_state(
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Maximum depth of nested lists cloned when forking ref globals.
+#define IREE_VM_BYTECODE_FORK_MAX_LIST_DEPTH 8
+
+// Objects in the parent state that have been cloned for a forked state.
+// Objects referenced from multiple globals or list elements are cloned once so
+// that aliasing in the parent is preserved in the fork.
+typedef struct iree_vm_bytecode_fork_map_t {
+  iree_allocator_t allocator;
+  iree_host_size_t count;
+  iree_host_size_t capacity;
+  struct iree_vm_bytecode_fork_map_entry_t {
+    void* source_ptr;
+    iree_vm_ref_t clone;
+  }* entries;
+} iree_vm_bytecode_fork_map_t;
+
+static void iree_vm_bytecode_fork_map_initialize(
+    iree_allocator_t allocator, iree_vm_bytecode_fork_map_t* out_map) {
+  memset(out_map, 0, sizeof(*out_map));
+  out_map->allocator = allocator;
+}
+
+static void iree_vm_bytecode_fork_map_deinitialize(
+    iree_vm_bytecode_fork_map_t* map) {
+  for (iree_host_size_t i = 0; i < map->count; ++i) {
+    iree_vm_ref_release(&map->entries[i].clone);
+  }
+  iree_allocator_free(map->allocator, map->entries);
+  memset(map, 0, sizeof(*map));
+}
+
+// Returns the clone of |source_ptr| made for the fork or NULL if not cloned.
+static iree_vm_ref_t* iree_vm_bytecode_fork_map_lookup(
+    iree_vm_bytecode_fork_map_t* map, void* source_ptr) {
+  for (iree_host_size_t i = 0; i < map->count; ++i) {
+    if (map->entries[i].source_ptr == source_ptr) return &map->entries[i].clone;
+  }
+  return NULL;
+}
+
+// Records |clone| (retained) as the clone of |source_ptr| for the fork.
+static iree_status_t iree_vm_bytecode_fork_map_insert(
+    iree_vm_bytecode_fork_map_t* map, void* source_ptr, iree_vm_ref_t* clone) {
+  if (map->count == map->capacity) {
+    iree_host_size_t new_capacity = iree_max(8, map->capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        map->allocator, new_capacity * sizeof(*map->entries),
+        (void**)&map->entries));
+    map->capacity = new_capacity;
+  }
+  struct iree_vm_bytecode_fork_map_entry_t* entry = &map->entries[map->count++];
+  entry->source_ptr = source_ptr;
+  memset(&entry->clone, 0, sizeof(entry->clone));
+  iree_vm_ref_retain(clone, &entry->clone);
+  return iree_ok_status();
+}
+
+// Copies the ref global value |source| into |out_target| for a forked state.
+// Objects that programs cannot change in-place (rodata and other immutable
+// buffers) or that are not owned by the VM (executables, devices, etc) are
+// shared with the parent. Mutable buffers are cloned, lists are cloned
+// recursively, and objects whose type provides a clone function are cloned by
+// it such that in-place changes made by either context are not observed by the
+// other. Each object is cloned at most once per |map|.
+static iree_status_t iree_vm_bytecode_module_fork_ref(
+    iree_vm_bytecode_fork_map_t* map, iree_vm_ref_t* source,
+    iree_host_size_t depth, iree_allocator_t allocator,
+    iree_vm_ref_t* out_target) {
+  if (iree_vm_ref_is_null(source)) {
+    iree_vm_ref_retain(source, out_target);
+    return iree_ok_status();
+  }
+  iree_vm_ref_t* existing_clone =
+      iree_vm_bytecode_fork_map_lookup(map, source->ptr);
+  if (existing_clone) {
+    iree_vm_ref_retain(existing_clone, out_target);
+    return iree_ok_status();
+  }
+
+  iree_vm_ref_t clone_ref = {0};
+  if (iree_vm_buffer_isa(*source)) {
+    iree_vm_buffer_t* buffer = iree_vm_buffer_deref(*source);
+    if (!iree_all_bits_set(buffer->access, IREE_VM_BUFFER_ACCESS_MUTABLE)) {
+      iree_vm_ref_retain(source, out_target);
+      return iree_ok_status();
+    }
+    iree_vm_buffer_t* clone = NULL;
+    IREE_RETURN_IF_ERROR(iree_vm_buffer_clone(
+        buffer->access, buffer, 0, iree_vm_buffer_length(buffer),
+        /*alignment=*/0, allocator, &clone));
+    clone_ref = iree_vm_buffer_move_ref(clone);
+  } else if (iree_vm_list_isa(*source)) {
+    if (depth >= IREE_VM_BYTECODE_FORK_MAX_LIST_DEPTH) {
+      return iree_make_status(
+          IREE_STATUS_FAILED_PRECONDITION,
+          "lists nested more than %d deep cannot be forked",
+          IREE_VM_BYTECODE_FORK_MAX_LIST_DEPTH);
+    }
+    iree_vm_list_t* clone = NULL;
+    IREE_RETURN_IF_ERROR(
+        iree_vm_list_clone(iree_vm_list_deref(*source), allocator, &clone));
+    clone_ref = iree_vm_list_move_ref(clone);
+    // Recorded before cloning the elements so that elements referencing this
+    // list (or lists already being cloned) resolve to the clones.
+    iree_status_t status =
+        iree_vm_bytecode_fork_map_insert(map, source->ptr, &clone_ref);
+    for (iree_host_size_t i = 0;
+         i < iree_vm_list_size(clone) && iree_status_is_ok(status); ++i) {
+      iree_vm_variant_t element = iree_vm_variant_empty();
+      status = iree_vm_list_get_variant_assign(clone, i, &element);
+      if (!iree_status_is_ok(status) || !iree_vm_variant_is_ref(element) ||
+          iree_vm_ref_is_null(&element.ref)) {
+        continue;
+      }
+      iree_vm_ref_t element_clone = {0};
+      status = iree_vm_bytecode_module_fork_ref(map, &element.ref, depth + 1,
+                                                allocator, &element_clone);
+      if (iree_status_is_ok(status) && element_clone.ptr != element.ref.ptr) {
+        status = iree_vm_list_set_ref_move(clone, i, &element_clone);
+      }
+      iree_vm_ref_release(&element_clone);
+    }
+    if (iree_status_is_ok(status)) {
+      iree_vm_ref_move(&clone_ref, out_target);
+    } else {
+      iree_vm_ref_release(&clone_ref);
+    }
+    return status;
+  } else {
+    const iree_vm_ref_type_descriptor_t* descriptor =
+        iree_vm_ref_type_descriptor(source->type);
+    if (!descriptor->clone) {
+      iree_vm_ref_retain(source, out_target);
+      return iree_ok_status();
+    }
+    void* clone_ptr = NULL;
+    IREE_RETURN_IF_ERROR(descriptor->clone(source->ptr, allocator, &clone_ptr));
+    IREE_RETURN_IF_ERROR(
+        iree_vm_ref_wrap_assign(clone_ptr, source->type, &clone_ref));
+  }
+
+  iree_status_t status =
+      iree_vm_bytecode_fork_map_insert(map, source->ptr, &clone_ref);
+  if (iree_status_is_ok(status)) {
+    iree_vm_ref_move(&clone_ref, out_target);
+  } else {
+    iree_vm_ref_release(&clone_ref);
+  }
+  return status;
+}
+
+static iree_status_t iree_vm_bytecode_module_fork_state(
+    void* self, iree_vm_module_state_t* parent_state,
+    iree_allocator_t allocator, iree_vm_module_state_t** out_module_state) {
+  IREE_ASSERT_ARGUMENT(parent_state);
+  IREE_ASSERT_ARGUMENT(out_module_state);
+  *out_module_state = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_vm_bytecode_module_t* module = (iree_vm_bytecode_module_t*)self;
+  iree_vm_BytecodeModuleDef_table_t module_def = module->def;
+  iree_vm_bytecode_module_state_t* parent =
+      (iree_vm_bytecode_module_state_t*)parent_state;
+
+  iree_host_size_t total_state_struct_size =
+      iree_vm_bytecode_module_layout_state(module_def, NULL);
+  iree_vm_bytecode_module_state_t* state = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, total_state_struct_size,
+                                (void**)&state));
+  state->allocator = allocator;
+  iree_vm_bytecode_module_layout_state(module_def, state);
+
+  // Primitive globals are copied by value so the fork can mutate them freely.
+  memcpy(state->rwdata_storage.data, parent->rwdata_storage.data,
+         state->rwdata_storage.data_length);
+
+  // Ref globals get their own slots in the fork. Immutable objects they
+  // reference (executables, constant buffers, etc) are shared with the parent
+  // while mutable buffers, lists, and objects of types providing a clone
+  // function are cloned.
+  iree_vm_bytecode_fork_map_t map;
+  iree_vm_bytecode_fork_map_initialize(allocator, &map);
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < state->global_ref_count; ++i) {
+    status = iree_vm_bytecode_module_fork_ref(
+        &map, &parent->global_ref_table[i], /*depth=*/0, allocator,
+        &state->global_ref_table[i]);
+    if (!iree_status_is_ok(status)) break;
+  }
+  iree_vm_bytecode_fork_map_deinitialize(&map);
+  if (!iree_status_is_ok(status)) {
+    iree_vm_bytecode_module_free_state(self, (iree_vm_module_state_t*)state);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  // Imports resolve to the same modules in the forked context and function
+  // references are independent of module state so the table can be reused.
+  memcpy(state->import_table, parent->import_table,
+         state->import_count * sizeof(*state->import_table));
+
+  *out_module_state = (iree_vm_module_state_t*)state;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
 static iree_status_t iree_vm_bytecode_module_resolve_import(
     void* self, iree_vm_module_state_t* module_state, iree_host_size_t ordinal,
     const iree_vm_function_t* function,
@@ -735,15 +947,159 @@ static iree_status_t IREE_API_PTR iree_vm_bytecode_module_notify(
   return iree_ok_status();
 }
 
+// Calls the native implementation of an internal function in a new native
+// stack frame. Native implementations always complete synchronously.
+static iree_status_t iree_vm_bytecode_module_call_native(
+    iree_vm_bytecode_module_t* module, iree_vm_stack_t* stack,
+    const iree_vm_function_call_t call,
+    const iree_vm_bytecode_native_function_t* native_function) {
+  iree_vm_stack_frame_t* callee_frame = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_stack_function_enter(
+      stack, &call.function, IREE_VM_STACK_FRAME_NATIVE, /*frame_size=*/0,
+      /*frame_cleanup_fn=*/NULL, &callee_frame));
+  iree_status_t status = native_function->ptr.shim(
+      stack, IREE_VM_NATIVE_FUNCTION_CALL_BEGIN, call.arguments, call.results,
+      native_function->ptr.target, module, callee_frame->module_state);
+  if (IREE_UNLIKELY(iree_status_is_deferred(status))) {
+    iree_status_ignore(status);
+    return iree_make_status(
+        IREE_STATUS_UNIMPLEMENTED,
+        "native implementations of bytecode functions cannot yield");
+  } else if (IREE_UNLIKELY(!iree_status_is_ok(status))) {
+    return iree_status_annotate(
+        status, iree_make_cstring_view("while calling native implementation"));
+  }
+  return iree_vm_stack_function_leave(stack);
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_native_global_storage(
+    void* module_state, iree_byte_span_t* out_storage) {
+  IREE_ASSERT_ARGUMENT(module_state);
+  IREE_ASSERT_ARGUMENT(out_storage);
+  iree_vm_bytecode_module_state_t* state =
+      (iree_vm_bytecode_module_state_t*)module_state;
+  *out_storage = state->rwdata_storage;
+  return iree_ok_status();
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_native_global_ref(
+    void* module_state, uint32_t ordinal, iree_vm_ref_t** out_ref) {
+  IREE_ASSERT_ARGUMENT(module_state);
+  IREE_ASSERT_ARGUMENT(out_ref);
+  *out_ref = NULL;
+  iree_vm_bytecode_module_state_t* state =
+      (iree_vm_bytecode_module_state_t*)module_state;
+  if (IREE_UNLIKELY(ordinal >= state->global_ref_count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "global ref ordinal %u out of range (%" PRIhsz
+                            " globals)",
+                            ordinal, state->global_ref_count);
+  }
+  *out_ref = &state->global_ref_table[ordinal];
+  return iree_ok_status();
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_native_rodata(
+    void* module, uint32_t ordinal, iree_vm_buffer_t** out_buffer) {
+  IREE_ASSERT_ARGUMENT(module);
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  *out_buffer = NULL;
+  iree_vm_bytecode_module_t* bytecode_module =
+      (iree_vm_bytecode_module_t*)module;
+  if (IREE_UNLIKELY(ordinal >= bytecode_module->rodata_ref_count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "rodata ordinal %u out of range (%" PRIhsz
+                            " segments)",
+                            ordinal, bytecode_module->rodata_ref_count);
+  }
+  *out_buffer = &bytecode_module->rodata_ref_table[ordinal];
+  return iree_ok_status();
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_native_call_import(
+    iree_vm_stack_t* stack, void* module_state, uint32_t ordinal,
+    iree_byte_span_t arguments, iree_byte_span_t results) {
+  IREE_ASSERT_ARGUMENT(stack);
+  IREE_ASSERT_ARGUMENT(module_state);
+  iree_vm_bytecode_module_state_t* state =
+      (iree_vm_bytecode_module_state_t*)module_state;
+  if (IREE_UNLIKELY(ordinal >= state->import_count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "import ordinal %u out of range (%" PRIhsz
+                            " imports)",
+                            ordinal, state->import_count);
+  }
+  const iree_vm_bytecode_import_t* import = &state->import_table[ordinal];
+  if (!import->function.module) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "optional import ordinal %u not resolved", ordinal);
+  }
+  if (iree_vm_function_call_is_variadic_cconv(import->arguments)) {
+    return iree_make_status(
+        IREE_STATUS_UNIMPLEMENTED,
+        "variadic imports cannot be called from native implementations");
+  }
+  if (IREE_UNLIKELY(arguments.data_length != import->argument_buffer_size ||
+                    results.data_length != import->result_buffer_size)) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "import ordinal %u expects %u argument bytes and %u result bytes but "
+        "was given %" PRIhsz " and %" PRIhsz,
+        ordinal, import->argument_buffer_size, import->result_buffer_size,
+        arguments.data_length, results.data_length);
+  }
+
+  iree_vm_function_call_t call;
+  memset(&call, 0, sizeof(call));
+  call.function = import->function;
+  call.arguments = arguments;
+  call.results = results;
+  iree_status_t status =
+      call.function.module->begin_call(call.function.module->self, stack, call);
+  if (IREE_UNLIKELY(iree_status_is_deferred(status))) {
+    iree_status_ignore(status);
+    return iree_make_status(
+        IREE_STATUS_UNIMPLEMENTED,
+        "imports called from native implementations cannot yield");
+  }
+  return status;
+}
+
+static const iree_vm_bytecode_native_environment_t
+    iree_vm_bytecode_native_environment_storage = {
+        iree_vm_bytecode_native_global_storage,
+        iree_vm_bytecode_native_global_ref,
+        iree_vm_bytecode_native_rodata,
+        iree_vm_bytecode_native_call_import,
+};
+
+IREE_API_EXPORT const iree_vm_bytecode_native_environment_t*
+iree_vm_bytecode_native_environment(void) {
+  return &iree_vm_bytecode_native_environment_storage;
+}
+
 static iree_status_t iree_vm_bytecode_module_begin_call(
     void* self, iree_vm_stack_t* stack, iree_vm_function_call_t call) {
   // NOTE: any work here adds directly to the invocation time. Avoid doing too
   // much work or touching too many unlikely-to-be-cached structures (such as
   // walking the FlatBuffer, which may cause page faults).
+  iree_vm_bytecode_module_t* module = (iree_vm_bytecode_module_t*)self;
+
+  // Internal functions are only called directly when bytecode calls a function
+  // with a native implementation.
+  if (call.function.linkage == IREE_VM_FUNCTION_LINKAGE_INTERNAL &&
+      call.function.ordinal < module->function_descriptor_count) {
+    const iree_vm_bytecode_native_function_t* native_function =
+        iree_vm_bytecode_module_lookup_native_function(module,
+                                                       call.function.ordinal);
+    if (native_function) {
+      return iree_vm_bytecode_module_call_native(module, stack, call,
+                                                 native_function);  // tail
+    }
+  }
 
   // Map the (potentially) export ordinal into the internal function ordinal in
   // the function descriptor table.
-  iree_vm_bytecode_module_t* module = (iree_vm_bytecode_module_t*)self;
   uint16_t internal_ordinal = 0;
   iree_vm_FunctionSignatureDef_table_t signature_def = NULL;
   IREE_RETURN_IF_ERROR(iree_vm_bytecode_map_internal_ordinal(
@@ -752,6 +1108,15 @@ static iree_status_t iree_vm_bytecode_module_begin_call(
   call.function.linkage = IREE_VM_FUNCTION_LINKAGE_INTERNAL;
   call.function.ordinal = internal_ordinal;
 
+  // Run the native implementation of the function instead of the bytecode if
+  // one was provided.
+  const iree_vm_bytecode_native_function_t* native_function =
+      iree_vm_bytecode_module_lookup_native_function(module, internal_ordinal);
+  if (native_function) {
+    return iree_vm_bytecode_module_call_native(module, stack, call,
+                                               native_function);  // tail
+  }
+
   // Grab calling convention string. This is not great as we are guaranteed to
   // have a bunch of cache misses, but without putting it on the descriptor
   // (which would duplicate data and slow down normal intra-module calls)
@@ -788,11 +1153,349 @@ static iree_status_t iree_vm_bytecode_module_resume_call(
   return iree_vm_bytecode_dispatch_resume(stack, module, call_results);  // tail
 }
 
+#if IREE_VM_BYTECODE_VERIFICATION_ENABLE
+
+// Number of functions verified by each workgroup when verifying in parallel.
+// Functions are generally small and this amortizes the per-workgroup overhead
+// while still allowing large functions to be spread across workers.
+#define IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP 4
+
+// State shared by all workgroups of a parallel verification dispatch.
+typedef struct iree_vm_bytecode_verify_dispatch_t {
+  iree_vm_bytecode_module_t* module;
+  // Set to 1 when the completion callback has been issued.
+  iree_atomic_int32_t completed;
+  // Result of the dispatch as passed to the completion callback.
+  iree_status_t status;
+} iree_vm_bytecode_verify_dispatch_t;
+
+static iree_status_t iree_vm_bytecode_module_verify_workgroup(
+    void* user_data, iree_loop_t loop, uint32_t workgroup_x,
+    uint32_t workgroup_y, uint32_t workgroup_z) {
+  iree_vm_bytecode_verify_dispatch_t* dispatch =
+      (iree_vm_bytecode_verify_dispatch_t*)user_data;
+  iree_vm_bytecode_module_t* module = dispatch->module;
+  iree_host_size_t function_begin =
+      (iree_host_size_t)workgroup_x *
+      IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP;
+  iree_host_size_t function_end =
+      iree_min(function_begin + IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP,
+               module->function_descriptor_count);
+  for (iree_host_size_t i = function_begin; i < function_end; ++i) {
+    IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_vm_bytecode_function_verify");
+    iree_status_t status = iree_vm_bytecode_function_verify(
+        module, (uint16_t)i, module->allocator);
+    IREE_TRACE_ZONE_END(z0);
+    IREE_RETURN_IF_ERROR(status);
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_vm_bytecode_module_verify_complete(
+    void* user_data, iree_loop_t loop, iree_status_t status) {
+  iree_vm_bytecode_verify_dispatch_t* dispatch =
+      (iree_vm_bytecode_verify_dispatch_t*)user_data;
+  dispatch->status = status;
+  iree_atomic_store_int32(&dispatch->completed, 1, iree_memory_order_release);
+  return iree_ok_status();
+}
+
+// Verifies all functions in |module| by fanning out across |loop| workgroups.
+// Blocks until the dispatch has completed by draining the loop.
+static iree_status_t iree_vm_bytecode_module_verify_functions_parallel(
+    iree_vm_bytecode_module_t* module, iree_loop_t loop) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_vm_bytecode_verify_dispatch_t dispatch = {
+      .module = module,
+      .status = iree_ok_status(),
+  };
+  iree_atomic_store_int32(&dispatch.completed, 0, iree_memory_order_relaxed);
+  const uint32_t workgroup_count_xyz[3] = {
+      (uint32_t)((module->function_descriptor_count +
+                  IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP - 1) /
+                 IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP),
+      1,
+      1,
+  };
+  iree_status_t status = iree_loop_dispatch(
+      loop, workgroup_count_xyz, iree_vm_bytecode_module_verify_workgroup,
+      iree_vm_bytecode_module_verify_complete, &dispatch);
+
+  // The dispatch references stack storage and must have completed before we
+  // can return.
+  if (iree_status_is_ok(status)) {
+    status = iree_loop_drain(loop, iree_infinite_timeout());
+  }
+  if (iree_atomic_load_int32(&dispatch.completed, iree_memory_order_acquire)) {
+    status = iree_status_join(status, dispatch.status);
+  } else if (iree_status_is_ok(status)) {
+    status = iree_make_status(
+        IREE_STATUS_FAILED_PRECONDITION,
+        "verification loop did not complete the dispatch when drained");
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Verifies all functions in |module| on the calling thread.
+static iree_status_t iree_vm_bytecode_module_verify_functions_serial(
+    iree_vm_bytecode_module_t* module) {
+  for (uint16_t i = 0; i < module->function_descriptor_count; ++i) {
+    IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_vm_bytecode_function_verify");
+    iree_status_t status =
+        iree_vm_bytecode_function_verify(module, i, module->allocator);
+    IREE_TRACE_ZONE_END(z0);
+    IREE_RETURN_IF_ERROR(status);
+  }
+  return iree_ok_status();
+}
+
+#endif  // IREE_VM_BYTECODE_VERIFICATION_ENABLE
+
+// Returns the internal ordinal of the function with the module-local |name|.
+// Exported function names are checked first followed by the internal function
+// names in the debug database (if present).
+static iree_status_t iree_vm_bytecode_module_find_internal_function(
+    iree_vm_bytecode_module_t* module, iree_string_view_t name,
+    uint16_t* out_ordinal) {
+  *out_ordinal = 0;
+  iree_vm_ExportFunctionDef_vec_t exported_functions =
+      iree_vm_BytecodeModuleDef_exported_functions(module->def);
+  for (iree_host_size_t i = 0;
+       i < iree_vm_ExportFunctionDef_vec_len(exported_functions); ++i) {
+    iree_vm_ExportFunctionDef_table_t export_def =
+        iree_vm_ExportFunctionDef_vec_at(exported_functions, i);
+    if (iree_vm_flatbuffer_strcmp(
+            iree_vm_ExportFunctionDef_local_name(export_def), name) == 0) {
+      *out_ordinal = iree_vm_ExportFunctionDef_internal_ordinal(export_def);
+      return iree_ok_status();
+    }
+  }
+  for (iree_host_size_t i = 0; i < module->function_descriptor_count; ++i) {
+    flatbuffers_string_t function_name =
+        iree_vm_bytecode_module_lookup_internal_function_name(module->def, i);
+    if (function_name && iree_vm_flatbuffer_strcmp(function_name, name) == 0) {
+      *out_ordinal = (uint16_t)i;
+      return iree_ok_status();
+    }
+  }
+  return iree_make_status(IREE_STATUS_NOT_FOUND,
+                          "native function `%.*s` not found in module; "
+                          "internal functions can only be replaced if the "
+                          "module retains its debug database",
+                          (int)name.size, name.data);
+}
+
+// Appends |data| to the 64-bit FNV-1a |hash|.
+static uint64_t iree_vm_bytecode_fingerprint_append(uint64_t hash,
+                                                    const void* data,
+                                                    iree_host_size_t length) {
+  const uint8_t* bytes = (const uint8_t*)data;
+  for (iree_host_size_t i = 0; i < length; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001B3ull;
+  }
+  return hash;
+}
+
+// Appends |value| to |hash| as a little-endian uint32_t.
+static uint64_t iree_vm_bytecode_fingerprint_append_u32(uint64_t hash,
+                                                        uint32_t value) {
+  const uint8_t bytes[4] = {
+      (uint8_t)value,
+      (uint8_t)(value >> 8),
+      (uint8_t)(value >> 16),
+      (uint8_t)(value >> 24),
+  };
+  return iree_vm_bytecode_fingerprint_append(hash, bytes, sizeof(bytes));
+}
+
+// Appends the NUL-terminated flatbuffer |string| to |hash|.
+static uint64_t iree_vm_bytecode_fingerprint_append_string(
+    uint64_t hash, flatbuffers_string_t string) {
+  // flatbuffers strings are always NUL-terminated.
+  return iree_vm_bytecode_fingerprint_append(
+      hash, string, string ? flatbuffers_string_len(string) + 1 : 0);
+}
+
+// Computes the fingerprint of the state layout of |module| that native
+// libraries are produced against. See
+// iree_vm_bytecode_native_library_t::module_fingerprint for the definition.
+static uint64_t iree_vm_bytecode_module_native_fingerprint(
+    iree_vm_bytecode_module_t* module) {
+  iree_vm_ModuleStateDef_table_t module_state_def =
+      iree_vm_BytecodeModuleDef_module_state(module->def);
+  uint32_t global_bytes_capacity = 0;
+  uint32_t global_ref_count = 0;
+  if (module_state_def) {
+    global_bytes_capacity =
+        (uint32_t)iree_vm_ModuleStateDef_global_bytes_capacity(
+            module_state_def);
+    global_ref_count =
+        (uint32_t)iree_vm_ModuleStateDef_global_ref_count(module_state_def);
+  }
+  uint64_t hash = 0xCBF29CE484222325ull;
+  hash = iree_vm_bytecode_fingerprint_append_u32(hash, global_bytes_capacity);
+  hash = iree_vm_bytecode_fingerprint_append_u32(hash, global_ref_count);
+  hash = iree_vm_bytecode_fingerprint_append_u32(
+      hash, (uint32_t)module->rodata_ref_count);
+  iree_vm_ImportFunctionDef_vec_t imported_functions =
+      iree_vm_BytecodeModuleDef_imported_functions(module->def);
+  for (size_t i = 0; i < iree_vm_ImportFunctionDef_vec_len(imported_functions);
+       ++i) {
+    iree_vm_ImportFunctionDef_table_t import_def =
+        iree_vm_ImportFunctionDef_vec_at(imported_functions, i);
+    hash = iree_vm_bytecode_fingerprint_append_string(
+        hash, iree_vm_ImportFunctionDef_full_name(import_def));
+    iree_vm_FunctionSignatureDef_table_t signature =
+        iree_vm_ImportFunctionDef_signature(import_def);
+    hash = iree_vm_bytecode_fingerprint_append_string(
+        hash, signature
+                  ? iree_vm_FunctionSignatureDef_calling_convention(signature)
+                  : NULL);
+  }
+  return hash;
+}
+
+// Binds the native function implementations in |library| to the internal
+// functions of |module| they replace.
+static iree_status_t iree_vm_bytecode_module_bind_native_library(
+    iree_vm_bytecode_module_t* module,
+    const iree_vm_bytecode_native_library_t* library) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  if (library->version > IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "native library version %08X is newer than the "
+                            "supported version %08X",
+                            library->version,
+                            IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST);
+  }
+  iree_string_view_t module_name = iree_vm_bytecode_module_name(module);
+  if (!iree_string_view_equal(library->module_name, module_name)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "native library for module `%.*s` cannot be used with module `%.*s`",
+        (int)library->module_name.size, library->module_name.data,
+        (int)module_name.size, module_name.data);
+  }
+  uint64_t module_fingerprint =
+      iree_vm_bytecode_module_native_fingerprint(module);
+  if (library->module_fingerprint != module_fingerprint) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "native library for module `%.*s` was produced for a different state "
+        "layout (fingerprint %016" PRIX64 ", module has %016" PRIX64 ")",
+        (int)module_name.size, module_name.data, library->module_fingerprint,
+        module_fingerprint);
+  }
+
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0;
+       i < library->function_count && iree_status_is_ok(status); ++i) {
+    const iree_vm_bytecode_native_function_descriptor_t* descriptor =
+        &library->functions[i];
+    uint16_t ordinal = 0;
+    status = iree_vm_bytecode_module_find_internal_function(
+        module, descriptor->name, &ordinal);
+    if (!iree_status_is_ok(status)) break;
+
+    // The native implementation must use the same ABI as the bytecode.
+    iree_vm_bytecode_native_function_t* native_function =
+        &module->native_function_table[ordinal];
+    iree_vm_function_signature_t signature;
+    status = iree_vm_bytecode_module_get_function(
+        module, IREE_VM_FUNCTION_LINKAGE_INTERNAL, ordinal,
+        &native_function->call.function, NULL, &signature);
+    if (!iree_status_is_ok(status)) break;
+    if (!iree_string_view_equal(signature.calling_convention,
+                                descriptor->calling_convention)) {
+      status = iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "native function `%.*s` calling convention `%.*s` does not match "
+          "the bytecode function calling convention `%.*s`",
+          (int)descriptor->name.size, descriptor->name.data,
+          (int)descriptor->calling_convention.size,
+          descriptor->calling_convention.data,
+          (int)signature.calling_convention.size,
+          signature.calling_convention.data);
+      break;
+    }
+
+    // Precalculate the marshaling information used when calling from bytecode
+    // in the same way as imports.
+    status = iree_vm_function_call_get_cconv_fragments(
+        &signature, &native_function->call.arguments,
+        &native_function->call.results);
+    if (!iree_status_is_ok(status)) break;
+    if (iree_vm_function_call_is_variadic_cconv(
+            native_function->call.arguments)) {
+      status = iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                                "native function `%.*s` is variadic",
+                                (int)descriptor->name.size,
+                                descriptor->name.data);
+      break;
+    }
+    iree_host_size_t argument_buffer_size = 0;
+    iree_host_size_t result_buffer_size = 0;
+    status = iree_vm_function_call_compute_cconv_fragment_size(
+        native_function->call.arguments, /*segment_size_list=*/NULL,
+        &argument_buffer_size);
+    if (!iree_status_is_ok(status)) break;
+    status = iree_vm_function_call_compute_cconv_fragment_size(
+        native_function->call.results, /*segment_size_list=*/NULL,
+        &result_buffer_size);
+    if (!iree_status_is_ok(status)) break;
+    if (argument_buffer_size > 16 * 1024 || result_buffer_size > 16 * 1024) {
+      status = iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "ABI marshaling buffer overflow on native function `%.*s`",
+          (int)descriptor->name.size, descriptor->name.data);
+      break;
+    }
+    native_function->call.argument_buffer_size = (uint16_t)argument_buffer_size;
+    native_function->call.result_buffer_size = (uint16_t)result_buffer_size;
+
+    native_function->ptr = descriptor->function;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT void iree_vm_bytecode_module_options_initialize(
+    iree_vm_bytecode_module_options_t* out_options) {
+  IREE_ASSERT_ARGUMENT(out_options);
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->flags = IREE_VM_BYTECODE_MODULE_FLAG_NONE;
+  out_options->verification_loop = iree_loop_null();
+  out_options->native_library = NULL;
+  out_options->native_library_allocator = iree_allocator_null();
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
     iree_vm_instance_t* instance, iree_const_byte_span_t archive_contents,
     iree_allocator_t archive_allocator, iree_allocator_t allocator,
     iree_vm_module_t** out_module) {
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  return iree_vm_bytecode_module_create_with_options(
+      instance, &options, archive_contents, archive_allocator, allocator,
+      out_module);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_options(
+    iree_vm_instance_t* instance,
+    const iree_vm_bytecode_module_options_t* options,
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_allocator_t allocator, iree_vm_module_t** out_module) {
   IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_ASSERT_ARGUMENT(options);
   IREE_ASSERT_ARGUMENT(out_module);
   *out_module = NULL;
 
@@ -832,19 +1535,57 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
   size_t rodata_ref_table_size =
       iree_host_align(rodata_ref_count * sizeof(iree_vm_buffer_t), 16);
 
+  iree_vm_FunctionDescriptor_vec_t function_descriptors =
+      iree_vm_BytecodeModuleDef_function_descriptors(module_def);
+  iree_host_size_t function_descriptor_count =
+      iree_vm_FunctionDescriptor_vec_len(function_descriptors);
+
+  // Deferred verification tracks which functions have been verified.
+  bool lazy_verification = false;
+#if IREE_VM_BYTECODE_VERIFICATION_ENABLE
+  lazy_verification = iree_all_bits_set(
+      options->flags, IREE_VM_BYTECODE_MODULE_FLAG_LAZY_VERIFICATION);
+#endif  // IREE_VM_BYTECODE_VERIFICATION_ENABLE
+  size_t function_verified_flags_size =
+      lazy_verification ? iree_host_align(function_descriptor_count *
+                                              sizeof(iree_atomic_int32_t),
+                                          16)
+                        : 0;
+
+  // Native implementations are looked up by internal function ordinal.
+  size_t native_function_table_size =
+      options->native_library
+          ? iree_host_align(function_descriptor_count *
+                                sizeof(iree_vm_bytecode_native_function_t),
+                            16)
+          : 0;
+
   iree_vm_bytecode_module_t* module = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0,
-      iree_allocator_malloc(
-          allocator, sizeof(*module) + type_table_size + rodata_ref_table_size,
-          (void**)&module));
+      z0, iree_allocator_malloc(
+              allocator,
+              sizeof(*module) + type_table_size + rodata_ref_table_size +
+                  function_verified_flags_size + native_function_table_size,
+              (void**)&module));
   module->allocator = allocator;
 
-  iree_vm_FunctionDescriptor_vec_t function_descriptors =
-      iree_vm_BytecodeModuleDef_function_descriptors(module_def);
-  module->function_descriptor_count =
-      iree_vm_FunctionDescriptor_vec_len(function_descriptors);
+  module->function_descriptor_count = function_descriptor_count;
   module->function_descriptor_table = function_descriptors;
+  if (lazy_verification) {
+    // NOTE: the allocation is zeroed and all functions start unverified.
+    module->function_verified_flags =
+        (iree_atomic_int32_t*)((uint8_t*)module + sizeof(*module) +
+                               type_table_size + rodata_ref_table_size);
+  }
+  if (options->native_library) {
+    // NOTE: the allocation is zeroed and all functions start interpreted.
+    module->native_function_table =
+        (iree_vm_bytecode_native_function_t*)((uint8_t*)module +
+                                              sizeof(*module) +
+                                              type_table_size +
+                                              rodata_ref_table_size +
+                                              function_verified_flags_size);
+  }
 
   flatbuffers_uint8_vec_t bytecode_data =
       iree_vm_BytecodeModuleDef_bytecode_data(module_def);
@@ -881,6 +1622,7 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
 #endif  // IREE_VM_BACKTRACE_ENABLE
   module->interface.alloc_state = iree_vm_bytecode_module_alloc_state;
   module->interface.free_state = iree_vm_bytecode_module_free_state;
+  module->interface.fork_state = iree_vm_bytecode_module_fork_state;
   module->interface.resolve_import = iree_vm_bytecode_module_resolve_import;
   module->interface.notify = iree_vm_bytecode_module_notify;
   module->interface.begin_call = iree_vm_bytecode_module_begin_call;
@@ -915,18 +1657,32 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
                               iree_allocator_null(), ref);
   }
 
-  // Verify functions in the module now that we've verified the metadata that we
-  // need to do so.
+  // Bind native function implementations. The bytecode of replaced functions
+  // is still verified below as it remains the reference implementation.
   iree_status_t verify_status = iree_ok_status();
+  if (options->native_library) {
+    verify_status = iree_vm_bytecode_module_bind_native_library(
+        module, options->native_library);
+  }
+
+  // Verify functions in the module now that we've verified the metadata that we
+  // need to do so. When deferred each function is verified on first entry.
 #if IREE_VM_BYTECODE_VERIFICATION_ENABLE
-  for (uint16_t i = 0; i < module->function_descriptor_count; ++i) {
-    IREE_TRACE_ZONE_BEGIN_NAMED(z1, "iree_vm_bytecode_function_verify");
-    verify_status = iree_vm_bytecode_function_verify(module, i, allocator);
-    IREE_TRACE_ZONE_END(z1);
-    if (!iree_status_is_ok(verify_status)) break;
+  if (iree_status_is_ok(verify_status) && !lazy_verification) {
+    if (options->verification_loop.ctl &&
+        module->function_descriptor_count >
+            IREE_VM_BYTECODE_VERIFY_FUNCTIONS_PER_WORKGROUP) {
+      verify_status = iree_vm_bytecode_module_verify_functions_parallel(
+          module, options->verification_loop);
+    } else {
+      verify_status = iree_vm_bytecode_module_verify_functions_serial(module);
+    }
   }
 #endif  // IREE_VM_BYTECODE_VERIFICATION_ENABLE
   if (iree_status_is_ok(verify_status)) {
+    // The module takes ownership of the native library (when successful).
+    module->native_library = options->native_library;
+    module->native_library_allocator = options->native_library_allocator;
     *out_module = &module->interface;
   } else {
     iree_allocator_free(allocator, module);
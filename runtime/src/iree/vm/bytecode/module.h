@@ -14,15 +14,200 @@
 extern "C" {
 #endif  // __cplusplus
 
+//===----------------------------------------------------------------------===//
+// Native function libraries
+//===----------------------------------------------------------------------===//
+
+// Version code indicating the native library structures used.
+// Runtimes cannot use native libraries with newer versions than they support.
+typedef uint32_t iree_vm_bytecode_native_library_version_t;
+
+#define IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_0_1 0x00000001u
+
+// The latest version of the native library structures.
+#define IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST \
+  IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_0_1
+
+// Describes a native implementation of a bytecode function.
+typedef struct iree_vm_bytecode_native_function_descriptor_t {
+  // Module-local name of the function being replaced. Matched against the
+  // exported function names and, if present, the function names in the debug
+  // database of the module.
+  iree_string_view_t name;
+
+  // Calling convention string of the function; see iree/vm/module.h for
+  // details. Must match the calling convention of the bytecode function.
+  iree_string_view_t calling_convention;
+
+  // Shim and target implementing the function. The shim is called with the
+  // same argument and result storage as the bytecode function would receive.
+  // The module and module state passed to the target are those of the bytecode
+  // module and must only be accessed through the native environment.
+  iree_vm_native_function_ptr_t function;
+} iree_vm_bytecode_native_function_descriptor_t;
+
+// Accessors native implementations use to reach the state of the bytecode
+// module they are part of. The |module| and |module_state| arguments are those
+// passed to the native function target. Ordinals and byte offsets are those
+// assigned by the compiler to the module the library was produced for.
+//
+// The table is append-only: new accessors are only added to the end and the
+// library version is bumped when they are.
+typedef struct iree_vm_bytecode_native_environment_t {
+  // Returns the storage of the primitive (non-ref) globals in |module_state|.
+  // Globals are at the byte offsets used by the vm.global.load/store ops.
+  iree_status_t(IREE_API_PTR* global_storage)(void* module_state,
+                                              iree_byte_span_t* out_storage);
+
+  // Returns the ref global with |ordinal| in |module_state|. The ref remains
+  // owned by the state and may be assigned, moved into, or retained.
+  iree_status_t(IREE_API_PTR* global_ref)(void* module_state, uint32_t ordinal,
+                                          iree_vm_ref_t** out_ref);
+
+  // Returns the rodata segment with |ordinal| in |module|. The buffer is
+  // owned by the module and may be retained.
+  iree_status_t(IREE_API_PTR* rodata)(void* module, uint32_t ordinal,
+                                      iree_vm_buffer_t** out_buffer);
+
+  // Calls the import with |ordinal| in |module_state| on |stack|.
+  // |arguments| and |results| are laid out as described by the calling
+  // convention of the import declaration and must exactly match its size.
+  // Returns IREE_STATUS_NOT_FOUND if the import is optional and unresolved.
+  // Variadic imports and imports that yield are not supported.
+  iree_status_t(IREE_API_PTR* call_import)(iree_vm_stack_t* stack,
+                                           void* module_state,
+                                           uint32_t ordinal,
+                                           iree_byte_span_t arguments,
+                                           iree_byte_span_t results);
+} iree_vm_bytecode_native_environment_t;
+
+// Returns the accessors for native implementations of bytecode functions.
+// Libraries linked into the hosting binary may use this directly while those
+// loaded from shared libraries receive it from the query function.
+IREE_API_EXPORT const iree_vm_bytecode_native_environment_t*
+iree_vm_bytecode_native_environment(void);
+
+// Native implementations of a subset of the functions in a bytecode module.
+// These are produced ahead-of-time for the module they are used with and are
+// called instead of interpreting the bytecode of the functions they replace.
+// Functions without native implementations are interpreted as usual.
+//
+// Native implementations must complete synchronously. They may read and write
+// globals, read rodata, and call imports through the
+// iree_vm_bytecode_native_environment_t accessors.
+//
+// NOTE: the compiler does not yet produce native libraries and they must be
+// written by hand for a particular compilation of a module; see the TODO in
+// the VM bytecode target of the compiler (BytecodeModuleTarget.cpp).
+typedef struct iree_vm_bytecode_native_library_t {
+  // Version of the structures used by the library.
+  iree_vm_bytecode_native_library_version_t version;
+
+  // Name of the module the library was produced for.
+  iree_string_view_t module_name;
+
+  // Fingerprint of the state layout of the module the library was produced
+  // for. Native implementations access globals, rodata, and imports at the
+  // byte offsets and ordinals assigned by the compiler and a library produced
+  // for a different compilation of a module with the same name would corrupt
+  // its state; libraries are rejected if this does not match the module.
+  //
+  // The fingerprint is the 64-bit FNV-1a hash of the following, in order:
+  //   - global_bytes_capacity, global_ref_count, and the rodata segment count
+  //     of the module as little-endian uint32_t values
+  //   - for each import: its full name and calling convention each followed
+  //     by a NUL byte
+  // The fingerprint of the module is reported when binding fails.
+  uint64_t module_fingerprint;
+
+  // Native function implementations.
+  iree_host_size_t function_count;
+  const iree_vm_bytecode_native_function_descriptor_t* functions;
+} iree_vm_bytecode_native_library_t;
+
+// Exported function from shared libraries for querying the native library.
+// The provided |max_version| is the maximum version the caller supports;
+// callees must return NULL if their lowest available version is greater than
+// the max version supported by the caller.
+//
+// The provided |environment| remains valid for the lifetime of the process and
+// may be retained by the library for use by its native implementations.
+typedef const iree_vm_bytecode_native_library_t*(
+    IREE_API_PTR* iree_vm_bytecode_native_library_query_fn_t)(
+    iree_vm_bytecode_native_library_version_t max_version,
+    const iree_vm_bytecode_native_environment_t* environment);
+
+// Function name exported from shared libraries (pass to dlsym).
+#define IREE_VM_BYTECODE_NATIVE_LIBRARY_EXPORT_NAME \
+  "iree_vm_bytecode_native_library_query"
+
+//===----------------------------------------------------------------------===//
+// iree_vm_bytecode_module_t
+//===----------------------------------------------------------------------===//
+
+// Controls bytecode module creation behavior.
+enum iree_vm_bytecode_module_flag_bits_t {
+  IREE_VM_BYTECODE_MODULE_FLAG_NONE = 0u,
+
+  // Defers verification of each function until it is first entered instead of
+  // verifying all functions during module creation. Functions that are never
+  // called are never verified. Verification failures are reported from the
+  // call that first enters the function.
+  //
+  // Has no effect if IREE_VM_BYTECODE_VERIFICATION_ENABLE is 0.
+  IREE_VM_BYTECODE_MODULE_FLAG_LAZY_VERIFICATION = 1u << 0,
+};
+typedef uint32_t iree_vm_bytecode_module_flags_t;
+
+// Options controlling bytecode module creation.
+typedef struct iree_vm_bytecode_module_options_t {
+  // Flags controlling module behavior.
+  iree_vm_bytecode_module_flags_t flags;
+
+  // Optional loop used to verify functions concurrently during creation.
+  // Functions are verified from workgroups of an iree_loop_dispatch operation
+  // and the loop is drained with iree_loop_drain before creation returns; the
+  // loop must have completed the dispatch by the time the drain returns.
+  // When iree_loop_null() functions are verified serially on the caller.
+  //
+  // Unused when IREE_VM_BYTECODE_MODULE_FLAG_LAZY_VERIFICATION is set.
+  iree_loop_t verification_loop;
+
+  // Optional native implementations of functions in the module.
+  // Calls to functions with native implementations, either from outside of the
+  // module or from other functions within it, run the native implementation
+  // instead of the bytecode. If |native_library_allocator| is provided it will
+  // be used to free |native_library| when the module is destroyed and otherwise
+  // the library must remain valid for the lifetime of the module. Ownership is
+  // only transferred if module creation succeeds.
+  const iree_vm_bytecode_native_library_t* native_library;
+  iree_allocator_t native_library_allocator;
+} iree_vm_bytecode_module_options_t;
+
+// Initializes |out_options| to the default values.
+IREE_API_EXPORT void iree_vm_bytecode_module_options_initialize(
+    iree_vm_bytecode_module_options_t* out_options);
+
 // Creates a VM module from an in-memory ModuleDef FlatBuffer archive.
 // If a |archive_allocator| is provided then it will be used to free the
 // |archive_contents| when the module is destroyed and otherwise the ownership
-// of the memory remains with the caller.
+// of the memory remains with the caller. If creation fails ownership of the
+// archive always remains with the caller.
 IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
     iree_vm_instance_t* instance, iree_const_byte_span_t archive_contents,
     iree_allocator_t archive_allocator, iree_allocator_t allocator,
     iree_vm_module_t** out_module);
 
+// Creates a VM module from an in-memory ModuleDef FlatBuffer archive with the
+// given |options|. See iree_vm_bytecode_module_create for more information.
+// If creation fails ownership of both the archive and the native library in
+// |options| remains with the caller.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_options(
+    iree_vm_instance_t* instance,
+    const iree_vm_bytecode_module_options_t* options,
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_allocator_t allocator, iree_vm_module_t** out_module);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -11,7 +11,9 @@
 #include "iree/base/api.h"
 #include "iree/vm/api.h"
 #include "iree/vm/bytecode/module.h"
+#include "iree/vm/bytecode/many_functions_benchmark_module_c.h"
 #include "iree/vm/bytecode/module_benchmark_module_c.h"
+#include "iree/vm/bytecode/verification_loop_test.h"
 
 namespace {
 
@@ -159,6 +161,91 @@ static void BM_ModuleCreate(benchmark::State& state) {
 }
 BENCHMARK(BM_ModuleCreate);
 
+// Benchmarks creating the module in |module_file_toc| with |options|.
+static void RunModuleCreate(benchmark::State& state,
+                            const iree_file_toc_t* module_file_toc,
+                            const iree_vm_bytecode_module_options_t& options) {
+  iree_vm_instance_t* instance = NULL;
+  IREE_CHECK_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
+                                        iree_allocator_system(), &instance));
+
+  while (state.KeepRunning()) {
+    iree_vm_module_t* module = nullptr;
+    IREE_CHECK_OK(iree_vm_bytecode_module_create_with_options(
+        instance, &options,
+        iree_const_byte_span_t{
+            reinterpret_cast<const uint8_t*>(module_file_toc->data),
+            static_cast<iree_host_size_t>(module_file_toc->size)},
+        iree_allocator_null(), iree_allocator_system(), &module));
+    benchmark::DoNotOptimize(module);
+    iree_vm_module_release(module);
+  }
+
+  iree_vm_instance_release(instance);
+}
+
+// Benchmarks creating |module_file_toc| verifying all functions in parallel
+// across state.range(0) threads.
+static void RunModuleCreateParallelVerification(
+    benchmark::State& state, const iree_file_toc_t* module_file_toc) {
+  iree::vm::ThreadPoolLoop thread_pool_loop(static_cast<int>(state.range(0)));
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.verification_loop = thread_pool_loop.loop();
+  RunModuleCreate(state, module_file_toc, options);
+}
+
+// Benchmarks creating |module_file_toc| deferring verification to first call.
+static void RunModuleCreateLazyVerification(
+    benchmark::State& state, const iree_file_toc_t* module_file_toc) {
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.flags |= IREE_VM_BYTECODE_MODULE_FLAG_LAZY_VERIFICATION;
+  RunModuleCreate(state, module_file_toc, options);
+}
+
+static void BM_ModuleCreateParallelVerification(benchmark::State& state) {
+  RunModuleCreateParallelVerification(
+      state, iree_vm_bytecode_module_benchmark_module_create());
+}
+BENCHMARK(BM_ModuleCreateParallelVerification)->Arg(1)->Arg(2)->Arg(4);
+
+static void BM_ModuleCreateLazyVerification(benchmark::State& state) {
+  RunModuleCreateLazyVerification(
+      state, iree_vm_bytecode_module_benchmark_module_create());
+}
+BENCHMARK(BM_ModuleCreateLazyVerification);
+
+// The benchmark module only has a handful of functions and verification is
+// dominated by fixed costs. Modules with thousands of functions are where
+// parallel and lazy verification are expected to pay off.
+static void BM_ModuleCreateManyFunctions(benchmark::State& state) {
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  RunModuleCreate(state,
+                  iree_vm_bytecode_many_functions_benchmark_module_create(),
+                  options);
+}
+BENCHMARK(BM_ModuleCreateManyFunctions);
+
+static void BM_ModuleCreateManyFunctionsParallelVerification(
+    benchmark::State& state) {
+  RunModuleCreateParallelVerification(
+      state, iree_vm_bytecode_many_functions_benchmark_module_create());
+}
+BENCHMARK(BM_ModuleCreateManyFunctionsParallelVerification)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
+static void BM_ModuleCreateManyFunctionsLazyVerification(
+    benchmark::State& state) {
+  RunModuleCreateLazyVerification(
+      state, iree_vm_bytecode_many_functions_benchmark_module_create());
+}
+BENCHMARK(BM_ModuleCreateManyFunctionsLazyVerification);
+
 static void BM_ModuleCreateState(benchmark::State& state) {
   iree_vm_instance_t* instance = NULL;
   IREE_CHECK_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
@@ -11,13 +11,48 @@
 #include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/vm/api.h"
+#include "iree/vm/bytecode/module.h"
 #include "iree/vm/bytecode/utils/isa.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
+// A resolved and split import in the module state table.
+//
+// NOTE: a table of these are stored per module per context so ideally we'd
+// only store the absolute minimum information to reduce our fixed overhead.
+// There's a big tradeoff though as a few extra bytes here can avoid non-trivial
+// work per import function invocation.
+typedef struct iree_vm_bytecode_import_t {
+  // Import function in the source module.
+  iree_vm_function_t function;
+
+  // Pre-parsed argument/result calling convention string fragments.
+  // For example, 0ii.r will be split to arguments=ii and results=r.
+  iree_string_view_t arguments;
+  iree_string_view_t results;
+
+  // Precomputed argument/result size requirements for marshaling values.
+  // Only usable for non-variadic signatures. Results are always usable as they
+  // don't support variadic values (yet).
+  uint16_t argument_buffer_size;
+  uint16_t result_buffer_size;
+} iree_vm_bytecode_import_t;
+
+// A native implementation of an internal function in the module.
+typedef struct iree_vm_bytecode_native_function_t {
+  // Shim and target implementing the function. The shim is NULL if the function
+  // has no native implementation and is interpreted.
+  iree_vm_native_function_ptr_t ptr;
+
+  // Pre-parsed call information used when calling the native implementation
+  // from bytecode. The function is the internal function being replaced.
+  iree_vm_bytecode_import_t call;
+} iree_vm_bytecode_native_function_t;
+
 // A loaded bytecode module.
 typedef struct iree_vm_bytecode_module_t {
   // Interface routing to the bytecode module functions.
@@ -31,6 +66,21 @@ typedef struct iree_vm_bytecode_module_t {
   iree_host_size_t function_descriptor_count;
   const iree_vm_FunctionDescriptor_t* function_descriptor_table;
 
+  // Per-function verification flags mapped 1:1 with the function descriptors
+  // when verification is deferred until first entry. Each flag is set to 1 once
+  // the function has been verified. NULL when all functions were verified
+  // during module creation.
+  iree_atomic_int32_t* function_verified_flags;
+
+  // Native implementations mapped 1:1 with the function descriptors. NULL when
+  // no native library was provided and all functions are interpreted.
+  iree_vm_bytecode_native_function_t* native_function_table;
+
+  // Optional native library and the allocator used to free it (which may be
+  // null).
+  const iree_vm_bytecode_native_library_t* native_library;
+  iree_allocator_t native_library_allocator;
+
   // A pointer to the bytecode data embedded within the module.
   iree_const_byte_span_t bytecode_data;
 
@@ -53,28 +103,6 @@ typedef struct iree_vm_bytecode_module_t {
   iree_vm_type_def_t type_table[];
 } iree_vm_bytecode_module_t;
 
-// A resolved and split import in the module state table.
-//
-// NOTE: a table of these are stored per module per context so ideally we'd
-// only store the absolute minimum information to reduce our fixed overhead.
-// There's a big tradeoff though as a few extra bytes here can avoid non-trivial
-// work per import function invocation.
-typedef struct iree_vm_bytecode_import_t {
-  // Import function in the source module.
-  iree_vm_function_t function;
-
-  // Pre-parsed argument/result calling convention string fragments.
-  // For example, 0ii.r will be split to arguments=ii and results=r.
-  iree_string_view_t arguments;
-  iree_string_view_t results;
-
-  // Precomputed argument/result size requirements for marshaling values.
-  // Only usable for non-variadic signatures. Results are always usable as they
-  // don't support variadic values (yet).
-  uint16_t argument_buffer_size;
-  uint16_t result_buffer_size;
-} iree_vm_bytecode_import_t;
-
 // Per-instance module state.
 // This is allocated with a provided allocator as a single flat allocation.
 // This struct is a prefix to the allocation pointing into the dynamic offsets
@@ -96,6 +124,17 @@ typedef struct iree_vm_bytecode_module_state_t {
   iree_allocator_t allocator;
 } iree_vm_bytecode_module_state_t;
 
+// Returns the native implementation of internal function |ordinal| or NULL if
+// the function is interpreted.
+static inline const iree_vm_bytecode_native_function_t*
+iree_vm_bytecode_module_lookup_native_function(
+    const iree_vm_bytecode_module_t* module, uint16_t ordinal) {
+  if (IREE_LIKELY(!module->native_function_table)) return NULL;
+  const iree_vm_bytecode_native_function_t* native_function =
+      &module->native_function_table[ordinal];
+  return native_function->ptr.shim ? native_function : NULL;
+}
+
 // Begins execution of the current frame and continues until either a yield or
 // return.
 iree_status_t iree_vm_bytecode_dispatch_begin(
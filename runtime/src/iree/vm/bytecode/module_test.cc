@@ -10,14 +10,19 @@
 
 #include "iree/vm/bytecode/module.h"
 
+#include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "iree/base/api.h"
 #include "iree/testing/gtest.h"
 #include "iree/testing/status_matchers.h"
 #include "iree/vm/api.h"
+#include "iree/vm/bytecode/archive.h"
 #include "iree/vm/bytecode/module_test_module_c.h"
+#include "iree/vm/bytecode/utils/isa.h"
+#include "iree/vm/bytecode/verification_loop_test.h"
 
 static bool operator==(const iree_vm_value_t& lhs,
                        const iree_vm_value_t& rhs) noexcept {
@@ -100,11 +105,13 @@ static std::vector<iree_vm_ref_t> MakeNullRefList(size_t count) {
 
 namespace {
 
+using iree::Status;
 using iree::StatusCode;
 using iree::StatusOr;
 using iree::testing::status::IsOkAndHolds;
 using iree::testing::status::StatusIs;
 using iree::vm::ref;
+using iree::vm::ThreadPoolLoop;
 using testing::Eq;
 
 class VMBytecodeModuleTest : public ::testing::Test {
@@ -113,13 +120,12 @@ class VMBytecodeModuleTest : public ::testing::Test {
     IREE_CHECK_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
                                           iree_allocator_system(), &instance_));
 
-    const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
-    IREE_CHECK_OK(iree_vm_bytecode_module_create(
-        instance_,
-        iree_const_byte_span_t{
-            reinterpret_cast<const uint8_t*>(module_file_toc->data),
-            static_cast<iree_host_size_t>(module_file_toc->size)},
-        iree_allocator_null(), iree_allocator_system(), &bytecode_module_));
+    iree_vm_bytecode_module_options_t options;
+    iree_vm_bytecode_module_options_initialize(&options);
+    InitializeOptions(&options);
+    IREE_CHECK_OK(iree_vm_bytecode_module_create_with_options(
+        instance_, &options, GetArchiveContents(), iree_allocator_null(),
+        iree_allocator_system(), &bytecode_module_));
 
     std::vector<iree_vm_module_t*> modules = {bytecode_module_};
     IREE_CHECK_OK(iree_vm_context_create_with_modules(
@@ -127,6 +133,17 @@ class VMBytecodeModuleTest : public ::testing::Test {
         iree_allocator_system(), &context_));
   }
 
+  // Overridden by subclasses to customize module creation.
+  virtual void InitializeOptions(iree_vm_bytecode_module_options_t* options) {}
+
+  // Overridden by subclasses to create the module from another archive.
+  virtual iree_const_byte_span_t GetArchiveContents() {
+    const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+    return iree_const_byte_span_t{
+        reinterpret_cast<const uint8_t*>(module_file_toc->data),
+        static_cast<iree_host_size_t>(module_file_toc->size)};
+  }
+
   virtual void TearDown() {
     iree_vm_module_release(bytecode_module_);
     iree_vm_context_release(context_);
@@ -228,4 +245,550 @@ TEST_F(VMBytecodeModuleTest, FuncIO600) {
               IsOkAndHolds(Eq(MakeNullRefList(600))));
 }
 
+TEST_F(VMBytecodeModuleTest, ForkContext) {
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({101}))));
+
+  iree_vm_context_t* forked_context = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_context_fork(context_, iree_allocator_system(), &forked_context));
+
+  // The fork starts from the parent globals but diverges independently.
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({102}))));
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({103}))));
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({102}))));
+
+  iree_vm_context_release(forked_context);
+}
+
+TEST_F(VMBytecodeModuleTest, ForkContextClonesMutableBuffers) {
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({1}))));
+
+  iree_vm_context_t* forked_context = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_context_fork(context_, iree_allocator_system(), &forked_context));
+
+  // The buffer held by the global is copied so in-place stores made by one
+  // context are not observed by the other.
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({2}))));
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({3}))));
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({2}))));
+
+  iree_vm_context_release(forked_context);
+}
+
+TEST_F(VMBytecodeModuleTest, ForkContextPreservesAliasing) {
+  iree_vm_context_t* forked_context = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_context_fork(context_, iree_allocator_system(), &forked_context));
+
+  // Both globals reference the same buffer in the parent and must reference
+  // the same clone in the fork.
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({1}))));
+  EXPECT_THAT(RunFunction("ReadScratchAlias", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({1}))));
+  std::swap(context_, forked_context);
+  EXPECT_THAT(RunFunction("ReadScratchAlias", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({0}))));
+
+  iree_vm_context_release(forked_context);
+}
+
+TEST_F(VMBytecodeModuleTest, PreparedCall) {
+  iree_vm_function_t function;
+  IREE_ASSERT_OK(iree_vm_module_lookup_function_by_name(
+      bytecode_module_, IREE_VM_FUNCTION_LINKAGE_EXPORT, IREE_SV("FuncIO8"),
+      &function));
+  iree_vm_prepared_call_t* call = nullptr;
+  IREE_ASSERT_OK(iree_vm_prepared_call_allocate(
+      context_, function, IREE_VM_INVOCATION_FLAG_NONE,
+      iree_allocator_system(), &call));
+  ASSERT_EQ(iree_vm_prepared_call_argument_count(call), 8u);
+  ASSERT_EQ(iree_vm_prepared_call_result_count(call), 8u);
+
+  // Arguments persist across invocations and only changed ones are set.
+  for (int32_t i = 0; i < 8; ++i) {
+    iree_vm_value_t value = iree_vm_value_make_i32(i);
+    IREE_ASSERT_OK(iree_vm_prepared_call_set_value(call, i, &value));
+  }
+  for (int32_t round = 0; round < 3; ++round) {
+    iree_vm_value_t value = iree_vm_value_make_i32(100 + round);
+    IREE_ASSERT_OK(iree_vm_prepared_call_set_value(call, 0, &value));
+    IREE_ASSERT_OK(iree_vm_prepared_call_invoke(call));
+    iree_vm_value_t result;
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_value(call, 7, &result));
+    EXPECT_EQ(result, iree_vm_value_make_i32(100 + round));
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_value(call, 0, &result));
+    EXPECT_EQ(result, iree_vm_value_make_i32(7));
+  }
+
+  // Types must match the function signature exactly.
+  iree_vm_value_t i64_value = iree_vm_value_make_i64(1);
+  EXPECT_THAT(Status(iree_vm_prepared_call_set_value(call, 0, &i64_value)),
+              StatusIs(StatusCode::kInvalidArgument));
+  iree_vm_ref_t null_ref = {0};
+  EXPECT_THAT(Status(iree_vm_prepared_call_set_ref_move(call, 0, &null_ref)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(Status(iree_vm_prepared_call_get_value(call, 8, &i64_value)),
+              StatusIs(StatusCode::kOutOfRange));
+
+  iree_vm_prepared_call_free(call);
+}
+
+TEST_F(VMBytecodeModuleTest, PreparedCallRefs) {
+  iree_vm_function_t function;
+  IREE_ASSERT_OK(iree_vm_module_lookup_function_by_name(
+      bytecode_module_, IREE_VM_FUNCTION_LINKAGE_EXPORT, IREE_SV("FuncIO600"),
+      &function));
+  iree_vm_prepared_call_t* call = nullptr;
+  IREE_ASSERT_OK(iree_vm_prepared_call_allocate(
+      context_, function, IREE_VM_INVOCATION_FLAG_NONE,
+      iree_allocator_system(), &call));
+
+  iree_vm_buffer_t* buffer = nullptr;
+  IREE_ASSERT_OK(iree_vm_buffer_create(IREE_VM_BUFFER_ACCESS_ORIGIN_HOST, 16,
+                                       /*alignment=*/0,
+                                       iree_allocator_system(), &buffer));
+  for (int round = 0; round < 2; ++round) {
+    // Refs are consumed by each invocation and moved back out of the results.
+    iree_vm_ref_t buffer_ref = iree_vm_buffer_retain_ref(buffer);
+    IREE_ASSERT_OK(iree_vm_prepared_call_set_ref_move(call, 599, &buffer_ref));
+    EXPECT_TRUE(iree_vm_ref_is_null(&buffer_ref));
+    IREE_ASSERT_OK(iree_vm_prepared_call_invoke(call));
+    iree_vm_ref_t result_ref = {0};
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_ref_move(call, 599, &result_ref));
+    EXPECT_EQ(result_ref.ptr, buffer);
+    iree_vm_ref_release(&result_ref);
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_ref_move(call, 599, &result_ref));
+    EXPECT_TRUE(iree_vm_ref_is_null(&result_ref));
+  }
+  iree_vm_buffer_release(buffer);
+
+  iree_vm_prepared_call_free(call);
+}
+
+// Defers function verification until each function is first called.
+class VMBytecodeModuleLazyVerificationTest : public VMBytecodeModuleTest {
+ protected:
+  void InitializeOptions(iree_vm_bytecode_module_options_t* options) override {
+    options->flags |= IREE_VM_BYTECODE_MODULE_FLAG_LAZY_VERIFICATION;
+  }
+};
+
+TEST_F(VMBytecodeModuleLazyVerificationTest, FuncIO8) {
+  // The first call verifies the function and the second takes the fast path.
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THAT(RunFunction("FuncIO8", MakeValueRangeList(0, 7)),
+                IsOkAndHolds(Eq(MakeValueRangeList(7, 0))));
+  }
+}
+
+TEST_F(VMBytecodeModuleLazyVerificationTest, FuncIO600) {
+  EXPECT_THAT(RunFunction("FuncIO600", MakeNullRefList(600)),
+              IsOkAndHolds(Eq(MakeNullRefList(600))));
+}
+
+// Returns a copy of the test module archive in which the bytecode of the
+// exported function |function_name| fails verification.
+// The returned storage must be freed with iree_allocator_free_aligned.
+static iree_byte_span_t MakeMalformedArchive(const char* function_name) {
+  const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+  void* storage = nullptr;
+  IREE_CHECK_OK(iree_allocator_malloc_aligned(
+      iree_allocator_system(), module_file_toc->size,
+      IREE_VM_ARCHIVE_SEGMENT_ALIGNMENT, 0, &storage));
+  memcpy(storage, module_file_toc->data, module_file_toc->size);
+  iree_byte_span_t archive =
+      iree_make_byte_span(storage, module_file_toc->size);
+
+  iree_const_byte_span_t flatbuffer_contents = iree_const_byte_span_empty();
+  iree_host_size_t rodata_offset = 0;
+  IREE_CHECK_OK(iree_vm_bytecode_archive_parse_header(
+      iree_make_const_byte_span(archive.data, archive.data_length),
+      &flatbuffer_contents, &rodata_offset));
+  iree_vm_BytecodeModuleDef_table_t module_def =
+      iree_vm_BytecodeModuleDef_as_root(flatbuffer_contents.data);
+  iree_vm_ExportFunctionDef_vec_t exported_functions =
+      iree_vm_BytecodeModuleDef_exported_functions(module_def);
+  iree_vm_FunctionDescriptor_vec_t function_descriptors =
+      iree_vm_BytecodeModuleDef_function_descriptors(module_def);
+  flatbuffers_uint8_vec_t bytecode_data =
+      iree_vm_BytecodeModuleDef_bytecode_data(module_def);
+  for (size_t i = 0; i < iree_vm_ExportFunctionDef_vec_len(exported_functions);
+       ++i) {
+    iree_vm_ExportFunctionDef_table_t export_def =
+        iree_vm_ExportFunctionDef_vec_at(exported_functions, i);
+    if (strcmp(iree_vm_ExportFunctionDef_local_name(export_def),
+               function_name) != 0) {
+      continue;
+    }
+    iree_vm_FunctionDescriptor_struct_t function_descriptor =
+        iree_vm_FunctionDescriptor_vec_at(
+            function_descriptors,
+            iree_vm_ExportFunctionDef_internal_ordinal(export_def));
+    // Functions must begin with a block marker; the bytecode data lives in
+    // our mutable copy of the archive.
+    uint8_t* function_bytecode = const_cast<uint8_t*>(
+        bytecode_data + function_descriptor->bytecode_offset);
+    function_bytecode[0] = IREE_VM_OP_CORE_Block + 1;
+    return archive;
+  }
+  IREE_CHECK_OK(iree_make_status(IREE_STATUS_NOT_FOUND,
+                                 "function %s not found", function_name));
+  return archive;
+}
+
+// Lazily verified module with one malformed function (FuncIO8).
+class VMBytecodeModuleLazyMalformedTest
+    : public VMBytecodeModuleLazyVerificationTest {
+ protected:
+  void SetUp() override {
+    archive_ = MakeMalformedArchive("FuncIO8");
+    VMBytecodeModuleLazyVerificationTest::SetUp();
+  }
+
+  void TearDown() override {
+    VMBytecodeModuleLazyVerificationTest::TearDown();
+    iree_allocator_free_aligned(iree_allocator_system(), archive_.data);
+  }
+
+  iree_const_byte_span_t GetArchiveContents() override {
+    return iree_make_const_byte_span(archive_.data, archive_.data_length);
+  }
+
+  iree_byte_span_t archive_ = iree_byte_span_empty();
+};
+
+// The malformed function is rejected when first called (and every call after)
+// while the other functions in the module remain usable.
+TEST_F(VMBytecodeModuleLazyMalformedTest, RejectsOnFirstCall) {
+  EXPECT_THAT(RunFunction("FuncIO1", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({1}))));
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THAT(RunFunction("FuncIO8", MakeValueRangeList(0, 7)),
+                StatusIs(StatusCode::kInvalidArgument));
+  }
+  EXPECT_THAT(RunFunction("CallAddOne", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({2}))));
+}
+
+// Verifies functions concurrently during module creation.
+class VMBytecodeModuleParallelVerificationTest : public VMBytecodeModuleTest {
+ protected:
+  void InitializeOptions(iree_vm_bytecode_module_options_t* options) override {
+    options->verification_loop = verification_loop_.loop();
+  }
+
+  ThreadPoolLoop verification_loop_{4};
+};
+
+TEST_F(VMBytecodeModuleParallelVerificationTest, FuncIO8) {
+  EXPECT_EQ(verification_loop_.dispatch_count(), 1);
+  EXPECT_THAT(RunFunction("FuncIO8", MakeValueRangeList(0, 7)),
+              IsOkAndHolds(Eq(MakeValueRangeList(7, 0))));
+  EXPECT_THAT(RunFunction("CallAddOne", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({2}))));
+}
+
+// A malformed function fails module creation when verified in parallel.
+TEST(VMBytecodeModuleParallelVerificationMalformedTest, RejectsModule) {
+  iree_vm_instance_t* instance = nullptr;
+  IREE_ASSERT_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
+                                         iree_allocator_system(), &instance));
+  iree_byte_span_t archive = MakeMalformedArchive("FuncIO8");
+  ThreadPoolLoop verification_loop(4);
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.verification_loop = verification_loop.loop();
+  iree_vm_module_t* module = nullptr;
+  EXPECT_THAT(Status(iree_vm_bytecode_module_create_with_options(
+                  instance, &options,
+                  iree_make_const_byte_span(archive.data, archive.data_length),
+                  iree_allocator_null(), iree_allocator_system(), &module)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_EQ(module, nullptr);
+  EXPECT_EQ(verification_loop.dispatch_count(), 1);
+  iree_allocator_free_aligned(iree_allocator_system(), archive.data);
+  iree_vm_instance_release(instance);
+}
+
+// Fingerprint of the state layout of module_test.mlir: 4 bytes of primitive
+// globals, 2 ref globals, no rodata, and no imports.
+static const uint64_t kModuleTestFingerprint = 0xBD4F306AC7B61613ull;
+
+// Native implementations replacing bytecode functions.
+// They add 100 instead of 1 so that tests can tell which implementation ran.
+typedef struct {
+  int32_t arg0;
+} NativeArgs;
+typedef struct {
+  int32_t ret0;
+} NativeResults;
+
+typedef iree_status_t (*NativeTargetFn)(iree_vm_stack_t* stack, void* module,
+                                        void* module_state, int32_t arg0,
+                                        int32_t* out_ret0);
+
+static iree_status_t NativeShimI32I32(iree_vm_stack_t* stack,
+                                      iree_vm_native_function_flags_t flags,
+                                      iree_byte_span_t args_storage,
+                                      iree_byte_span_t rets_storage,
+                                      NativeTargetFn target_fn, void* module,
+                                      void* module_state) {
+  const NativeArgs* args = (const NativeArgs*)args_storage.data;
+  NativeResults* results = (NativeResults*)rets_storage.data;
+  return target_fn(stack, module, module_state, args->arg0, &results->ret0);
+}
+
+static iree_status_t NativeAddOneHundred(iree_vm_stack_t* stack, void* module,
+                                         void* module_state, int32_t arg0,
+                                         int32_t* out_ret0) {
+  *out_ret0 = arg0 + 100;
+  return iree_ok_status();
+}
+
+static const iree_vm_bytecode_native_function_descriptor_t kNativeFunctions[] =
+    {
+        {iree_make_cstring_view("FuncIO1"), iree_make_cstring_view("0i_i"),
+         {(iree_vm_native_function_shim_t)NativeShimI32I32,
+          (iree_vm_native_function_target_t)NativeAddOneHundred}},
+        {iree_make_cstring_view("AddOne"), iree_make_cstring_view("0i_i"),
+         {(iree_vm_native_function_shim_t)NativeShimI32I32,
+          (iree_vm_native_function_target_t)NativeAddOneHundred}},
+};
+
+static const iree_vm_bytecode_native_library_t kNativeLibrary = {
+    IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST,
+    iree_make_cstring_view("bytecode_module_test"),
+    kModuleTestFingerprint,
+    IREE_ARRAYSIZE(kNativeFunctions),
+    kNativeFunctions,
+};
+
+class VMBytecodeModuleNativeLibraryTest : public VMBytecodeModuleTest {
+ protected:
+  void InitializeOptions(iree_vm_bytecode_module_options_t* options) override {
+    options->native_library = &kNativeLibrary;
+  }
+};
+
+TEST_F(VMBytecodeModuleTest, CallAddOne) {
+  EXPECT_THAT(RunFunction("CallAddOne", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({2}))));
+}
+
+// Exported functions with native implementations are called directly.
+TEST_F(VMBytecodeModuleNativeLibraryTest, Export) {
+  EXPECT_THAT(RunFunction("FuncIO1", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({101}))));
+}
+
+// Internal functions with native implementations are called from bytecode.
+TEST_F(VMBytecodeModuleNativeLibraryTest, InternalCall) {
+  EXPECT_THAT(RunFunction("CallAddOne", MakeValuesList({1})),
+              IsOkAndHolds(Eq(MakeValuesList({101}))));
+}
+
+// Functions without native implementations are interpreted.
+TEST_F(VMBytecodeModuleNativeLibraryTest, Interpreted) {
+  EXPECT_THAT(RunFunction("FuncIO8", MakeValueRangeList(0, 7)),
+              IsOkAndHolds(Eq(MakeValueRangeList(7, 0))));
+}
+
+// Native implementations of functions that access the module state.
+// They add 10 instead of 1 so that tests can tell which implementation ran.
+typedef iree_status_t (*NativeTargetVFn)(iree_vm_stack_t* stack, void* module,
+                                         void* module_state, int32_t* out_ret0);
+
+static iree_status_t NativeShimVI32(iree_vm_stack_t* stack,
+                                    iree_vm_native_function_flags_t flags,
+                                    iree_byte_span_t args_storage,
+                                    iree_byte_span_t rets_storage,
+                                    NativeTargetVFn target_fn, void* module,
+                                    void* module_state) {
+  NativeResults* results = (NativeResults*)rets_storage.data;
+  return target_fn(stack, module, module_state, &results->ret0);
+}
+
+static iree_status_t NativeIncrementCounter(iree_vm_stack_t* stack,
+                                            void* module, void* module_state,
+                                            int32_t* out_ret0) {
+  // @counter is the only primitive global and is at byte offset 0.
+  iree_byte_span_t storage = iree_byte_span_empty();
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_native_environment()->global_storage(
+      module_state, &storage));
+  int32_t value = 0;
+  memcpy(&value, storage.data, sizeof(value));
+  value += 10;
+  memcpy(storage.data, &value, sizeof(value));
+  *out_ret0 = value;
+  return iree_ok_status();
+}
+
+static iree_status_t NativeIncrementScratch(iree_vm_stack_t* stack,
+                                            void* module, void* module_state,
+                                            int32_t* out_ret0) {
+  // @scratch is the first ref global and has ordinal 0.
+  iree_vm_ref_t* scratch_ref = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_native_environment()->global_ref(
+      module_state, 0, &scratch_ref));
+  iree_vm_buffer_t* scratch = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(*scratch_ref, &scratch));
+  uint8_t value = 0;
+  IREE_RETURN_IF_ERROR(
+      iree_vm_buffer_read_elements(scratch, 0, &value, 1, sizeof(value)));
+  value += 10;
+  IREE_RETURN_IF_ERROR(
+      iree_vm_buffer_write_elements(&value, scratch, 0, 1, sizeof(value)));
+  *out_ret0 = value;
+  return iree_ok_status();
+}
+
+static const iree_vm_bytecode_native_function_descriptor_t
+    kNativeStateFunctions[] = {
+        {iree_make_cstring_view("IncrementCounter"),
+         iree_make_cstring_view("0v_i"),
+         {(iree_vm_native_function_shim_t)NativeShimVI32,
+          (iree_vm_native_function_target_t)NativeIncrementCounter}},
+        {iree_make_cstring_view("IncrementScratch"),
+         iree_make_cstring_view("0v_i"),
+         {(iree_vm_native_function_shim_t)NativeShimVI32,
+          (iree_vm_native_function_target_t)NativeIncrementScratch}},
+};
+
+static const iree_vm_bytecode_native_library_t kNativeStateLibrary = {
+    IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST,
+    iree_make_cstring_view("bytecode_module_test"),
+    kModuleTestFingerprint,
+    IREE_ARRAYSIZE(kNativeStateFunctions),
+    kNativeStateFunctions,
+};
+
+class VMBytecodeModuleNativeStateTest : public VMBytecodeModuleTest {
+ protected:
+  void InitializeOptions(iree_vm_bytecode_module_options_t* options) override {
+    options->native_library = &kNativeStateLibrary;
+  }
+};
+
+// Native implementations read and write primitive globals.
+TEST_F(VMBytecodeModuleNativeStateTest, PrimitiveGlobal) {
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({110}))));
+  EXPECT_THAT(RunFunction("IncrementCounter", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({120}))));
+}
+
+// Native implementations access ref globals set by the bytecode initializer.
+TEST_F(VMBytecodeModuleNativeStateTest, RefGlobal) {
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({10}))));
+  EXPECT_THAT(RunFunction("IncrementScratch", std::vector<iree_vm_value_t>()),
+              IsOkAndHolds(Eq(MakeValuesList({20}))));
+}
+
+// Counts the number of times the native library is freed.
+static iree_status_t CountingLibraryAllocatorCtl(
+    void* self, iree_allocator_command_t command, const void* params,
+    void** inout_ptr) {
+  if (command == IREE_ALLOCATOR_COMMAND_FREE) ++*(int*)self;
+  return iree_ok_status();
+}
+
+// The module owns the native library once it has been created.
+TEST(VMBytecodeModuleNativeLibraryBindingTest, OwnershipOnSuccess) {
+  iree_vm_instance_t* instance = nullptr;
+  IREE_ASSERT_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
+                                         iree_allocator_system(), &instance));
+  int free_count = 0;
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.native_library = &kNativeLibrary;
+  options.native_library_allocator = {&free_count,
+                                      CountingLibraryAllocatorCtl};
+  const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+  iree_vm_module_t* module = nullptr;
+  IREE_ASSERT_OK(iree_vm_bytecode_module_create_with_options(
+      instance, &options,
+      iree_const_byte_span_t{
+          reinterpret_cast<const uint8_t*>(module_file_toc->data),
+          static_cast<iree_host_size_t>(module_file_toc->size)},
+      iree_allocator_null(), iree_allocator_system(), &module));
+  EXPECT_EQ(free_count, 0);
+  iree_vm_module_release(module);
+  EXPECT_EQ(free_count, 1);
+  iree_vm_instance_release(instance);
+}
+
+// Ownership of the native library remains with the caller if module creation
+// fails.
+TEST(VMBytecodeModuleNativeLibraryBindingTest, MismatchedCallingConvention) {
+  iree_vm_instance_t* instance = nullptr;
+  IREE_ASSERT_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
+                                         iree_allocator_system(), &instance));
+  const iree_vm_bytecode_native_function_descriptor_t functions[] = {
+      {iree_make_cstring_view("FuncIO1"), iree_make_cstring_view("0I_I"),
+       {(iree_vm_native_function_shim_t)NativeShimI32I32,
+        (iree_vm_native_function_target_t)NativeAddOneHundred}},
+  };
+  iree_vm_bytecode_native_library_t library = kNativeLibrary;
+  library.function_count = IREE_ARRAYSIZE(functions);
+  library.functions = functions;
+  int free_count = 0;
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.native_library = &library;
+  options.native_library_allocator = {&free_count,
+                                      CountingLibraryAllocatorCtl};
+  const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+  iree_vm_module_t* module = nullptr;
+  EXPECT_THAT(Status(iree_vm_bytecode_module_create_with_options(
+                  instance, &options,
+                  iree_const_byte_span_t{
+                      reinterpret_cast<const uint8_t*>(module_file_toc->data),
+                      static_cast<iree_host_size_t>(module_file_toc->size)},
+                  iree_allocator_null(), iree_allocator_system(), &module)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_EQ(module, nullptr);
+  EXPECT_EQ(free_count, 0);
+  iree_vm_instance_release(instance);
+}
+
+// Libraries produced for a module with a different state layout are rejected
+// even if the module name and calling conventions match.
+TEST(VMBytecodeModuleNativeLibraryBindingTest, MismatchedFingerprint) {
+  iree_vm_instance_t* instance = nullptr;
+  IREE_ASSERT_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
+                                         iree_allocator_system(), &instance));
+  iree_vm_bytecode_native_library_t library = kNativeStateLibrary;
+  library.module_fingerprint = kModuleTestFingerprint + 1;
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.native_library = &library;
+  const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+  iree_vm_module_t* module = nullptr;
+  EXPECT_THAT(Status(iree_vm_bytecode_module_create_with_options(
+                  instance, &options,
+                  iree_const_byte_span_t{
+                      reinterpret_cast<const uint8_t*>(module_file_toc->data),
+                      static_cast<iree_host_size_t>(module_file_toc->size)},
+                  iree_allocator_null(), iree_allocator_system(), &module)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_EQ(module, nullptr);
+  iree_vm_instance_release(instance);
+}
+
 }  // namespace
@@ -11,6 +11,60 @@ vm.module @bytecode_module_test {
     vm.return %0 : i32
   }
 
+  // Tests calls to internal functions from bytecode.
+  vm.export @CallAddOne
+  vm.func @CallAddOne(%arg0: i32) -> i32 {
+    %0 = vm.call @AddOne(%arg0) : (i32) -> i32
+    vm.return %0 : i32
+  }
+  vm.func private @AddOne(%arg0: i32) -> i32 attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %0 = vm.add.i32 %arg0, %c1 : i32
+    vm.return %0 : i32
+  }
+
+  // Tests that mutable globals are isolated between forked contexts.
+  vm.global.i32 private mutable @counter = 100 : i32
+  vm.export @IncrementCounter
+  vm.func @IncrementCounter() -> i32 {
+    %0 = vm.global.load.i32 @counter : i32
+    %c1 = vm.const.i32 1
+    %1 = vm.add.i32 %0, %c1 : i32
+    vm.global.store.i32 %1, @counter : i32
+    vm.return %1 : i32
+  }
+
+  // Tests that mutable buffers referenced by globals are isolated between forked
+  // contexts and that globals referencing the same buffer still do after
+  // forking.
+  vm.global.ref private mutable @scratch : !vm.buffer
+  vm.global.ref private mutable @scratch_alias : !vm.buffer
+  vm.initializer {
+    %c1 = vm.const.i64 1
+    %alignment = vm.const.i32 16
+    %buf = vm.buffer.alloc %c1, %alignment : !vm.buffer
+    vm.global.store.ref %buf, @scratch : !vm.buffer
+    vm.global.store.ref %buf, @scratch_alias : !vm.buffer
+    vm.return
+  }
+  vm.export @IncrementScratch
+  vm.func @IncrementScratch() -> i32 {
+    %buf = vm.global.load.ref @scratch : !vm.buffer
+    %c0 = vm.const.i64 0
+    %0 = vm.buffer.load.i8.u %buf[%c0] : !vm.buffer -> i32
+    %c1 = vm.const.i32 1
+    %1 = vm.add.i32 %0, %c1 : i32
+    vm.buffer.store.i8 %1, %buf[%c0] : i32 -> !vm.buffer
+    vm.return %1 : i32
+  }
+  vm.export @ReadScratchAlias
+  vm.func @ReadScratchAlias() -> i32 {
+    %buf = vm.global.load.ref @scratch_alias : !vm.buffer
+    %c0 = vm.const.i64 0
+    %0 = vm.buffer.load.i8.u %buf[%c0] : !vm.buffer -> i32
+    vm.return %0 : i32
+  }
+
   // Tests a reasonable set of arguments and results.
   vm.export @FuncIO8
   vm.func @FuncIO8(%0: i32, %1: i32, %2: i32, %3: i32, %4: i32, %5: i32, %6: i32, %7: i32) -> (i32, i32, i32, i32, i32, i32, i32, i32) {
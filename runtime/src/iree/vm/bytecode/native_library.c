@@ -0,0 +1,100 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/vm/bytecode/native_library.h"
+
+#include "iree/base/internal/dynamic_library.h"
+
+// A native library loaded from a shared library.
+// The library structures live in the shared library and remain valid until
+// it is unloaded.
+typedef struct iree_vm_bytecode_native_library_file_t {
+  // Allocator this file was allocated with and must be freed with.
+  iree_allocator_t host_allocator;
+  // Loaded system library exporting the native library.
+  iree_dynamic_library_t* handle;
+  // Native library returned from the query function.
+  const iree_vm_bytecode_native_library_t* library;
+} iree_vm_bytecode_native_library_file_t;
+
+static void iree_vm_bytecode_native_library_file_free(
+    iree_vm_bytecode_native_library_file_t* file) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_dynamic_library_release(file->handle);
+  iree_allocator_free(file->host_allocator, file);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_status_t iree_vm_bytecode_native_library_file_allocator_ctl(
+    void* self, iree_allocator_command_t command, const void* params,
+    void** inout_ptr) {
+  if (command != IREE_ALLOCATOR_COMMAND_FREE) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "native library deallocator must only be used to "
+                            "deallocate native libraries");
+  }
+  iree_vm_bytecode_native_library_file_t* file =
+      (iree_vm_bytecode_native_library_file_t*)self;
+  if (file->library != *inout_ptr) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "only the loaded native library is valid");
+  }
+  iree_vm_bytecode_native_library_file_free(file);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_native_library_load_from_file(
+    iree_string_view_t path, iree_allocator_t host_allocator,
+    const iree_vm_bytecode_native_library_t** out_library,
+    iree_allocator_t* out_library_allocator) {
+  IREE_ASSERT_ARGUMENT(out_library);
+  IREE_ASSERT_ARGUMENT(out_library_allocator);
+  *out_library = NULL;
+  *out_library_allocator = iree_allocator_null();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_TEXT(z0, path.data, path.size);
+
+  iree_vm_bytecode_native_library_file_t* file = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*file), (void**)&file));
+  file->host_allocator = host_allocator;
+
+  // Try to load the library from file using the system loader.
+  char path_str[2048] = {0};
+  iree_string_view_to_cstring(path, path_str, sizeof(path_str));
+  iree_status_t status = iree_dynamic_library_load_from_file(
+      path_str, IREE_DYNAMIC_LIBRARY_FLAG_NONE, host_allocator, &file->handle);
+
+  // Query the library for the native function table.
+  iree_vm_bytecode_native_library_query_fn_t query_fn = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_dynamic_library_lookup_symbol(
+        file->handle, IREE_VM_BYTECODE_NATIVE_LIBRARY_EXPORT_NAME,
+        (void**)&query_fn);
+  }
+  if (iree_status_is_ok(status)) {
+    file->library = query_fn(IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST,
+                             iree_vm_bytecode_native_environment());
+    if (!file->library) {
+      status = iree_make_status(
+          IREE_STATUS_UNIMPLEMENTED,
+          "native library `%.*s` does not support version %08X",
+          (int)path.size, path.data,
+          IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_LATEST);
+    }
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_library = file->library;
+    out_library_allocator->self = file;
+    out_library_allocator->ctl =
+        iree_vm_bytecode_native_library_file_allocator_ctl;
+  } else {
+    iree_vm_bytecode_native_library_file_free(file);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
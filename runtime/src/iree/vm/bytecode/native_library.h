@@ -0,0 +1,39 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_VM_BYTECODE_NATIVE_LIBRARY_H_
+#define IREE_VM_BYTECODE_NATIVE_LIBRARY_H_
+
+#include "iree/base/api.h"
+#include "iree/vm/bytecode/module.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Loads the native function library exported from the shared library at
+// |path| for use with iree_vm_bytecode_module_options_t::native_library.
+// The library is queried with the exported function named
+// IREE_VM_BYTECODE_NATIVE_LIBRARY_EXPORT_NAME.
+//
+// |out_library_allocator| must be used to free |out_library| when it is no
+// longer required and can be passed directly to the module options in order
+// to have the module unload the shared library when it is destroyed. As with
+// the module archive the module only takes ownership if its creation succeeds
+// and otherwise the caller must free the library with the allocator.
+//
+// If loading fails the shared library is unloaded, |out_library| is NULL, and
+// there is nothing for the caller to free.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_native_library_load_from_file(
+    iree_string_view_t path, iree_allocator_t host_allocator,
+    const iree_vm_bytecode_native_library_t** out_library,
+    iree_allocator_t* out_library_allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_VM_BYTECODE_NATIVE_LIBRARY_H_
@@ -0,0 +1,152 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/vm/bytecode/native_library.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "iree/base/api.h"
+#include "iree/base/internal/file_io.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/vm/api.h"
+#include "iree/vm/bytecode/module.h"
+#include "iree/vm/bytecode/module_test_module_c.h"
+#include "iree/vm/bytecode/native_library_test_library_embed.h"
+
+namespace {
+
+using iree::Status;
+using iree::StatusCode;
+using iree::testing::status::StatusIs;
+
+class VMBytecodeNativeLibraryTest : public ::testing::Test {
+ public:
+  static std::string GetTempFilename(const char* suffix) {
+    static int unique_id = 0;
+    char* test_tmpdir = getenv("TEST_TMPDIR");
+    if (!test_tmpdir) {
+      test_tmpdir = getenv("TMPDIR");
+    }
+    if (!test_tmpdir) {
+      test_tmpdir = getenv("TEMP");
+    }
+    if (!test_tmpdir) {
+      std::cerr << "TEST_TMPDIR/TMPDIR/TEMP not defined\n";
+      exit(1);
+    }
+    return test_tmpdir + std::string("/iree_test_") +
+           std::to_string(unique_id++) + suffix;
+  }
+
+  static void SetUpTestCase() {
+    // The test library is embedded in the test binary and written out to a
+    // temp file for loading; see iree/base/testing/dynamic_library_test.cc.
+#if defined(IREE_PLATFORM_WINDOWS)
+    static constexpr const char* ext = ".dll";
+#else
+    static constexpr const char* ext = ".so";
+#endif
+    library_temp_path_ = GetTempFilename(ext);
+
+    const struct iree_file_toc_t* file_toc =
+        native_library_test_library_create();
+    IREE_ASSERT_OK(iree_file_write_contents(
+        library_temp_path_.c_str(),
+        iree_make_const_byte_span(file_toc->data, file_toc->size)));
+  }
+
+ protected:
+  virtual void SetUp() {
+    IREE_ASSERT_OK(iree_vm_instance_create(
+        IREE_VM_TYPE_CAPACITY_DEFAULT, iree_allocator_system(), &instance_));
+  }
+
+  virtual void TearDown() { iree_vm_instance_release(instance_); }
+
+  static iree_const_byte_span_t GetArchiveContents() {
+    const auto* module_file_toc = iree_vm_bytecode_module_test_module_create();
+    return iree_const_byte_span_t{
+        reinterpret_cast<const uint8_t*>(module_file_toc->data),
+        static_cast<iree_host_size_t>(module_file_toc->size)};
+  }
+
+  static std::string library_temp_path_;
+  iree_vm_instance_t* instance_ = nullptr;
+};
+
+std::string VMBytecodeNativeLibraryTest::library_temp_path_;
+
+// Loads the library and runs its native implementation as part of the module.
+// The module takes ownership of the library and unloads it when destroyed.
+TEST_F(VMBytecodeNativeLibraryTest, LoadAndCall) {
+  const iree_vm_bytecode_native_library_t* library = nullptr;
+  iree_allocator_t library_allocator = iree_allocator_null();
+  IREE_ASSERT_OK(iree_vm_bytecode_native_library_load_from_file(
+      iree_make_cstring_view(library_temp_path_.c_str()),
+      iree_allocator_system(), &library, &library_allocator));
+  ASSERT_NE(library, nullptr);
+  EXPECT_EQ(library->function_count, 1);
+
+  iree_vm_bytecode_module_options_t options;
+  iree_vm_bytecode_module_options_initialize(&options);
+  options.native_library = library;
+  options.native_library_allocator = library_allocator;
+  iree_vm_module_t* module = nullptr;
+  IREE_ASSERT_OK(iree_vm_bytecode_module_create_with_options(
+      instance_, &options, GetArchiveContents(), iree_allocator_null(),
+      iree_allocator_system(), &module));
+
+  iree_vm_context_t* context = nullptr;
+  IREE_ASSERT_OK(iree_vm_context_create_with_modules(
+      instance_, IREE_VM_CONTEXT_FLAG_NONE, 1, &module,
+      iree_allocator_system(), &context));
+  iree_vm_function_t function;
+  IREE_ASSERT_OK(iree_vm_module_lookup_function_by_name(
+      module, IREE_VM_FUNCTION_LINKAGE_EXPORT,
+      iree_make_cstring_view("IncrementCounter"), &function));
+  iree_vm_list_t* outputs = nullptr;
+  IREE_ASSERT_OK(iree_vm_list_create(iree_vm_make_undefined_type_def(), 1,
+                                     iree_allocator_system(), &outputs));
+  IREE_ASSERT_OK(iree_vm_invoke(context, function,
+                                IREE_VM_INVOCATION_FLAG_NONE,
+                                /*policy=*/nullptr, /*inputs=*/nullptr,
+                                outputs, iree_allocator_system()));
+  iree_vm_value_t result;
+  IREE_ASSERT_OK(iree_vm_list_get_value(outputs, 0, &result));
+  EXPECT_EQ(result.i32, 110);
+
+  iree_vm_list_release(outputs);
+  iree_vm_context_release(context);
+  iree_vm_module_release(module);
+}
+
+// Libraries not handed to a module are freed with the returned allocator.
+TEST_F(VMBytecodeNativeLibraryTest, LoadAndFree) {
+  const iree_vm_bytecode_native_library_t* library = nullptr;
+  iree_allocator_t library_allocator = iree_allocator_null();
+  IREE_ASSERT_OK(iree_vm_bytecode_native_library_load_from_file(
+      iree_make_cstring_view(library_temp_path_.c_str()),
+      iree_allocator_system(), &library, &library_allocator));
+  ASSERT_NE(library, nullptr);
+  iree_allocator_free(library_allocator, (void*)library);
+}
+
+// Failing to load leaves nothing for the caller to free.
+TEST_F(VMBytecodeNativeLibraryTest, LoadMissingFile) {
+  const iree_vm_bytecode_native_library_t* library = nullptr;
+  iree_allocator_t library_allocator = iree_allocator_null();
+  EXPECT_THAT(Status(iree_vm_bytecode_native_library_load_from_file(
+                  iree_make_cstring_view("library_that_does_not_exist.so"),
+                  iree_allocator_system(), &library, &library_allocator)),
+              StatusIs(StatusCode::kNotFound));
+  EXPECT_EQ(library, nullptr);
+  EXPECT_EQ(library_allocator.ctl, nullptr);
+}
+
+}  // namespace
@@ -0,0 +1,78 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Native library for module_test.mlir loaded from a shared library.
+// This must not depend on the runtime: all access to the module state goes
+// through the environment provided by the query function.
+
+#include <string.h>
+
+#include "iree/vm/bytecode/module.h"
+
+#if defined(_WIN32)
+#define IREE_SYM_EXPORT __declspec(dllexport)
+#else
+#define IREE_SYM_EXPORT __attribute__((visibility("default")))
+#endif  // _WIN32
+
+static const iree_vm_bytecode_native_environment_t* environment = NULL;
+
+typedef struct {
+  int32_t ret0;
+} results_t;
+
+typedef iree_status_t (*call_v_i32_t)(iree_vm_stack_t* stack, void* module,
+                                      void* module_state, int32_t* out_ret0);
+
+static iree_status_t call_shim_v_i32(iree_vm_stack_t* stack,
+                                     iree_vm_native_function_flags_t flags,
+                                     iree_byte_span_t args_storage,
+                                     iree_byte_span_t rets_storage,
+                                     call_v_i32_t target_fn, void* module,
+                                     void* module_state) {
+  results_t* results = (results_t*)rets_storage.data;
+  return target_fn(stack, module, module_state, &results->ret0);
+}
+
+// Replaces @IncrementCounter with one that adds 10 instead of 1.
+static iree_status_t increment_counter(iree_vm_stack_t* stack, void* module,
+                                       void* module_state, int32_t* out_ret0) {
+  // @counter is the only primitive global and is at byte offset 0.
+  iree_byte_span_t storage = {NULL, 0};
+  iree_status_t status = environment->global_storage(module_state, &storage);
+  if (!iree_status_is_ok(status)) return status;
+  int32_t value = 0;
+  memcpy(&value, storage.data, sizeof(value));
+  value += 10;
+  memcpy(storage.data, &value, sizeof(value));
+  *out_ret0 = value;
+  return iree_ok_status();
+}
+
+static const iree_vm_bytecode_native_function_descriptor_t functions[] = {
+    {{"IncrementCounter", sizeof("IncrementCounter") - 1},
+     {"0v_i", sizeof("0v_i") - 1},
+     {(iree_vm_native_function_shim_t)call_shim_v_i32,
+      (iree_vm_native_function_target_t)increment_counter}},
+};
+
+static const iree_vm_bytecode_native_library_t library = {
+    IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_0_1,
+    {"bytecode_module_test", sizeof("bytecode_module_test") - 1},
+    // 4 bytes of primitive globals, 2 ref globals, no rodata, and no imports.
+    0xBD4F306AC7B61613ull,
+    sizeof(functions) / sizeof(functions[0]),
+    functions,
+};
+
+IREE_SYM_EXPORT const iree_vm_bytecode_native_library_t*
+iree_vm_bytecode_native_library_query(
+    iree_vm_bytecode_native_library_version_t max_version,
+    const iree_vm_bytecode_native_environment_t* env) {
+  if (max_version < IREE_VM_BYTECODE_NATIVE_LIBRARY_VERSION_0_1) return NULL;
+  environment = env;
+  return &library;
+}
@@ -138,14 +138,14 @@ typedef enum {
   IREE_VM_OP_CORE_MaxI64S = 0x80,
   IREE_VM_OP_CORE_MaxI64U = 0x81,
   IREE_VM_OP_CORE_CastAnyRef = 0x82,
-  IREE_VM_OP_CORE_RSV_0x83,
-  IREE_VM_OP_CORE_RSV_0x84,
-  IREE_VM_OP_CORE_RSV_0x85,
-  IREE_VM_OP_CORE_RSV_0x86,
-  IREE_VM_OP_CORE_RSV_0x87,
-  IREE_VM_OP_CORE_RSV_0x88,
-  IREE_VM_OP_CORE_RSV_0x89,
-  IREE_VM_OP_CORE_RSV_0x8A,
+  IREE_VM_OP_CORE_CondBranchEQI32 = 0x83,
+  IREE_VM_OP_CORE_CondBranchNEI32 = 0x84,
+  IREE_VM_OP_CORE_CondBranchLTI32S = 0x85,
+  IREE_VM_OP_CORE_CondBranchLTI32U = 0x86,
+  IREE_VM_OP_CORE_CondBranchEQI64 = 0x87,
+  IREE_VM_OP_CORE_CondBranchNEI64 = 0x88,
+  IREE_VM_OP_CORE_CondBranchLTI64S = 0x89,
+  IREE_VM_OP_CORE_CondBranchLTI64U = 0x8A,
   IREE_VM_OP_CORE_RSV_0x8B,
   IREE_VM_OP_CORE_RSV_0x8C,
   IREE_VM_OP_CORE_RSV_0x8D,
@@ -397,14 +397,14 @@ typedef enum {
     OPC(0x80, MaxI64S) \
     OPC(0x81, MaxI64U) \
     OPC(0x82, CastAnyRef) \
-    RSV(0x83) \
-    RSV(0x84) \
-    RSV(0x85) \
-    RSV(0x86) \
-    RSV(0x87) \
-    RSV(0x88) \
-    RSV(0x89) \
-    RSV(0x8A) \
+    OPC(0x83, CondBranchEQI32) \
+    OPC(0x84, CondBranchNEI32) \
+    OPC(0x85, CondBranchLTI32S) \
+    OPC(0x86, CondBranchLTI32U) \
+    OPC(0x87, CondBranchEQI64) \
+    OPC(0x88, CondBranchNEI64) \
+    OPC(0x89, CondBranchLTI64S) \
+    OPC(0x8A, CondBranchLTI64U) \
     RSV(0x8B) \
     RSV(0x8C) \
     RSV(0x8D) \
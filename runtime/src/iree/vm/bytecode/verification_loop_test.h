@@ -0,0 +1,137 @@
+// Copyright 2023 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_VM_BYTECODE_VERIFICATION_LOOP_TEST_H_
+#define IREE_VM_BYTECODE_VERIFICATION_LOOP_TEST_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "iree/base/api.h"
+
+namespace iree {
+namespace vm {
+
+// Minimal loop for use as a bytecode module verification loop that only
+// supports iree_loop_dispatch by fanning workgroups out across a fixed pool of
+// threads (including the caller). Dispatches complete before returning so
+// draining is a no-op.
+class ThreadPoolLoop {
+ public:
+  explicit ThreadPoolLoop(int thread_count) {
+    for (int i = 1; i < thread_count; ++i) {
+      workers_.emplace_back([this]() { WorkerMain(); });
+    }
+  }
+
+  ~ThreadPoolLoop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      exiting_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) worker.join();
+  }
+
+  iree_loop_t loop() { return iree_loop_t{this, ThreadPoolLoop::Ctl}; }
+
+  // Total number of dispatches issued to the loop.
+  int dispatch_count() const { return dispatch_count_; }
+
+ private:
+  static iree_status_t Ctl(void* self, iree_loop_command_t command,
+                           const void* params, void** inout_ptr) {
+    switch (command) {
+      case IREE_LOOP_COMMAND_DISPATCH:
+        return reinterpret_cast<ThreadPoolLoop*>(self)->Dispatch(
+            *reinterpret_cast<const iree_loop_dispatch_params_t*>(params));
+      case IREE_LOOP_COMMAND_DRAIN:
+        return iree_ok_status();
+      default:
+        return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                                "unsupported loop command");
+    }
+  }
+
+  iree_status_t Dispatch(const iree_loop_dispatch_params_t& params) {
+    ++dispatch_count_;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      params_ = &params;
+      workgroup_count_ = params.workgroup_count_xyz[0] *
+                         params.workgroup_count_xyz[1] *
+                         params.workgroup_count_xyz[2];
+      next_workgroup_ = 0;
+      pending_workers_ = workers_.size();
+      status_ = iree_ok_status();
+      ++generation_;
+    }
+    work_cv_.notify_all();
+    RunWorkgroups();
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_cv_.wait(lock, [this]() { return pending_workers_ == 0; });
+    }
+    return params.callback.fn(params.callback.user_data, loop(), status_);
+  }
+
+  void RunWorkgroups() {
+    const iree_loop_dispatch_params_t& params = *params_;
+    const uint32_t count_x = params.workgroup_count_xyz[0];
+    const uint32_t count_y = params.workgroup_count_xyz[1];
+    uint32_t i = 0;
+    while ((i = next_workgroup_.fetch_add(1)) < workgroup_count_) {
+      iree_status_t status = params.workgroup_fn(
+          params.callback.user_data, loop(), i % count_x,
+          (i / count_x) % count_y, i / (count_x * count_y));
+      if (!iree_status_is_ok(status)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = iree_status_join(status_, status);
+      }
+    }
+  }
+
+  void WorkerMain() {
+    uint64_t seen_generation = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_cv_.wait(lock, [&]() {
+          return exiting_ || generation_ != seen_generation;
+        });
+        if (exiting_) return;
+        seen_generation = generation_;
+      }
+      RunWorkgroups();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending_workers_ == 0) done_cv_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  bool exiting_ = false;
+  uint64_t generation_ = 0;
+  size_t pending_workers_ = 0;
+  int dispatch_count_ = 0;
+  const iree_loop_dispatch_params_t* params_ = nullptr;
+  uint32_t workgroup_count_ = 0;
+  std::atomic<uint32_t> next_workgroup_ = {0};
+  iree_status_t status_ = iree_ok_status();
+};
+
+}  // namespace vm
+}  // namespace iree
+
+#endif  // IREE_VM_BYTECODE_VERIFICATION_LOOP_TEST_H_
@@ -427,6 +427,30 @@ iree_status_t iree_vm_bytecode_function_verify(
   return status;
 }
 
+iree_status_t iree_vm_bytecode_function_verify_once(
+    iree_vm_bytecode_module_t* module, uint16_t function_ordinal) {
+  IREE_ASSERT(module->function_verified_flags);
+  if (function_ordinal >= module->function_descriptor_count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "invalid function ordinal");
+  }
+  iree_atomic_int32_t* verified_flag =
+      &module->function_verified_flags[function_ordinal];
+  if (IREE_LIKELY(
+          iree_atomic_load_int32(verified_flag, iree_memory_order_acquire))) {
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, function_ordinal);
+  iree_status_t status = iree_vm_bytecode_function_verify(
+      module, function_ordinal, module->allocator);
+  if (iree_status_is_ok(status)) {
+    iree_atomic_store_int32(verified_flag, 1, iree_memory_order_release);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 //===----------------------------------------------------------------------===//
 // Utilities matching the tablegen op encoding scheme
 //===----------------------------------------------------------------------===//
@@ -1548,6 +1572,26 @@ static iree_status_t iree_vm_bytecode_function_verify_bytecode_op(
       verify_state->in_block = 0;  // terminator
     });
 
+#define VERIFY_OP_CORE_COND_BRANCH_CMP(op_name, reg_type) \
+  VERIFY_OP(CORE, op_name, {                               \
+    VM_VerifyOperandReg##reg_type(lhs);                    \
+    VM_VerifyOperandReg##reg_type(rhs);                    \
+    VM_VerifyBranchTarget(true_dest_pc);                   \
+    VM_VerifyBranchOperands(true_operands);                \
+    VM_VerifyBranchTarget(false_dest_pc);                  \
+    VM_VerifyBranchOperands(false_operands);               \
+    verify_state->in_block = 0; /* terminator */           \
+  });
+
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchEQI32, I32);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchNEI32, I32);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32S, I32);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchLTI32U, I32);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchEQI64, I64);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchNEI64, I64);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64S, I64);
+    VERIFY_OP_CORE_COND_BRANCH_CMP(CondBranchLTI64U, I64);
+
     VERIFY_OP(CORE, Call, {
       VM_VerifyFuncAttr(callee_ordinal);
       VM_VerifyVariadicOperandsAny(operands);
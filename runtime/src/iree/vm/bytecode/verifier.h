@@ -35,4 +35,14 @@ iree_status_t iree_vm_bytecode_function_verify(
     iree_vm_bytecode_module_t* module, uint16_t function_ordinal,
     iree_allocator_t scratch_allocator);
 
+// Verifies |function_ordinal| with iree_vm_bytecode_function_verify if it has
+// not already been verified successfully. Requires that the module was created
+// with deferred verification. Failures are not recorded and each call on a
+// function that fails verification will return the failure.
+//
+// Thread-safe: concurrent callers may both verify the same function as the
+// verification is idempotent and only the result is published.
+iree_status_t iree_vm_bytecode_function_verify_once(
+    iree_vm_bytecode_module_t* module, uint16_t function_ordinal);
+
 #endif  // IREE_VM_BYTECODE_VERIFIER_H_
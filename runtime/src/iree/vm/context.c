@@ -291,29 +291,21 @@ static void iree_vm_context_release_modules(iree_vm_context_t* context,
   IREE_TRACE_ZONE_END(z0);
 }
 
-IREE_API_EXPORT iree_status_t iree_vm_context_create(
-    iree_vm_instance_t* instance, iree_vm_context_flags_t flags,
-    iree_allocator_t allocator, iree_vm_context_t** out_context) {
-  return iree_vm_context_create_with_modules(
-      instance, flags, /*module_count=*/0, /*modules=*/NULL, allocator,
-      out_context);
-}
-
-IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
-    iree_vm_instance_t* instance, iree_vm_context_flags_t flags,
-    iree_host_size_t module_count, iree_vm_module_t** modules,
-    iree_allocator_t allocator, iree_vm_context_t** out_context) {
-  IREE_TRACE_ZONE_BEGIN(z0);
-  IREE_ASSERT_ARGUMENT(out_context);
-  *out_context = NULL;
-
+// Allocates an empty context with storage for |module_count| modules.
+// If |module_count| is non-zero the module lists are allocated inline with the
+// context and the context is frozen.
+static iree_status_t iree_vm_context_allocate(iree_vm_instance_t* instance,
+                                              iree_vm_context_flags_t flags,
+                                              iree_host_size_t module_count,
+                                              iree_allocator_t allocator,
+                                              iree_vm_context_t** out_context) {
   iree_host_size_t context_size =
       sizeof(iree_vm_context_t) + sizeof(iree_vm_module_t*) * module_count +
       sizeof(iree_vm_module_state_t*) * module_count;
 
   iree_vm_context_t* context = NULL;
-  IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_allocator_malloc(allocator, context_size, (void**)&context));
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(allocator, context_size, (void**)&context));
   iree_atomic_ref_count_init(&context->ref_count);
   context->instance = instance;
   iree_vm_instance_retain(context->instance);
@@ -334,6 +326,31 @@ IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
   context->list.count = 0;
   context->list.capacity = module_count;
 
+  *out_context = context;
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_context_create(
+    iree_vm_instance_t* instance, iree_vm_context_flags_t flags,
+    iree_allocator_t allocator, iree_vm_context_t** out_context) {
+  return iree_vm_context_create_with_modules(
+      instance, flags, /*module_count=*/0, /*modules=*/NULL, allocator,
+      out_context);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
+    iree_vm_instance_t* instance, iree_vm_context_flags_t flags,
+    iree_host_size_t module_count, iree_vm_module_t** modules,
+    iree_allocator_t allocator, iree_vm_context_t** out_context) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_ASSERT_ARGUMENT(out_context);
+  *out_context = NULL;
+
+  iree_vm_context_t* context = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_vm_context_allocate(instance, flags, module_count, allocator,
+                                   &context));
+
   iree_status_t register_status =
       iree_vm_context_register_modules(context, module_count, modules);
   if (!iree_status_is_ok(register_status)) {
@@ -347,6 +364,92 @@ IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
   return iree_ok_status();
 }
 
+IREE_API_EXPORT iree_status_t iree_vm_context_fork(
+    const iree_vm_context_t* parent, iree_allocator_t allocator,
+    iree_vm_context_t** out_context) {
+  IREE_ASSERT_ARGUMENT(parent);
+  IREE_ASSERT_ARGUMENT(out_context);
+  *out_context = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_host_size_t module_count = parent->list.count;
+  iree_vm_context_t* context = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_vm_context_allocate(parent->instance, parent->flags,
+                                   module_count, allocator, &context));
+  if (!module_count) {
+    *out_context = context;
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+
+  // VM stack used to call into __init methods of modules that cannot fork.
+  IREE_VM_INLINE_STACK_INITIALIZE(
+      stack,
+      context->flags & IREE_VM_CONTEXT_FLAG_TRACE_EXECUTION
+          ? IREE_VM_INVOCATION_FLAG_TRACE_EXECUTION
+          : IREE_VM_INVOCATION_FLAG_NONE,
+      iree_vm_context_state_resolver(context), context->allocator);
+
+  // Modules are processed in registration order so that any module that needs
+  // to be initialized from scratch can resolve imports against and call into
+  // the modules preceding it.
+  iree_status_t status = iree_ok_status();
+  iree_host_size_t i = 0;
+  for (i = 0; i < module_count; ++i) {
+    iree_vm_module_t* module = parent->list.modules[i];
+    context->list.modules[i] = module;
+    context->list.module_states[i] = NULL;
+
+    iree_vm_module_retain(module);
+
+    iree_vm_module_state_t* module_state = NULL;
+    if (module->fork_state) {
+      // Forked states carry over their resolved imports and initialized
+      // globals from the parent.
+      status = module->fork_state(module->self, parent->list.module_states[i],
+                                  context->allocator, &module_state);
+      if (!iree_status_is_ok(status)) break;
+      context->list.module_states[i] = module_state;
+      ++context->list.count;
+      continue;
+    }
+
+    // Fallback to allocating and initializing the module as if registering.
+    status =
+        module->alloc_state(module->self, context->allocator, &module_state);
+    if (!iree_status_is_ok(status)) break;
+    context->list.module_states[i] = module_state;
+    status =
+        iree_vm_context_resolve_module_imports(context, module, module_state);
+    if (!iree_status_is_ok(status)) {
+      iree_string_view_t module_name = iree_vm_module_name(module);
+      (void)module_name;
+      status = iree_status_annotate_f(status, "resolving module '%.*s' imports",
+                                      (int)module_name.size, module_name.data);
+      break;
+    }
+    ++context->list.count;
+    status = iree_vm_context_run_function(context, stack, module,
+                                          iree_make_cstring_view("__init"));
+    if (!iree_status_is_ok(status)) break;
+  }
+
+  iree_vm_stack_deinitialize(stack);
+
+  if (!iree_status_is_ok(status)) {
+    iree_vm_context_release_modules(context, 0, i);
+    context->list.count = 0;
+    iree_vm_context_destroy(context);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  *out_context = context;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
 static void iree_vm_context_destroy(iree_vm_context_t* context) {
   if (!context) return;
 
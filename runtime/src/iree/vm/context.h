@@ -69,6 +69,29 @@ IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
     iree_host_size_t module_count, iree_vm_module_t** modules,
     iree_allocator_t allocator, iree_vm_context_t** out_context);
 
+// Creates a new context as a copy of an initialized |parent| context.
+// The forked context has the same modules registered in the same order and
+// begins with a snapshot of the module state in |parent| without running any
+// module initializers. Modules implementing `iree_vm_module_t::fork_state`
+// share their immutable state with the parent (e.g. bytecode modules copy
+// their primitive globals, clone the mutable VM buffers and lists referenced by
+// their ref globals along with objects whose type descriptor provides a clone
+// function, and share all other referenced objects) while other modules have
+// their state allocated and initialized from scratch. Objects referenced from
+// multiple globals are cloned once so that they remain shared within the fork.
+// After forking the two contexts are independent and changes to globals in one
+// are not visible in the other. Types that cannot be cloned may fail the fork
+// (such as HAL buffers that cannot be written to from the host) and types
+// without a clone function are shared and observe in-place changes made by
+// either context.
+//
+// |parent| must not be executing while being forked. The forked context is
+// frozen and cannot have additional modules registered.
+// |out_context| must be released by the caller.
+IREE_API_EXPORT iree_status_t iree_vm_context_fork(
+    const iree_vm_context_t* parent, iree_allocator_t allocator,
+    iree_vm_context_t** out_context);
+
 // Retains the given |context| for the caller.
 IREE_API_EXPORT void iree_vm_context_retain(iree_vm_context_t* context);
 
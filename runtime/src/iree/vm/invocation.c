@@ -24,9 +24,8 @@
 static void iree_vm_invoke_release_io_refs(iree_string_view_t cconv_fragment,
                                            iree_byte_span_t storage) {
   if (!storage.data_length) return;
-  if (cconv_fragment.size == 0 || cconv_fragment.data[0] != '0') return;
   uint8_t* p = storage.data;
-  for (iree_host_size_t i = 1; i < cconv_fragment.size; ++i) {
+  for (iree_host_size_t i = 0; i < cconv_fragment.size; ++i) {
     char c = cconv_fragment.data[i];
     switch (c) {
       default:
@@ -269,6 +268,52 @@ static void iree_vm_invoke_fiber_leave(iree_vm_invocation_id_t invocation_id,
 // Synchronous invocation
 //===----------------------------------------------------------------------===//
 
+// Drives an invocation begun with |status| until it completes by synchronously
+// performing any waits on the calling thread. Waits are performed outside of
+// the fiber and the |zi| tick zone, which is reopened after each wait.
+static iree_status_t iree_vm_invoke_run_to_completion(
+    iree_vm_invoke_state_t* state, iree_status_t status,
+    iree_vm_invocation_id_t invocation_id, iree_time_t deadline_ns,
+    iree_zone_id_t* zi) {
+  (void)invocation_id;  // unused when tracing is disabled
+  while (iree_status_is_deferred(status)) {
+    // Grab the wait frame from the stack holding the wait parameters.
+    // This is optional: if an invocation yields for cooperative scheduling
+    // purposes there will not be a wait frame on the stack and we'll just
+    // resume it below.
+    iree_vm_stack_frame_t* current_frame =
+        iree_vm_stack_current_frame(state->stack);
+    if (IREE_UNLIKELY(!current_frame)) {
+      // Unbalanced stack.
+      status = iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                                "unbalanced stack after yield");
+      break;  // bail and don't attempt a resume
+    } else if (current_frame->type == IREE_VM_STACK_FRAME_WAIT) {
+      // Perform the wait operation synchronously.
+      // We do this outside of the fiber to match accounting with async
+      // executors.
+      IREE_TRACE(iree_vm_invoke_fiber_leave(invocation_id, state->stack));
+      IREE_TRACE_ZONE_END(*zi);
+
+      iree_vm_wait_frame_t* wait_frame =
+          (iree_vm_wait_frame_t*)iree_vm_stack_frame_storage(current_frame);
+      status = iree_vm_wait_invoke(state, wait_frame, deadline_ns);
+
+      // Restore tick zone and re-enter the fiber for the resume.
+      IREE_TRACE_ZONE_BEGIN_NAMED(zi_next, "iree_vm_invoke_tick");
+      *zi = zi_next;
+      IREE_TRACE(iree_vm_invoke_fiber_reenter(invocation_id, state->stack));
+      if (!iree_status_is_ok(status)) break;
+    }
+
+    // Resume the invocation after its wait completes (if it wasn't just a
+    // simple yield for cooperation). This may yield again and require another
+    // tick or complete with OK (or an error).
+    status = iree_vm_resume_invoke(state);
+  }
+  return status;
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_invoke(
     iree_vm_context_t* context, iree_vm_function_t function,
     iree_vm_invocation_flags_t flags, const iree_vm_invocation_policy_t* policy,
@@ -301,41 +346,8 @@ IREE_API_EXPORT iree_status_t iree_vm_invoke(
   iree_vm_invoke_state_t state = {0};
   iree_status_t status = iree_vm_begin_invoke(&state, context, function, flags,
                                               policy, inputs, host_allocator);
-  while (iree_status_is_deferred(status)) {
-    // Grab the wait frame from the stack holding the wait parameters.
-    // This is optional: if an invocation yields for cooperative scheduling
-    // purposes there will not be a wait frame on the stack and we'll just
-    // resume it below.
-    iree_vm_stack_frame_t* current_frame =
-        iree_vm_stack_current_frame(state.stack);
-    if (IREE_UNLIKELY(!current_frame)) {
-      // Unbalanced stack.
-      status = iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
-                                "unbalanced stack after yield");
-      break;  // bail and don't attempt a resume
-    } else if (current_frame->type == IREE_VM_STACK_FRAME_WAIT) {
-      // Perform the wait operation synchronously.
-      // We do this outside of the fiber to match accounting with async
-      // executors.
-      IREE_TRACE(iree_vm_invoke_fiber_leave(invocation_id, state.stack));
-      IREE_TRACE_ZONE_END(zi);
-
-      iree_vm_wait_frame_t* wait_frame =
-          (iree_vm_wait_frame_t*)iree_vm_stack_frame_storage(current_frame);
-      status = iree_vm_wait_invoke(&state, wait_frame, deadline_ns);
-
-      // Restore tick zone and re-enter the fiber for the resume.
-      IREE_TRACE_ZONE_BEGIN_NAMED(zi_next, "iree_vm_invoke_tick");
-      zi = zi_next;
-      IREE_TRACE(iree_vm_invoke_fiber_reenter(invocation_id, state.stack));
-      if (!iree_status_is_ok(status)) break;
-    }
-
-    // Resume the invocation after its wait completes (if it wasn't just a
-    // simple yield for cooperation). This may yield again and require another
-    // tick or complete with OK (or an error).
-    status = iree_vm_resume_invoke(&state);
-  }
+  status = iree_vm_invoke_run_to_completion(&state, status, invocation_id,
+                                            deadline_ns, &zi);
 
   // If the invoke process itself was successful we can end the invocation
   // cleanly and get the invocation status as returned by the target function.
@@ -368,6 +380,384 @@ IREE_API_EXPORT iree_status_t iree_vm_invoke(
   return status;
 }
 
+//===----------------------------------------------------------------------===//
+// Prepared synchronous invocation
+//===----------------------------------------------------------------------===//
+
+struct iree_vm_prepared_call_t {
+  iree_allocator_t host_allocator;
+  // Retained context the call is invoked within.
+  iree_vm_context_t* context;
+  iree_vm_function_t function;
+  iree_vm_invocation_flags_t flags;
+  // Calling convention fragments; one type character per argument/result.
+  iree_string_view_t cconv_arguments;
+  iree_string_view_t cconv_results;
+  iree_host_size_t argument_count;
+  iree_host_size_t result_count;
+  // Byte offsets of each argument/result in their respective storage.
+  iree_host_size_t* argument_offsets;
+  iree_host_size_t* result_offsets;
+  // ABI storage passed directly to the callee.
+  iree_byte_span_t arguments;
+  iree_byte_span_t results;
+  // Invocation state holding the VM stack. The stack is initialized once and
+  // reset after each invocation so that any growth is retained.
+  iree_vm_invoke_state_t state;
+};
+
+// Returns the number of values in a non-variadic |cconv_fragment|.
+static iree_host_size_t iree_vm_prepared_call_count_values(
+    iree_string_view_t cconv_fragment) {
+  return cconv_fragment.size > 0
+             ? (cconv_fragment.data[0] == IREE_VM_CCONV_TYPE_VOID
+                    ? 0
+                    : cconv_fragment.size)
+             : 0;
+}
+
+// Populates |out_offsets| with the byte offset of each value in
+// |cconv_fragment| and returns the total storage size required.
+static iree_host_size_t iree_vm_prepared_call_layout_values(
+    iree_string_view_t cconv_fragment, iree_host_size_t* out_offsets) {
+  iree_host_size_t offset = 0;
+  iree_host_size_t count = iree_vm_prepared_call_count_values(cconv_fragment);
+  for (iree_host_size_t i = 0; i < count; ++i) {
+    if (out_offsets) out_offsets[i] = offset;
+    switch (cconv_fragment.data[i]) {
+      case IREE_VM_CCONV_TYPE_I32:
+      case IREE_VM_CCONV_TYPE_F32:
+        offset += sizeof(int32_t);
+        break;
+      case IREE_VM_CCONV_TYPE_I64:
+      case IREE_VM_CCONV_TYPE_F64:
+        offset += sizeof(int64_t);
+        break;
+      case IREE_VM_CCONV_TYPE_REF:
+        offset += sizeof(iree_vm_ref_t);
+        break;
+    }
+  }
+  return offset;
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_allocate(
+    iree_vm_context_t* context, iree_vm_function_t function,
+    iree_vm_invocation_flags_t flags, iree_allocator_t host_allocator,
+    iree_vm_prepared_call_t** out_call) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(out_call);
+  *out_call = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Force tracing if specified on the context.
+  if (iree_vm_context_flags(context) & IREE_VM_CONTEXT_FLAG_TRACE_EXECUTION) {
+    flags |= IREE_VM_INVOCATION_FLAG_TRACE_EXECUTION;
+  }
+
+  iree_vm_function_signature_t signature =
+      iree_vm_function_signature(&function);
+  iree_string_view_t cconv_arguments = iree_string_view_empty();
+  iree_string_view_t cconv_results = iree_string_view_empty();
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_vm_function_call_get_cconv_fragments(
+              &signature, &cconv_arguments, &cconv_results));
+  if (iree_vm_function_call_is_variadic_cconv(cconv_arguments) ||
+      iree_vm_function_call_is_variadic_cconv(cconv_results)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "prepared calls do not support variadic functions");
+  }
+
+  // Allocate the call and all of its storage in a single allocation.
+  iree_host_size_t argument_count =
+      iree_vm_prepared_call_count_values(cconv_arguments);
+  iree_host_size_t result_count =
+      iree_vm_prepared_call_count_values(cconv_results);
+  iree_host_size_t arguments_size =
+      iree_vm_prepared_call_layout_values(cconv_arguments, NULL);
+  iree_host_size_t results_size =
+      iree_vm_prepared_call_layout_values(cconv_results, NULL);
+  iree_host_size_t offsets_size =
+      (argument_count + result_count) * sizeof(iree_host_size_t);
+  iree_host_size_t total_size =
+      iree_host_align(sizeof(iree_vm_prepared_call_t), iree_max_align_t) +
+      iree_host_align(offsets_size, iree_max_align_t) +
+      iree_host_align(arguments_size, iree_max_align_t) + results_size;
+  iree_vm_prepared_call_t* call = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size, (void**)&call));
+  memset(call, 0, total_size);
+  call->host_allocator = host_allocator;
+  call->function = function;
+  call->flags = flags;
+  call->cconv_arguments = cconv_arguments;
+  call->cconv_results = cconv_results;
+  call->argument_count = argument_count;
+  call->result_count = result_count;
+
+  uint8_t* p = (uint8_t*)call + iree_host_align(sizeof(iree_vm_prepared_call_t),
+                                                iree_max_align_t);
+  call->argument_offsets = (iree_host_size_t*)p;
+  call->result_offsets = call->argument_offsets + argument_count;
+  p += iree_host_align(offsets_size, iree_max_align_t);
+  call->arguments = iree_make_byte_span(p, arguments_size);
+  p += iree_host_align(arguments_size, iree_max_align_t);
+  call->results = iree_make_byte_span(p, results_size);
+  iree_vm_prepared_call_layout_values(cconv_arguments, call->argument_offsets);
+  iree_vm_prepared_call_layout_values(cconv_results, call->result_offsets);
+
+  iree_status_t status = iree_vm_stack_initialize(
+      iree_make_byte_span(call->state.stack_storage,
+                          sizeof(call->state.stack_storage)),
+      flags, iree_vm_context_state_resolver(context), host_allocator,
+      &call->state.stack);
+  if (!iree_status_is_ok(status)) {
+    iree_allocator_free(host_allocator, call);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+  call->context = context;
+  iree_vm_context_retain(context);
+  call->state.context = context;
+  call->state.cconv_results = cconv_results;
+  call->state.results = call->results;
+
+  *out_call = call;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT void iree_vm_prepared_call_free(iree_vm_prepared_call_t* call) {
+  if (!call) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_vm_stack_deinitialize(call->state.stack);
+  iree_vm_invoke_release_io_refs(call->cconv_arguments, call->arguments);
+  iree_vm_invoke_release_io_refs(call->cconv_results, call->results);
+  iree_vm_context_release(call->context);
+  iree_allocator_free(call->host_allocator, call);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT iree_host_size_t
+iree_vm_prepared_call_argument_count(const iree_vm_prepared_call_t* call) {
+  IREE_ASSERT_ARGUMENT(call);
+  return call->argument_count;
+}
+
+IREE_API_EXPORT iree_host_size_t
+iree_vm_prepared_call_result_count(const iree_vm_prepared_call_t* call) {
+  IREE_ASSERT_ARGUMENT(call);
+  return call->result_count;
+}
+
+// Returns a pointer to the ABI storage of value |i| in |cconv_fragment| if it
+// has the |expected_type|.
+static iree_status_t iree_vm_prepared_call_lookup_value(
+    iree_string_view_t cconv_fragment, const iree_host_size_t* offsets,
+    iree_host_size_t count, iree_byte_span_t storage, iree_host_size_t i,
+    char expected_type, uint8_t** out_ptr) {
+  if (IREE_UNLIKELY(i >= count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "ordinal %" PRIhsz " out of range (count=%" PRIhsz
+                            ")",
+                            i, count);
+  }
+  if (IREE_UNLIKELY(cconv_fragment.data[i] != expected_type)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "ordinal %" PRIhsz " has type '%c' but '%c' used",
+                            i, cconv_fragment.data[i], expected_type);
+  }
+  *out_ptr = storage.data + offsets[i];
+  return iree_ok_status();
+}
+
+// Returns the calling convention type character for |value_type|.
+static char iree_vm_prepared_call_cconv_type(iree_vm_value_type_t value_type) {
+  switch (value_type) {
+    case IREE_VM_VALUE_TYPE_I32:
+      return IREE_VM_CCONV_TYPE_I32;
+    case IREE_VM_VALUE_TYPE_I64:
+      return IREE_VM_CCONV_TYPE_I64;
+    case IREE_VM_VALUE_TYPE_F32:
+      return IREE_VM_CCONV_TYPE_F32;
+    case IREE_VM_VALUE_TYPE_F64:
+      return IREE_VM_CCONV_TYPE_F64;
+    default:
+      return IREE_VM_CCONV_TYPE_VOID;
+  }
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_value(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    const iree_vm_value_t* value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(value);
+  uint8_t* p = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_prepared_call_lookup_value(
+      call->cconv_arguments, call->argument_offsets, call->argument_count,
+      call->arguments, i, iree_vm_prepared_call_cconv_type(value->type), &p));
+  memcpy(p, value->value_storage,
+         value->type == IREE_VM_VALUE_TYPE_I64 ||
+                 value->type == IREE_VM_VALUE_TYPE_F64
+             ? sizeof(int64_t)
+             : sizeof(int32_t));
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_ref_retain(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    const iree_vm_ref_t* value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(value);
+  uint8_t* p = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_prepared_call_lookup_value(
+      call->cconv_arguments, call->argument_offsets, call->argument_count,
+      call->arguments, i, IREE_VM_CCONV_TYPE_REF, &p));
+  iree_vm_ref_retain((iree_vm_ref_t*)value, (iree_vm_ref_t*)p);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_ref_move(
+    iree_vm_prepared_call_t* call, iree_host_size_t i, iree_vm_ref_t* value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(value);
+  uint8_t* p = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_prepared_call_lookup_value(
+      call->cconv_arguments, call->argument_offsets, call->argument_count,
+      call->arguments, i, IREE_VM_CCONV_TYPE_REF, &p));
+  iree_vm_ref_move(value, (iree_vm_ref_t*)p);
+  return iree_ok_status();
+}
+
+// WARNING: this function cannot have any trace markers that span the begin
+// call; the begin may yield with zones still open.
+IREE_API_EXPORT iree_status_t
+iree_vm_prepared_call_invoke(iree_vm_prepared_call_t* call) {
+  IREE_ASSERT_ARGUMENT(call);
+  iree_vm_invoke_state_t* state = &call->state;
+
+  // Drop any results from the prior invocation the caller did not take.
+  iree_vm_invoke_release_io_refs(call->cconv_results, call->results);
+  memset(call->results.data, 0, call->results.data_length);
+
+  // See iree_vm_invoke; we only use the timeouts specified on waits.
+  iree_time_t deadline_ns =
+      iree_timeout_as_deadline_ns(iree_infinite_timeout());
+
+  // Allocate an invocation ID for tracing.
+  iree_vm_invocation_id_t invocation_id =
+      iree_any_bit_set(call->flags, IREE_VM_INVOCATION_FLAG_TRACE_INLINE)
+          ? 0
+          : iree_vm_invoke_allocate_id(call->context, &call->function);
+  (void)invocation_id;  // unused when tracing is disabled
+
+  IREE_TRACE_ZONE_BEGIN_NAMED(zi, "iree_vm_invoke_tick");
+  IREE_TRACE(iree_vm_invoke_fiber_enter(invocation_id));
+
+  // Call directly with the prepared ABI storage. Refs are moved into the callee
+  // and any that remain (such as those borrowed by native functions) are
+  // released so that the next invocation starts clean.
+  iree_vm_function_call_t function_call = {
+      .function = call->function,
+      .arguments = call->arguments,
+      .results = call->results,
+  };
+  state->status = call->function.module->begin_call(
+      call->function.module->self, state->stack, function_call);
+  iree_vm_invoke_release_io_refs(call->cconv_arguments, call->arguments);
+
+  iree_status_t status = iree_status_is_deferred(state->status)
+                             ? iree_status_from_code(IREE_STATUS_DEFERRED)
+                             : iree_ok_status();
+  status = iree_vm_invoke_run_to_completion(state, status, invocation_id,
+                                            deadline_ns, &zi);
+
+  // Take the invocation result if the invoke process itself succeeded.
+  iree_status_t invoke_status = iree_ok_status();
+  if (iree_status_is_ok(status)) {
+    invoke_status = state->status;
+    state->status = iree_ok_status();
+    if (!iree_status_is_ok(invoke_status)) {
+      invoke_status = IREE_VM_STACK_ANNOTATE_BACKTRACE_IF_ENABLED(
+          state->stack, invoke_status);
+    }
+  } else {
+    iree_status_ignore(state->status);
+    state->status = iree_ok_status();
+  }
+
+  // Pop any frames left on the stack by failures so that it can be reused.
+  // Zones are suspended first to keep them balanced as in iree_vm_end_invoke.
+  iree_vm_stack_suspend_trace_zones(state->stack);
+  iree_vm_stack_reset(state->stack);
+  if (!iree_status_is_ok(status) || !iree_status_is_ok(invoke_status)) {
+    iree_vm_invoke_release_io_refs(call->cconv_results, call->results);
+  }
+
+  IREE_TRACE(iree_vm_invoke_fiber_leave(invocation_id, NULL));
+  IREE_TRACE_ZONE_END(zi);
+
+  return !iree_status_is_ok(invoke_status) ? invoke_status : status;
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_value(
+    const iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_value_t* out_value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(out_value);
+  if (IREE_UNLIKELY(i >= call->result_count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "result %" PRIhsz " out of range (count=%" PRIhsz
+                            ")",
+                            i, call->result_count);
+  }
+  const uint8_t* p = call->results.data + call->result_offsets[i];
+  switch (call->cconv_results.data[i]) {
+    case IREE_VM_CCONV_TYPE_I32:
+      *out_value = iree_vm_value_make_i32(*(const int32_t*)p);
+      return iree_ok_status();
+    case IREE_VM_CCONV_TYPE_I64:
+      *out_value = iree_vm_value_make_i64(*(const int64_t*)p);
+      return iree_ok_status();
+    case IREE_VM_CCONV_TYPE_F32:
+      *out_value = iree_vm_value_make_f32(*(const float*)p);
+      return iree_ok_status();
+    case IREE_VM_CCONV_TYPE_F64:
+      *out_value = iree_vm_value_make_f64(*(const double*)p);
+      return iree_ok_status();
+    default:
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "result %" PRIhsz " is not a primitive value", i);
+  }
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_ref_retain(
+    const iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_ref_t* out_value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(out_value);
+  uint8_t* p = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_prepared_call_lookup_value(
+      call->cconv_results, call->result_offsets, call->result_count,
+      call->results, i, IREE_VM_CCONV_TYPE_REF, &p));
+  iree_vm_ref_retain((iree_vm_ref_t*)p, out_value);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_ref_move(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_ref_t* out_value) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(out_value);
+  uint8_t* p = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_prepared_call_lookup_value(
+      call->cconv_results, call->result_offsets, call->result_count,
+      call->results, i, IREE_VM_CCONV_TYPE_REF, &p));
+  iree_vm_ref_move((iree_vm_ref_t*)p, out_value);
+  return iree_ok_status();
+}
+
 //===----------------------------------------------------------------------===//
 // Asynchronous invocation
 //===----------------------------------------------------------------------===//
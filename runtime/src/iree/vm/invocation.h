@@ -14,6 +14,7 @@
 #include "iree/vm/list.h"
 #include "iree/vm/module.h"
 #include "iree/vm/ref.h"
+#include "iree/vm/value.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +49,100 @@ IREE_API_EXPORT iree_status_t iree_vm_invoke(
     const iree_vm_list_t* inputs, iree_vm_list_t* outputs,
     iree_allocator_t host_allocator);
 
+//===----------------------------------------------------------------------===//
+// Prepared synchronous invocation
+//===----------------------------------------------------------------------===//
+
+// A synchronous call to a single function that can be invoked repeatedly.
+// The function calling convention, argument/result storage, and VM stack are
+// resolved and allocated once when the call is prepared such that subsequent
+// invocations perform no heap allocations (unless the VM stack needs to grow
+// beyond what any prior invocation required). Arguments and results are passed
+// directly in the function ABI storage instead of through iree_vm_list_t and
+// refs may be moved in and out without additional retains.
+//
+// Primitive arguments persist across invocations and only need to be set when
+// they change. Ref arguments are consumed by each invocation and must be set
+// again before the next. Results remain valid until the next invocation or
+// until the call is freed; refs that are not moved out by the caller will be
+// released at that time.
+//
+// Usage:
+//   iree_vm_prepared_call_t* call = NULL;
+//   iree_vm_prepared_call_allocate(context, function, flags, allocator, &call);
+//   for (...) {
+//     iree_vm_prepared_call_set_value(call, 0, &value);
+//     iree_vm_prepared_call_set_ref_move(call, 1, &buffer_ref);
+//     iree_vm_prepared_call_invoke(call);
+//     iree_vm_prepared_call_get_ref_move(call, 0, &result_ref);
+//   }
+//   iree_vm_prepared_call_free(call);
+//
+// Thread-compatible: only one invocation may be in-flight at a time. Use one
+// prepared call per thread to invoke the same function concurrently.
+// Variadic functions are not supported.
+typedef struct iree_vm_prepared_call_t iree_vm_prepared_call_t;
+
+// Prepares a call to |function| in |context| for repeated invocation.
+// |context| is retained for the lifetime of the call. |flags| apply to all
+// invocations made with the call.
+// |out_call| must be freed by the caller with iree_vm_prepared_call_free.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_allocate(
+    iree_vm_context_t* context, iree_vm_function_t function,
+    iree_vm_invocation_flags_t flags, iree_allocator_t host_allocator,
+    iree_vm_prepared_call_t** out_call);
+
+// Frees a prepared |call| and releases any retained arguments and results.
+IREE_API_EXPORT void iree_vm_prepared_call_free(iree_vm_prepared_call_t* call);
+
+// Returns the total number of arguments the function takes.
+IREE_API_EXPORT iree_host_size_t
+iree_vm_prepared_call_argument_count(const iree_vm_prepared_call_t* call);
+
+// Returns the total number of results the function returns.
+IREE_API_EXPORT iree_host_size_t
+iree_vm_prepared_call_result_count(const iree_vm_prepared_call_t* call);
+
+// Sets the primitive argument at ordinal |i| to |value|.
+// The value type must match the function signature exactly.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_value(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    const iree_vm_value_t* value);
+
+// Sets the ref argument at ordinal |i|, retaining |value| until it is consumed
+// by the next invocation.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_ref_retain(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    const iree_vm_ref_t* value);
+
+// Sets the ref argument at ordinal |i|, moving ownership of |value| to the
+// call until it is consumed by the next invocation.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_set_ref_move(
+    iree_vm_prepared_call_t* call, iree_host_size_t i, iree_vm_ref_t* value);
+
+// Synchronously invokes the prepared function with the current arguments.
+// The function will be run to completion and may block on external resources.
+// Results from any prior invocation are released before the function begins.
+IREE_API_EXPORT iree_status_t
+iree_vm_prepared_call_invoke(iree_vm_prepared_call_t* call);
+
+// Gets the primitive result at ordinal |i| from the last invocation.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_value(
+    const iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_value_t* out_value);
+
+// Gets the ref result at ordinal |i| from the last invocation.
+// The ref will be retained and must be released by the caller.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_ref_retain(
+    const iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_ref_t* out_value);
+
+// Gets the ref result at ordinal |i| from the last invocation, transferring
+// ownership to the caller. Subsequent gets of the same result will be null.
+IREE_API_EXPORT iree_status_t iree_vm_prepared_call_get_ref_move(
+    iree_vm_prepared_call_t* call, iree_host_size_t i,
+    iree_vm_ref_t* out_value);
+
 //===----------------------------------------------------------------------===//
 // Asynchronous invocation
 //===----------------------------------------------------------------------===//
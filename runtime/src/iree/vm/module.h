@@ -451,6 +451,20 @@ typedef struct iree_vm_module_t {
   // without first completing prior ones.
   iree_status_t(IREE_API_PTR* resume_call)(void* self, iree_vm_stack_t* stack,
                                            iree_byte_span_t call_results);
+
+  // Optional: allocates module state data as a copy of |parent_state|.
+  // The new state must behave as if it had been allocated, had its imports
+  // resolved, and been initialized identically to |parent_state| but must not
+  // observe any future changes made to |parent_state| (and vice versa).
+  // Immutable resources (executables, constant buffers, etc) may be shared.
+  // Objects the module cannot copy (such as those of types owned by other
+  // modules) may also be shared, in which case in-place changes made to them
+  // through either state are observed by both.
+  // Modules that do not implement this will have their state allocated and
+  // initialized from scratch when a context is forked.
+  iree_status_t(IREE_API_PTR* fork_state)(
+      void* self, iree_vm_module_state_t* parent_state,
+      iree_allocator_t allocator, iree_vm_module_state_t** out_module_state);
 } iree_vm_module_t;
 
 // Initializes the interface of a module handle.
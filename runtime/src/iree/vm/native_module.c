@@ -304,6 +304,20 @@ static void IREE_API_PTR iree_vm_native_module_free_state(
   IREE_ASSERT_EQ(module_state, NULL);
 }
 
+static iree_status_t IREE_API_PTR iree_vm_native_module_fork_state(
+    void* self, iree_vm_module_state_t* parent_state,
+    iree_allocator_t allocator, iree_vm_module_state_t** out_module_state) {
+  iree_vm_native_module_t* module = (iree_vm_native_module_t*)self;
+  *out_module_state = NULL;
+  if (module->user_interface.fork_state) {
+    return module->user_interface.fork_state(module->self, parent_state,
+                                             allocator, out_module_state);
+  }
+  // Stateless modules have nothing to fork.
+  IREE_ASSERT_EQ(parent_state, NULL);
+  return iree_ok_status();
+}
+
 static iree_status_t IREE_API_PTR iree_vm_native_module_resolve_import(
     void* self, iree_vm_module_state_t* module_state, iree_host_size_t ordinal,
     const iree_vm_function_t* function,
@@ -519,6 +533,13 @@ IREE_API_EXPORT iree_status_t iree_vm_native_module_initialize(
       iree_vm_native_module_get_function_attr;
   module->base_interface.alloc_state = iree_vm_native_module_alloc_state;
   module->base_interface.free_state = iree_vm_native_module_free_state;
+  if (module->user_interface.fork_state ||
+      (!module->user_interface.alloc_state &&
+       !module->user_interface.resolve_import)) {
+    // Modules with state must opt-in to forking; otherwise the state will be
+    // allocated and initialized from scratch in forked contexts.
+    module->base_interface.fork_state = iree_vm_native_module_fork_state;
+  }
   module->base_interface.resolve_import = iree_vm_native_module_resolve_import;
   module->base_interface.notify = iree_vm_native_module_notify;
   module->base_interface.begin_call = iree_vm_native_module_begin_call;
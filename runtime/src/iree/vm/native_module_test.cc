@@ -6,11 +6,15 @@
 
 #include "iree/vm/native_module_test.h"
 
+#include <atomic>
+#include <utility>
 #include <vector>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/testing/gtest.h"
 #include "iree/testing/status_matchers.h"
+#include "iree/vm/buffer.h"
 #include "iree/vm/context.h"
 #include "iree/vm/instance.h"
 #include "iree/vm/invocation.h"
@@ -21,6 +25,33 @@
 namespace iree {
 namespace {
 
+// Forwards to the system allocator and counts the allocations made.
+class CountingAllocator {
+ public:
+  iree_allocator_t allocator() { return {this, CountingAllocator::Ctl}; }
+  int allocation_count() const { return allocation_count_.load(); }
+
+ private:
+  static iree_status_t Ctl(void* self, iree_allocator_command_t command,
+                           const void* params, void** inout_ptr) {
+    auto* counting_allocator = reinterpret_cast<CountingAllocator*>(self);
+    if (command != IREE_ALLOCATOR_COMMAND_FREE) {
+      ++counting_allocator->allocation_count_;
+    }
+    iree_allocator_t system_allocator = iree_allocator_system();
+    return system_allocator.ctl(system_allocator.self, command, params,
+                                inout_ptr);
+  }
+
+  std::atomic<int> allocation_count_{0};
+};
+
+// Returns the current reference count of |buffer|.
+// This is an implementation detail only used to check for leaks.
+static int32_t ReadRefCount(iree_vm_buffer_t* buffer) {
+  return iree_atomic_ref_count_load(&buffer->ref_object.counter);
+}
+
 // Test suite that uses module_a and module_b defined in native_module_test.h.
 // Both modules are put in a context and the module_b.entry function can be
 // executed with RunFunction.
@@ -28,16 +59,14 @@ class VMNativeModuleTest : public ::testing::Test {
  protected:
   virtual void SetUp() {
     IREE_CHECK_OK(iree_vm_instance_create(IREE_VM_TYPE_CAPACITY_DEFAULT,
-                                          iree_allocator_system(), &instance_));
+                                          host_allocator(), &instance_));
 
     // Create both modules shared instances. These are generally immutable and
     // can be shared by multiple contexts.
     iree_vm_module_t* module_a = nullptr;
-    IREE_CHECK_OK(
-        module_a_create(instance_, iree_allocator_system(), &module_a));
+    IREE_CHECK_OK(module_a_create(instance_, host_allocator(), &module_a));
     iree_vm_module_t* module_b = nullptr;
-    IREE_CHECK_OK(
-        module_b_create(instance_, iree_allocator_system(), &module_b));
+    IREE_CHECK_OK(module_b_create(instance_, host_allocator(), &module_b));
 
     // Create the context with both modules and perform runtime linkage.
     // Imports from module_a -> module_b will be resolved and per-context state
@@ -45,7 +74,7 @@ class VMNativeModuleTest : public ::testing::Test {
     std::vector<iree_vm_module_t*> modules = {module_a, module_b};
     IREE_CHECK_OK(iree_vm_context_create_with_modules(
         instance_, IREE_VM_CONTEXT_FLAG_NONE, modules.size(), modules.data(),
-        iree_allocator_system(), &context_));
+        host_allocator(), &context_));
 
     // No longer need the modules as the context retains them.
     iree_vm_module_release(module_a);
@@ -94,7 +123,9 @@ class VMNativeModuleTest : public ::testing::Test {
     return ret0_value.i32;
   }
 
- private:
+  iree_allocator_t host_allocator() { return counting_allocator_.allocator(); }
+
+  CountingAllocator counting_allocator_;
   iree_vm_instance_t* instance_ = nullptr;
   iree_vm_context_t* context_ = nullptr;
 };
@@ -111,5 +142,123 @@ TEST_F(VMNativeModuleTest, Example) {
   ASSERT_EQ(v2, 8);
 }
 
+// Invocations of a prepared call after the first perform no allocations.
+// module_b has no fork_state so forking falls back to allocating a fresh state,
+// resolving imports, and rerunning __init instead of copying the parent state.
+TEST_F(VMNativeModuleTest, ForkWithoutHookReinitializes) {
+  IREE_ASSERT_OK_AND_ASSIGN(
+      int32_t v0, RunFunction(iree_make_cstring_view("module_b.entry"), 1));
+  ASSERT_EQ(v0, 1);
+
+  iree_vm_context_t* forked_context = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_context_fork(context_, host_allocator(), &forked_context));
+  iree_vm_module_t* module_b = iree_vm_context_module_at(forked_context, 1);
+  iree_vm_module_state_t* parent_state = nullptr;
+  IREE_ASSERT_OK(iree_vm_context_resolve_module_state(context_, module_b,
+                                                      &parent_state));
+  iree_vm_module_state_t* forked_state = nullptr;
+  IREE_ASSERT_OK(iree_vm_context_resolve_module_state(forked_context, module_b,
+                                                      &forked_state));
+  ASSERT_NE(parent_state, forked_state);
+  EXPECT_EQ(((module_b_state_t*)parent_state)->init_count, 1);
+  EXPECT_EQ(((module_b_state_t*)forked_state)->init_count, 1);
+  EXPECT_EQ(((module_b_state_t*)forked_state)->counter, 0);
+
+  // The fork has its own imports and state and runs from the initial state.
+  std::swap(context_, forked_context);
+  IREE_ASSERT_OK_AND_ASSIGN(
+      int32_t v1, RunFunction(iree_make_cstring_view("module_b.entry"), 1));
+  EXPECT_EQ(v1, 1);
+  std::swap(context_, forked_context);
+  IREE_ASSERT_OK_AND_ASSIGN(
+      int32_t v2, RunFunction(iree_make_cstring_view("module_b.entry"), 1));
+  EXPECT_EQ(v2, 3);
+
+  iree_vm_context_release(forked_context);
+}
+
+TEST_F(VMNativeModuleTest, PreparedCallAllocationFree) {
+  iree_vm_function_t function;
+  IREE_ASSERT_OK(iree_vm_context_resolve_function(
+      context_, IREE_SV("module_b.entry"), &function));
+  iree_vm_prepared_call_t* call = nullptr;
+  IREE_ASSERT_OK(iree_vm_prepared_call_allocate(
+      context_, function, IREE_VM_INVOCATION_FLAG_NONE, host_allocator(),
+      &call));
+
+  // The first invocation may grow the stack.
+  int32_t counter = 0;
+  iree_vm_value_t value = iree_vm_value_make_i32(1);
+  IREE_ASSERT_OK(iree_vm_prepared_call_set_value(call, 0, &value));
+  IREE_ASSERT_OK(iree_vm_prepared_call_invoke(call));
+  counter += 1 + 1;
+
+  const int allocation_count = counting_allocator_.allocation_count();
+  for (int32_t i = 2; i < 10; ++i) {
+    value = iree_vm_value_make_i32(i);
+    IREE_ASSERT_OK(iree_vm_prepared_call_set_value(call, 0, &value));
+    IREE_ASSERT_OK(iree_vm_prepared_call_invoke(call));
+    counter += i + 1;
+    iree_vm_value_t result;
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_value(call, 0, &result));
+    EXPECT_EQ(result.i32, counter - 1);
+  }
+  EXPECT_EQ(counting_allocator_.allocation_count(), allocation_count);
+
+  iree_vm_prepared_call_free(call);
+}
+
+// Refs borrowed by a native callee are released by the caller after the call.
+TEST_F(VMNativeModuleTest, InvokeReleasesBorrowedRefs) {
+  iree_vm_function_t function;
+  IREE_ASSERT_OK(iree_vm_context_resolve_function(
+      context_, IREE_SV("module_a.buffer_length"), &function));
+
+  iree_vm_buffer_t* buffer = nullptr;
+  IREE_ASSERT_OK(iree_vm_buffer_create(IREE_VM_BUFFER_ACCESS_ORIGIN_HOST, 16,
+                                       /*alignment=*/0, host_allocator(),
+                                       &buffer));
+  ASSERT_EQ(ReadRefCount(buffer), 1);
+
+  // List-based invocation.
+  {
+    vm::ref<iree_vm_list_t> input_list;
+    IREE_ASSERT_OK(iree_vm_list_create(iree_vm_make_undefined_type_def(), 1,
+                                       host_allocator(), &input_list));
+    iree_vm_ref_t buffer_ref = iree_vm_buffer_retain_ref(buffer);
+    IREE_ASSERT_OK(iree_vm_list_push_ref_move(input_list.get(), &buffer_ref));
+    vm::ref<iree_vm_list_t> output_list;
+    IREE_ASSERT_OK(iree_vm_list_create(iree_vm_make_undefined_type_def(), 1,
+                                       host_allocator(), &output_list));
+    IREE_ASSERT_OK(iree_vm_invoke(
+        context_, function, IREE_VM_INVOCATION_FLAG_NONE, /*policy=*/nullptr,
+        input_list.get(), output_list.get(), host_allocator()));
+    iree_vm_value_t length;
+    IREE_ASSERT_OK(iree_vm_list_get_value(output_list.get(), 0, &length));
+    EXPECT_EQ(length.i32, 16);
+  }
+  EXPECT_EQ(ReadRefCount(buffer), 1);
+
+  // Prepared invocation.
+  iree_vm_prepared_call_t* call = nullptr;
+  IREE_ASSERT_OK(iree_vm_prepared_call_allocate(
+      context_, function, IREE_VM_INVOCATION_FLAG_NONE, host_allocator(),
+      &call));
+  for (int i = 0; i < 2; ++i) {
+    iree_vm_ref_t buffer_ref = iree_vm_buffer_retain_ref(buffer);
+    IREE_ASSERT_OK(iree_vm_prepared_call_set_ref_move(call, 0, &buffer_ref));
+    IREE_ASSERT_OK(iree_vm_prepared_call_invoke(call));
+    iree_vm_value_t length;
+    IREE_ASSERT_OK(iree_vm_prepared_call_get_value(call, 0, &length));
+    EXPECT_EQ(length.i32, 16);
+    EXPECT_EQ(ReadRefCount(buffer), 1);
+  }
+  iree_vm_prepared_call_free(call);
+  EXPECT_EQ(ReadRefCount(buffer), 1);
+
+  iree_vm_buffer_release(buffer);
+}
+
 }  // namespace
 }  // namespace iree
@@ -10,6 +10,7 @@
 #include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/vm/buffer.h"
 #include "iree/vm/context.h"
 #include "iree/vm/instance.h"
 #include "iree/vm/module.h"
@@ -64,6 +65,45 @@ static iree_status_t call_shim_i32_i32(iree_vm_stack_t* stack,
   return target_fn(stack, module, module_state, args->arg0, &results->ret0);
 }
 
+typedef iree_status_t (*call_r_i32_t)(iree_vm_stack_t* stack, void* module_ptr,
+                                      void* module_state, iree_vm_ref_t* arg0,
+                                      int32_t* out_ret0);
+
+// Wrapper for calling a |target_fn| C function taking a ref from the VM ABI.
+// The ref is borrowed from the caller: the callee must retain it if it needs to
+// keep it beyond the call and the caller releases the argument storage.
+static iree_status_t call_shim_r_i32(iree_vm_stack_t* stack,
+                                     iree_vm_native_function_flags_t flags,
+                                     iree_byte_span_t args_storage,
+                                     iree_byte_span_t rets_storage,
+                                     call_r_i32_t target_fn, void* module,
+                                     void* module_state) {
+  typedef struct {
+    iree_vm_ref_t arg0;
+  } args_t;
+  typedef struct {
+    int32_t ret0;
+  } results_t;
+
+  args_t* args = (args_t*)args_storage.data;
+  results_t* results = (results_t*)rets_storage.data;
+
+  return target_fn(stack, module, module_state, &args->arg0, &results->ret0);
+}
+
+typedef iree_status_t (*call_v_v_t)(iree_vm_stack_t* stack, void* module_ptr,
+                                    void* module_state);
+
+// Wrapper for calling a |target_fn| C function with no arguments or results.
+static iree_status_t call_shim_v_v(iree_vm_stack_t* stack,
+                                   iree_vm_native_function_flags_t flags,
+                                   iree_byte_span_t args_storage,
+                                   iree_byte_span_t rets_storage,
+                                   call_v_v_t target_fn, void* module,
+                                   void* module_state) {
+  return target_fn(stack, module, module_state);
+}
+
 //===----------------------------------------------------------------------===//
 // module_a
 //===----------------------------------------------------------------------===//
@@ -95,13 +135,30 @@ static iree_status_t module_a_sub_1(iree_vm_stack_t* stack, module_a_t* module,
   return iree_ok_status();
 }
 
+// vm.import private @module_a.buffer_length(%arg0 : !vm.buffer) -> i32
+static iree_status_t module_a_buffer_length(iree_vm_stack_t* stack,
+                                            module_a_t* module,
+                                            module_a_state_t* module_state,
+                                            iree_vm_ref_t* arg0,
+                                            int32_t* out_ret0) {
+  // Borrow the buffer to query its length; the caller retains ownership.
+  iree_vm_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(*arg0, &buffer));
+  *out_ret0 = (int32_t)iree_vm_buffer_length(buffer);
+  return iree_ok_status();
+}
+
 static const iree_vm_native_export_descriptor_t module_a_exports_[] = {
     {iree_make_cstring_view("add_1"), iree_make_cstring_view("0i_i"), 0, NULL},
+    {iree_make_cstring_view("buffer_length"), iree_make_cstring_view("0r_i"), 0,
+     NULL},
     {iree_make_cstring_view("sub_1"), iree_make_cstring_view("0i_i"), 0, NULL},
 };
 static const iree_vm_native_function_ptr_t module_a_funcs_[] = {
     {(iree_vm_native_function_shim_t)call_shim_i32_i32,
      (iree_vm_native_function_target_t)module_a_add_1},
+    {(iree_vm_native_function_shim_t)call_shim_r_i32,
+     (iree_vm_native_function_target_t)module_a_buffer_length},
     {(iree_vm_native_function_shim_t)call_shim_i32_i32,
      (iree_vm_native_function_target_t)module_a_sub_1},
 };
@@ -166,6 +223,8 @@ typedef struct module_b_state_t {
   iree_vm_function_t imports[2];
   // Example user data stored per-state.
   int counter;
+  // Number of times __init has run on this state.
+  int init_count;
 } module_b_state_t;
 
 // Frees the shared module; by this point all per-context states have been
@@ -206,6 +265,17 @@ static iree_status_t IREE_API_PTR module_b_resolve_import(
   return iree_ok_status();
 }
 
+// Called by the context after the state is allocated and imports resolved.
+// The context also runs this when forking as module_b does not implement
+// fork_state and the fork receives a freshly initialized state.
+//
+// vm.func @__init()
+static iree_status_t module_b_init(iree_vm_stack_t* stack, module_b_t* module,
+                                   module_b_state_t* module_state) {
+  ++module_state->init_count;
+  return iree_ok_status();
+}
+
 // Our actual function. Here we directly access the registers but one could also
 // use this as a trampoline into user code with a native signature (such as
 // fetching the args, calling the function as a normal C function, and stashing
@@ -239,6 +309,8 @@ static iree_status_t module_b_entry(iree_vm_stack_t* stack, module_b_t* module,
 // (like here) or shared/per-context to allow exposing different functions based
 // on versions, access rights, etc.
 static const iree_vm_native_function_ptr_t module_b_funcs_[] = {
+    {(iree_vm_native_function_shim_t)call_shim_v_v,
+     (iree_vm_native_function_target_t)module_b_init},
     {(iree_vm_native_function_shim_t)call_shim_i32_i32,
      (iree_vm_native_function_target_t)module_b_entry},
 };
@@ -254,6 +326,8 @@ static const iree_string_pair_t module_b_entry_attrs_[] = {
     {iree_make_cstring_view("key1"), iree_make_cstring_view("value1")},
 };
 static const iree_vm_native_export_descriptor_t module_b_exports_[] = {
+    {iree_make_cstring_view("__init"), iree_make_cstring_view("0v_v"), 0,
+     NULL},
     {iree_make_cstring_view("entry"), iree_make_cstring_view("0i_i"),
      IREE_ARRAYSIZE(module_b_entry_attrs_), module_b_entry_attrs_},
 };
@@ -61,6 +61,12 @@ enum iree_vm_ref_type_bits_t {
 
 typedef void(IREE_API_PTR* iree_vm_ref_destroy_t)(void* ptr);
 
+// Returns in |out_ptr| a copy of |ptr| for use by a forked context with a
+// reference count of 1. Objects that cannot be changed in-place may instead be
+// retained and returned as-is.
+typedef iree_status_t(IREE_API_PTR* iree_vm_ref_clone_t)(
+    void* ptr, iree_allocator_t host_allocator, void** out_ptr);
+
 // Describes a type for the VM.
 typedef iree_alignas(IREE_VM_REF_TYPE_DESCRIPTOR_ALIGNMENT) struct
     iree_vm_ref_type_descriptor_t {
@@ -73,6 +79,10 @@ typedef iree_alignas(IREE_VM_REF_TYPE_DESCRIPTOR_ALIGNMENT) struct
   // an iree_atomic_ref_count_t representing the current reference count.
   uintptr_t offsetof_counter : IREE_VM_REF_TYPE_TAG_BITS;
   uintptr_t reserved : IREE_VM_REF_TYPE_PTR_BITS;
+  // Optional function called when a context holding references of this type
+  // is forked (see iree_vm_context_fork). Types without one are shared
+  // between the parent and forked contexts. Failing fails the fork.
+  iree_vm_ref_clone_t clone;
 } iree_vm_ref_type_descriptor_t;
 
 // Type-erased reference counted type descriptor.
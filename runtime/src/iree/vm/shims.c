@@ -65,6 +65,7 @@ IREE_VM_ABI_DEFINE_SHIM(rrIii, v);
 IREE_VM_ABI_DEFINE_SHIM(rrrIii, v);
 IREE_VM_ABI_DEFINE_SHIM(rIrriiiI, r);
 IREE_VM_ABI_DEFINE_SHIM(rIrrr, v);
+IREE_VM_ABI_DEFINE_SHIM(rIrrrIrIIi, v);
 IREE_VM_ABI_DEFINE_SHIM(rIrrCrD, v);
 IREE_VM_ABI_DEFINE_SHIM(CrID, r);
 IREE_VM_ABI_DEFINE_SHIM(CrD, r);
@@ -431,6 +431,19 @@ IREE_VM_ABI_FIXED_STRUCT(rIrrr, {
   iree_vm_ref_t r4;
 });
 
+IREE_VM_ABI_FIXED_STRUCT(rIrrrIrIIi, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  iree_vm_ref_t r2;
+  iree_vm_ref_t r3;
+  iree_vm_ref_t r4;
+  int64_t i5;
+  iree_vm_ref_t r6;
+  int64_t i7;
+  int64_t i8;
+  int32_t i9;
+});
+
 IREE_VM_ABI_VLA_STRUCT(rIrrCrD, a4_count, a4, {
   iree_vm_ref_t r0;
   int64_t i1;
@@ -632,6 +645,7 @@ IREE_VM_ABI_DECLARE_SHIM(rrIii, v);
 IREE_VM_ABI_DECLARE_SHIM(rrrIii, v);
 IREE_VM_ABI_DECLARE_SHIM(rIrriiiI, r);
 IREE_VM_ABI_DECLARE_SHIM(rIrrr, v);
+IREE_VM_ABI_DECLARE_SHIM(rIrrrIrIIi, v);
 IREE_VM_ABI_DECLARE_SHIM(rIrrCrD, v);
 IREE_VM_ABI_DECLARE_SHIM(CrID, r);
 IREE_VM_ABI_DECLARE_SHIM(CrD, r);
@@ -168,4 +168,385 @@ vm.module @comparison_ops_i64 {
 
     vm.return
   }
+
+  //===--------------------------------------------------------------------===//
+  // vm.cmp.* fused with vm.cond_br
+  //===--------------------------------------------------------------------===//
+  // A comparison whose only use is the condition of the vm.cond_br directly
+  // following it is encoded as a single fused compare-and-branch op. Each test
+  // takes both the true and false edge and checks that the i32, i64, and ref
+  // branch operands are remapped into the shared successor block.
+  // EmitC lowers cond_br with a shared successor to a select (see
+  // control_flow_ops.mlir) so these only run on bytecode.
+
+  vm.rodata private @cond_br_true_buffer dense<[1]> : tensor<1xi8>
+  vm.rodata private @cond_br_false_buffer dense<[2]> : tensor<1xi8>
+
+  vm.export @test_cond_br_cmp_eq_i32 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_eq_i32() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i32 5
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i32
+    %t_rhs = vm.const.i32 5
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i32
+    %t:3 = vm.call @_cond_br_cmp_eq_i32(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "5 == 5" : i32
+    vm.check.eq %t#1, %c1_i64, "5 == 5" : i64
+    vm.check.eq %t#2, %ref_true, "5 == 5" : !vm.buffer
+
+    %f_lhs = vm.const.i32 5
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i32
+    %f_rhs = vm.const.i32 7
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i32
+    %f:3 = vm.call @_cond_br_cmp_eq_i32(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "5 == 7" : i32
+    vm.check.eq %f#1, %c2_i64, "5 == 7" : i64
+    vm.check.eq %f#2, %ref_false, "5 == 7" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_eq_i32(%lhs : i32, %rhs : i32,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.eq.i32 %lhs, %rhs : i32
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_ne_i32 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_ne_i32() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i32 5
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i32
+    %t_rhs = vm.const.i32 7
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i32
+    %t:3 = vm.call @_cond_br_cmp_ne_i32(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "5 != 7" : i32
+    vm.check.eq %t#1, %c1_i64, "5 != 7" : i64
+    vm.check.eq %t#2, %ref_true, "5 != 7" : !vm.buffer
+
+    %f_lhs = vm.const.i32 5
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i32
+    %f_rhs = vm.const.i32 5
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i32
+    %f:3 = vm.call @_cond_br_cmp_ne_i32(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "5 != 5" : i32
+    vm.check.eq %f#1, %c2_i64, "5 != 5" : i64
+    vm.check.eq %f#2, %ref_false, "5 != 5" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_ne_i32(%lhs : i32, %rhs : i32,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.ne.i32 %lhs, %rhs : i32
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_lt_s_i32 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_lt_s_i32() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i32 -1
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i32
+    %t_rhs = vm.const.i32 1
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i32
+    %t:3 = vm.call @_cond_br_cmp_lt_s_i32(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "-1 < 1" : i32
+    vm.check.eq %t#1, %c1_i64, "-1 < 1" : i64
+    vm.check.eq %t#2, %ref_true, "-1 < 1" : !vm.buffer
+
+    %f_lhs = vm.const.i32 1
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i32
+    %f_rhs = vm.const.i32 -1
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i32
+    %f:3 = vm.call @_cond_br_cmp_lt_s_i32(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "1 < -1" : i32
+    vm.check.eq %f#1, %c2_i64, "1 < -1" : i64
+    vm.check.eq %f#2, %ref_false, "1 < -1" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_lt_s_i32(%lhs : i32, %rhs : i32,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.lt.i32.s %lhs, %rhs : i32
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_lt_u_i32 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_lt_u_i32() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i32 1
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i32
+    %t_rhs = vm.const.i32 -1
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i32
+    %t:3 = vm.call @_cond_br_cmp_lt_u_i32(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "1 < -1 (unsigned)" : i32
+    vm.check.eq %t#1, %c1_i64, "1 < -1 (unsigned)" : i64
+    vm.check.eq %t#2, %ref_true, "1 < -1 (unsigned)" : !vm.buffer
+
+    %f_lhs = vm.const.i32 -1
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i32
+    %f_rhs = vm.const.i32 1
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i32
+    %f:3 = vm.call @_cond_br_cmp_lt_u_i32(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i32, i32, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "-1 < 1 (unsigned)" : i32
+    vm.check.eq %f#1, %c2_i64, "-1 < 1 (unsigned)" : i64
+    vm.check.eq %f#2, %ref_false, "-1 < 1 (unsigned)" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_lt_u_i32(%lhs : i32, %rhs : i32,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.lt.i32.u %lhs, %rhs : i32
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_eq_i64 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_eq_i64() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i64 4294967301
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i64
+    %t_rhs = vm.const.i64 4294967301
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i64
+    %t:3 = vm.call @_cond_br_cmp_eq_i64(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "4294967301 == 4294967301" : i32
+    vm.check.eq %t#1, %c1_i64, "4294967301 == 4294967301" : i64
+    vm.check.eq %t#2, %ref_true, "4294967301 == 4294967301" : !vm.buffer
+
+    %f_lhs = vm.const.i64 4294967301
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i64
+    %f_rhs = vm.const.i64 5
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i64
+    %f:3 = vm.call @_cond_br_cmp_eq_i64(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "4294967301 == 5" : i32
+    vm.check.eq %f#1, %c2_i64, "4294967301 == 5" : i64
+    vm.check.eq %f#2, %ref_false, "4294967301 == 5" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_eq_i64(%lhs : i64, %rhs : i64,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.eq.i64 %lhs, %rhs : i64
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_ne_i64 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_ne_i64() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i64 4294967301
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i64
+    %t_rhs = vm.const.i64 5
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i64
+    %t:3 = vm.call @_cond_br_cmp_ne_i64(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "4294967301 != 5" : i32
+    vm.check.eq %t#1, %c1_i64, "4294967301 != 5" : i64
+    vm.check.eq %t#2, %ref_true, "4294967301 != 5" : !vm.buffer
+
+    %f_lhs = vm.const.i64 4294967301
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i64
+    %f_rhs = vm.const.i64 4294967301
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i64
+    %f:3 = vm.call @_cond_br_cmp_ne_i64(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "4294967301 != 4294967301" : i32
+    vm.check.eq %f#1, %c2_i64, "4294967301 != 4294967301" : i64
+    vm.check.eq %f#2, %ref_false, "4294967301 != 4294967301" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_ne_i64(%lhs : i64, %rhs : i64,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.ne.i64 %lhs, %rhs : i64
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_lt_s_i64 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_lt_s_i64() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i64 -4294967296
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i64
+    %t_rhs = vm.const.i64 1
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i64
+    %t:3 = vm.call @_cond_br_cmp_lt_s_i64(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "-4294967296 < 1" : i32
+    vm.check.eq %t#1, %c1_i64, "-4294967296 < 1" : i64
+    vm.check.eq %t#2, %ref_true, "-4294967296 < 1" : !vm.buffer
+
+    %f_lhs = vm.const.i64 1
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i64
+    %f_rhs = vm.const.i64 -4294967296
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i64
+    %f:3 = vm.call @_cond_br_cmp_lt_s_i64(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "1 < -4294967296" : i32
+    vm.check.eq %f#1, %c2_i64, "1 < -4294967296" : i64
+    vm.check.eq %f#2, %ref_false, "1 < -4294967296" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_lt_s_i64(%lhs : i64, %rhs : i64,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.lt.i64.s %lhs, %rhs : i64
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
+
+  vm.export @test_cond_br_cmp_lt_u_i64 attributes {emitc.exclude}
+  vm.func private @test_cond_br_cmp_lt_u_i64() {
+    %ref_true = vm.const.ref.rodata @cond_br_true_buffer : !vm.buffer
+    %ref_false = vm.const.ref.rodata @cond_br_false_buffer : !vm.buffer
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+
+    %t_lhs = vm.const.i64 1
+    %t_lhs_dno = util.optimization_barrier %t_lhs : i64
+    %t_rhs = vm.const.i64 -4294967296
+    %t_rhs_dno = util.optimization_barrier %t_rhs : i64
+    %t:3 = vm.call @_cond_br_cmp_lt_u_i64(%t_lhs_dno, %t_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %t#0, %c1, "1 < -4294967296 (unsigned)" : i32
+    vm.check.eq %t#1, %c1_i64, "1 < -4294967296 (unsigned)" : i64
+    vm.check.eq %t#2, %ref_true, "1 < -4294967296 (unsigned)" : !vm.buffer
+
+    %f_lhs = vm.const.i64 -4294967296
+    %f_lhs_dno = util.optimization_barrier %f_lhs : i64
+    %f_rhs = vm.const.i64 1
+    %f_rhs_dno = util.optimization_barrier %f_rhs : i64
+    %f:3 = vm.call @_cond_br_cmp_lt_u_i64(%f_lhs_dno, %f_rhs_dno, %ref_true, %ref_false)
+        : (i64, i64, !vm.buffer, !vm.buffer) -> (i32, i64, !vm.buffer)
+    vm.check.eq %f#0, %c2, "-4294967296 < 1 (unsigned)" : i32
+    vm.check.eq %f#1, %c2_i64, "-4294967296 < 1 (unsigned)" : i64
+    vm.check.eq %f#2, %ref_false, "-4294967296 < 1 (unsigned)" : !vm.buffer
+
+    vm.return
+  }
+
+  vm.func private @_cond_br_cmp_lt_u_i64(%lhs : i64, %rhs : i64,
+      %ref_true : !vm.buffer, %ref_false : !vm.buffer)
+      -> (i32, i64, !vm.buffer) attributes {noinline} {
+    %c1 = vm.const.i32 1
+    %c2 = vm.const.i32 2
+    %c1_i64 = vm.const.i64 4294967297
+    %c2_i64 = vm.const.i64 8589934594
+    %cond = vm.cmp.lt.i64.u %lhs, %rhs : i64
+    vm.cond_br %cond, ^bb1(%c1, %c1_i64, %ref_true : i32, i64, !vm.buffer),
+                      ^bb1(%c2, %c2_i64, %ref_false : i32, i64, !vm.buffer)
+  ^bb1(%i32 : i32, %i64 : i64, %ref : !vm.buffer):
+    vm.return %i32, %i64, %ref : i32, i64, !vm.buffer
+  }
 }